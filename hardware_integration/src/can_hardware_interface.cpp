@@ -7,6 +7,7 @@
 /// @copyright 2022 Adrian Del Grosso
 //================================================================================================
 #include "isobus/hardware_integration/can_hardware_interface.hpp"
+#include "isobus/isobus/can_latency_monitor.hpp"
 #include "isobus/isobus/can_stack_logger.hpp"
 #include "isobus/utility/system_timing.hpp"
 #include "isobus/utility/to_string.hpp"
@@ -213,6 +214,9 @@ namespace isobus
 		{
 			std::lock_guard<std::mutex> lock(channel->messagesToBeTransmittedMutex);
 			channel->messagesToBeTransmitted.push_back(frame);
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+			channel->messagesToBeTransmitted.back().queueTimestamp_us = isobus::SystemTiming::get_uncached_timestamp_us();
+#endif
 
 			updateThreadWakeupCondition.notify_all();
 			return true;
@@ -289,9 +293,19 @@ namespace isobus
 					while (!channel->messagesToBeTransmitted.empty())
 					{
 						const auto &frame = channel->messagesToBeTransmitted.front();
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+						std::uint64_t writeStartTimestamp_us = isobus::SystemTiming::get_uncached_timestamp_us();
+#endif
 
 						if (transmit_can_frame_from_buffer(frame))
 						{
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+							if (0 != frame.queueTimestamp_us)
+							{
+								isobus::CANLatencyMonitor::record(frame.channel, isobus::CANLatencyMonitor::Stage::TxQueue, writeStartTimestamp_us - frame.queueTimestamp_us);
+							}
+							isobus::CANLatencyMonitor::record(frame.channel, isobus::CANLatencyMonitor::Stage::TxDriverWrite, isobus::SystemTiming::get_uncached_timestamp_us() - writeStartTimestamp_us);
+#endif
 							frameTransmittedEventDispatcher.invoke(frame);
 							isobus::on_transmit_can_message_frame_from_hardware(frame);
 							channel->messagesToBeTransmitted.pop_front();
@@ -320,10 +334,24 @@ namespace isobus
 			if (hardwareChannels[channelIndex]->frameHandler->get_is_valid())
 			{
 				// Socket or other hardware still open
+				// Drivers that support receive timestamps will overwrite this
+				frame.timestamp_us = std::numeric_limits<std::uint64_t>::max();
+
 				if (hardwareChannels[channelIndex]->frameHandler->read_frame(frame))
 				{
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+					frame.readTimestamp_us = isobus::SystemTiming::get_uncached_timestamp_us();
+#endif
 					frame.channel = channelIndex;
+
+					if (std::numeric_limits<std::uint64_t>::max() == frame.timestamp_us)
+					{
+						frame.timestamp_us = SystemTiming::get_timestamp_us();
+					}
 					std::unique_lock<std::mutex> receiveLock(hardwareChannels[channelIndex]->receivedMessagesMutex);
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+					frame.queueTimestamp_us = isobus::SystemTiming::get_uncached_timestamp_us();
+#endif
 					hardwareChannels[channelIndex]->receivedMessages.push_back(frame);
 					receiveLock.unlock();
 					updateThreadWakeupCondition.notify_all();
@@ -7,6 +7,7 @@
 /// @copyright 2023 Adrian Del Grosso
 //================================================================================================
 #include "isobus/hardware_integration/can_hardware_interface_single_thread.hpp"
+#include "isobus/isobus/can_latency_monitor.hpp"
 #include "isobus/isobus/can_stack_logger.hpp"
 #include "isobus/utility/system_timing.hpp"
 #include "isobus/utility/to_string.hpp"
@@ -173,6 +174,9 @@ namespace isobus
 		if (channel->frameHandler->get_is_valid())
 		{
 			channel->messagesToBeTransmitted.push_back(frame);
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+			channel->messagesToBeTransmitted.back().queueTimestamp_us = isobus::SystemTiming::get_uncached_timestamp_us();
+#endif
 			return true;
 		}
 		return false;
@@ -215,9 +219,19 @@ namespace isobus
 				while (!channel->messagesToBeTransmitted.empty())
 				{
 					const auto &frame = channel->messagesToBeTransmitted.front();
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+					std::uint64_t writeStartTimestamp_us = isobus::SystemTiming::get_uncached_timestamp_us();
+#endif
 
 					if (transmit_can_frame_from_buffer(frame))
 					{
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+						if (0 != frame.queueTimestamp_us)
+						{
+							isobus::CANLatencyMonitor::record(frame.channel, isobus::CANLatencyMonitor::Stage::TxQueue, writeStartTimestamp_us - frame.queueTimestamp_us);
+						}
+						isobus::CANLatencyMonitor::record(frame.channel, isobus::CANLatencyMonitor::Stage::TxDriverWrite, isobus::SystemTiming::get_uncached_timestamp_us() - writeStartTimestamp_us);
+#endif
 						frameTransmittedEventDispatcher.invoke(frame);
 						isobus::on_transmit_can_message_frame_from_hardware(frame);
 						channel->messagesToBeTransmitted.pop_front();
@@ -240,9 +254,23 @@ namespace isobus
 			if (hardwareChannels[channelIndex]->frameHandler->get_is_valid())
 			{
 				// Socket or other hardware still open
+				// Drivers that support receive timestamps will overwrite this
+				frame.timestamp_us = std::numeric_limits<std::uint64_t>::max();
+
 				if (hardwareChannels[channelIndex]->frameHandler->read_frame(frame))
 				{
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+					frame.readTimestamp_us = isobus::SystemTiming::get_uncached_timestamp_us();
+#endif
 					frame.channel = channelIndex;
+
+					if (std::numeric_limits<std::uint64_t>::max() == frame.timestamp_us)
+					{
+						frame.timestamp_us = SystemTiming::get_timestamp_us();
+					}
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+					frame.queueTimestamp_us = frame.readTimestamp_us; // The frame is queued straight away on this thread
+#endif
 					hardwareChannels[channelIndex]->receivedMessages.push_back(frame);
 				}
 			}
@@ -16,6 +16,7 @@
 namespace isobus
 {
 	class CANMessage; ///< Forward declare CANMessage
+	class CANNetworkManager; ///< Forward declare CANNetworkManager
 
 	//================================================================================================
 	/// @class AddressClaimStateMachine
@@ -47,7 +48,8 @@ namespace isobus
 		/// @param[in] preferredAddressValue The address you prefer to claim
 		/// @param[in] ControlFunctionNAME The NAME you want to claim
 		/// @param[in] portIndex The CAN channel index to claim on
-		AddressClaimStateMachine(std::uint8_t preferredAddressValue, NAME ControlFunctionNAME, std::uint8_t portIndex);
+		/// @param[in] network The network manager to claim on
+		AddressClaimStateMachine(std::uint8_t preferredAddressValue, NAME ControlFunctionNAME, std::uint8_t portIndex, CANNetworkManager &network);
 
 		/// @brief The destructor for the address claim state machine
 		~AddressClaimStateMachine();
@@ -101,6 +103,7 @@ namespace isobus
 		/// @returns true if the message was sent, otherwise false
 		bool send_address_claim(std::uint8_t address);
 
+		CANNetworkManager &m_network; ///< The network manager to claim on
 		NAME m_isoname; ///< The ISO NAME to claim as
 		State m_currentState = State::None; ///< The address claim state machine state
 		std::uint32_t m_timestamp_ms = 0; ///< A generic timestamp in milliseconds used to find timeouts
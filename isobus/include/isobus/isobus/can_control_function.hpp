@@ -15,12 +15,10 @@
 
 #include <memory>
 
-#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
-#include <mutex>
-#endif
-
 namespace isobus
 {
+	class CANNetworkManager;
+
 	//================================================================================================
 	/// @class ControlFunction
 	///
@@ -39,13 +37,21 @@ namespace isobus
 
 		virtual ~ControlFunction() = default;
 
-		/// @brief The factory function to construct a control function
+		/// @brief The factory function to construct a control function on the default network manager
 		/// @param[in] NAMEValue The NAME of the control function
 		/// @param[in] addressValue The current address of the control function
 		/// @param[in] CANPort The CAN channel index that the control function communicates on
 		/// @returns A shared pointer to a ControlFunction object created with the parameters passed in
 		static std::shared_ptr<ControlFunction> create(NAME NAMEValue, std::uint8_t addressValue, std::uint8_t CANPort);
 
+		/// @brief The factory function to construct a control function on a specific network manager
+		/// @param[in] NAMEValue The NAME of the control function
+		/// @param[in] addressValue The current address of the control function
+		/// @param[in] CANPort The CAN channel index that the control function communicates on
+		/// @param[in] parentNetwork The network manager the control function belongs to
+		/// @returns A shared pointer to a ControlFunction object created with the parameters passed in
+		static std::shared_ptr<ControlFunction> create(NAME NAMEValue, std::uint8_t addressValue, std::uint8_t CANPort, CANNetworkManager &parentNetwork);
+
 		/// @brief Destroys this control function, by removing it from the network manager
 		/// @param[in] expectedRefCount The expected number of shared pointers to this control function after removal
 		/// @returns true if the control function was successfully removed from everywhere in the stack, otherwise false
@@ -75,18 +81,21 @@ namespace isobus
 		///@returns The control function type as a string
 		std::string get_type_string() const;
 
+		/// @brief Returns the network manager this control function belongs to
+		/// @returns The network manager this control function was created on
+		CANNetworkManager &get_network() const;
+
 	protected:
 		/// @brief The protected constructor for the control function, which is called by the (inherited) factory function
 		/// @param[in] NAMEValue The NAME of the control function
 		/// @param[in] addressValue The current address of the control function
 		/// @param[in] CANPort The CAN channel index that the control function communicates on
+		/// @param[in] parentNetwork The network manager the control function belongs to
 		/// @param[in] type The 'Type' of control function to create
-		ControlFunction(NAME NAMEValue, std::uint8_t addressValue, std::uint8_t CANPort, Type type = Type::External);
+		ControlFunction(NAME NAMEValue, std::uint8_t addressValue, std::uint8_t CANPort, CANNetworkManager &parentNetwork, Type type = Type::External);
 
 		friend class CANNetworkManager; ///< The network manager needs access to the control function's internals
-#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
-		static std::mutex controlFunctionProcessingMutex; ///< Protects the control function tables
-#endif
+		CANNetworkManager &network; ///< The network manager this control function belongs to
 		const Type controlFunctionType; ///< The Type of the control function
 		NAME controlFunctionNAME; ///< The NAME of the control function
 		bool claimedAddressSinceLastAddressClaimRequest = false; ///< Used to mark CFs as stale if they don't claim within a certain time
@@ -94,6 +103,45 @@ namespace isobus
 		const std::uint8_t canPortIndex; ///< The CAN channel index of the control function
 	};
 
+	//================================================================================================
+	/// @class ControlFunctionHandle
+	///
+	/// @brief A non-owning reference to an entry in the network manager's address table
+	/// @details Handles are cheap to copy and do no reference counting, which makes them suitable for
+	/// the receive path. Each table entry has a generation that is incremented whenever the control
+	/// function at that address changes, so a handle taken before the change reads as empty afterwards
+	/// instead of pointing at the wrong control function.
+	/// A handle must not outlive the network manager it was taken from.
+	//================================================================================================
+	class ControlFunctionHandle
+	{
+	public:
+		/// @brief Constructs an empty handle
+		ControlFunctionHandle() = default;
+
+		/// @brief Constructs a handle to an address table entry. Used by the network manager.
+		/// @param[in] tableEntry The address table entry to refer to
+		/// @param[in] tableEntryGeneration The generation counter of the table entry
+		ControlFunctionHandle(const std::shared_ptr<ControlFunction> &tableEntry, const std::uint32_t &tableEntryGeneration);
+
+		/// @brief Returns if the table entry still holds the control function it held when the handle was created
+		/// @returns true if the handle refers to a control function, otherwise false
+		bool get_is_valid() const;
+
+		/// @brief Returns the control function without taking ownership of it
+		/// @returns The control function, or nullptr if the handle is empty or out of date
+		ControlFunction *get() const;
+
+		/// @brief Returns a shared pointer to the control function
+		/// @returns The control function, or nullptr if the handle is empty or out of date
+		std::shared_ptr<ControlFunction> lock() const;
+
+	private:
+		const std::shared_ptr<ControlFunction> *entry = nullptr; ///< The address table entry this handle refers to
+		const std::uint32_t *entryGeneration = nullptr; ///< The generation counter of the address table entry
+		std::uint32_t generation = 0; ///< The generation of the table entry when this handle was created
+	};
+
 } // namespace isobus
 
 #endif // CAN_CONTROL_FUNCTION_HPP
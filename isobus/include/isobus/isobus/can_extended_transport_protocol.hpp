@@ -112,7 +112,8 @@ namespace isobus
 		};
 
 		/// @brief The constructor for the TransportProtocolManager
-		ExtendedTransportProtocolManager();
+		/// @param[in] parentNetwork The network manager this protocol belongs to
+		explicit ExtendedTransportProtocolManager(CANNetworkManager &parentNetwork);
 
 		/// @brief The destructor for the TransportProtocolManager
 		~ExtendedTransportProtocolManager() final;
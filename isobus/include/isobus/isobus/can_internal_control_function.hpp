@@ -41,6 +41,14 @@ namespace isobus
 		/// @returns A shared pointer to an InternalControlFunction object created with the parameters passed in
 		static std::shared_ptr<InternalControlFunction> create(NAME desiredName, std::uint8_t preferredAddress, std::uint8_t CANPort);
 
+		/// @brief The factory function to construct an internal control function on a specific network manager
+		/// @param[in] desiredName The NAME for this control function to claim as
+		/// @param[in] preferredAddress The preferred NAME for this control function
+		/// @param[in] CANPort The CAN channel index for this control function to use
+		/// @param[in] parentNetwork The network manager the control function belongs to
+		/// @returns A shared pointer to an InternalControlFunction object created with the parameters passed in
+		static std::shared_ptr<InternalControlFunction> create(NAME desiredName, std::uint8_t preferredAddress, std::uint8_t CANPort, CANNetworkManager &parentNetwork);
+
 		/// @brief Destroys this control function, by removing it from the network manager
 		/// @param[in] expectedRefCount The expected number of shared pointers to this control function after removal
 		/// @returns true if the control function was successfully removed from everywhere in the stack, otherwise false
@@ -50,7 +58,8 @@ namespace isobus
 		/// @param[in] desiredName The NAME for this control function to claim as
 		/// @param[in] preferredAddress The preferred NAME for this control function
 		/// @param[in] CANPort The CAN channel index for this control function to use
-		InternalControlFunction(NAME desiredName, std::uint8_t preferredAddress, std::uint8_t CANPort, CANLibBadge<InternalControlFunction>);
+		/// @param[in] parentNetwork The network manager the control function belongs to
+		InternalControlFunction(NAME desiredName, std::uint8_t preferredAddress, std::uint8_t CANPort, CANNetworkManager &parentNetwork, CANLibBadge<InternalControlFunction>);
 
 		/// @brief Used to inform the member address claim state machine that two CFs are using the same source address.
 		/// @note Address violation occurs when two CFs are using the same source address.
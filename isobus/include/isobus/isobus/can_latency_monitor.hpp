@@ -0,0 +1,161 @@
+//================================================================================================
+/// @file can_latency_monitor.hpp
+///
+/// @brief Optional instrumentation that measures how long CAN frames spend in each stage of the
+/// stack's receive and transmit pipelines.
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#ifndef CAN_LATENCY_MONITOR_HPP
+#define CAN_LATENCY_MONITOR_HPP
+
+#include "isobus/isobus/can_constants.hpp"
+
+#include <array>
+#include <cstdint>
+
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+#include <atomic>
+#endif
+
+namespace isobus
+{
+	//================================================================================================
+	/// @class CANLatencyHistogram
+	///
+	/// @brief A fixed size, lock-free histogram of latencies in microseconds
+	/// @details Values are sorted into log-linear buckets, 8 per power of two, so any percentile
+	/// is reported with at most 12.5% error. Values above ~71 minutes are clamped.
+	/// Recording is wait-free and may be done from any thread.
+	//================================================================================================
+	class CANLatencyHistogram
+	{
+	public:
+		/// @brief Constructor for a CANLatencyHistogram
+		CANLatencyHistogram();
+
+		/// @brief Adds a sample to the histogram
+		/// @param[in] value_us The latency to record in microseconds
+		void record(std::uint64_t value_us);
+
+		/// @brief Clears all samples from the histogram
+		void reset();
+
+		/// @brief Returns the number of samples that have been recorded
+		/// @returns The number of samples that have been recorded
+		std::uint64_t get_sample_count() const;
+
+		/// @brief Returns the largest sample that has been recorded
+		/// @returns The largest sample in microseconds
+		std::uint32_t get_maximum_us() const;
+
+		/// @brief Returns the average of all recorded samples
+		/// @returns The average latency in microseconds
+		std::uint32_t get_mean_us() const;
+
+		/// @brief Returns an upper bound for the given percentile of recorded samples
+		/// @param[in] percentile The percentile to get, between 0 and 100
+		/// @returns The latency in microseconds under which `percentile` percent of the samples fall
+		std::uint32_t get_percentile_us(float percentile) const;
+
+	private:
+		static constexpr std::uint8_t SUB_BUCKET_BITS = 3; ///< Each power of two is split into 2^SUB_BUCKET_BITS buckets
+		static constexpr std::uint32_t SUB_BUCKET_COUNT = (1 << SUB_BUCKET_BITS); ///< The number of buckets per power of two
+		static constexpr std::uint32_t NUMBER_OF_BUCKETS = (32 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT; ///< Enough buckets to cover the whole 32 bit range
+
+		/// @brief Returns the bucket a value falls into
+		/// @param[in] value The value to find the bucket for
+		/// @returns The index of the bucket the value falls into
+		static std::uint32_t get_bucket_index(std::uint32_t value);
+
+		/// @brief Returns the largest value that will be sorted into a bucket
+		/// @param[in] index The index of the bucket
+		/// @returns The largest value that falls into the bucket
+		static std::uint32_t get_bucket_upper_bound(std::uint32_t index);
+
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		std::array<std::atomic<std::uint32_t>, NUMBER_OF_BUCKETS> buckets; ///< The number of samples in each bucket
+		std::atomic<std::uint64_t> sampleCount; ///< The total number of samples recorded
+		std::atomic<std::uint64_t> sampleSum_us; ///< The sum of all samples, for calculating the mean
+		std::atomic<std::uint32_t> maximum_us; ///< The largest sample recorded
+#endif
+	};
+
+	//================================================================================================
+	/// @class CANLatencyMonitor
+	///
+	/// @brief Collects per channel latency histograms for each stage of the CAN stack's pipeline
+	/// @details The hardware interface and network manager record how long each frame spends between
+	/// being read from the driver and its PGN callbacks returning, and between a frame being queued
+	/// for transmit and the driver accepting it. Timing uses SystemTiming, so it follows any injected
+	/// clock. Recording costs a few relaxed atomic increments per stage.
+	///
+	/// The instrumentation can be removed entirely by defining `CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION`
+	/// (or setting the CMake option of the same name), in which case all statistics read as zero.
+	//================================================================================================
+	class CANLatencyMonitor
+	{
+	public:
+		/// @brief Enumerates the stages of the stack that are measured
+		enum class Stage : std::uint8_t
+		{
+			RxQueue = 0, ///< Time a frame waits in the hardware interface's Rx queue for the update thread
+			RxStackQueue, ///< Time a message waits in the network manager's Rx queue for `process_rx_messages`
+			RxCallbacks, ///< Time spent processing a message in protocols and PGN callbacks
+			RxTotal, ///< From the driver returning a frame to its PGN callbacks returning
+			TxQueue, ///< Time a frame waits in the hardware interface's Tx queue before being written to the driver
+			TxDriverWrite, ///< Time the driver takes to accept a frame for transmit
+
+			NumberOfStages ///< The number of stages, not a valid stage
+		};
+
+		/// @brief A summary of the latency of one stage on one channel
+		struct Statistics
+		{
+			std::uint64_t sampleCount; ///< The number of frames that were measured
+			std::uint32_t mean_us; ///< The average latency in microseconds
+			std::uint32_t median_us; ///< The 50th percentile latency in microseconds
+			std::uint32_t percentile99_us; ///< The 99th percentile latency in microseconds
+			std::uint32_t maximum_us; ///< The largest latency in microseconds
+		};
+
+		/// @brief Returns if the instrumentation was compiled into the stack
+		/// @returns `true` if latencies are being recorded, otherwise `false`
+		static constexpr bool get_is_enabled()
+		{
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		/// @brief Records a latency sample for a stage. Called by the stack.
+		/// @param[in] channelIndex The CAN channel the frame was on
+		/// @param[in] stage The stage that was measured
+		/// @param[in] latency_us The time the frame spent in the stage in microseconds
+		static void record(std::uint8_t channelIndex, Stage stage, std::uint64_t latency_us);
+
+		/// @brief Returns a snapshot of the latency statistics for a stage
+		/// @param[in] channelIndex The CAN channel to get statistics for
+		/// @param[in] stage The stage to get statistics for
+		/// @returns The latency statistics for the stage, or all zeros if the channel or stage is invalid
+		static Statistics get_statistics(std::uint8_t channelIndex, Stage stage);
+
+		/// @brief Returns an arbitrary percentile for a stage
+		/// @param[in] channelIndex The CAN channel to get the percentile for
+		/// @param[in] stage The stage to get the percentile for
+		/// @param[in] percentile The percentile to get, between 0 and 100
+		/// @returns The latency in microseconds under which `percentile` percent of the frames fell
+		static std::uint32_t get_percentile_us(std::uint8_t channelIndex, Stage stage, float percentile);
+
+		/// @brief Clears all recorded samples for all channels and stages
+		static void reset();
+
+	private:
+		static std::array<std::array<CANLatencyHistogram, static_cast<std::size_t>(Stage::NumberOfStages)>, CAN_PORT_MAXIMUM> histograms; ///< The histograms for each stage of each channel
+	};
+} // namespace isobus
+
+#endif // CAN_LATENCY_MONITOR_HPP
@@ -67,6 +67,8 @@ namespace isobus
 		virtual std::uint32_t get_data_length() const;
 
 		/// @brief Gets the source control function that the message is from
+		/// @note For received messages this is nullptr if the source's address was claimed by
+		/// a different control function before the message was processed.
 		/// @returns The source control function that the message is from
 		std::shared_ptr<ControlFunction> get_source_control_function() const;
 
@@ -74,6 +76,19 @@ namespace isobus
 		/// @returns The destination control function that the message is to
 		std::shared_ptr<ControlFunction> get_destination_control_function() const;
 
+		/// @brief Gets the source control function that the message is from, without taking ownership of it
+		/// @details Unlike get_source_control_function, this does no reference counting, so it's the
+		/// better choice in receive callbacks that only need to check or read the source. The pointer
+		/// is only valid while the message is being processed.
+		/// @returns The source control function that the message is from, or nullptr if there is none
+		ControlFunction *get_source_control_function_pointer() const;
+
+		/// @brief Gets the destination control function that the message is to, without taking ownership of it
+		/// @details Unlike get_destination_control_function, this does no reference counting. The pointer
+		/// is only valid while the message is being processed.
+		/// @returns The destination control function that the message is to, or nullptr for global messages
+		ControlFunction *get_destination_control_function_pointer() const;
+
 		/// @brief Returns the identifier of the message
 		/// @returns The identifier of the message
 		CANIdentifier get_identifier() const;
@@ -82,6 +97,19 @@ namespace isobus
 		/// @returns The CAN channel index associated with the message
 		std::uint8_t get_can_port_index() const;
 
+		/// @brief Returns the time at which the first frame of the message was received
+		/// @details This is the timestamp reported by the CAN driver for the frame, which for drivers
+		/// that support it (like SocketCAN) is the kernel or hardware receive time. If the driver does not
+		/// provide timestamps, the time the frame was read from the driver is used instead (see SystemTiming).
+		/// @returns The receive timestamp of the first frame of the message in microseconds
+		std::uint64_t get_timestamp_us() const;
+
+		/// @brief Returns the time at which the last frame of the message was received
+		/// @details For single frame messages this is the same as get_timestamp_us. For messages
+		/// received through a transport protocol this is the timestamp of the frame that completed the message.
+		/// @returns The receive timestamp of the last frame of the message in microseconds
+		std::uint64_t get_completion_timestamp_us() const;
+
 		/// @brief Sets the message data to the value supplied. Creates a copy.
 		/// @param[in] dataBuffer The data payload
 		/// @param[in] length the length of the data payload in bytes
@@ -104,10 +132,44 @@ namespace isobus
 		/// @param[in] value The destination control function
 		void set_destination_control_function(std::shared_ptr<ControlFunction> value);
 
+		/// @brief Sets the source control function for the message without taking ownership of it.
+		/// Used by the network manager on the receive path.
+		/// @param[in] value A handle to the source control function's address table entry
+		void set_source_control_function(const ControlFunctionHandle &value);
+
+		/// @brief Sets the destination control function for the message without taking ownership of it.
+		/// Used by the network manager on the receive path.
+		/// @param[in] value A handle to the destination control function's address table entry
+		void set_destination_control_function(const ControlFunctionHandle &value);
+
 		/// @brief Sets the CAN ID of the message
 		/// @param[in] value The CAN ID for the message
 		void set_identifier(CANIdentifier value);
 
+		/// @brief Sets the receive timestamp of the first frame of the message.
+		/// Also sets the completion timestamp, as most messages are a single frame.
+		/// @param[in] value The receive timestamp in microseconds
+		void set_timestamp_us(std::uint64_t value);
+
+		/// @brief Sets the receive timestamp of the last frame of the message
+		/// @param[in] value The receive timestamp in microseconds
+		void set_completion_timestamp_us(std::uint64_t value);
+
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		/// @brief Stores the stack times used by the CANLatencyMonitor to measure the receive pipeline
+		/// @param[in] readTimestamp_us The stack time when the frame was read from the driver
+		/// @param[in] dequeueTimestamp_us The stack time when the frame was taken from the hardware interface's queue
+		void set_pipeline_timestamps(std::uint64_t readTimestamp_us, std::uint64_t dequeueTimestamp_us);
+
+		/// @brief Returns the stack time when the message's frame was read from the driver
+		/// @returns The stack time in microseconds, or 0 if the message was not measured
+		std::uint64_t get_pipeline_read_timestamp_us() const;
+
+		/// @brief Returns the stack time when the message's frame was taken from the hardware interface's queue
+		/// @returns The stack time in microseconds, or 0 if the message was not measured
+		std::uint64_t get_pipeline_dequeue_timestamp_us() const;
+#endif
+
 		/// @brief Get a 8-bit unsigned byte from the buffer at a specific index.
 		/// A 8-bit unsigned byte can hold a value between 0 and 255.
 		/// @details This function will return the byte at the specified index in the buffer.
@@ -200,6 +262,14 @@ namespace isobus
 		std::vector<std::uint8_t> data; ///< A data buffer for the message, used when not using data chunk callbacks
 		std::shared_ptr<ControlFunction> source = nullptr; ///< The source control function of the message
 		std::shared_ptr<ControlFunction> destination = nullptr; ///< The destination control function of the message
+		ControlFunctionHandle sourceHandle; ///< The source control function of a received message, used when `source` is not set
+		ControlFunctionHandle destinationHandle; ///< The destination control function of a received message, used when `destination` is not set
+		std::uint64_t timestamp_us = 0; ///< The receive time of the first frame of the message in microseconds
+		std::uint64_t completionTimestamp_us = 0; ///< The receive time of the last frame of the message in microseconds
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		std::uint64_t pipelineReadTimestamp_us = 0; ///< Stack time when the frame was read from the driver
+		std::uint64_t pipelineDequeueTimestamp_us = 0; ///< Stack time when the frame was taken from the hardware interface's queue
+#endif
 		const std::uint8_t CANPortIndex; ///< The CAN channel index associated with the message
 	};
 
@@ -27,12 +27,16 @@ namespace isobus
 		/// @returns The number of bits in the message (with average bit stuffing)
 		std::uint32_t get_number_bits_in_message() const;
 
-		std::uint64_t timestamp_us; ///< A microsecond timestamp
+		std::uint64_t timestamp_us; ///< A microsecond timestamp, set to the receive time when the frame is read from a driver
 		std::uint32_t identifier; ///< The 32 bit identifier of the frame
 		std::uint8_t channel; ///< The CAN channel index associated with the frame
 		std::uint8_t data[8]; ///< The data payload of the frame
 		std::uint8_t dataLength; ///< The length of the data used in the frame
 		bool isExtendedFrame; ///< Denotes if the frame is extended format
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		std::uint64_t readTimestamp_us = 0; ///< Stack time when the frame was read from the driver, used by the CANLatencyMonitor
+		std::uint64_t queueTimestamp_us = 0; ///< Stack time when the frame was added to a hardware interface queue, used by the CANLatencyMonitor
+#endif
 	};
 
 } // namespace isobus
@@ -30,6 +30,7 @@
 #include <deque>
 #include <list>
 #include <memory>
+#include <unordered_map>
 
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
 #include <mutex>
@@ -45,11 +46,37 @@ namespace isobus
 	///
 	/// @brief The main CAN network manager object, handles protocol management and updating other
 	/// stack components. Provides an interface for sending CAN messages.
+	/// @details Most applications only need the default instance, `CANNetwork`, which is the one the
+	/// CANHardwareInterface feeds. Additional instances can be created to run several isolated stacks in
+	/// one process, for example to simulate multiple ECUs or to replay several logs in parallel.
+	/// Each extra instance has its own address table, protocols and callbacks. It is fed frames with
+	/// receive_can_message_frame and sends through the callback set with set_frame_transmit_callback.
+	///
+	/// Control functions are bound to a network manager when they are created, using the default
+	/// instance unless another one is passed to their factory function. Protocols and interfaces
+	/// like the VT client use the network manager of the control functions they are constructed with.
 	//================================================================================================
 	class CANNetworkManager
 	{
 	public:
-		static CANNetworkManager CANNetwork; ///< Static singleton of the one network manager. Use this to access stack functionality.
+		/// @brief A callback used to transmit frames from a network manager
+		/// @param[in] frame The frame to transmit
+		/// @param[in] parentPointer A generic context variable passed to set_frame_transmit_callback
+		/// @returns `true` if the frame was sent, otherwise `false`
+		using FrameTransmitCallback = bool (*)(const CANMessageFrame &frame, void *parentPointer);
+
+		static CANNetworkManager CANNetwork; ///< The default network manager, which the CANHardwareInterface is connected to. Use this to access stack functionality.
+
+		/// @brief Constructor for the network manager. Sets default values for members.
+		/// @details Use this to create network managers in addition to the default instance.
+		CANNetworkManager();
+
+		/// @brief Deleted copy constructor
+		CANNetworkManager(const CANNetworkManager &) = delete;
+
+		/// @brief Deleted assignment operator
+		/// @returns Nothing, this is deleted
+		CANNetworkManager &operator=(const CANNetworkManager &) = delete;
 
 		/// @brief Initializer function for the network manager
 		void initialize();
@@ -135,15 +162,29 @@ namespace isobus
 		/// @brief The main update function for the network manager. Updates all protocols.
 		void update();
 
-		/// @brief Process the CAN Rx queue
+		/// @brief Process the CAN Rx queue of the default network manager
 		/// @param[in] rxFrame Frame to process
 		static void process_receive_can_message_frame(const CANMessageFrame &rxFrame);
 
-		/// @brief Used to tell the network manager when frames are emitted on the bus, so that they can be
+		/// @brief Used to tell the default network manager when frames are emitted on the bus, so that they can be
 		/// added to the internal bus load calculations.
 		/// @param[in] txFrame The frame that was just emitted onto the bus
 		static void process_transmitted_can_message_frame(const CANMessageFrame &txFrame);
 
+		/// @brief Passes a received frame to this network manager
+		/// @param[in] rxFrame The frame that was received
+		void receive_can_message_frame(const CANMessageFrame &rxFrame);
+
+		/// @brief Tells this network manager that a frame was emitted on the bus, for the bus load calculations
+		/// @param[in] txFrame The frame that was just emitted onto the bus
+		void on_can_message_frame_transmitted(const CANMessageFrame &txFrame);
+
+		/// @brief Sets where this network manager sends its frames.
+		/// By default frames are sent to the CANHardwareInterface.
+		/// @param[in] callback The callback to send frames with, or nullptr to send to the CANHardwareInterface
+		/// @param[in] parentPointer A generic context variable that is passed to the callback
+		void set_frame_transmit_callback(FrameTransmitCallback callback, void *parentPointer);
+
 		/// @brief Informs the network manager that a control function object has been destroyed, so that it can be purged from the network manager
 		/// @param[in] controlFunction The control function that was destroyed
 		void on_control_function_destroyed(std::shared_ptr<ControlFunction> controlFunction, CANLibBadge<ControlFunction>);
@@ -200,6 +241,8 @@ namespace isobus
 		friend class ParameterGroupNumberRequestProtocol; ///< Allows the PGN request protocol to access the network manager protected functions
 		friend class FastPacketProtocol; ///< Allows the FP protocol to access the network manager protected functions
 		friend class CANLibProtocol; ///< Allows the CANLib protocol base class functions to access the network manager protected functions
+		friend class ControlFunction; ///< Allows control functions to lock the control function tables
+		friend class PartneredControlFunction; ///< Allows partnered control functions to lock the control function tables
 
 		/// @brief Adds a PGN callback for a protocol class
 		/// @param[in] parameterGroupNumber The PGN to register for
@@ -240,9 +283,6 @@ namespace isobus
 		std::vector<CANLibProtocol *> protocolList; ///< A list of all created protocol classes
 
 	private:
-		/// @brief Constructor for the network manager. Sets default values for members
-		CANNetworkManager();
-
 		/// @brief Updates the internal address table based on a received CAN message
 		/// @param[in] message A message being received by the stack
 		void update_address_table(const CANMessage &message);
@@ -288,6 +328,27 @@ namespace isobus
 		/// @returns A control function matching the address and CAN port passed in
 		std::shared_ptr<ControlFunction> get_control_function(std::uint8_t channelIndex, std::uint8_t address) const;
 
+		/// @brief Gets a non-owning handle to the control function at an address, for use on the receive path
+		/// @param[in] channelIndex The CAN channel index of the CF
+		/// @param[in] address The address of the CF
+		/// @returns A handle to the address table entry, which is empty if the channel or address is invalid
+		ControlFunctionHandle get_control_function_handle(std::uint8_t channelIndex, std::uint8_t address) const;
+
+		/// @brief Places a control function in the address table, invalidating handles to the previous one
+		/// and indexing it by NAME for address claim processing
+		/// @param[in] channelIndex The CAN channel index of the table entry
+		/// @param[in] address The address of the table entry
+		/// @param[in] controlFunction The control function to place in the table, or nullptr to clear the entry
+		void set_control_function_table_entry(std::uint8_t channelIndex, std::uint8_t address, std::shared_ptr<ControlFunction> controlFunction);
+
+		/// @brief Adds a control function to the inactive list, and to the index of inactive control functions by NAME
+		/// @param[in] controlFunction The control function that no longer has a valid address
+		void add_inactive_control_function(const std::shared_ptr<ControlFunction> &controlFunction);
+
+		/// @brief Removes a control function from the inactive list, and from the index of inactive control functions by NAME
+		/// @param[in] controlFunction The control function to remove
+		void remove_inactive_control_function(const std::shared_ptr<ControlFunction> &controlFunction);
+
 		/// @brief Gets a message from the Rx Queue.
 		/// @note This will only ever get an 8 byte message. Long messages are handled elsewhere.
 		/// @returns The can message that was at the front of the buffer
@@ -375,7 +436,10 @@ namespace isobus
 		std::array<std::uint32_t, CAN_PORT_MAXIMUM> lastAddressClaimRequestTimestamp_ms; ///< Stores timestamps for when the last request for the address claim PGN was received. Used to prune stale CFs.
 
 		std::array<std::array<std::shared_ptr<ControlFunction>, NULL_CAN_ADDRESS>, CAN_PORT_MAXIMUM> controlFunctionTable; ///< Table to maintain address to NAME mappings
+		std::array<std::array<std::uint32_t, NULL_CAN_ADDRESS>, CAN_PORT_MAXIMUM> controlFunctionTableGenerations; ///< Incremented each time an entry of the control function table changes, to invalidate handles
+		std::array<std::unordered_map<std::uint64_t, std::uint8_t>, CAN_PORT_MAXIMUM> controlFunctionAddressesByNAME; ///< The last address table entry each NAME was placed in, to avoid searching the table on address claims
 		std::list<std::shared_ptr<ControlFunction>> inactiveControlFunctions; ///< A list of the control function that currently don't have a valid address
+		std::array<std::unordered_multimap<std::uint64_t, std::shared_ptr<ControlFunction>>, CAN_PORT_MAXIMUM> inactiveControlFunctionsByNAME; ///< The inactive control functions on each channel, by NAME, to avoid searching the inactive list on address claims
 		std::list<std::shared_ptr<InternalControlFunction>> internalControlFunctions; ///< A list of the internal control functions
 		std::list<std::shared_ptr<PartneredControlFunction>> partneredControlFunctions; ///< A list of the partnered control functions
 
@@ -391,7 +455,10 @@ namespace isobus
 		std::mutex anyControlFunctionCallbacksMutex; ///< Mutex to protect the "any CF" callbacks
 		std::mutex busloadUpdateMutex; ///< A mutex that protects the busload metrics since we calculate it on our own thread
 		std::mutex controlFunctionStatusCallbacksMutex; ///< A Mutex that protects access to the control function status callback list
+		std::mutex controlFunctionProcessingMutex; ///< Protects the control function tables
 #endif
+		FrameTransmitCallback frameTransmitCallback = nullptr; ///< Sends frames for this network manager, or nullptr to use the hardware interface
+		void *frameTransmitParent = nullptr; ///< The context variable for frameTransmitCallback
 		std::uint32_t busloadUpdateTimestamp_ms = 0; ///< Tracks a time window for determining approximate busload
 		std::uint32_t updateTimestamp_ms = 0; ///< Keeps track of the last time the CAN stack was update in milliseconds
 		bool initialized = false; ///< True if the network manager has been initialized by the update function
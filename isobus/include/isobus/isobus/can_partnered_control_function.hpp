@@ -44,10 +44,18 @@ namespace isobus
 		/// @returns A shared pointer to a PartneredControlFunction object created with the parameters passed in
 		static std::shared_ptr<PartneredControlFunction> create(std::uint8_t CANPort, const std::vector<NAMEFilter> NAMEFilters);
 
+		/// @brief Factory function to create a partnered control function on a specific network manager
+		/// @param[in] CANPort The CAN channel associated with this control function definition
+		/// @param[in] NAMEFilters A list of filters that describe the identity of the CF based on NAME components
+		/// @param[in] parentNetwork The network manager the control function belongs to
+		/// @returns A shared pointer to a PartneredControlFunction object created with the parameters passed in
+		static std::shared_ptr<PartneredControlFunction> create(std::uint8_t CANPort, const std::vector<NAMEFilter> NAMEFilters, CANNetworkManager &parentNetwork);
+
 		/// @brief the constructor for a PartneredControlFunction, which is called by the factory function
 		/// @param[in] CANPort The CAN channel associated with this control function definition
 		/// @param[in] NAMEFilters A list of filters that describe the identity of the CF based on NAME components
-		PartneredControlFunction(std::uint8_t CANPort, const std::vector<NAMEFilter> NAMEFilters, CANLibBadge<PartneredControlFunction>);
+		/// @param[in] parentNetwork The network manager the control function belongs to
+		PartneredControlFunction(std::uint8_t CANPort, const std::vector<NAMEFilter> NAMEFilters, CANNetworkManager &parentNetwork, CANLibBadge<PartneredControlFunction>);
 
 		/// @brief Deleted copy constructor for PartneredControlFunction to avoid slicing
 		PartneredControlFunction(PartneredControlFunction &) = delete;
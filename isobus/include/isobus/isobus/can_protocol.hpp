@@ -32,8 +32,9 @@ namespace isobus
 	class CANLibProtocol
 	{
 	public:
-		/// @brief The base class constructor for a CANLibProtocol
-		CANLibProtocol();
+		/// @brief The base class constructor for a CANLibProtocol that belongs to a specific network manager
+		/// @param[in] parentNetwork The network manager that will update this protocol
+		explicit CANLibProtocol(CANNetworkManager &parentNetwork);
 
 		/// @brief Deleted copy constructor for a CANLibProtocol
 		CANLibProtocol(CANLibProtocol &) = delete;
@@ -45,14 +46,14 @@ namespace isobus
 		/// @returns true if the protocol has been initialized by the network manager
 		bool get_is_initialized() const;
 
-		/// @brief Gets a CAN protocol by index from the list of all protocols
+		/// @brief Gets a CAN protocol by index from the default network manager's list of protocols
 		/// @param[in] index The index of the protocol to get from the list of protocols
 		/// @param[out] returnedProtocol The returned protocol
 		/// @returns true if a protocol was successfully returned, false if index was out of range
 		static bool get_protocol(std::uint32_t index, CANLibProtocol *&returnedProtocol);
 
-		/// @brief Returns the number of all created protocols
-		/// @returns The number of all created protocols
+		/// @brief Returns the number of protocols in the default network manager
+		/// @returns The number of protocols in the default network manager
 		static std::uint32_t get_number_protocols();
 
 		/// @brief A generic way to initialize a protocol
@@ -87,6 +88,7 @@ namespace isobus
 		virtual void update(CANLibBadge<CANNetworkManager>) = 0;
 
 	protected:
+		CANNetworkManager &network; ///< The network manager this protocol belongs to
 		bool initialized; ///< Keeps track of if the protocol has been initialized by the network manager
 	};
 
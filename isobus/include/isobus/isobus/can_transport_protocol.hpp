@@ -125,7 +125,8 @@ namespace isobus
 		static constexpr std::uint8_t PROTOCOL_BYTES_PER_FRAME = 7; ///< The number of payload bytes per frame minus overhead of sequence number
 
 		/// @brief The constructor for the TransportProtocolManager
-		TransportProtocolManager() = default;
+		/// @param[in] parentNetwork The network manager this protocol belongs to
+		explicit TransportProtocolManager(CANNetworkManager &parentNetwork);
 
 		/// @brief The destructor for the TransportProtocolManager
 		~TransportProtocolManager() final;
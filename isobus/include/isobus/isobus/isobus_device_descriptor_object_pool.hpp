@@ -13,7 +13,10 @@
 #include "isobus/isobus/can_NAME.hpp"
 #include "isobus/isobus/isobus_task_controller_client_objects.hpp"
 
+#include <iosfwd>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 namespace isobus
 {
@@ -131,15 +134,46 @@ namespace isobus
 		bool deserialize_binary_object_pool(const std::uint8_t *binaryPool, std::uint32_t binaryPoolSizeBytes, NAME clientNAME = NAME(0));
 
 		/// Constructs a binary DDOP using the objects that were previously added
+		/// @details The exact size of the pool is computed first, so the pool is written in a single pass
+		/// into a buffer that is only allocated once. Reusing the same vector avoids even that allocation.
 		/// @param[in,out] resultantPool The binary representation of the DDOP, or an empty vector if this function returns false
 		/// @returns `true` if the object pool was generated and is valid, otherwise `false`.
 		bool generate_binary_object_pool(std::vector<std::uint8_t> &resultantPool);
 
+		/// @brief Returns the number of bytes generate_binary_object_pool will produce for the objects currently in the pool
+		/// @returns The size of the binary DDOP, in bytes
+		std::size_t get_binary_object_pool_size() const;
+
 		/// Constructs a ISOXML formatted TASKDATA.xml file inside a string using the objects that were previously added.
 		/// @param[in,out] resultantString The XML representation of the DDOP, or an empty string if this function returns false
 		/// @returns `true` if the object pool was generated and is valid, otherwise `false`.
 		bool generate_task_data_iso_xml(std::string &resultantString);
 
+		/// Constructs a ISOXML formatted TASKDATA.xml file using the objects that were previously added,
+		/// and writes it to a stream as it is generated, such as a std::ofstream to write it straight to a file.
+		/// @details The XML is written in chunks, so the whole document is never held in memory at once.
+		/// @param[in,out] output The stream to write the XML representation of the DDOP to
+		/// @returns `true` if the object pool was generated and is valid and the stream accepted it, otherwise `false`.
+		bool generate_task_data_iso_xml(std::ostream &output);
+
+		/// @brief Attempts to take the device from an ISOXML TASKDATA.xml file and convert it into C++ objects
+		/// @details The XML is read in a single pass, creating objects straight from the DVC, DET, DOR, DPD, DPT and DVP
+		/// elements without building a document tree first. Only the first DVC element is read, and other elements,
+		/// such as tasks, are skipped. ISOXML has no extended structure label, so the device won't have one.
+		/// @param[in] isoXML The ISOXML text, which doesn't need to be null terminated
+		/// @param[in] isoXMLSize The number of bytes of ISOXML text
+		/// @returns True if the device was successfully read, otherwise false and the DDOP is left empty.
+		/// NOTE: This only means that the XML was read. It does not mean that the
+		/// relationship between objects is valid. You may have to do additional
+		/// checking on the pool before using it.
+		bool deserialize_task_data_iso_xml(const char *isoXML, std::size_t isoXMLSize);
+
+		/// @brief Attempts to take the device from an ISOXML TASKDATA.xml file and convert it into C++ objects
+		/// @details See the other overload of this function for details.
+		/// @param[in] isoXML The ISOXML text
+		/// @returns True if the device was successfully read, otherwise false and the DDOP is left empty.
+		bool deserialize_task_data_iso_xml(const std::string &isoXML);
+
 		/// @brief Gets an object from the DDOP that corresponds to a certain object ID
 		/// @param[in] objectID The ID of the object to get
 		/// @returns Pointer to the object matching the provided ID, or nullptr if no match was found
@@ -183,14 +217,34 @@ namespace isobus
 		/// @returns `true` if all object IDs were validated, otherwise `false`
 		bool resolve_parent_ids_to_objects();
 
+		/// @brief Writes the ISOXML representation of the DDOP
+		/// @param[in,out] buffer The buffer the XML is built in, which is left empty if this function returns false
+		/// @param[in,out] output A stream to move the buffer's contents to each time it fills up, or nullptr to keep everything in the buffer
+		/// @returns `true` if the object pool was generated and is valid, otherwise `false`
+		bool write_task_data_iso_xml(std::string &buffer, std::ostream *output);
+
+		/// @brief Estimates how many bytes the ISOXML representation of the DDOP will take
+		/// @returns The estimated size of the ISOXML, which is enough unless designators need a lot of escaping
+		std::size_t estimate_task_data_iso_xml_size() const;
+
 		/// @brief Checks the DDOP to see if an object ID has already been used
 		/// @param[in] uniqueID The ID to check against in the DDOP for uniqueness
 		/// @returns true if the object ID parameter is unique in the DDOP, otherwise false
-		bool check_object_id_unique(std::uint16_t uniqueID) const;
+		bool check_object_id_unique(std::uint16_t uniqueID);
+
+		/// @brief Adds an object that was just added to objectList to the object ID index
+		/// @param[in] object The object to index
+		void index_object(const std::shared_ptr<task_controller_object::Object> &object);
+
+		/// @brief Rebuilds the object ID index if any object's ID was changed since it was built
+		void update_object_index();
 
 		static constexpr std::uint8_t MAX_TC_VERSION_SUPPORTED = 4; ///< The max TC version a DDOP object can support as of today
 
 		std::vector<std::shared_ptr<task_controller_object::Object>> objectList; ///< Maintains a list of all added objects
+		std::unordered_map<std::uint16_t, std::shared_ptr<task_controller_object::Object>> objectIndex; ///< Finds objects in objectList by their object ID
+		std::shared_ptr<std::uint32_t> objectIDChangeCount = std::make_shared<std::uint32_t>(0); ///< Incremented by this pool's objects when their ID is changed, shared with copies of the pool since they share the objects, and kept by objects removed from the pool
+		std::uint32_t objectIndexChangeCount = 0; ///< The object ID change count when objectIndex was last rebuilt
 		std::uint8_t taskControllerCompatibilityLevel = MAX_TC_VERSION_SUPPORTED; ///< Stores the max TC version
 	};
 } // namespace isobus
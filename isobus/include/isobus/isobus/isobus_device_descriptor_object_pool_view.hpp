@@ -0,0 +1,285 @@
+//================================================================================================
+/// @file isobus_device_descriptor_object_pool_view.hpp
+///
+/// @brief Provides read-only access to a binary DDOP without deserializing it.
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#ifndef ISOBUS_DEVICE_DESCRIPTOR_OBJECT_POOL_VIEW_HPP
+#define ISOBUS_DEVICE_DESCRIPTOR_OBJECT_POOL_VIEW_HPP
+
+#include "isobus/isobus/isobus_task_controller_client_objects.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace isobus
+{
+	//================================================================================================
+	/// @class DeviceDescriptorObjectPoolView
+	///
+	/// @brief A read-only view of a binary device descriptor object pool
+	/// @details Opening a pool makes a single pass over the binary to check each object's length
+	/// and record where it starts, without copying anything out of it. Objects are decoded from
+	/// the binary only when they are accessed, and text fields are returned as Text spans that
+	/// point into the binary. This makes inspecting large pools, or many pools, much faster and
+	/// lighter on memory than deserializing them with DeviceDescriptorObjectPool.
+	///
+	/// The binary is not copied, so it must outlive the view and any ObjectView or Text taken from it.
+	/// A pool mapped with IOPFileInterface::map_iop_file works well for this.
+	///
+	/// Opening a pool only checks that objects are well formed and that object IDs are unique.
+	/// Object references are not resolved, so use DeviceDescriptorObjectPool to fully validate a pool.
+	//================================================================================================
+	class DeviceDescriptorObjectPoolView
+	{
+	public:
+		/// @brief A read-only span of text inside a binary DDOP
+		class Text
+		{
+		public:
+			/// @brief Constructs an empty span
+			Text() = default;
+
+			/// @brief Constructs a span over some bytes
+			/// @param[in] textData The first byte of the text
+			/// @param[in] textSize The number of bytes in the text
+			Text(const std::uint8_t *textData, std::size_t textSize);
+
+			/// @brief Returns a pointer to the text, which is not null terminated
+			/// @returns A pointer to the first character of the text
+			const char *data() const;
+
+			/// @brief Returns the length of the text
+			/// @returns The number of bytes in the text
+			std::size_t size() const;
+
+			/// @brief Returns if the text is empty
+			/// @returns `true` if the text has no characters, otherwise `false`
+			bool empty() const;
+
+			/// @brief Copies the text into a string
+			/// @returns A string containing a copy of the text
+			std::string to_string() const;
+
+			/// @brief Compares the text with a string
+			/// @param[in] other The string to compare with
+			/// @returns `true` if the text and the string are identical, otherwise `false`
+			bool operator==(const std::string &other) const;
+
+			/// @brief Compares the text with a string
+			/// @param[in] other The string to compare with
+			/// @returns `true` if the text and the string are different, otherwise `false`
+			bool operator!=(const std::string &other) const;
+
+		private:
+			const std::uint8_t *textData = nullptr; ///< The first byte of the text
+			std::size_t textSize = 0; ///< The number of bytes in the text
+		};
+
+		/// @brief A read-only view of a single object in a binary DDOP
+		/// @details Each getter decodes its field straight from the binary. Getters that don't apply
+		/// to the object's type return a default value, so check get_object_type first.
+		class ObjectView
+		{
+		public:
+			/// @brief Constructs an invalid view, which refers to no object
+			ObjectView() = default;
+
+			/// @brief Returns if the view refers to an object
+			/// @returns `true` if the view refers to an object, otherwise `false`
+			bool get_is_valid() const;
+
+			/// @brief Returns the type of the object
+			/// @returns The type of the object
+			task_controller_object::ObjectTypes get_object_type() const;
+
+			/// @brief Returns the object ID of the object
+			/// @returns The object ID, or NULL_OBJECT_ID if the view is invalid
+			std::uint16_t get_object_id() const;
+
+			/// @brief Returns the designator of the object
+			/// @returns The designator, or empty text if the view is invalid
+			Text get_designator() const;
+
+			/// @brief Returns the size of the object in the binary
+			/// @returns The number of bytes the object takes up in the binary DDOP
+			std::size_t get_binary_object_size() const;
+
+			/// @brief Returns the software version of a device object
+			/// @returns The software version, or empty text if this is not a device object
+			Text get_software_version() const;
+
+			/// @brief Returns the serial number of a device object
+			/// @returns The serial number, or empty text if this is not a device object
+			Text get_serial_number() const;
+
+			/// @brief Returns the ISO NAME of a device object
+			/// @returns The ISO NAME, or 0 if this is not a device object
+			std::uint64_t get_iso_name() const;
+
+			/// @brief Returns the structure label of a device object
+			/// @returns The 7 byte structure label, or empty text if this is not a device object
+			Text get_structure_label() const;
+
+			/// @brief Returns the localization label of a device object
+			/// @returns The localization label, or all zeros if this is not a device object
+			std::array<std::uint8_t, 7> get_localization_label() const;
+
+			/// @brief Returns the extended structure label of a device object
+			/// @returns The extended structure label, or empty text if this is not a device object or the pool is older than version 4
+			Text get_extended_structure_label() const;
+
+			/// @brief Returns the type of a device element object
+			/// @returns The element type, or Type::Device if this is not a device element object
+			task_controller_object::DeviceElementObject::Type get_element_type() const;
+
+			/// @brief Returns the element number of a device element object
+			/// @returns The element number, or 0 if this is not a device element object
+			std::uint16_t get_element_number() const;
+
+			/// @brief Returns the parent object ID of a device element object
+			/// @returns The parent object ID, or NULL_OBJECT_ID if this is not a device element object
+			std::uint16_t get_parent_object() const;
+
+			/// @brief Returns the number of child objects a device element object references
+			/// @returns The number of child objects, or 0 if this is not a device element object
+			std::uint16_t get_number_child_objects() const;
+
+			/// @brief Returns the object ID of one of a device element object's children
+			/// @param[in] index The index of the child to get
+			/// @returns The child's object ID, or NULL_OBJECT_ID if the index or object type is invalid
+			std::uint16_t get_child_object_id(std::uint16_t index) const;
+
+			/// @brief Returns the DDI of a process data or property object
+			/// @returns The DDI, or 0 if this is not a process data or property object
+			std::uint16_t get_ddi() const;
+
+			/// @brief Returns the properties bitfield of a process data object
+			/// @returns The properties bitfield, or 0 if this is not a process data object
+			std::uint8_t get_properties_bitfield() const;
+
+			/// @brief Returns the trigger methods bitfield of a process data object
+			/// @returns The trigger methods bitfield, or 0 if this is not a process data object
+			std::uint8_t get_trigger_methods_bitfield() const;
+
+			/// @brief Returns the value of a property object
+			/// @returns The property's value, or 0 if this is not a property object
+			std::int32_t get_value() const;
+
+			/// @brief Returns the value presentation object ID of a process data or property object
+			/// @returns The presentation object ID, or NULL_OBJECT_ID if this is not a process data or property object
+			std::uint16_t get_device_value_presentation_object_id() const;
+
+			/// @brief Returns the offset of a value presentation object
+			/// @returns The offset, or 0 if this is not a value presentation object
+			std::int32_t get_offset() const;
+
+			/// @brief Returns the scale of a value presentation object
+			/// @returns The scale, or 0 if this is not a value presentation object
+			float get_scale() const;
+
+			/// @brief Returns the number of decimals of a value presentation object
+			/// @returns The number of decimals, or 0 if this is not a value presentation object
+			std::uint8_t get_number_of_decimals() const;
+
+			/// @brief Creates a regular, standalone TC object with the same contents as this one
+			/// @returns The new object, or nullptr if the view is invalid
+			std::shared_ptr<task_controller_object::Object> materialize() const;
+
+		private:
+			friend class DeviceDescriptorObjectPoolView;
+
+			/// @brief Constructs a view of an object that has already been checked
+			/// @param[in] data The first byte of the object in the binary DDOP
+			/// @param[in] type The type of the object
+			/// @param[in] hasExtendedStructureLabel If a device object has an extended structure label (version 4 and later)
+			ObjectView(const std::uint8_t *data, task_controller_object::ObjectTypes type, bool hasExtendedStructureLabel);
+
+			/// @brief Reads a little endian 16 bit value from the object
+			/// @param[in] offset The offset of the value from the start of the object
+			/// @returns The value
+			std::uint16_t read_uint16(std::size_t offset) const;
+
+			/// @brief Reads a little endian 32 bit value from the object
+			/// @param[in] offset The offset of the value from the start of the object
+			/// @returns The value
+			std::uint32_t read_uint32(std::size_t offset) const;
+
+			/// @brief Returns the offset of the NAME in a device object, which follows the variable length designator and software version
+			/// @returns The offset of the NAME from the start of the object
+			std::size_t get_device_name_offset() const;
+
+			/// @brief Returns the offset of the structure label in a device object, which follows the variable length serial number
+			/// @returns The offset of the structure label from the start of the object
+			std::size_t get_device_structure_label_offset() const;
+
+			const std::uint8_t *objectData = nullptr; ///< The first byte of the object in the binary DDOP
+			task_controller_object::ObjectTypes objectType = task_controller_object::ObjectTypes::Device; ///< The type of the object
+			bool extendedStructureLabel = false; ///< If a device object has an extended structure label
+		};
+
+		/// @brief Constructs a view, which starts out empty
+		/// @param[in] taskControllerServerVersion The TC version the pools will be read as, which decides if the device object has an extended structure label
+		explicit DeviceDescriptorObjectPoolView(std::uint8_t taskControllerServerVersion = 4);
+
+		/// @brief Opens a binary DDOP, replacing any pool that was open
+		/// @details The binary is not copied, and must outlive the view.
+		/// @param[in] binaryPool The binary DDOP
+		/// @param[in] binaryPoolSizeBytes The number of bytes in the binary DDOP
+		/// @returns `true` if the pool was well formed and is now open, otherwise `false` and the view is left empty
+		bool open(const std::uint8_t *binaryPool, std::uint32_t binaryPoolSizeBytes);
+
+		/// @brief Opens a binary DDOP, replacing any pool that was open
+		/// @details The binary is not copied, and must outlive the view.
+		/// @param[in] binaryPool The binary DDOP
+		/// @returns `true` if the pool was well formed and is now open, otherwise `false` and the view is left empty
+		bool open(const std::vector<std::uint8_t> &binaryPool);
+
+		/// @brief Closes the pool, leaving the view empty
+		void close();
+
+		/// @brief Returns the number of objects in the pool
+		/// @returns The number of objects in the pool
+		std::size_t size() const;
+
+		/// @brief Returns an object by its position in the binary DDOP
+		/// @param[in] index The index of the object
+		/// @returns A view of the object, which is invalid if the index is out of range
+		ObjectView get_object_by_index(std::size_t index) const;
+
+		/// @brief Returns an object by its object ID
+		/// @param[in] objectID The ID of the object to get
+		/// @returns A view of the object, which is invalid if there is no object with that ID
+		ObjectView get_object_by_id(std::uint16_t objectID) const;
+
+	private:
+		/// @brief Records where an object is in the binary DDOP
+		struct IndexedObject
+		{
+			std::uint32_t offset; ///< The offset of the object from the start of the binary DDOP
+			std::uint16_t objectID; ///< The object's ID
+			task_controller_object::ObjectTypes type; ///< The object's type
+		};
+
+		/// @brief Checks that an object is well formed and finds its length
+		/// @param[in] data The first byte of the object
+		/// @param[in] remainingBytes The number of bytes left in the binary DDOP, starting at the object
+		/// @param[out] type The type of the object
+		/// @param[out] objectSize The number of bytes in the object
+		/// @returns `true` if the object is well formed, otherwise `false`
+		bool index_object(const std::uint8_t *data, std::uint32_t remainingBytes, task_controller_object::ObjectTypes &type, std::uint32_t &objectSize) const;
+
+		std::vector<IndexedObject> objects; ///< Every object in the pool, in the order they appear in the binary
+		std::vector<std::uint32_t> objectsByID; ///< Indices into objects, sorted by object ID
+		const std::uint8_t *poolData = nullptr; ///< The binary DDOP
+		std::uint8_t taskControllerCompatibilityLevel; ///< The TC version the pool is read as
+	};
+} // namespace isobus
+
+#endif // ISOBUS_DEVICE_DESCRIPTOR_OBJECT_POOL_VIEW_HPP
@@ -393,6 +393,7 @@ namespace isobus
 		/// @returns true if the message was sent, otherwise false
 		bool send_guidance_system_command() const;
 
+		CANNetworkManager &network; ///< The network manager of the interface's control function
 		ProcessingFlags txFlags; ///< Tx flag for sending messages periodically
 		EventDispatcher<const std::shared_ptr<GuidanceMachineInfo>, bool> guidanceMachineInfoEventPublisher; ///< An event publisher for notifying when new guidance machine info messages are received
 		EventDispatcher<const std::shared_ptr<GuidanceSystemCommand>, bool> guidanceSystemCommandEventPublisher; ///< An event publisher for notifying when new guidance system commands are received
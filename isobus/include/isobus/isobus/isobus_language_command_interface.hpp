@@ -329,6 +329,7 @@ namespace isobus
 
 		std::shared_ptr<InternalControlFunction> myControlFunction; ///< The control function to send messages as
 		std::shared_ptr<PartneredControlFunction> myPartner; ///< The partner to talk to, or nullptr to listen to all CFs
+		CANNetworkManager &network; ///< The network manager of the interface's control function
 		std::string countryCode; ///< The last received alpha-2 country code as specified by ISO 3166-1, such as "NL, FR, GB, US, DE".
 		std::string languageCode; ///< The last received language code, such as "en", "es", "de", etc.
 		std::uint32_t languageCommandTimestamp_ms = 0; ///< A millisecond timestamp correlated to the last received language command message
@@ -255,6 +255,7 @@ namespace isobus
 		/// @param[in] parentPointer A context variable to find the relevant instance of this class
 		static void process_rx_message(const CANMessage &message, void *parentPointer);
 
+		CANNetworkManager &network; ///< The network manager of the interface's control function
 		ProcessingFlags txFlags; ///< Tx flag for sending the maintain power message. Handles retries automatically.
 
 	private:
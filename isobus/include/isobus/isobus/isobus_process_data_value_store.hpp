@@ -0,0 +1,152 @@
+//================================================================================================
+/// @file isobus_process_data_value_store.hpp
+///
+/// @brief A store of process data values that an application writes into and a task controller
+/// client reads from, without either side waiting on the other.
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#ifndef ISOBUS_PROCESS_DATA_VALUE_STORE_HPP
+#define ISOBUS_PROCESS_DATA_VALUE_STORE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+namespace isobus
+{
+	//================================================================================================
+	/// @class ProcessDataValueStore
+	///
+	/// @brief Holds the current value of process data variables, keyed by element number and DDI
+	/// @details Variables are added up front with add_value, which is not thread safe and must be
+	/// done before the store is used by other threads (for a TaskControllerClient, before calling
+	/// initialize). After that, set_value and get_value are lock-free and may be called from any thread.
+	///
+	/// Each time a variable's value changes, it is queued once for the consumer to take with
+	/// take_changed_value, so the consumer only has to look at variables that actually changed.
+	/// Only one thread may take changed values.
+	//================================================================================================
+	class ProcessDataValueStore
+	{
+	public:
+		/// @brief Describes a variable that was taken from the changed values queue
+		struct ChangedValue
+		{
+			std::uint32_t value; ///< The value of the variable when it was taken
+			std::uint16_t elementNumber; ///< The element number of the variable
+			std::uint16_t ddi; ///< The DDI of the variable
+			bool sendOnChange; ///< If the variable should be sent to the TC whenever it changes
+		};
+
+		/// @brief Constructor for a ProcessDataValueStore
+		ProcessDataValueStore() = default;
+
+		/// @brief Deleted copy constructor, since the store is shared between threads
+		ProcessDataValueStore(const ProcessDataValueStore &) = delete;
+
+		/// @brief Deleted assignment operator, since the store is shared between threads
+		/// @returns Nothing, since this is deleted
+		ProcessDataValueStore &operator=(const ProcessDataValueStore &) = delete;
+
+		/// @brief Adds a process data variable to the store
+		/// @attention This is not thread safe, so add all variables before sharing the store with other threads
+		/// @param[in] elementNumber The element number of the variable
+		/// @param[in] ddi The DDI of the variable
+		/// @param[in] initialValue The value the variable starts with
+		/// @param[in] sendOnChange Set to true if the variable should be sent to the TC every time it changes,
+		/// which is the same as calling TaskControllerClient::on_value_changed_trigger for it
+		/// @returns true if the variable was added, or false if it was already in the store
+		bool add_value(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t initialValue = 0, bool sendOnChange = false);
+
+		/// @brief Updates the value of a process data variable
+		/// @details This is lock-free and may be called from any thread. If the value is different from
+		/// the previous one, the variable is queued as changed.
+		/// @param[in] elementNumber The element number of the variable
+		/// @param[in] ddi The DDI of the variable
+		/// @param[in] value The new value of the variable
+		/// @returns true if the variable is in the store and was updated, otherwise false
+		bool set_value(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t value);
+
+		/// @brief Reads the current value of a process data variable
+		/// @details This is lock-free and may be called from any thread.
+		/// @param[in] elementNumber The element number of the variable
+		/// @param[in] ddi The DDI of the variable
+		/// @param[out] value The current value of the variable, if it is in the store
+		/// @returns true if the variable is in the store, otherwise false
+		bool get_value(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t &value) const;
+
+		/// @brief Returns if a process data variable has been added to the store
+		/// @param[in] elementNumber The element number of the variable
+		/// @param[in] ddi The DDI of the variable
+		/// @returns true if the variable is in the store, otherwise false
+		bool has_value(std::uint16_t elementNumber, std::uint16_t ddi) const;
+
+		/// @brief Takes the next variable whose value changed since it was last taken
+		/// @details A variable that changes many times before it is taken is only returned once, with
+		/// its latest value. Only one thread may call this.
+		/// @param[out] changedValue The variable that changed
+		/// @returns true if a changed variable was returned, or false if there are none
+		bool take_changed_value(ChangedValue &changedValue);
+
+		/// @brief Returns the number of variables in the store
+		/// @returns The number of variables in the store
+		std::size_t size() const;
+
+		/// @brief Sets a function to call whenever a variable is queued as changed
+		/// @details The callback is called from the thread that called set_value, so it must be thread safe.
+		/// It is only called when a variable is newly queued, not for every change while it's waiting to be taken.
+		/// The callback may be changed while other threads are setting values, but a set_value that is
+		/// already running may still call the previous callback.
+		/// @param[in] callback The function to call, or nullptr for none
+		/// @param[in] parentPointer A context variable that is passed to the callback
+		void set_value_changed_callback(void (*callback)(void *parentPointer), void *parentPointer);
+
+	private:
+		/// @brief Stores one process data variable
+		struct Entry
+		{
+			/// @brief Constructor for an Entry
+			/// @param[in] elementNumber The element number of the variable
+			/// @param[in] ddi The DDI of the variable
+			/// @param[in] initialValue The value the variable starts with
+			/// @param[in] sendOnChange If the variable should be sent to the TC whenever it changes
+			Entry(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t initialValue, bool sendOnChange);
+
+			std::atomic<std::uint32_t> value; ///< The current value of the variable
+			std::atomic<bool> changed; ///< Set while the variable is in the changed values queue
+			const std::uint16_t elementNumber; ///< The element number of the variable
+			const std::uint16_t ddi; ///< The DDI of the variable
+			const bool sendOnChange; ///< If the variable should be sent to the TC whenever it changes
+		};
+
+		/// @brief Packs an element number and DDI into a single key for the index
+		/// @param[in] elementNumber The element number of the variable
+		/// @param[in] ddi The DDI of the variable
+		/// @returns A key that uniquely identifies the variable
+		static std::uint32_t get_key(std::uint16_t elementNumber, std::uint16_t ddi);
+
+		/// @brief Finds a variable in the store
+		/// @param[in] elementNumber The element number of the variable
+		/// @param[in] ddi The DDI of the variable
+		/// @returns The index of the variable in entries, or NO_ENTRY if it is not in the store
+		std::uint32_t find_entry(std::uint16_t elementNumber, std::uint16_t ddi) const;
+
+		static constexpr std::uint32_t NO_ENTRY = 0xFFFFFFFF; ///< Marks an empty changed values queue slot, or a variable that isn't in the store
+
+		std::deque<Entry> entries; ///< The variables, which a deque keeps at a fixed address as more are added
+		std::unordered_map<std::uint32_t, std::uint32_t> entryIndex; ///< Maps a key from get_key to an index in entries
+		std::unique_ptr<std::atomic<std::uint32_t>[]> changedQueue; ///< A ring of entry indices, which can never overflow since each entry is in it at most once
+		std::uint32_t changedQueueMask = 0; ///< The size of the changed queue minus 1, the size being a power of two
+		std::atomic<std::uint32_t> changedQueueWriteIndex = { 0 }; ///< The next changed queue slot a writer will claim
+		std::uint32_t changedQueueReadIndex = 0; ///< The next changed queue slot the consumer will read
+		std::atomic<void (*)(void *parentPointer)> valueChangedCallback = { nullptr }; ///< Called when a variable is queued as changed
+		std::atomic<void *> valueChangedParent = { nullptr }; ///< The context variable passed to valueChangedCallback
+	};
+} // namespace isobus
+
+#endif // ISOBUS_PROCESS_DATA_VALUE_STORE_HPP
@@ -616,6 +616,7 @@ namespace isobus
 		/// @returns true if the message was sent, otherwise false
 		bool send_machine_selected_speed_command() const;
 
+		CANNetworkManager &network; ///< The network manager of the interface's control function
 		ProcessingFlags txFlags; ///< Tx flag for sending messages periodically
 		EventDispatcher<const std::shared_ptr<WheelBasedMachineSpeedData>, bool> wheelBasedMachineSpeedDataEventPublisher; ///< An event publisher for notifying when new wheel-based speed messages are received
 		EventDispatcher<const std::shared_ptr<MachineSelectedSpeedData>, bool> machineSelectedSpeedDataEventPublisher; ///< An event publisher for notifying when new machine selected speed messages are received
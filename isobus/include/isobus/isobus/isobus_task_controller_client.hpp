@@ -13,14 +13,21 @@
 #include "isobus/isobus/can_partnered_control_function.hpp"
 #include "isobus/isobus/isobus_device_descriptor_object_pool.hpp"
 #include "isobus/isobus/isobus_language_command_interface.hpp"
+#include "isobus/isobus/isobus_process_data_value_store.hpp"
+#include "isobus/isobus/isobus_standard_data_description_indices.hpp"
 #include "isobus/utility/processing_flags.hpp"
 
+#include <atomic>
 #include <list>
+#include <map>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
 
 namespace isobus
 {
 	class VirtualTerminalClient; // Forward declaring VT client
+	class TaskControllerClientExecutor; // Forward declaring the executor
 
 	/// @brief A class to manage a client connection to a ISOBUS field computer's task controller or data logger
 	class TaskControllerClient
@@ -137,6 +144,75 @@ namespace isobus
 		/// @param[in] parentPointer parent pointer associated to the callback being removed
 		void remove_value_command_callback(ValueCommandCallback callback, void *parentPointer);
 
+		/// @brief Adds a callback that will be called when the TC requests the value of one specific variable
+		/// @details Routed callbacks are looked up by element number and DDI, so they are found without
+		/// calling every callback added with the other version of this function. They are called before
+		/// those general callbacks, which are only called if no routed callback provides the value.
+		/// @param[in] elementNumber The element number of the variable the callback provides
+		/// @param[in] ddi The DDI of the variable the callback provides
+		/// @param[in] callback The callback to add
+		/// @param[in] parentPointer A generic context variable that will be passed into the associated callback when it gets called
+		void add_request_value_callback(std::uint16_t elementNumber, std::uint16_t ddi, RequestValueCommandCallback callback, void *parentPointer);
+
+		/// @brief Adds a callback that will be called when the TC requests the value of any variable in a range of DDIs on one element
+		/// @details This is the same as adding the callback for each DDI from firstDDI to lastDDI, such as
+		/// for the 16 DDIs of a condensed work state.
+		/// @param[in] elementNumber The element number of the variables the callback provides
+		/// @param[in] firstDDI The first DDI the callback provides
+		/// @param[in] lastDDI The last DDI the callback provides (inclusive)
+		/// @param[in] callback The callback to add
+		/// @param[in] parentPointer A generic context variable that will be passed into the associated callback when it gets called
+		void add_request_value_callback(std::uint16_t elementNumber, std::uint16_t firstDDI, std::uint16_t lastDDI, RequestValueCommandCallback callback, void *parentPointer);
+
+		/// @brief Adds a callback that will be called when the TC commands a new value for one specific variable
+		/// @details Routed callbacks are looked up by element number and DDI, so high rate commands like section
+		/// control set points go straight to the callback that owns them. They are called before the general callbacks,
+		/// which are only called if no routed callback handles the command.
+		/// @param[in] elementNumber The element number of the variable the callback handles
+		/// @param[in] ddi The DDI of the variable the callback handles
+		/// @param[in] callback The callback to add
+		/// @param[in] parentPointer A generic context variable that will be passed into the associated callback when it gets called
+		void add_value_command_callback(std::uint16_t elementNumber, std::uint16_t ddi, ValueCommandCallback callback, void *parentPointer);
+
+		/// @brief Adds a callback that will be called when the TC commands a new value for any variable in a range of DDIs on one element
+		/// @details This is the same as adding the callback for each DDI from firstDDI to lastDDI.
+		/// @param[in] elementNumber The element number of the variables the callback handles
+		/// @param[in] firstDDI The first DDI the callback handles
+		/// @param[in] lastDDI The last DDI the callback handles (inclusive)
+		/// @param[in] callback The callback to add
+		/// @param[in] parentPointer A generic context variable that will be passed into the associated callback when it gets called
+		void add_value_command_callback(std::uint16_t elementNumber, std::uint16_t firstDDI, std::uint16_t lastDDI, ValueCommandCallback callback, void *parentPointer);
+
+		/// @brief Removes a routed value request callback for one variable
+		/// @param[in] elementNumber The element number the callback was added for
+		/// @param[in] ddi The DDI the callback was added for
+		/// @param[in] callback The callback to remove
+		/// @param[in] parentPointer parent pointer associated to the callback being removed
+		void remove_request_value_callback(std::uint16_t elementNumber, std::uint16_t ddi, RequestValueCommandCallback callback, void *parentPointer);
+
+		/// @brief Removes a routed value request callback for a range of DDIs on one element
+		/// @param[in] elementNumber The element number the callback was added for
+		/// @param[in] firstDDI The first DDI to remove the callback from
+		/// @param[in] lastDDI The last DDI to remove the callback from (inclusive)
+		/// @param[in] callback The callback to remove
+		/// @param[in] parentPointer parent pointer associated to the callback being removed
+		void remove_request_value_callback(std::uint16_t elementNumber, std::uint16_t firstDDI, std::uint16_t lastDDI, RequestValueCommandCallback callback, void *parentPointer);
+
+		/// @brief Removes a routed value command callback for one variable
+		/// @param[in] elementNumber The element number the callback was added for
+		/// @param[in] ddi The DDI the callback was added for
+		/// @param[in] callback The callback to remove
+		/// @param[in] parentPointer parent pointer associated to the callback being removed
+		void remove_value_command_callback(std::uint16_t elementNumber, std::uint16_t ddi, ValueCommandCallback callback, void *parentPointer);
+
+		/// @brief Removes a routed value command callback for a range of DDIs on one element
+		/// @param[in] elementNumber The element number the callback was added for
+		/// @param[in] firstDDI The first DDI to remove the callback from
+		/// @param[in] lastDDI The last DDI to remove the callback from (inclusive)
+		/// @param[in] callback The callback to remove
+		/// @param[in] parentPointer parent pointer associated to the callback being removed
+		void remove_value_command_callback(std::uint16_t elementNumber, std::uint16_t firstDDI, std::uint16_t lastDDI, ValueCommandCallback callback, void *parentPointer);
+
 		/// @brief A convenient way to set all client options at once instead of calling the individual setters
 		/// @details This function sets up the parameters that the client will report to the TC server.
 		/// These parameters should be tailored to your specific application.
@@ -307,11 +383,60 @@ namespace isobus
 		/// @brief Tells the TC client that a value was changed or the TC client needs to command
 		/// a value to the TC server.
 		/// @details If you provide on-change triggers in your DDOP, this is how you can request the TC client
-		/// to update the TC server on the current value of your process data variables.
+		/// to update the TC server on the current value of your process data variables. Variables in
+		/// processDataValues that were added with `sendOnChange` are sent this way automatically.
 		/// @param[in] elementNumber The element number of the process data variable that changed
 		/// @param[in] DDI The DDI of the process data variable that changed
 		void on_value_changed_trigger(std::uint16_t elementNumber, std::uint16_t DDI);
 
+		/// @brief Tells the TC client that a process data value has changed, so that any measurement
+		/// threshold commands the TC has set for it can be checked.
+		/// @details Minimum, maximum and change threshold commands are checked when the TC sends them,
+		/// when a value is published with this function, and then every threshold check interval as a fallback
+		/// (see set_threshold_check_interval). Unlike on_value_changed_trigger, the value is only sent to the TC
+		/// if one of the thresholds it set was crossed.
+		/// @param[in] elementNumber The element number of the process data variable that changed
+		/// @param[in] DDI The DDI of the process data variable that changed
+		void on_value_published(std::uint16_t elementNumber, std::uint16_t DDI);
+
+		/// @brief Sets how often threshold measurement commands are checked when no value is published for them
+		/// @details Set this to 0 to only check thresholds when on_value_published is called, which is the
+		/// cheapest option for clients with a lot of process data. The interval applies to threshold commands
+		/// received after it is set.
+		/// @param[in] interval_ms The threshold check interval in milliseconds, or 0 to disable polling thresholds
+		void set_threshold_check_interval(std::uint32_t interval_ms);
+
+		/// @brief Sets the most process data value messages the client will send to the TC in one update
+		/// @details Values that the client sends because of requests and measurement commands are buffered
+		/// during each update. If the same variable is sent more than once, only its latest value is kept.
+		/// At the end of the update, section control values (work states and condensed work states) are sent
+		/// first, then the rest in the order they were buffered, up to this limit. The remainder is sent on later updates.
+		/// @param[in] numberOfFrames The most value messages to send per update, or 0 for no limit
+		void set_process_data_frames_per_update(std::uint8_t numberOfFrames);
+
+		/// @brief Returns the most process data value messages the client will send to the TC in one update
+		/// @returns The most value messages sent per update, or 0 if there is no limit
+		std::uint8_t get_process_data_frames_per_update() const;
+
+		/// @brief Returns how often threshold measurement commands are checked when no value is published for them
+		/// @returns The threshold check interval in milliseconds, or 0 if thresholds are only checked when a value is published
+		std::uint32_t get_threshold_check_interval() const;
+
+		/// @brief Sets if the client should manage the DDOP's structure and localization labels itself
+		/// @details This only applies to DDOPs supplied as a DeviceDescriptorObjectPool. When enabled, the
+		/// localization label is set from the language command the TC sent, and the structure label is set
+		/// from a hash of the generated DDOP (leaving out both labels) each time the DDOP is generated.
+		/// The same pool always gets the same structure label, and any change to it gets a new one, so
+		/// the TC's stored copy of the pool is reused whenever it still matches, including after the
+		/// client or the TC restarts. Reuploading a pool that hasn't changed is skipped entirely,
+		/// unless the language has changed since the active pool was generated.
+		/// @param[in] enabled Set to true to have the client set the labels, or false to use the labels in the DDOP as-is
+		void set_automatic_ddop_labels(bool enabled);
+
+		/// @brief Returns if the client manages the DDOP's structure and localization labels itself
+		/// @returns true if the client sets the DDOP's labels, otherwise false
+		bool get_automatic_ddop_labels() const;
+
 		/// @brief Sends a broadcast request to TCs to identify themseleves.
 		/// @details Upon receipt of this message, the TC shall display, for a period of 3 s, the TC Number
 		/// @returns `true` if the message was sent, otherwise `false`
@@ -351,9 +476,27 @@ namespace isobus
 		/// yourself at some interval.
 		void update();
 
+		/// @brief Returns how long the client can wait before update needs to be called again
+		/// @details This is meant to be called right after update. It accounts for the client's state machine,
+		/// measurement commands and status message, so an application that calls update itself
+		/// can sleep for this long instead of polling. Receiving a message from the TC, or a change to one of
+		/// your process data values, can make an update due sooner. A TaskControllerClientExecutor takes care of this for you.
+		/// @returns The number of milliseconds until the next update is due, or 0xFFFFFFFF if the client has nothing to wait for
+		std::uint32_t get_time_until_update_due_ms();
+
 		/// @brief Used to determine the language and unit systems in use by the TC server
 		LanguageCommandInterface languageCommandInterface;
 
+		/// @brief Values that the application pushes to the TC client instead of answering request value callbacks
+		/// @details Any process data variable added to this store is read from it when the TC requests its value,
+		/// and when checking measurement commands, without calling your request value callbacks. Whenever
+		/// a stored value changes, its threshold commands are checked automatically (as if on_value_published
+		/// was called), and variables added with `sendOnChange` are sent to the TC (as if on_value_changed_trigger
+		/// was called). Add all variables before calling initialize, then set values from any thread.
+		/// Setting a value doesn't lock anything, except that when the client is added to an executor, the
+		/// first change since the client was last updated briefly locks to wake the executor up.
+		ProcessDataValueStore processDataValues;
+
 	protected:
 		/// @brief Enumerates the different Process Data commands from ISO11783-10 Table B.1
 		enum class ProcessDataCommands : std::uint8_t
@@ -428,10 +571,30 @@ namespace isobus
 		/// @brief Searches the DDOP for a device object and stores that object's structure and localization labels
 		void process_labels_from_ddop();
 
+		/// @brief Generates the binary DDOP from the client's DeviceDescriptorObjectPool, and sets its labels
+		/// if automatic DDOP labels are enabled
+		/// @returns true if the DDOP was generated, otherwise false
+		bool generate_binary_ddop();
+
+		/// @brief Sets the structure label of the generated binary DDOP, and of the pool it was generated from,
+		/// from a hash of the binary that leaves out the structure and localization labels
+		/// @returns true if the label was set, or false if the binary has no device object
+		bool set_structure_label_from_hash();
+
 		/// @brief Processes queued TC requests and commands. Calls the user's callbacks if needed.
 		void process_queued_commands();
 
+		/// @brief Takes values that changed from the process data value store, and publishes
+		/// them or queues them to be sent to the TC
+		void process_changed_values();
+
+		/// @brief Sends the values buffered by queue_value_command during this update, within the frames per update limit
+		void process_outbound_values();
+
 		/// @brief Processes measurement threshold/interval commands
+		/// @details Only time interval commands that are due and threshold commands for values that
+		/// were published (or whose check interval elapsed) are processed, so the cost of each update
+		/// depends on how much work is due rather than how many commands the TC has set.
 		void process_queued_threshold_commands();
 
 		/// @brief Processes a CAN message destined for any TC client
@@ -439,6 +602,16 @@ namespace isobus
 		/// @param[in] parentPointer A context variable to find the relevant TC client class
 		static void process_rx_message(const CANMessage &message, void *parentPointer);
 
+		/// @brief Wakes up the client's executor, if it has one, so that the client is updated as soon as possible
+		/// @details Only the first request since the client was last updated locks anything, later ones just
+		/// find the request flag already set.
+		void request_update();
+
+		/// @brief Called by the process data value store when one of its values changes
+		/// @details This is only registered with the store while the client is added to an executor.
+		/// @param[in] parentPointer A context variable to find the relevant TC client class
+		static void process_value_changed(void *parentPointer);
+
 		/// @brief The callback passed to the network manager's send function to know when a Tx is completed
 		/// @param[in] parameterGroupNumber The parameter group number of the message that was sent
 		/// @param[in] dataLength The number of bytes sent
@@ -563,8 +736,13 @@ namespace isobus
 
 		static constexpr std::uint32_t SIX_SECOND_TIMEOUT_MS = 6000; ///< The startup delay time defined in the standard
 		static constexpr std::uint16_t TWO_SECOND_TIMEOUT_MS = 2000; ///< Used for sending the status message to the TC
+		static constexpr std::uint32_t DEFAULT_THRESHOLD_CHECK_INTERVAL_MS = 100; ///< How often threshold commands are checked by default if no value is published for them
+		static constexpr std::uint32_t STATE_MACHINE_UPDATE_INTERVAL_MS = 50; ///< How often the worker thread updates the client, and how soon work that couldn't be finished is retried
+		static constexpr std::uint8_t DEFAULT_PROCESS_DATA_FRAMES_PER_UPDATE = 32; ///< The default limit on value messages sent per update, about a third of a 250 kbit/s bus at the worker thread's rate
 
 	private:
+		friend class TaskControllerClientExecutor; ///< The executor needs access to the client's worker thread, executor pointer and update request flag
+
 		/// @brief Stores data related to requests and commands from the TC
 		struct ProcessDataCallbackInfo
 		{
@@ -580,6 +758,22 @@ namespace isobus
 			bool thresholdPassed; ///< Used when the structure is being used to track measurement command thresholds to know if the threshold has been passed
 		};
 
+		/// @brief An entry in the measurement schedule, which is kept as a min-heap ordered by due time
+		struct ScheduledMeasurement
+		{
+			std::uint32_t dueTimestamp_ms; ///< The time at which the command should next be processed
+			std::uint32_t processDataKey; ///< Identifies the element number and DDI of the command, see get_process_data_key
+			ProcessDataCommands command; ///< The kind of measurement command this entry is for
+		};
+
+		/// @brief A process data value waiting to be sent to the TC
+		struct OutboundValue
+		{
+			std::uint32_t processDataKey; ///< Identifies the element number and DDI of the value, see get_process_data_key
+			std::uint32_t value; ///< The latest value to send
+			bool highPriority; ///< Set for section control values, which are sent before anything else
+		};
+
 		/// @brief Stores a TC value command callback along with its parent pointer
 		struct RequestValueCommandCallbackInfo
 		{
@@ -602,6 +796,62 @@ namespace isobus
 			void *parent; ///< The parent pointer, generic context value
 		};
 
+		/// @brief Buffers a value to be sent to the TC at the end of the current update
+		/// @details If a value for the same element number and DDI is already buffered, it is replaced.
+		/// @param[in] elementNumber The element number of the value
+		/// @param[in] ddi The DDI of the value
+		/// @param[in] value The value to send
+		void queue_value_command(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t value);
+
+		/// @brief Returns if a DDI is one of the section control work states, which are sent with a higher priority
+		/// @param[in] ddi The DDI to check
+		/// @returns true if the DDI is a work state, condensed work state, or the section control state, otherwise false
+		static bool is_section_control_ddi(std::uint16_t ddi);
+
+		/// @brief Packs an element number and DDI into a single key for the measurement command maps
+		/// @param[in] elementNumber The element number of the process data variable
+		/// @param[in] ddi The DDI of the process data variable
+		/// @returns A key that uniquely identifies the process data variable
+		static std::uint32_t get_process_data_key(std::uint16_t elementNumber, std::uint16_t ddi);
+
+		/// @brief The ordering used to keep the measurement schedule as a min-heap
+		/// @param[in] lhs The first scheduled measurement to compare
+		/// @param[in] rhs The second scheduled measurement to compare
+		/// @returns true if lhs is due after rhs, otherwise false
+		static bool is_measurement_due_later(const ScheduledMeasurement &lhs, const ScheduledMeasurement &rhs);
+
+		/// @brief Adds a measurement command to the schedule, or moves it if it is already scheduled
+		/// @details The schedule holds at most one entry for each command and process data key, so a TC
+		/// that resends or changes a command never leaves a stale entry behind.
+		/// @param[in] command The kind of measurement command to schedule
+		/// @param[in] processDataKey The key of the command's process data variable
+		/// @param[in] dueTimestamp_ms The time at which the command should be processed
+		void schedule_measurement(ProcessDataCommands command, std::uint32_t processDataKey, std::uint32_t dueTimestamp_ms);
+
+		/// @brief Gets the current value of a process data variable, from the process data value
+		/// store if the variable is in it, otherwise from the request value callbacks
+		/// @param[in] elementNumber The element number of the process data variable
+		/// @param[in] ddi The DDI of the process data variable
+		/// @param[out] value The current value of the process data variable
+		/// @returns true if the value was found in the store or provided by a callback, otherwise false
+		bool get_process_data_value(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t &value) const;
+
+		/// @brief Checks the minimum, maximum and change threshold commands for a process data variable,
+		/// and sends its value to the TC if any of them were crossed
+		/// @param[in] processDataKey The key of the process data variable to check
+		void check_threshold_commands(std::uint32_t processDataKey);
+
+		/// @brief Queues a process data variable to have its threshold commands checked, if it has any
+		/// @param[in] processDataKey The key of the process data variable that changed
+		void publish_process_data_key(std::uint32_t processDataKey);
+
+		/// @brief Passes a value command from the TC to the routed callback for its variable, or to the general callbacks
+		/// @param[in] elementNumber The element number of the commanded variable
+		/// @param[in] ddi The DDI of the commanded variable
+		/// @param[in] value The commanded value
+		/// @returns true if a callback handled the command, otherwise false
+		bool dispatch_value_command(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t value) const;
+
 		/// @brief Enumerates the modes that the client may use when dealing with a DDOP
 		enum class DDOPUploadType
 		{
@@ -612,6 +862,7 @@ namespace isobus
 
 		std::shared_ptr<PartneredControlFunction> partnerControlFunction; ///< The partner control function this client will send to
 		std::shared_ptr<InternalControlFunction> myControlFunction; ///< The internal control function the client uses to send from
+		CANNetworkManager &network; ///< The network manager of the client's internal control function
 		std::shared_ptr<VirtualTerminalClient> primaryVirtualTerminal; ///< A pointer to the primary VT. Used for TCs < version 4
 		std::shared_ptr<DeviceDescriptorObjectPool> clientDDOP; ///< Stores the DDOP for upload to the TC (if needed)
 		std::uint8_t const *userSuppliedBinaryDDOP = nullptr; ///< Stores a client-provided DDOP if one was provided
@@ -619,18 +870,28 @@ namespace isobus
 		std::vector<std::uint8_t> generatedBinaryDDOP; ///< Stores the DDOP in binary form after it has been generated
 		std::vector<RequestValueCommandCallbackInfo> requestValueCallbacks; ///< A list of callbacks that will be called when the TC requests a process data value
 		std::vector<ValueCommandCallbackInfo> valueCommandsCallbacks; ///< A list of callbacks that will be called when the TC sets a process data value
+		std::unordered_map<std::uint32_t, std::vector<RequestValueCommandCallbackInfo>> routedRequestValueCallbacks; ///< Value request callbacks for specific variables, by process data key
+		std::unordered_map<std::uint32_t, std::vector<ValueCommandCallbackInfo>> routedValueCommandCallbacks; ///< Value command callbacks for specific variables, by process data key
 		std::list<ProcessDataCallbackInfo> queuedValueRequests; ///< A list of queued value requests that will be processed on the next update
 		std::list<ProcessDataCallbackInfo> queuedValueCommands; ///< A list of queued value commands that will be processed on the next update
-		std::list<ProcessDataCallbackInfo> measurementTimeIntervalCommands; ///< A list of measurement commands that will be processed on a time interval
-		std::list<ProcessDataCallbackInfo> measurementMinimumThresholdCommands; ///< A list of measurement commands that will be processed when the value drops below a threshold
-		std::list<ProcessDataCallbackInfo> measurementMaximumThresholdCommands; ///< A list of measurement commands that will be processed when the value above a threshold
-		std::list<ProcessDataCallbackInfo> measurementOnChangeThresholdCommands; ///< A list of measurement commands that will be processed when the value changes by the specified amount
+		std::map<std::uint32_t, ProcessDataCallbackInfo> measurementTimeIntervalCommands; ///< Measurement commands that will be processed on a time interval, by process data key
+		std::map<std::uint32_t, ProcessDataCallbackInfo> measurementMinimumThresholdCommands; ///< Measurement commands that will be processed when the value drops below a threshold, by process data key
+		std::map<std::uint32_t, ProcessDataCallbackInfo> measurementMaximumThresholdCommands; ///< Measurement commands that will be processed when the value above a threshold, by process data key
+		std::map<std::uint32_t, ProcessDataCallbackInfo> measurementOnChangeThresholdCommands; ///< Measurement commands that will be processed when the value changes by the specified amount, by process data key
+		std::vector<ScheduledMeasurement> measurementSchedule; ///< A min-heap of measurement commands ordered by when they are next due
+		std::vector<std::uint32_t> publishedProcessDataKeys; ///< Process data keys whose threshold commands should be checked on the next update
+		std::vector<OutboundValue> outboundValues; ///< Values waiting to be sent to the TC, at most one per process data key
+		std::unordered_map<std::uint32_t, std::size_t> outboundValueIndex; ///< Maps a process data key to its index in outboundValues
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
 		std::mutex clientMutex; ///< A general mutex to protect data in the worker thread against data accessed by the app or the network manager
 		std::thread *workerThread = nullptr; ///< The worker thread that updates this interface
+		std::mutex executorMutex; ///< Protects the executor pointer, which is used from any thread that wakes the client up
 #endif
+		TaskControllerClientExecutor *executor = nullptr; ///< The executor that updates this client, if it has one
+		std::atomic<bool> updateRequested = { false }; ///< Set when the client has new work for its executor, and cleared when the executor takes it to update
 		std::string ddopStructureLabel; ///< Stores a pre-parsed structure label, helps to avoid processing the whole DDOP during a CAN message callback
 		std::string previousStructureLabel; ///< Stores the last structure label we used, helps to warn the user if they aren't updating the label properly
+		std::uint64_t generatedDDOPHash = 0; ///< The hash the structure label of the generated DDOP was derived from, if automatic DDOP labels are enabled
 		std::array<std::uint8_t, 7> ddopLocalizationLabel = { 0 }; ///< Stores a pre-parsed localization label, helps to avoid processing the whole DDOP during a CAN message callback
 		DDOPUploadType ddopUploadMode = DDOPUploadType::ProgramaticallyGenerated; ///< Determines if DDOPs get generated or raw uploaded
 		StateMachineState currentState = StateMachineState::Disconnected; ///< Tracks the internal state machine's current state
@@ -638,7 +899,9 @@ namespace isobus
 		std::uint32_t statusMessageTimestamp_ms = 0; ///< Timestamp corresponding to the last time we sent a status message to the TC
 		std::uint32_t serverStatusMessageTimestamp_ms = 0; ///< Timestamp corresponding to the last time we received a status message from the TC
 		std::uint32_t userSuppliedBinaryDDOPSize_bytes = 0; ///< The number of bytes in the user provided binary DDOP (if one was provided)
+		std::uint32_t thresholdCheckInterval_ms = DEFAULT_THRESHOLD_CHECK_INTERVAL_MS; ///< How often threshold commands are checked if no value is published for them
 		std::uint8_t numberOfWorkingSetMembers = 1; ///< The number of working set members that will be reported in the working set master message
+		std::uint8_t processDataFramesPerUpdate = DEFAULT_PROCESS_DATA_FRAMES_PER_UPDATE; ///< The most value messages sent to the TC per update, or 0 for no limit
 		std::uint8_t tcStatusBitfield = 0; ///< The last received TC/DL status from the status message
 		std::uint8_t sourceAddressOfCommandBeingExecuted = 0; ///< Source address of client for which the current command is being executed
 		std::uint8_t commandBeingExecuted = 0; ///< The current command the TC is executing as reported in the status message
@@ -661,6 +924,7 @@ namespace isobus
 		bool supportsPeerControlAssignment = false; ///< Determines if the client reports peer control assignment capability to the TC
 		bool supportsImplementSectionControl = false; ///< Determines if the client reports implement section control capability to the TC
 		bool shouldReuploadAfterDDOPDeletion = false; ///< Used to determine how the state machine should progress when updating a DDOP
+		bool automaticDDOPLabels = false; ///< Determines if the client sets the structure and localization labels of generated DDOPs
 	};
 } // namespace isobus
 
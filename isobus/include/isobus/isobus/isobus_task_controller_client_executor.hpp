@@ -0,0 +1,136 @@
+//================================================================================================
+/// @file isobus_task_controller_client_executor.hpp
+///
+/// @brief Drives any number of task controller clients from a shared set of threads.
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#ifndef ISOBUS_TASK_CONTROLLER_CLIENT_EXECUTOR_HPP
+#define ISOBUS_TASK_CONTROLLER_CLIENT_EXECUTOR_HPP
+
+#include "isobus/isobus/isobus_task_controller_client.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+namespace isobus
+{
+	class CANNetworkManager;
+
+	//================================================================================================
+	/// @class TaskControllerClientExecutor
+	///
+	/// @brief Updates many task controller clients from one thread, or a small pool of threads
+	/// @details Instead of each client polling from its own worker thread, clients added to an executor
+	/// are only updated when they have something to do. A client is woken up straight away when it
+	/// receives a message from its TC, when one of its process data values changes, or when its state
+	/// machine moves on. Otherwise it sleeps until its next deadline, such as a time interval
+	/// measurement or status message being due.
+	///
+	/// Waking a client up only sets a flag on that client, and only locks the executor to notify its
+	/// threads when one of them is asleep, so setting process data values stays cheap.
+	///
+	/// Initialize each client with `initialize(false)` before adding it, so that it doesn't spawn its own
+	/// worker thread. A client is never updated by two threads at once.
+	///
+	/// An executor with no threads doesn't update anything by itself. Call update periodically
+	/// instead, for example from the application's main loop, or on platforms without threads.
+	//================================================================================================
+	class TaskControllerClientExecutor
+	{
+	public:
+		/// @brief Constructs an executor, and starts its threads
+		/// @param[in] numberOfThreads The number of threads to update clients from, or 0 to only update clients when update is called
+		explicit TaskControllerClientExecutor(std::size_t numberOfThreads = 1);
+
+		/// @brief Stops the executor's threads and removes all clients
+		~TaskControllerClientExecutor();
+
+		/// @brief Deleted copy constructor, since the executor owns threads
+		TaskControllerClientExecutor(const TaskControllerClientExecutor &) = delete;
+
+		/// @brief Deleted assignment operator, since the executor owns threads
+		/// @returns Nothing, since this is deleted
+		TaskControllerClientExecutor &operator=(const TaskControllerClientExecutor &) = delete;
+
+		/// @brief Adds a client for the executor to update
+		/// @param[in] client The client to update, which must not have its own worker thread
+		/// @returns true if the client was added, or false if it is null, already added to an executor, or has its own worker thread
+		bool add_client(std::shared_ptr<TaskControllerClient> client);
+
+		/// @brief Stops updating a client
+		/// @details If the client is being updated on another thread, this waits for that update to finish.
+		/// @param[in] client The client to remove
+		/// @returns true if the client was removed, or false if it wasn't added to this executor
+		bool remove_client(std::shared_ptr<TaskControllerClient> client);
+
+		/// @brief Returns the number of clients the executor is updating
+		/// @returns The number of clients added to the executor
+		std::size_t get_number_of_clients() const;
+
+		/// @brief Returns the number of threads the executor updates clients from
+		/// @returns The number of threads, which is 0 if the application calls update itself
+		std::size_t get_number_of_threads() const;
+
+		/// @brief Updates every client that is due, from the calling thread
+		/// @details This is only needed for an executor without threads.
+		/// @returns The number of milliseconds until the next client is due, which is the longest the caller should wait before calling this again
+		std::uint32_t update();
+
+	private:
+		friend class TaskControllerClient;
+
+		/// @brief Stores a client and when it next needs to be updated
+		struct ScheduledClient
+		{
+			std::shared_ptr<TaskControllerClient> client; ///< The client to update
+			std::uint32_t dueTimestamp_ms; ///< The time the client next needs to be updated
+			bool updating; ///< Set while a thread is updating the client
+		};
+
+		/// @brief Wakes up any sleeping threads, so they look for clients with new work. Called by a client
+		/// after setting its update request flag.
+		void wake_up();
+
+		/// @brief Finds a client that is due and marks it as being updated
+		/// @details Clients are checked round robin, so a busy client can't keep the others waiting.
+		/// @param[out] dueClient The client that is due, if there is one
+		/// @returns true if a client is due, otherwise false
+		bool take_due_client(ScheduledClient &dueClient);
+
+		/// @brief Returns how long until the next client that isn't being updated is due
+		/// @returns The number of milliseconds until the next client is due, at most MAX_WAIT_TIME_MS
+		std::uint32_t get_time_until_next_client_due_ms() const;
+
+		/// @brief Updates a client that was taken with take_due_client, then schedules its next update
+		/// @param[in] dueClient The client to update
+		void update_client(const ScheduledClient &dueClient);
+
+		/// @brief The function each of the executor's threads runs
+		void worker_thread_function();
+
+		static constexpr std::uint32_t MAX_WAIT_TIME_MS = 1000; ///< The longest the executor sleeps, in case a client has work that didn't wake it
+
+		std::vector<ScheduledClient> clients; ///< The clients being updated
+		std::size_t nextClientIndex = 0; ///< Where take_due_client starts looking for a due client
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		std::vector<std::thread> workerThreads; ///< The threads that update clients
+		mutable std::mutex executorMutex; ///< Protects the clients, and is never held while a client is updated
+		std::condition_variable wakeupCondition; ///< Wakes up threads when a client has new work, or has finished updating
+#endif
+		std::atomic<std::size_t> numberOfSleepingThreads = { 0 }; ///< The number of threads that may be waiting on wakeupCondition
+		bool shouldStop = false; ///< Tells the threads to exit
+	};
+} // namespace isobus
+
+#endif // ISOBUS_TASK_CONTROLLER_CLIENT_EXECUTOR_HPP
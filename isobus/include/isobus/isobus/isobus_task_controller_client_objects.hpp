@@ -9,13 +9,19 @@
 #ifndef ISOBUS_TASK_CONTROLLER_CLIENT_OBJECTS_HPP
 #define ISOBUS_TASK_CONTROLLER_CLIENT_OBJECTS_HPP
 
+#include "isobus/isobus/can_badge.hpp"
+
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace isobus
 {
+	class DeviceDescriptorObjectPool;
+
 	/// @brief A namespace that contains the generic task controller objects
 	namespace task_controller_object
 	{
@@ -57,6 +63,11 @@ namespace isobus
 			/// @param[in] id The object ID to set. IDs must be unique in the DDOP and less than or equal to MAX_OBJECT_ID
 			void set_object_id(std::uint16_t id);
 
+			/// @brief Sets the counter of the pool this object is in, which set_object_id increments
+			/// @details The pool uses the counter to know when its object ID index has to be rebuilt.
+			/// @param[in] counter The pool's object ID change counter, which the object keeps if it is removed from the pool
+			void set_object_id_change_counter(std::shared_ptr<std::uint32_t> counter, CANLibBadge<DeviceDescriptorObjectPool>);
+
 			/// @brief Returns the XML namespace for the object
 			/// @returns the XML namespace for the object
 			virtual std::string get_table_id() const = 0;
@@ -65,9 +76,19 @@ namespace isobus
 			/// @returns The derived TC object type for this object
 			virtual ObjectTypes get_object_type() const = 0;
 
-			/// @brief Returns the binary representation of the TC object, or an empty vector if object is invalid
-			/// @returns The binary representation of the TC object, or an empty vector if object is invalid
-			virtual std::vector<std::uint8_t> get_binary_object() const = 0;
+			/// @brief Returns the binary representation of the TC object
+			/// @details This allocates a new vector for the object. To serialize many objects into one
+			/// buffer, use get_binary_object_size and append_binary_object instead.
+			/// @returns The binary representation of the TC object
+			std::vector<std::uint8_t> get_binary_object() const;
+
+			/// @brief Returns the exact number of bytes append_binary_object will add for this object
+			/// @returns The size of the binary representation of the TC object, in bytes
+			virtual std::size_t get_binary_object_size() const = 0;
+
+			/// @brief Appends the binary representation of the TC object to the end of a buffer
+			/// @param[in,out] buffer The buffer to append the object to. Reserve space for it first to avoid reallocating.
+			virtual void append_binary_object(std::vector<std::uint8_t> &buffer) const = 0;
 
 			/// @brief The max allowable "valid" object ID
 			static constexpr std::uint16_t MAX_OBJECT_ID = 65534;
@@ -84,6 +105,9 @@ namespace isobus
 		protected:
 			std::string designator; ///< UTF-8 Descriptive text to identify this object. Max length of 32.
 			std::uint16_t objectID; ///< Unique object ID in the DDOP
+
+		private:
+			std::shared_ptr<std::uint32_t> objectIDChangeCounter; ///< Counts ID changes of the objects in the pool this object is in, shared with that pool
 		};
 
 		/// @brief Each device shall have one single DeviceObject in its device descriptor object pool.
@@ -120,9 +144,13 @@ namespace isobus
 			/// @returns The object type for this object (Object::Device)
 			ObjectTypes get_object_type() const override;
 
-			/// @brief Returns the binary representation of the TC object, or an empty vector if object is invalid
-			/// @returns The binary representation of the TC object, or an empty vector if object is invalid
-			std::vector<std::uint8_t> get_binary_object() const override;
+			/// @brief Returns the exact number of bytes append_binary_object will add for this object
+			/// @returns The size of the binary representation of the TC object, in bytes
+			std::size_t get_binary_object_size() const override;
+
+			/// @brief Appends the binary representation of the TC object to the end of a buffer
+			/// @param[in,out] buffer The buffer to append the object to
+			void append_binary_object(std::vector<std::uint8_t> &buffer) const override;
 
 			/// @brief Returns the software version of the device
 			/// @returns The software version of the device
@@ -241,9 +269,13 @@ namespace isobus
 			/// @returns The object type for this object (Object::DeviceElement)
 			ObjectTypes get_object_type() const override;
 
-			/// @brief Returns the binary representation of the TC object, or an empty vector if object is invalid
-			/// @returns The binary representation of the TC object, or an empty vector if object is invalid
-			std::vector<std::uint8_t> get_binary_object() const override;
+			/// @brief Returns the exact number of bytes append_binary_object will add for this object
+			/// @returns The size of the binary representation of the TC object, in bytes
+			std::size_t get_binary_object_size() const override;
+
+			/// @brief Appends the binary representation of the TC object to the end of a buffer
+			/// @param[in,out] buffer The buffer to append the object to
+			void append_binary_object(std::vector<std::uint8_t> &buffer) const override;
 
 			/// @brief Returns the element number
 			/// @returns The element number
@@ -341,9 +373,13 @@ namespace isobus
 			/// @returns The object type for this object (Object::DeviceProcessData)
 			ObjectTypes get_object_type() const override;
 
-			/// @brief Returns the binary representation of the TC object, or an empty vector if object is invalid
-			/// @returns The binary representation of the TC object, or an empty vector if object is invalid
-			std::vector<std::uint8_t> get_binary_object() const override;
+			/// @brief Returns the exact number of bytes append_binary_object will add for this object
+			/// @returns The size of the binary representation of the TC object, in bytes
+			std::size_t get_binary_object_size() const override;
+
+			/// @brief Appends the binary representation of the TC object to the end of a buffer
+			/// @param[in,out] buffer The buffer to append the object to
+			void append_binary_object(std::vector<std::uint8_t> &buffer) const override;
 
 			/// @brief Returns the DDI
 			/// @returns the DDI for this property
@@ -414,9 +450,13 @@ namespace isobus
 			/// @returns The object type for this object (Object::DeviceProperty)
 			ObjectTypes get_object_type() const override;
 
-			/// @brief Returns the binary representation of the TC object, or an empty vector if object is invalid
-			/// @returns The binary representation of the TC object, or an empty vector if object is invalid
-			std::vector<std::uint8_t> get_binary_object() const override;
+			/// @brief Returns the exact number of bytes append_binary_object will add for this object
+			/// @returns The size of the binary representation of the TC object, in bytes
+			std::size_t get_binary_object_size() const override;
+
+			/// @brief Appends the binary representation of the TC object to the end of a buffer
+			/// @param[in,out] buffer The buffer to append the object to
+			void append_binary_object(std::vector<std::uint8_t> &buffer) const override;
 
 			/// @brief Returns the property's value
 			/// @returns The property's value
@@ -479,9 +519,13 @@ namespace isobus
 			/// @returns The object type for this object (Object::DeviceValuePresentation)
 			ObjectTypes get_object_type() const override;
 
-			/// @brief Returns the binary representation of the TC object, or an empty vector if object is invalid
-			/// @returns The binary representation of the TC object, or an empty vector if object is invalid
-			std::vector<std::uint8_t> get_binary_object() const override;
+			/// @brief Returns the exact number of bytes append_binary_object will add for this object
+			/// @returns The size of the binary representation of the TC object, in bytes
+			std::size_t get_binary_object_size() const override;
+
+			/// @brief Appends the binary representation of the TC object to the end of a buffer
+			/// @param[in,out] buffer The buffer to append the object to
+			void append_binary_object(std::vector<std::uint8_t> &buffer) const override;
 
 			/// @brief Returns the offset that is applied to the value for presentation
 			/// @returns The offset that is applied to the value for presentation
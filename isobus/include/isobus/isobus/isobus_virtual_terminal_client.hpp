@@ -9,20 +9,27 @@
 #ifndef ISOBUS_VIRTUAL_TERMINAL_CLIENT_HPP
 #define ISOBUS_VIRTUAL_TERMINAL_CLIENT_HPP
 
+#include "isobus/isobus/can_constants.hpp"
+#include "isobus/isobus/can_identifier.hpp"
 #include "isobus/isobus/can_internal_control_function.hpp"
 #include "isobus/isobus/can_partnered_control_function.hpp"
 #include "isobus/isobus/isobus_language_command_interface.hpp"
 #include "isobus/isobus/isobus_virtual_terminal_objects.hpp"
 #include "isobus/utility/event_dispatcher.hpp"
+#include "isobus/utility/iop_file_interface.hpp"
 #include "isobus/utility/processing_flags.hpp"
 
+#include <array>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+#include <atomic>
+#include <mutex>
 #include <thread>
 #endif
 
@@ -440,6 +447,20 @@ namespace isobus
 			std::uint16_t value2; ///< The second value
 		};
 
+		/// @brief A summary of how commands are being paced to the VT server the client is connected to
+		struct CommandStatistics
+		{
+			std::uint64_t commandsSent; ///< The number of commands sent that the VT server should respond to
+			std::uint64_t responsesReceived; ///< The number of those commands the VT server has responded to
+			std::uint64_t responseTimeouts; ///< The number of commands the VT server did not respond to in time
+			std::uint32_t responsesPerSecond; ///< The number of responses received during the last second
+			std::uint32_t smoothedRoundTripTime_us; ///< The moving average of the time between sending a command and its response
+			std::uint32_t minimumRoundTripTime_us; ///< The fastest response seen from this VT server
+			std::uint32_t maximumRoundTripTime_us; ///< The slowest response seen from this VT server
+			std::uint8_t windowSize; ///< The number of commands currently allowed to wait for a response at once
+			std::uint8_t commandsInFlight; ///< The number of commands currently waiting for a response
+		};
+
 		/// @brief Add a listener for when a soft key is pressed or released
 		/// @param[in] callback The callback to be invoked
 		/// @returns A shared pointer to the callback, which must be kept alive for as long as the callback is needed
@@ -535,9 +556,23 @@ namespace isobus
 		// Command Messages
 		/// @brief Set whether the client should queue commands when sending them to the VT server failed first try. (Default: true).
 		/// This can happen if a transport protocol is busy with sending another message.
+		/// While a command is queued, newer commands that change the same object and attribute replace it,
+		/// so a burst of updates to a value only sends the latest one once the VT link is free again.
 		/// @param[in] shouldQueueCommands Whether the client should queue commands when sending them to the VT server failed first try
 		void set_should_queue_commands(const bool shouldQueueCommands);
 
+		/// @brief Set whether the client should limit how many commands wait for a response from the VT server at once (Default: true).
+		/// @details The limit starts at a few commands and adapts to the measured round trip time. While the
+		/// VT responds about as fast as it ever has, the limit grows, and when responses slow down or time out
+		/// it is halved. Commands over the limit wait in the command queue, so this has no effect if queueing is disabled.
+		/// @param[in] shouldPaceCommands Whether the client should limit the number of commands waiting for a response
+		void set_should_pace_commands(const bool shouldPaceCommands);
+
+		/// @brief Returns the throughput and round trip time of commands sent to the VT server
+		/// @details The statistics are reset each time the client starts connecting to a VT server.
+		/// @returns A snapshot of the command statistics
+		CommandStatistics get_command_statistics() const;
+
 		/// @brief Sends a hide/show object command
 		/// @details This command is used to hide or show a Container object.
 		/// This pertains to the visibility of the object as well as its
@@ -1177,6 +1212,36 @@ namespace isobus
 		                     const std::vector<std::uint8_t> *pool,
 		                     std::string version = "");
 
+		/// @brief Assigns an object pool to the client using a memory mapped IOP file.
+		/// @details The pool is uploaded directly from the mapping without being copied into RAM first,
+		/// which is the fastest way to load large pools from IOP files.
+		/// @param[in] poolIndex The index of the pool you are assigning
+		/// @param[in] poolSupportedVTVersion The VT version of the object pool
+		/// @param[in] pool A pointer to the mapped object pool. Must remain valid until client is connected!
+		/// @param[in] version An optional version string. The stack will automatically store/load your pool from the VT if this is provided.
+		void set_object_pool(std::uint8_t poolIndex,
+		                     VTVersion poolSupportedVTVersion,
+		                     const MappedIOPFile *pool,
+		                     std::string version = "");
+
+		/// @brief Assigns an object pool to the client that the client is allowed to modify.
+		/// @details If auto-scaling is configured for this pool it is scaled in place, rather than first
+		/// being copied into RAM, and is then uploaded straight from your buffer. After scaling, the pool's
+		/// scaling configuration is updated to the geometry of the VT it was scaled for, so reconnecting to
+		/// the same VT does not scale it again, and connecting to a different VT rescales it from there.
+		/// @note Each rescale rounds coordinates again, so prefer set_object_pool if your application
+		/// will move between VTs with different resolutions often.
+		/// @param[in] poolIndex The index of the pool you are assigning
+		/// @param[in] poolSupportedVTVersion The VT version of the object pool
+		/// @param[in] pool A pointer to the object pool. Must remain valid until client is connected!
+		/// @param[in] size The object pool size
+		/// @param[in] version An optional version string. The stack will automatically store/load your pool from the VT if this is provided.
+		void set_mutable_object_pool(std::uint8_t poolIndex,
+		                             VTVersion poolSupportedVTVersion,
+		                             std::uint8_t *pool,
+		                             std::uint32_t size,
+		                             std::string version = "");
+
 		/// @brief Configures an object pool to be automatically scaled to match the target VT server
 		/// @param[in] poolIndex The index of the pool you want to auto-scale
 		/// @param[in] originalDataMaskDimensions_px The data mask width that your object pool was originally designed for
@@ -1185,6 +1250,52 @@ namespace isobus
 		                             std::uint32_t originalDataMaskDimensions_px,
 		                             std::uint32_t originalSoftKyeDesignatorHeight_px);
 
+		/// @brief Enables an on-disk cache of auto-scaled object pools
+		/// @details When set, every pool that is auto-scaled is saved to this directory, keyed by a hash of the
+		/// original pool, its scaling configuration, and the VT's screen size, soft key size, fonts and version.
+		/// On later connections to a VT with the same properties the scaled pool is memory mapped from the
+		/// cache and uploaded directly, skipping the scaling step. Pools assigned with set_mutable_object_pool
+		/// are not cached, since they are scaled in place.
+		/// @param[in] directory An existing, writable directory to store scaled pools in, or an empty string to disable the cache
+		void set_scaled_object_pool_cache_directory(const std::string &directory);
+
+		/// @brief Returns the directory used to cache scaled object pools
+		/// @returns The cache directory, or an empty string if the cache is disabled
+		std::string get_scaled_object_pool_cache_directory() const;
+
+		/// @brief Enables uploading only the objects that changed since a version of the pool the VT already has
+		/// @details When set, and a version label is assigned to the first pool, the client saves a hash of every
+		/// object it uploads to this directory once the VT has stored the pool. If the pool's label later changes,
+		/// for example after a software update, and the VT still has a version that was saved this way, that
+		/// version is loaded and only the objects that were added or changed are transferred on top of it.
+		/// The result is stored under the new label and the old version is deleted from the VT.
+		/// Objects removed from the pool remain in the VT's copy, but are never referenced.
+		/// The index is saved per VT, since each VT may be sent a differently scaled pool.
+		/// @param[in] directory An existing, writable directory to store object indexes in, or an empty string to always upload the full pool
+		void set_object_pool_delta_upload_directory(const std::string &directory);
+
+		/// @brief Returns the directory used to store the object indexes for delta uploads
+		/// @returns The object index directory, or an empty string if delta uploads are disabled
+		std::string get_object_pool_delta_upload_directory() const;
+
+		/// @brief Configures how the picture graphics in an object pool are compressed before upload
+		/// @details Picture graphics are processed after any auto-scaling, and only if doing so makes them
+		/// smaller. Run length encoding is applied to pictures that are not already encoded. Colour depth
+		/// reduction repacks 8 bit pictures that only use colours 0 and 1 as monochrome, and pictures that
+		/// only use the first 16 colours as 4 bit, if the VT supports at least 16 colours. Pools that contain
+		/// a Colour Map object are never colour reduced, since the map may not treat every format alike.
+		/// Optimized pools are held in RAM for upload, so pools registered with a data chunk callback are
+		/// read into memory in full.
+		/// @param[in] poolIndex The index of the pool to optimize
+		/// @param[in] runLengthEncode Set to true to run length encode picture graphics
+		/// @param[in] reduceColourDepth Set to true to store pictures in the smallest format their colours allow
+		void set_object_pool_picture_optimization(std::uint8_t poolIndex, bool runLengthEncode, bool reduceColourDepth);
+
+		/// @brief Returns how many bytes picture optimization removed from an object pool
+		/// @param[in] poolIndex The index of the pool to check
+		/// @returns The number of bytes saved the last time the pool was prepared for upload
+		std::uint32_t get_object_pool_bytes_saved(std::uint8_t poolIndex) const;
+
 		/// @brief Assigns an object pool to the client where the client will get data in chunks during upload.
 		/// @details This is probably better for huge pools if you are RAM constrained, or if your
 		/// pool is stored on some external device that you need to get data from in pages.
@@ -1331,13 +1442,19 @@ namespace isobus
 		struct ObjectPoolDataStruct
 		{
 			const std::uint8_t *objectPoolDataPointer; ///< A pointer to an object pool
+			std::uint8_t *mutableObjectPoolPointer = nullptr; ///< A pointer to an object pool that may be scaled in place
 			const std::vector<std::uint8_t> *objectPoolVectorPointer; ///< A pointer to an object pool (vector format)
-			std::vector<std::uint8_t> scaledObjectPool; ///< Stores a copy of a pool to auto-scale in RAM before uploading it
+			std::vector<std::uint8_t> scaledObjectPool; ///< Stores a copy of a pool that has been auto-scaled or optimized in RAM before uploading it
+			MappedIOPFile cachedScaledObjectPool; ///< A scaled copy of the pool loaded from the scaling cache, used instead of scaling it again
 			DataChunkCallback dataCallback; ///< A callback used to get data in chunks as an alternative to loading the whole pool at once
 			std::string versionLabel; ///< An optional version label that will be used to load/store the pool to the VT. 7 character max!
 			std::uint32_t objectPoolSize; ///< The size of the object pool
 			std::uint32_t autoScaleDataMaskOriginalDimension; ///< The original length or width of this object pool's data mask area (in pixels)
 			std::uint32_t autoScaleSoftKeyDesignatorOriginalHeight; ///< The original height of a soft key designator as designed in the pool (in pixels)
+			std::uint32_t pictureBytesSaved = 0; ///< The number of bytes removed from the pool by picture optimization
+			bool runLengthEncodePictures = false; ///< Determines if picture graphics are run length encoded before upload
+			bool reducePictureColourDepth = false; ///< Determines if picture graphics are stored in the smallest format their colours allow
+			bool uploadingDelta = false; ///< Determines if scaledObjectPool holds only the objects that changed since the loaded version
 			bool useDataCallback; ///< Determines if the client will use callbacks to get the data in chunks.
 			bool uploaded; ///< The upload state of this pool
 		};
@@ -1350,6 +1467,32 @@ namespace isobus
 			std::vector<AssignedAuxiliaryFunction> functions; ///< The functions assigned to this auxiliary input device (only applicable for listeners of input)
 		};
 
+		/// @brief A command waiting in the command queue to be sent to the VT server
+		/// @details Commands that fit in a single CAN frame are stored inline, so queueing the
+		/// usual burst of value updates does not allocate once the queue has grown to size.
+		struct QueuedCommand
+		{
+			std::array<std::uint8_t, CAN_DATA_LENGTH> inlineData; ///< The command's data, if it fits in a single frame
+			std::vector<std::uint8_t> extendedData; ///< The command's data, if it needs a transport protocol
+			std::uint64_t key; ///< Identifies the function, object and attribute the command changes, see get_command_coalescing_key
+			std::uint32_t length; ///< The number of bytes in the command
+			bool coalescable; ///< If a newer command with the same key replaces this one instead of being queued behind it
+		};
+
+		/// @brief Where a coalescable command is in the command queue
+		struct QueuedCommandLocation
+		{
+			std::uint8_t priority; ///< The priority level the command was queued at
+			std::size_t index; ///< The position of the command within its priority level
+		};
+
+		/// @brief A command that was sent to the VT server and is waiting for its response
+		struct InFlightCommand
+		{
+			std::uint64_t timestamp_us; ///< When the command was sent
+			std::uint8_t functionCode; ///< The function code of the command, which the response will echo
+		};
+
 		/// @brief Struct for storing the state of an auxiliary input on our device
 		struct AuxiliaryInputState
 		{
@@ -1527,10 +1670,120 @@ namespace isobus
 		/// @returns true if any pool has both data mask and softkey scaling configured
 		bool get_any_pool_needs_scaling() const;
 
+		/// @brief Returns if an object pool has scaling configured
+		/// @param[in] objectPool The object pool to check
+		/// @returns true if the pool has both data mask and softkey scaling configured
+		static bool get_pool_needs_scaling(const ObjectPoolDataStruct &objectPool);
+
 		/// @brief Iterates through each object pool and scales each object in the pool automatically
+		/// @details Scaling is done in two passes. The first finds where every object starts, and the
+		/// second resizes the objects, which are independent of each other, split across worker threads.
 		/// @returns true if all object pools scaled with no error
 		bool scale_object_pools();
 
+		/// @brief Works out where a scaled copy of an object pool would be stored in the scaling cache
+		/// @details The cache key is made of a content hash of the original pool and every parameter
+		/// that affects scaling. The file name is a hash of the key, and the key itself is stored
+		/// after the scaled pool in the cache file so it can be checked when the file is loaded.
+		/// @param[in] objectPool The object pool to get the cache path for
+		/// @param[out] path The path to the cache file for the pool scaled for the connected VT
+		/// @param[out] cacheKey The key a cache file at that path must contain to be used
+		/// @returns true if the path was determined, false if the original pool could not be read
+		bool get_scaled_object_pool_cache_path(const ObjectPoolDataStruct &objectPool, std::string &path, std::vector<std::uint8_t> &cacheKey);
+
+		/// @brief Checks that a cache file holds a scaled copy of a pool for a specific cache key
+		/// @details A valid file is the scaled pool, followed by the cache key, followed by a hash of the scaled pool.
+		/// @param[in] cachedPool The mapped cache file
+		/// @param[in] poolSize The size of the object pool in bytes
+		/// @param[in] cacheKey The key that the file must have been written with
+		/// @returns true if the file matches the key and its contents are intact
+		static bool get_is_scaled_object_pool_cache_valid(const MappedIOPFile &cachedPool, std::uint32_t poolSize, const std::vector<std::uint8_t> &cacheKey);
+
+		/// @brief Finds the start of every object in an object pool
+		/// @param[in] pool A pointer to the object pool
+		/// @param[in] size The size of the object pool in bytes
+		/// @param[out] objectOffsets The offset of each object in the pool
+		/// @returns true if the pool was parsed to the end without error
+		static bool index_object_pool(const std::uint8_t *pool, std::uint32_t size, std::vector<std::uint32_t> &objectOffsets);
+
+		/// @brief Returns the number of bytes that will be sent to the VT for an object pool
+		/// @param[in] objectPool The object pool to check
+		/// @returns The size of the optimized or scaled copy of the pool if there is one, otherwise the size of the pool
+		static std::uint32_t get_object_pool_upload_size(const ObjectPoolDataStruct &objectPool);
+
+		/// @brief Returns a pointer to the data that will be uploaded for an object pool
+		/// @details Pools that are only available through a data chunk callback are read into RAM
+		/// @param[in] objectPool The object pool to get the data of
+		/// @returns A pointer to get_object_pool_upload_size bytes of pool data, or nullptr if the pool could not be read
+		const std::uint8_t *get_object_pool_upload_data(ObjectPoolDataStruct &objectPool);
+
+		/// @brief Hashes every object about to be uploaded, and if a stored version was loaded as the base
+		/// for a delta upload, reduces each pool to the objects that differ from that version
+		/// @details Must be called after scaling and picture optimization, since it works on the final pool data
+		void prepare_object_pool_delta();
+
+		/// @brief Works out where the object index for a version stored on the connected VT is saved
+		/// @param[in] versionLabel The 7 character version label
+		/// @returns The path to the object index file
+		std::string get_object_pool_delta_index_path(const std::string &versionLabel) const;
+
+		/// @brief Saves the object index of the pool that was just stored, and deletes the version it replaced
+		void on_object_pool_version_stored();
+
+		/// @brief Pads or truncates a version label to the 7 characters used by the VT
+		/// @param[in] versionLabel The version label to pad
+		/// @returns The padded version label
+		static std::string get_padded_version_label(const std::string &versionLabel);
+
+		/// @brief Applies picture optimization to each object pool that has it configured
+		/// @details Must be called after scale_object_pools, since it works on the scaled copy of each pool.
+		/// A pool that can't be optimized is logged and uploaded as it is.
+		void optimize_object_pools();
+
+		/// @brief Rewrites an object pool with its picture graphics compressed
+		/// @param[in] pool A pointer to the object pool
+		/// @param[in] size The size of the object pool in bytes
+		/// @param[in] runLengthEncode Set to true to run length encode picture graphics
+		/// @param[in] reduceColourDepth Set to true to store pictures in the smallest format their colours allow
+		/// @param[in] graphicMode The graphics mode of the VT the pool will be uploaded to
+		/// @param[out] optimizedPool The rewritten object pool
+		/// @returns true if the pool was parsed to the end without error
+		static bool optimize_object_pool(const std::uint8_t *pool,
+		                                 std::uint32_t size,
+		                                 bool runLengthEncode,
+		                                 bool reduceColourDepth,
+		                                 GraphicMode graphicMode,
+		                                 std::vector<std::uint8_t> &optimizedPool);
+
+		/// @brief Appends a picture graphic object to a pool, compressed if that makes it smaller
+		/// @param[in] object A pointer to the start of the picture graphic object
+		/// @param[in] objectSize The total number of bytes in the object
+		/// @param[in] runLengthEncode Set to true to run length encode the raw data
+		/// @param[in] reduceColourDepth Set to true to store the picture in the smallest format its colours allow
+		/// @param[in] graphicMode The graphics mode of the VT the pool will be uploaded to
+		/// @param[out] optimizedPool The pool to append the object to
+		static void optimize_picture_graphic(const std::uint8_t *object,
+		                                     std::uint32_t objectSize,
+		                                     bool runLengthEncode,
+		                                     bool reduceColourDepth,
+		                                     GraphicMode graphicMode,
+		                                     std::vector<std::uint8_t> &optimizedPool);
+
+		/// @brief Run length encodes picture graphic raw data as pairs of a repeat count and a value
+		/// @param[in] data A pointer to the data to encode
+		/// @param[in] size The number of bytes to encode
+		/// @param[out] encodedData The encoded data
+		static void run_length_encode(const std::uint8_t *data, std::uint32_t size, std::vector<std::uint8_t> &encodedData);
+
+		/// @brief Resizes a range of objects in an object pool
+		/// @param[in] pool A pointer to the object pool
+		/// @param[in] objectOffsets The offsets of the objects to resize
+		/// @param[in] numberOfObjects The number of offsets in objectOffsets to process
+		/// @param[in] dataMaskScaleFactor The scale factor for objects other than soft keys
+		/// @param[in] softKeyScaleFactor The scale factor for soft keys
+		/// @returns true if all objects were resized without error
+		bool resize_objects(std::uint8_t *pool, const std::uint32_t *objectOffsets, std::size_t numberOfObjects, float dataMaskScaleFactor, float softKeyScaleFactor) const;
+
 		/// @brief Returns if the specified object type can be scaled
 		/// @param[in] type The object type to check
 		/// @returns true if the object is inherently scalable
@@ -1553,10 +1806,18 @@ namespace isobus
 		/// @returns The minimum number of bytes that the specified object might use
 		static std::uint32_t get_minimum_object_length(VirtualTerminalObjectType type);
 
+		/// @brief Returns if enough of a VT object is in a buffer to find the object's total length
+		/// @details This is the object's fixed length, plus the value of string objects, which comes
+		/// before their list of macros.
+		/// @param[in] buffer A pointer to the start of the VT object
+		/// @param[in] bufferLength The number of bytes available from the start of the object
+		/// @returns true if get_number_bytes_in_object can read the object without going past the end of the buffer
+		static bool get_is_object_length_readable(const std::uint8_t *buffer, std::uint32_t bufferLength);
+
 		/// @brief Returns the total number of bytes in the VT object located at the specified memory location
 		/// @param[in] buffer A pointer to the start of the VT object
 		/// @returns The total number of bytes present in the VT object at the specified location
-		static std::uint32_t get_number_bytes_in_object(std::uint8_t *buffer);
+		static std::uint32_t get_number_bytes_in_object(const std::uint8_t *buffer);
 
 		/// @brief Resizes the most common VT object format by some scale factor
 		/// @param[in] buffer A pointer to the start of the VT object
@@ -1568,37 +1829,87 @@ namespace isobus
 		/// @param[in] scaleFactor The scale factor to scale the object by
 		/// @param[in] type The type of the object to resize. Must match the object located at `buffer`
 		/// @returns true if the object was resized, otherwise false
-		bool resize_object(std::uint8_t *buffer, float scaleFactor, VirtualTerminalObjectType type);
+		bool resize_object(std::uint8_t *buffer, float scaleFactor, VirtualTerminalObjectType type) const;
 
 		/// @brief Sends a command to the VT server
 		/// @param[in] data The data to send, including the function-code
 		/// @returns true if the message was sent successfully
 		bool send_command(const std::vector<std::uint8_t> &data) const;
 
-		/// @brief Tries to send a command to the VT server, and queues it if it fails
+		/// @brief Sends a command to the VT server
 		/// @param[in] data The data to send, including the function-code
-		/// @param[in] replace If true, the message will replace any existing message with the same priority and function-code
-		/// @returns true if the message was sent/queued successfully
-		bool queue_command(const std::vector<std::uint8_t> &data, bool replace = false);
+		/// @param[in] length The number of bytes to send
+		/// @returns true if the message was sent successfully
+		bool send_command(const std::uint8_t *data, std::uint32_t length) const;
 
-		/// @brief Replaces the first message in the queue with the same function-code and priority, and removes the rest
-		/// @note This will not queue a message if one does not already exist.
+		/// @brief Tries to send a command to the VT server, and queues it if it fails
+		/// @details If a command that changes the same object and attribute is already queued, it is
+		/// replaced with this one rather than sending both, see get_command_coalescing_key.
+		/// This is thread safe, so commands can be queued from the application while the update thread sends them.
 		/// @param[in] data The data to send, including the function-code
-		/// @returns true if the message was replaced successfully
-		bool replace_command(const std::vector<std::uint8_t> &data);
+		/// @param[in] priority The queue priority of the command, queued commands with a lower value are sent first
+		/// @returns true if the message was sent/queued successfully
+		bool queue_command(const std::vector<std::uint8_t> &data, CANIdentifier::CANPriority priority = CANIdentifier::CANPriority::PriorityLowest7);
+
+		/// @brief Finds what a command changes, so that queued commands for the same thing can be coalesced
+		/// @details The key is made of the function code, the object ID, and the attribute ID, list index
+		/// or parent object where the command has one. Commands that are not idempotent, like relative
+		/// moves, macros and graphics context drawing, are never coalesced. Neither are queries such as
+		/// get attribute value, since every one of them is expected to get its own response.
+		/// @param[in] data The data of the command, including the function-code
+		/// @param[in] length The number of bytes in the command
+		/// @param[out] key The key of the command, if it can be coalesced
+		/// @returns true if only the latest queued command with this key needs to be sent
+		static bool get_command_coalescing_key(const std::uint8_t *data, std::uint32_t length, std::uint64_t &key);
 
 		/// @brief Tries to send all messages in the queue
 		void process_command_queue();
 
+		/// @brief Returns if the VT server sends a response to a command
+		/// @param[in] functionCode The function code of the command
+		/// @returns true if the command should be counted against the window of commands in flight
+		static bool get_command_expects_response(std::uint8_t functionCode);
+
+		/// @brief Returns if another command can be sent without exceeding the window of commands in flight
+		/// @param[in] functionCode The function code of the command to be sent
+		/// @returns true if the command can be sent now
+		bool get_command_window_available(std::uint8_t functionCode) const;
+
+		/// @brief Starts tracking the response to a command that was just sent
+		/// @param[in] functionCode The function code of the command that was sent
+		void on_command_sent(std::uint8_t functionCode);
+
+		/// @brief Matches a response from the VT server to the oldest command in flight with the same function code,
+		/// and adapts the window to the measured round trip time
+		/// @param[in] functionCode The function code of the response
+		void on_command_response(std::uint8_t functionCode);
+
+		/// @brief Drops commands that the VT server has not responded to in time, and updates the throughput counter
+		void update_command_pacing();
+
+		/// @brief Clears all commands in flight and, if requested, the statistics
+		/// @param[in] resetStatistics If the counters and round trip time should be reset as well
+		void reset_command_pacing(bool resetStatistics);
+
 		/// @brief The worker thread will execute this function when it runs, if applicable
 		void worker_thread_function();
 
+		static constexpr std::uint32_t SCALING_CHUNK_SIZE = 4096; ///< The number of bytes requested from a data chunk callback at a time when copying a pool for scaling
+		static constexpr std::size_t SCALING_OBJECTS_PER_TASK = 512; ///< The number of objects in each unit of work handed to a scaling thread
 		static constexpr std::uint32_t VT_STATUS_TIMEOUT_MS = 3000; ///< The max allowable time between VT status messages before its considered offline
 		static constexpr std::uint32_t WORKING_SET_MAINTENANCE_TIMEOUT_MS = 1000; ///< The delay between working set maintenance messages
 		static constexpr std::uint32_t AUXILIARY_MAINTENANCE_TIMEOUT_MS = 100; ///< The delay between auxiliary maintenance messages
+		static constexpr std::uint8_t NUMBER_OF_COMMAND_PRIORITIES = 8; ///< The number of CAN priority levels commands can be queued at
+		static constexpr std::uint8_t MINIMUM_COMMAND_WINDOW = 1; ///< The fewest commands that are always allowed to wait for a response
+		static constexpr std::uint8_t INITIAL_COMMAND_WINDOW = 8; ///< The number of commands allowed to wait for a response before any round trip time is known
+		static constexpr std::uint8_t MAXIMUM_COMMAND_WINDOW = 32; ///< The most commands ever allowed to wait for a response
+		static constexpr std::uint32_t COMMAND_RESPONSE_TIMEOUT_MS = 1500; ///< How long to wait for a response to a command before no longer counting it as in flight
+		static constexpr std::uint32_t COMMAND_RTT_TOLERANCE_US = 10000; ///< Round trip times within this much of twice the minimum are not treated as the VT falling behind
+		static constexpr std::uint32_t COMMAND_THROUGHPUT_INTERVAL_MS = 1000; ///< How often the responses per second counter is updated
 
 		std::shared_ptr<PartneredControlFunction> partnerControlFunction; ///< The partner control function this client will send to
 		std::shared_ptr<InternalControlFunction> myControlFunction; ///< The internal control function the client uses to send from
+		CANNetworkManager &network; ///< The network manager of the client's internal control function
 
 		ProcessingFlags txFlags; ///< A retry mechanism for internal Tx messages
 
@@ -1636,6 +1947,11 @@ namespace isobus
 		std::uint32_t lastWorkingSetMaintenanceTimestamp_ms = 0; ///< The timestamp from the last time we sent the maintenance message
 		std::uint32_t lastAuxiliaryMaintenanceTimestamp_ms = 0; ///< The timestamp from the last time we sent the maintenance message
 		std::vector<ObjectPoolDataStruct> objectPools; ///< A container to hold all object pools that have been assigned to the interface
+		std::string scaledObjectPoolCacheDirectory; ///< Where scaled object pools are cached, or empty if caching is disabled
+		std::string objectPoolDeltaDirectory; ///< Where object indexes for delta uploads are saved, or empty if delta uploads are disabled
+		std::string deltaBaseVersionLabel; ///< The stored version a delta upload is based on, or empty if the full pool is uploaded
+		std::map<std::uint16_t, std::uint64_t> deltaBaseObjectHashes; ///< The hash of each object in the version a delta upload is based on, by object ID
+		std::map<std::uint16_t, std::uint64_t> uploadedObjectHashes; ///< The hash of each object in the pool being uploaded, by object ID
 		std::vector<AssignedAuxiliaryInputDevice> assignedAuxiliaryInputDevices; ///< A container to hold all auxiliary input devices known
 		std::uint16_t ourModelIdentificationCode = 1; ///< The model identification code of this input device
 		std::map<std::uint16_t, AuxiliaryInputState> ourAuxiliaryInputs; ///< The inputs on this auxiliary input device
@@ -1649,9 +1965,25 @@ namespace isobus
 		bool shouldTerminate = false; ///< Used to determine if the client should exit and join the worker thread
 
 		// Command queue
-		std::vector<std::vector<std::uint8_t>> commandQueue; ///< A queue of commands to send to the VT server
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		std::mutex commandQueueMutex; ///< Protects the command queue, which the application adds to while the update thread sends from it
+#endif
+		std::array<std::vector<QueuedCommand>, NUMBER_OF_COMMAND_PRIORITIES> commandQueue; ///< Commands waiting to be sent to the VT server, in send order within each priority level
+		std::unordered_map<std::uint64_t, QueuedCommandLocation> queuedCommandsByKey; ///< Finds the queued command for each coalescing key
 		bool commandQueueEnabled = true; ///< Determines if the command queue is enabled
 
+		// Command pacing
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		mutable std::mutex commandPacingMutex; ///< Protects the pacing state, which is updated by both the Tx and Rx paths
+#endif
+		std::array<InFlightCommand, MAXIMUM_COMMAND_WINDOW> inFlightCommands; ///< The commands waiting for a response, oldest first
+		CommandStatistics commandStatistics = {}; ///< Counters and round trip times for the current VT server
+		std::uint64_t responsesAtLastThroughputUpdate = 0; ///< The response counter when the responses per second were last calculated
+		std::uint64_t lastWindowDecreaseTimestamp_us = 0; ///< When the window was last halved, so it is halved at most once per round trip
+		std::uint32_t lastThroughputUpdateTimestamp_ms = 0; ///< When the responses per second were last calculated
+		std::uint8_t fastResponsesSinceWindowIncrease = 0; ///< Responses near the minimum round trip time since the window last grew
+		bool commandPacingEnabled = true; ///< Determines if the number of commands in flight is limited
+
 		// Activation event callbacks
 		EventDispatcher<VTKeyEvent> softKeyEventDispatcher; ///< A list of all soft key event callbacks
 		EventDispatcher<VTKeyEvent> buttonEventDispatcher; ///< A list of all button event callbacks
@@ -0,0 +1,75 @@
+//================================================================================================
+/// @file isobus_virtual_terminal_object_pool_parser.hpp
+///
+/// @brief Builds a table of VT objects from a binary (IOP) object pool.
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#ifndef ISOBUS_VIRTUAL_TERMINAL_OBJECT_POOL_PARSER_HPP
+#define ISOBUS_VIRTUAL_TERMINAL_OBJECT_POOL_PARSER_HPP
+
+#include "isobus/isobus/isobus_virtual_terminal_objects.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace isobus
+{
+	//================================================================================================
+	/// @class VTObjectPoolParser
+	///
+	/// @brief Deserializes a binary VT object pool into a VTObjectTable
+	/// @details The pool is decoded in a single pass over the data, which may be a file mapped with
+	/// IOPFileInterface::map_iop_file. Every object is created in the table's memory arena, and
+	/// every object ID an object refers to is recorded as it is read. Once all objects exist, the
+	/// recorded references are checked and each object's own validation is run, so a pool with
+	/// dangling references or children of the wrong type is rejected.
+	///
+	/// Objects of types that have no VTObject class (such as Graphics Context, Animation and the
+	/// auxiliary control objects) are checked for length and a unique ID, and can be referenced
+	/// by other objects, but are not added to the table. Macro references and Working Set language
+	/// codes are skipped, since the object classes do not store them.
+	//================================================================================================
+	class VTObjectPoolParser
+	{
+	public:
+		/// @brief Enumerates the reasons a pool can fail to parse
+		enum class Error : std::uint8_t
+		{
+			None = 0, ///< The pool was parsed and validated
+			TruncatedObject, ///< An object extends past the end of the pool
+			UnsupportedObjectType, ///< An object's type is unknown, so its length and the rest of the pool can't be decoded
+			DuplicateObjectID, ///< An object ID is used more than once, or an object uses NULL_OBJECT_ID
+			MissingObjectReference, ///< An object refers to an object ID that is not in the pool
+			InvalidObject ///< An object failed its own validation, for example by having a child of the wrong type
+		};
+
+		/// @brief The outcome of parsing a pool
+		struct Result
+		{
+			Error error; ///< The reason parsing failed, or Error::None if it succeeded
+			std::uint16_t objectID; ///< The ID of the object the error was found in, or NULL_OBJECT_ID if there was no error
+			std::uint32_t offset; ///< The byte offset of the object the error was found in
+			std::uint32_t numberOfObjects; ///< The number of objects added to the table
+			std::uint32_t numberOfSkippedObjects; ///< The number of objects that had no VTObject class, and so were not added to the table
+		};
+
+		/// @brief Parses a binary object pool into a table of objects
+		/// @details Any objects already in the table are removed first. If parsing fails, the table is left empty.
+		/// @param[in] binaryPool The object pool, in the format sent to a VT
+		/// @param[in] binaryPoolSizeBytes The number of bytes in the object pool
+		/// @param[out] objectPool The table to fill with the parsed objects
+		/// @returns The outcome of parsing the pool
+		static Result parse(const std::uint8_t *binaryPool, std::uint32_t binaryPoolSizeBytes, VTObjectTable &objectPool);
+
+		/// @brief Parses a binary object pool into a table of objects
+		/// @details Any objects already in the table are removed first. If parsing fails, the table is left empty.
+		/// @param[in] binaryPool The object pool, in the format sent to a VT
+		/// @param[out] objectPool The table to fill with the parsed objects
+		/// @returns The outcome of parsing the pool
+		static Result parse(const std::vector<std::uint8_t> &binaryPool, VTObjectTable &objectPool);
+	};
+} // namespace isobus
+
+#endif // ISOBUS_VIRTUAL_TERMINAL_OBJECT_POOL_PARSER_HPP
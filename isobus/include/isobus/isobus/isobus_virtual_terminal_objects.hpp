@@ -134,6 +134,8 @@ namespace isobus
 
 	static constexpr std::uint16_t NULL_OBJECT_ID = 0xFFFF; ///< The NULL Object ID, usually drawn as blank space
 
+	class VTObjectTable;
+
 	/// @brief Generic VT object base class
 	class VTObject
 	{
@@ -162,19 +164,19 @@ namespace isobus
 		virtual std::uint32_t get_minumum_object_length() const = 0;
 
 		/// @brief Performs basic error checking on the object and returns if the object is valid
-		/// @param[in] objectPool A map of all objects in the current object pool, keyed by their object ID
+		/// @param[in] objectPool A table of all objects in the current object pool, indexed by their object ID
 		/// @returns `true` if the object passed basic error checks
-		virtual bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const = 0;
+		virtual bool get_is_valid(const VTObjectTable &objectPool) const = 0;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
 		/// @param[in] rawAttributeData The raw data to change the attribute to, as decoded in little endian format with unused
 		/// bytes/bits set to zero.
-		/// @param[in] objectPool A map of all objects in the current object pool, keyed by their object ID. Used to validate some object references.
+		/// @param[in] objectPool A table of all objects in the current object pool, indexed by their object ID. Used to validate some object references.
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		virtual bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) = 0;
+		virtual bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) = 0;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -275,7 +277,7 @@ namespace isobus
 		/// @param[in] objectID The object ID to search for
 		/// @param[in] objectPool The object pool to search in
 		/// @returns The object with the corresponding ID
-		static std::shared_ptr<VTObject> get_object_by_id(std::uint16_t objectID, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool);
+		static std::shared_ptr<VTObject> get_object_by_id(std::uint16_t objectID, const VTObjectTable &objectPool);
 
 	protected:
 		/// @brief Storage for child object data
@@ -304,6 +306,173 @@ namespace isobus
 		std::uint8_t backgroundColor = 0; ///< The background color (from the VT colour table)
 	};
 
+	//================================================================================================
+	/// @class VTObjectTable
+	///
+	/// @brief A VT object pool, indexed by object ID
+	/// @details Finding an object is a single array access, since each of the 65535 possible object IDs
+	/// maps directly to a slot in a dense list of objects. Validating a pool looks up every child
+	/// and attribute reference of every object, so this is much faster than a tree for large pools.
+	/// Objects made with create_object are allocated together from large blocks, which are freed once the
+	/// table and every object created by it are destroyed. The table is not thread safe.
+	///
+	/// The lookup functions mirror std::map so code written against a map of objects keeps working.
+	//================================================================================================
+	class VTObjectTable
+	{
+	public:
+		using value_type = std::pair<std::uint16_t, std::shared_ptr<VTObject>>; ///< An object ID and the object with that ID
+		using const_iterator = std::vector<value_type>::const_iterator; ///< An iterator over the objects in the table, in the order they were added
+
+		/// @brief Constructor for an empty VTObjectTable
+		VTObjectTable();
+
+		/// @brief Constructor that copies the objects from a map keyed by object ID
+		/// @param[in] objects The objects to add to the table
+		explicit VTObjectTable(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objects);
+
+		/// @brief Creates an object in the table's memory arena and adds it to the table
+		/// @param[in] objectID The ID of the new object, which must not already be in the table
+		/// @returns The new object, or nullptr if the ID is NULL_OBJECT_ID or already in use
+		template<typename T>
+		std::shared_ptr<T> create_object(std::uint16_t objectID)
+		{
+			std::shared_ptr<T> retVal;
+
+			if ((NULL_OBJECT_ID != objectID) && (0 == count(objectID)))
+			{
+				retVal = std::allocate_shared<T>(ArenaAllocator<T>(arena));
+				retVal->set_id(objectID);
+				insert(retVal);
+			}
+			return retVal;
+		}
+
+		/// @brief Adds an object to the table, using its ID as the key
+		/// @param[in] object The object to add
+		/// @returns true if the object was added, false if it was null, its ID was NULL_OBJECT_ID or its ID is already in use
+		bool insert(std::shared_ptr<VTObject> object);
+
+		/// @brief Removes an object from the table
+		/// @param[in] objectID The ID of the object to remove
+		/// @returns The number of objects removed, 0 or 1
+		std::size_t erase(std::uint16_t objectID);
+
+		/// @brief Removes all objects from the table
+		void clear();
+
+		/// @brief Returns the object with an ID
+		/// @param[in] objectID The ID of the object to look up
+		/// @returns The object, or nullptr if there is no object with that ID in the table
+		std::shared_ptr<VTObject> get_object(std::uint16_t objectID) const;
+
+		/// @brief Finds the object with an ID
+		/// @param[in] objectID The ID of the object to look up
+		/// @returns An iterator to the object, or end() if there is no object with that ID in the table
+		const_iterator find(std::uint16_t objectID) const;
+
+		/// @brief Returns the number of objects with an ID
+		/// @param[in] objectID The ID of the object to look up
+		/// @returns 1 if there is an object with that ID in the table, otherwise 0
+		std::size_t count(std::uint16_t objectID) const;
+
+		/// @brief Returns an iterator to the first object in the table
+		/// @returns An iterator to the first object in the table
+		const_iterator begin() const;
+
+		/// @brief Returns an iterator past the last object in the table
+		/// @returns An iterator past the last object in the table
+		const_iterator end() const;
+
+		/// @brief Returns the number of objects in the table
+		/// @returns The number of objects in the table
+		std::size_t size() const;
+
+		/// @brief Returns if the table has no objects in it
+		/// @returns true if the table is empty
+		bool empty() const;
+
+	private:
+		/// @brief Hands out memory from large blocks that are only freed when the arena is destroyed
+		class Arena
+		{
+		public:
+			/// @brief Allocates memory from the current block, or a new block if it doesn't fit
+			/// @param[in] size The number of bytes to allocate
+			/// @param[in] alignment The required alignment of the memory
+			/// @returns A pointer to the allocated memory
+			void *allocate(std::size_t size, std::size_t alignment);
+
+		private:
+			static constexpr std::size_t BLOCK_SIZE = 64 * 1024; ///< The size of each block of memory objects are allocated from
+
+			std::vector<std::unique_ptr<std::uint8_t[]>> blocks; ///< The blocks of memory owned by the arena
+			std::size_t blockUsed = BLOCK_SIZE; ///< The number of bytes used in the last block
+		};
+
+		/// @brief An allocator that allocates from an arena, and keeps the arena alive while anything it allocated is
+		template<typename T>
+		class ArenaAllocator
+		{
+		public:
+			using value_type = T; ///< The type of object allocated
+
+			/// @brief Constructor for an ArenaAllocator
+			/// @param[in] sourceArena The arena to allocate from
+			explicit ArenaAllocator(std::shared_ptr<Arena> sourceArena) :
+			  arena(std::move(sourceArena))
+			{
+			}
+
+			/// @brief Constructor for an ArenaAllocator that shares the arena of an allocator of another type
+			/// @param[in] other The allocator to share the arena of
+			template<typename U>
+			ArenaAllocator(const ArenaAllocator<U> &other) :
+			  arena(other.arena)
+			{
+			}
+
+			/// @brief Allocates memory for objects from the arena
+			/// @param[in] numberOfObjects The number of objects to allocate memory for
+			/// @returns A pointer to the allocated memory
+			T *allocate(std::size_t numberOfObjects)
+			{
+				return static_cast<T *>(arena->allocate(numberOfObjects * sizeof(T), alignof(T)));
+			}
+
+			/// @brief Does nothing, the memory is freed with the arena
+			void deallocate(T *, std::size_t)
+			{
+			}
+
+			/// @brief Compares two allocators
+			/// @param[in] other The allocator to compare to
+			/// @returns true if both allocators use the same arena
+			template<typename U>
+			bool operator==(const ArenaAllocator<U> &other) const
+			{
+				return arena == other.arena;
+			}
+
+			/// @brief Compares two allocators
+			/// @param[in] other The allocator to compare to
+			/// @returns true if the allocators use different arenas
+			template<typename U>
+			bool operator!=(const ArenaAllocator<U> &other) const
+			{
+				return arena != other.arena;
+			}
+
+			std::shared_ptr<Arena> arena; ///< The arena to allocate from
+		};
+
+		static constexpr std::uint16_t EMPTY_SLOT = 0xFFFF; ///< Marks an object ID that has no object in the table
+
+		std::vector<std::uint16_t> slotsByObjectID; ///< The index into objects for each object ID, allocated when the first object is added
+		std::vector<value_type> objects; ///< The objects in the table, in the order they were added
+		std::shared_ptr<Arena> arena; ///< The memory objects made with create_object are allocated from
+	};
+
 	/// @brief This object shall include one or more objects that fit inside a Soft Key designator for use as an
 	/// identification of the Working Set.
 	class WorkingSet : public VTObject
@@ -338,7 +507,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating this object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -348,7 +517,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -414,7 +583,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -424,7 +593,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -439,7 +608,7 @@ namespace isobus
 		/// @param[in] newMaskID The object ID of the new soft key mask to associate with this data mask
 		/// @param[in] objectPool The object pool to use when validating the objects affected by setting this attribute
 		/// @returns True if the mask was changed, false if the new ID was not valid and the mask was not changed
-		bool change_soft_key_mask(std::uint16_t newMaskID, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool);
+		bool change_soft_key_mask(std::uint16_t newMaskID, const VTObjectTable &objectPool);
 
 		/// @brief Changes the soft key mask associated to this data mask to a new object ID, but
 		/// does no checking on the validity of the new object ID.
@@ -507,7 +676,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -517,7 +686,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -552,7 +721,7 @@ namespace isobus
 		/// @param[in] newMaskID The object ID of the new soft key mask to associate with this data mask
 		/// @param[in] objectPool The object pool to use when validating the objects affected by setting this attribute
 		/// @returns True if the mask was changed, false if the new ID was not valid and the mask was not changed
-		bool change_soft_key_mask(std::uint16_t newMaskID, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool);
+		bool change_soft_key_mask(std::uint16_t newMaskID, const VTObjectTable &objectPool);
 
 		/// @brief Changes the soft key mask associated to this alarm mask to a new object ID, but
 		/// does no checking on the validity of the new object ID.
@@ -606,7 +775,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -616,7 +785,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -674,7 +843,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -684,7 +853,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -731,7 +900,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -741,7 +910,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -804,7 +973,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -814,7 +983,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -863,7 +1032,7 @@ namespace isobus
 		/// @param[in] nameIDToValidate The name's object ID to validate
 		/// @param[in] objectPool The object pool to use when validating the name object
 		/// @returns True if the name ID is valid for this object, otherwise false
-		bool validate_name(std::uint16_t nameIDToValidate, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const;
+		bool validate_name(std::uint16_t nameIDToValidate, const VTObjectTable &objectPool) const;
 
 		static constexpr std::uint32_t MIN_OBJECT_LENGTH = 10; ///< The fewest bytes of IOP data that can represent this object
 
@@ -923,7 +1092,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -933,7 +1102,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -1017,7 +1186,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -1027,7 +1196,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -1148,7 +1317,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -1158,7 +1327,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -1331,7 +1500,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -1341,7 +1510,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -1533,7 +1702,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -1543,7 +1712,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -1590,7 +1759,7 @@ namespace isobus
 		/// @param[in] newListItem The object ID to use as the new list item at the specified index
 		/// @param[in] objectPool The object pool to use to look up the object ID
 		/// @returns True if the operation was successful, otherwise false (perhaps the index is out of bounds?)
-		bool change_list_item(std::uint8_t index, std::uint16_t newListItem, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool);
+		bool change_list_item(std::uint8_t index, std::uint16_t newListItem, const VTObjectTable &objectPool);
 
 		/// @brief Returns the number of items in the list
 		/// @note This is not the number of children, it's the number of allocated
@@ -1676,7 +1845,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -1686,7 +1855,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -1826,7 +1995,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -1836,7 +2005,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -1983,7 +2152,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -1993,7 +2162,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -2038,7 +2207,7 @@ namespace isobus
 		/// @param[in] newListItem The object ID to use as the new list item at the specified index
 		/// @param[in] objectPool The object pool to use to look up the object ID
 		/// @returns True if the operation was successful, otherwise false (perhaps the index is out of bounds?)
-		bool change_list_item(std::uint8_t index, std::uint16_t newListItem, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool);
+		bool change_list_item(std::uint8_t index, std::uint16_t newListItem, const VTObjectTable &objectPool);
 
 	private:
 		static constexpr std::uint32_t MIN_OBJECT_LENGTH = 12; ///< The fewest bytes of IOP data that can represent this object
@@ -2089,7 +2258,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -2099,7 +2268,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -2182,7 +2351,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -2192,7 +2361,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -2284,7 +2453,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -2294,7 +2463,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -2414,7 +2583,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -2424,7 +2593,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -2534,7 +2703,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -2544,7 +2713,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -2724,7 +2893,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -2734,7 +2903,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -2907,7 +3076,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -2917,7 +3086,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -3109,7 +3278,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -3119,7 +3288,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -3239,7 +3408,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -3249,7 +3418,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -3303,7 +3472,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -3313,7 +3482,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -3420,7 +3589,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -3430,7 +3599,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -3532,7 +3701,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -3542,7 +3711,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -3608,7 +3777,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -3618,7 +3787,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -3690,7 +3859,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -3700,7 +3869,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -3773,7 +3942,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -3783,7 +3952,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -3856,7 +4025,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -3866,7 +4035,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -3924,7 +4093,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -3934,7 +4103,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -4053,7 +4222,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -4063,7 +4232,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -4137,7 +4306,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -4147,7 +4316,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -4247,7 +4416,7 @@ namespace isobus
 		/// @brief Performs basic error checking on the object and returns if the object is valid
 		/// @param[in] objectPool The object pool to use when validating the object
 		/// @returns `true` if the object passed basic error checks
-		bool get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const override;
+		bool get_is_valid(const VTObjectTable &objectPool) const override;
 
 		/// @brief Sets an attribute and optionally returns an error code in the last parameter
 		/// @param[in] attributeID The ID of the attribute to change
@@ -4257,7 +4426,7 @@ namespace isobus
 		/// @param[out] returnedError If this function returns false, this will be the error code. If the function
 		/// returns true, this value is undefined.
 		/// @returns True if the attribute was changed, otherwise false (check the returnedError in this case to know why).
-		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError) override;
+		bool set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError) override;
 
 		/// @brief Gets an attribute and returns the raw data in the last parameter
 		/// @param[in] attributeID The ID of the attribute to get
@@ -39,6 +39,10 @@ namespace isobus
 	class FastPacketProtocol : public CANLibProtocol
 	{
 	public:
+		/// @brief The constructor for the FastPacketProtocol
+		/// @param[in] parentNetwork The network manager this protocol belongs to
+		explicit FastPacketProtocol(CANNetworkManager &parentNetwork);
+
 		/// @brief A generic way to initialize a protocol
 		/// @details The network manager will call a protocol's initialize function
 		/// when it is first updated, if it has yet to be initialized.
@@ -304,6 +304,7 @@ namespace isobus
 		/// @brief Checks to see if any transmit flags need to be set based on the last time the message was sent, if enabled.
 		void check_transmit_timeouts();
 
+		CANNetworkManager &network; ///< The network manager of the interface's control function
 		ProcessingFlags txFlags; ///< A set of flags used to track what messages need to be transmitted or retried
 		NMEA2000Messages::CourseOverGroundSpeedOverGroundRapidUpdate cogSogTransmitMessage; ///< Stores a set of data specifically for transmitting the PGN 129026 (0x1F802) if enabled
 		NMEA2000Messages::Datum datumTransmitMessage; ///< Stores a set of data specifically for transmitting the PGN 129044 (0x1F814) if enabled
@@ -18,7 +18,8 @@
 
 namespace isobus
 {
-	AddressClaimStateMachine::AddressClaimStateMachine(std::uint8_t preferredAddressValue, NAME ControlFunctionNAME, std::uint8_t portIndex) :
+	AddressClaimStateMachine::AddressClaimStateMachine(std::uint8_t preferredAddressValue, NAME ControlFunctionNAME, std::uint8_t portIndex, CANNetworkManager &network) :
+	  m_network(network),
 	  m_isoname(ControlFunctionNAME),
 	  m_portIndex(portIndex),
 	  m_preferredAddress(preferredAddressValue)
@@ -29,14 +30,14 @@ namespace isobus
 		std::default_random_engine generator;
 		std::uniform_int_distribution<unsigned int> distribution(0, 255);
 		m_randomClaimDelay_ms = distribution(generator) * 0.6f; // Defined by ISO part 5
-		CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest), process_rx_message, this);
-		CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AddressClaim), process_rx_message, this);
+		m_network.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest), process_rx_message, this);
+		m_network.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AddressClaim), process_rx_message, this);
 	}
 
 	AddressClaimStateMachine ::~AddressClaimStateMachine()
 	{
-		CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest), process_rx_message, this);
-		CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AddressClaim), process_rx_message, this);
+		m_network.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest), process_rx_message, this);
+		m_network.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AddressClaim), process_rx_message, this);
 	}
 
 	AddressClaimStateMachine::State AddressClaimStateMachine::get_current_state() const
@@ -65,7 +66,7 @@ namespace isobus
 			}
 			else
 			{
-				std::shared_ptr<ControlFunction> deviceAtOurPreferredAddress = CANNetworkManager::CANNetwork.get_control_function(m_portIndex, commandedAddress, {});
+				std::shared_ptr<ControlFunction> deviceAtOurPreferredAddress = m_network.get_control_function(m_portIndex, commandedAddress, {});
 				m_preferredAddress = commandedAddress;
 
 				if (nullptr == deviceAtOurPreferredAddress)
@@ -143,7 +144,7 @@ namespace isobus
 
 					if (SystemTiming::time_expired_ms(m_timestamp_ms, addressContentionTime_ms + m_randomClaimDelay_ms))
 					{
-						std::shared_ptr<ControlFunction> deviceAtOurPreferredAddress = CANNetworkManager::CANNetwork.get_control_function(m_portIndex, m_preferredAddress, {});
+						std::shared_ptr<ControlFunction> deviceAtOurPreferredAddress = m_network.get_control_function(m_portIndex, m_preferredAddress, {});
 						// Time to find a free address
 						if (nullptr == deviceAtOurPreferredAddress)
 						{
@@ -201,7 +202,7 @@ namespace isobus
 
 					for (std::uint8_t i = 128; i <= 247; i++)
 					{
-						if ((nullptr == CANNetworkManager::CANNetwork.get_control_function(m_portIndex, i, {})) && (send_address_claim(i)))
+						if ((nullptr == m_network.get_control_function(m_portIndex, i, {})) && (send_address_claim(i)))
 						{
 							addressFound = true;
 							CANStackLogger::debug("[AC]: Internal control function %016llx could not use the preferred address, but has claimed address %u on channel %u",
@@ -337,14 +338,14 @@ namespace isobus
 			dataBuffer[1] = ((PGN >> 8) & std::numeric_limits<std::uint8_t>::max());
 			dataBuffer[2] = ((PGN >> 16) & std::numeric_limits<std::uint8_t>::max());
 
-			retVal = CANNetworkManager::CANNetwork.send_can_message_raw(m_portIndex,
-			                                                            NULL_CAN_ADDRESS,
-			                                                            BROADCAST_CAN_ADDRESS,
-			                                                            static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest),
-			                                                            static_cast<std::uint8_t>(CANIdentifier::CANPriority::PriorityDefault6),
-			                                                            dataBuffer,
-			                                                            3,
-			                                                            {});
+			retVal = m_network.send_can_message_raw(m_portIndex,
+			                                      NULL_CAN_ADDRESS,
+			                                      BROADCAST_CAN_ADDRESS,
+			                                      static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest),
+			                                      static_cast<std::uint8_t>(CANIdentifier::CANPriority::PriorityDefault6),
+			                                      dataBuffer,
+			                                      3,
+			                                      {});
 		}
 		return retVal;
 	}
@@ -368,14 +369,14 @@ namespace isobus
 			dataBuffer[5] = static_cast<uint8_t>(isoNAME >> 40);
 			dataBuffer[6] = static_cast<uint8_t>(isoNAME >> 48);
 			dataBuffer[7] = static_cast<uint8_t>(isoNAME >> 56);
-			retVal = CANNetworkManager::CANNetwork.send_can_message_raw(m_portIndex,
-			                                                            address,
-			                                                            BROADCAST_CAN_ADDRESS,
-			                                                            static_cast<std::uint32_t>(CANLibParameterGroupNumber::AddressClaim),
-			                                                            static_cast<std::uint8_t>(CANIdentifier::CANPriority::PriorityDefault6),
-			                                                            dataBuffer,
-			                                                            CAN_DATA_LENGTH,
-			                                                            {});
+			retVal = m_network.send_can_message_raw(m_portIndex,
+			                                      address,
+			                                      BROADCAST_CAN_ADDRESS,
+			                                      static_cast<std::uint32_t>(CANLibParameterGroupNumber::AddressClaim),
+			                                      static_cast<std::uint8_t>(CANIdentifier::CANPriority::PriorityDefault6),
+			                                      dataBuffer,
+			                                      CAN_DATA_LENGTH,
+			                                      {});
 			if (retVal)
 			{
 				m_claimedAddress = address;
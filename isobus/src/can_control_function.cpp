@@ -17,11 +17,8 @@
 
 namespace isobus
 {
-#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
-	std::mutex ControlFunction::controlFunctionProcessingMutex;
-#endif
-
-	isobus::ControlFunction::ControlFunction(NAME NAMEValue, std::uint8_t addressValue, std::uint8_t CANPort, Type type) :
+	isobus::ControlFunction::ControlFunction(NAME NAMEValue, std::uint8_t addressValue, std::uint8_t CANPort, CANNetworkManager &parentNetwork, Type type) :
+	  network(parentNetwork),
 	  controlFunctionType(type),
 	  controlFunctionNAME(NAMEValue),
 	  address(addressValue),
@@ -30,20 +27,25 @@ namespace isobus
 	}
 
 	std::shared_ptr<ControlFunction> ControlFunction::create(NAME NAMEValue, std::uint8_t addressValue, std::uint8_t CANPort)
+	{
+		return create(NAMEValue, addressValue, CANPort, CANNetworkManager::CANNetwork);
+	}
+
+	std::shared_ptr<ControlFunction> ControlFunction::create(NAME NAMEValue, std::uint8_t addressValue, std::uint8_t CANPort, CANNetworkManager &parentNetwork)
 	{
 		// Unfortunately, we can't use `std::make_shared` here because the constructor is private
-		auto controlFunction = std::shared_ptr<ControlFunction>(new ControlFunction(NAMEValue, addressValue, CANPort));
-		CANNetworkManager::CANNetwork.on_control_function_created(controlFunction, CANLibBadge<ControlFunction>());
+		auto controlFunction = std::shared_ptr<ControlFunction>(new ControlFunction(NAMEValue, addressValue, CANPort, parentNetwork));
+		parentNetwork.on_control_function_created(controlFunction, CANLibBadge<ControlFunction>());
 		return controlFunction;
 	}
 
 	bool ControlFunction::destroy(std::uint32_t expectedRefCount)
 	{
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
-		std::lock_guard<std::mutex> lock(controlFunctionProcessingMutex);
+		std::lock_guard<std::mutex> lock(network.controlFunctionProcessingMutex);
 #endif
 
-		CANNetworkManager::CANNetwork.on_control_function_destroyed(shared_from_this(), {});
+		network.on_control_function_destroyed(shared_from_this(), {});
 
 		return static_cast<std::uint32_t>(shared_from_this().use_count()) == expectedRefCount + 1;
 	}
@@ -88,4 +90,45 @@ namespace isobus
 		}
 	}
 
+	CANNetworkManager &ControlFunction::get_network() const
+	{
+		return network;
+	}
+
+
+	ControlFunctionHandle::ControlFunctionHandle(const std::shared_ptr<ControlFunction> &tableEntry, const std::uint32_t &tableEntryGeneration) :
+	  entry(&tableEntry),
+	  entryGeneration(&tableEntryGeneration),
+	  generation(tableEntryGeneration)
+	{
+	}
+
+	bool ControlFunctionHandle::get_is_valid() const
+	{
+		return (nullptr != get());
+	}
+
+	ControlFunction *ControlFunctionHandle::get() const
+	{
+		ControlFunction *retVal = nullptr;
+
+		if ((nullptr != entry) &&
+		    (*entryGeneration == generation))
+		{
+			retVal = entry->get();
+		}
+		return retVal;
+	}
+
+	std::shared_ptr<ControlFunction> ControlFunctionHandle::lock() const
+	{
+		std::shared_ptr<ControlFunction> retVal = nullptr;
+
+		if ((nullptr != entry) &&
+		    (*entryGeneration == generation))
+		{
+			retVal = *entry;
+		}
+		return retVal;
+	}
 } // namespace isobus
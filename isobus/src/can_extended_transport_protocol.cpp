@@ -46,7 +46,8 @@ namespace isobus
 	{
 	}
 
-	ExtendedTransportProtocolManager::ExtendedTransportProtocolManager()
+	ExtendedTransportProtocolManager::ExtendedTransportProtocolManager(CANNetworkManager &parentNetwork) :
+	  CANLibProtocol(parentNetwork)
 	{
 	}
 
@@ -61,14 +62,14 @@ namespace isobus
 		if (!initialized)
 		{
 			initialized = true;
-			CANNetworkManager::CANNetwork.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolDataTransfer), process_message, this);
-			CANNetworkManager::CANNetwork.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement), process_message, this);
+			network.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolDataTransfer), process_message, this);
+			network.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement), process_message, this);
 		}
 	}
 
 	void ExtendedTransportProtocolManager::process_message(const CANMessage &message)
 	{
-		if ((nullptr != CANNetworkManager::CANNetwork.get_internal_control_function(message.get_destination_control_function())))
+		if ((nullptr != network.get_internal_control_function(message.get_destination_control_function())))
 		{
 			switch (message.get_identifier().get_parameter_group_number())
 			{
@@ -85,7 +86,7 @@ namespace isobus
 							case EXTENDED_REQUEST_TO_SEND_MULTIPLEXOR:
 							{
 								if ((nullptr != message.get_destination_control_function()) &&
-								    (activeSessions.size() < CANNetworkManager::CANNetwork.get_configuration().get_max_number_transport_protocol_sessions()) &&
+								    (activeSessions.size() < network.get_configuration().get_max_number_transport_protocol_sessions()) &&
 								    (!get_session(session, message.get_source_control_function(), message.get_destination_control_function(), pgn)))
 								{
 									ExtendedTransportProtocolSession *newSession = new ExtendedTransportProtocolSession(ExtendedTransportProtocolSession::Direction::Receive, message.get_can_port_index());
@@ -95,6 +96,7 @@ namespace isobus
 									newSession->sessionMessage.set_destination_control_function(message.get_destination_control_function());
 									newSession->packetCount = 0xFF;
 									newSession->sessionMessage.set_identifier(tempIdentifierData);
+									newSession->sessionMessage.set_timestamp_us(message.get_timestamp_us());
 									newSession->state = StateMachineState::ClearToSend;
 									newSession->timestamp_ms = SystemTiming::get_timestamp_ms();
 									activeSessions.push_back(newSession);
@@ -107,7 +109,7 @@ namespace isobus
 									CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Error, "[ETP]: Sent abort to address " + isobus::to_string(static_cast<int>(message.get_source_control_function()->get_address())) + " RTS when already in session");
 									close_session(session, false);
 								}
-								else if ((activeSessions.size() >= CANNetworkManager::CANNetwork.get_configuration().get_max_number_transport_protocol_sessions()) &&
+								else if ((activeSessions.size() >= network.get_configuration().get_max_number_transport_protocol_sessions()) &&
 								         (nullptr != message.get_destination_control_function()) &&
 								         (ControlFunction::Type::Internal == message.get_destination_control_function()->get_type()))
 								{
@@ -128,9 +130,9 @@ namespace isobus
 									{
 										session->packetCount = packetsToBeSent;
 
-										if (session->packetCount > CANNetworkManager::CANNetwork.get_configuration().get_max_number_of_etp_frames_per_edpo())
+										if (session->packetCount > network.get_configuration().get_max_number_of_etp_frames_per_edpo())
 										{
-											session->packetCount = CANNetworkManager::CANNetwork.get_configuration().get_max_number_of_etp_frames_per_edpo();
+											session->packetCount = network.get_configuration().get_max_number_of_etp_frames_per_edpo();
 										}
 										session->timestamp_ms = SystemTiming::get_timestamp_ms();
 										// If 0 was sent as the packet number, they want us to wait.
@@ -304,12 +306,13 @@ namespace isobus
 						tempSession->processedPacketsThisSession++;
 						if ((tempSession->processedPacketsThisSession * PROTOCOL_BYTES_PER_FRAME) >= tempSession->get_message_data_length())
 						{
+							tempSession->sessionMessage.set_completion_timestamp_us(message.get_timestamp_us());
 							if (nullptr != tempSession->sessionMessage.get_destination_control_function())
 							{
 								send_end_of_session_acknowledgement(tempSession);
 							}
-							CANNetworkManager::CANNetwork.process_any_control_function_pgn_callbacks(tempSession->sessionMessage);
-							CANNetworkManager::CANNetwork.protocol_message_callback(tempSession->sessionMessage);
+							network.process_any_control_function_pgn_callbacks(tempSession->sessionMessage);
+							network.protocol_message_callback(tempSession->sessionMessage);
 							close_session(tempSession, true);
 						}
 						tempSession->timestamp_ms = SystemTiming::get_timestamp_ms();
@@ -413,12 +416,12 @@ namespace isobus
 
 			if (ExtendedTransportProtocolSession::Direction::Transmit == session->sessionDirection)
 			{
-				myControlFunction = CANNetworkManager::CANNetwork.get_internal_control_function(session->sessionMessage.get_source_control_function());
+				myControlFunction = network.get_internal_control_function(session->sessionMessage.get_source_control_function());
 				partnerControlFunction = session->sessionMessage.get_destination_control_function();
 			}
 			else
 			{
-				myControlFunction = CANNetworkManager::CANNetwork.get_internal_control_function(session->sessionMessage.get_destination_control_function());
+				myControlFunction = network.get_internal_control_function(session->sessionMessage.get_destination_control_function());
 				partnerControlFunction = session->sessionMessage.get_source_control_function();
 			}
 
@@ -430,7 +433,7 @@ namespace isobus
 			data[5] = static_cast<std::uint8_t>(pgn & 0xFF);
 			data[6] = static_cast<std::uint8_t>((pgn >> 8) & 0xFF);
 			data[7] = static_cast<std::uint8_t>((pgn >> 16) & 0xFF);
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
 			                                                        data.data(),
 			                                                        CAN_DATA_LENGTH,
 			                                                        myControlFunction,
@@ -452,7 +455,7 @@ namespace isobus
 		data[5] = static_cast<std::uint8_t>(parameterGroupNumber & 0xFF);
 		data[6] = static_cast<std::uint8_t>((parameterGroupNumber >> 8) & 0xFF);
 		data[7] = static_cast<std::uint8_t>((parameterGroupNumber >> 16) & 0xFF);
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
 		                                                      data.data(),
 		                                                      CAN_DATA_LENGTH,
 		                                                      source,
@@ -535,7 +538,7 @@ namespace isobus
 				                                                 static_cast<std::uint8_t>(session->sessionMessage.get_identifier().get_parameter_group_number() & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 8) & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 16) & 0xFF) };
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
 			                                                        dataBuffer,
 			                                                        CAN_DATA_LENGTH,
 			                                                        std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_destination_control_function()),
@@ -571,7 +574,7 @@ namespace isobus
 				                                                 static_cast<std::uint8_t>(session->sessionMessage.get_identifier().get_parameter_group_number() & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 8) & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 16) & 0xFF) };
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
 			                                                        dataBuffer,
 			                                                        CAN_DATA_LENGTH,
 			                                                        std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_destination_control_function()),
@@ -595,7 +598,7 @@ namespace isobus
 				                                                 static_cast<std::uint8_t>(session->sessionMessage.get_identifier().get_parameter_group_number() & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 8) & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 16) & 0xFF) };
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
 			                                                        dataBuffer,
 			                                                        CAN_DATA_LENGTH,
 			                                                        std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_source_control_function()),
@@ -619,7 +622,7 @@ namespace isobus
 				                                                 static_cast<std::uint8_t>(session->sessionMessage.get_identifier().get_parameter_group_number() & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 8) & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 16) & 0xFF) };
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolConnectionManagement),
 			                                                        dataBuffer,
 			                                                        CAN_DATA_LENGTH,
 			                                                        std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_source_control_function()),
@@ -750,7 +753,7 @@ namespace isobus
 									}
 								}
 
-								if (CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolDataTransfer),
+								if (network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ExtendedTransportProtocolDataTransfer),
 								                                                   dataBuffer,
 								                                                   CAN_DATA_LENGTH,
 								                                                   std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_source_control_function()),
@@ -762,7 +765,7 @@ namespace isobus
 									session->processedPacketsThisSession++;
 									session->timestamp_ms = SystemTiming::get_timestamp_ms();
 
-									if (framesSentThisUpdate >= CANNetworkManager::CANNetwork.get_configuration().get_max_number_of_network_manager_protocol_frames_per_update())
+									if (framesSentThisUpdate >= network.get_configuration().get_max_number_of_network_manager_protocol_frames_per_update())
 									{
 										break; // Throttle the session
 									}
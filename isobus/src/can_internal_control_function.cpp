@@ -18,19 +18,24 @@
 
 namespace isobus
 {
-	InternalControlFunction::InternalControlFunction(NAME desiredName, std::uint8_t preferredAddress, std::uint8_t CANPort, CANLibBadge<InternalControlFunction>) :
-	  ControlFunction(desiredName, NULL_CAN_ADDRESS, CANPort, Type::Internal),
-	  stateMachine(preferredAddress, desiredName, CANPort)
+	InternalControlFunction::InternalControlFunction(NAME desiredName, std::uint8_t preferredAddress, std::uint8_t CANPort, CANNetworkManager &parentNetwork, CANLibBadge<InternalControlFunction>) :
+	  ControlFunction(desiredName, NULL_CAN_ADDRESS, CANPort, parentNetwork, Type::Internal),
+	  stateMachine(preferredAddress, desiredName, CANPort, parentNetwork)
 	{
 	}
 
 	std::shared_ptr<InternalControlFunction> InternalControlFunction::create(NAME desiredName, std::uint8_t preferredAddress, std::uint8_t CANPort)
+	{
+		return create(desiredName, preferredAddress, CANPort, CANNetworkManager::CANNetwork);
+	}
+
+	std::shared_ptr<InternalControlFunction> InternalControlFunction::create(NAME desiredName, std::uint8_t preferredAddress, std::uint8_t CANPort, CANNetworkManager &parentNetwork)
 	{
 		// Unfortunately, we can't use `std::make_shared` here because the constructor is private
 		CANLibBadge<InternalControlFunction> badge; // This badge is used to allow creation of the PGN request protocol only from within this class
-		auto controlFunction = std::shared_ptr<InternalControlFunction>(new InternalControlFunction(desiredName, preferredAddress, CANPort, badge));
+		auto controlFunction = std::shared_ptr<InternalControlFunction>(new InternalControlFunction(desiredName, preferredAddress, CANPort, parentNetwork, badge));
 		controlFunction->pgnRequestProtocol = std::make_unique<ParameterGroupNumberRequestProtocol>(controlFunction, badge);
-		CANNetworkManager::CANNetwork.on_control_function_created(controlFunction, badge);
+		parentNetwork.on_control_function_created(controlFunction, badge);
 		return controlFunction;
 	}
 
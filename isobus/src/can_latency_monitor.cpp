@@ -0,0 +1,228 @@
+//================================================================================================
+/// @file can_latency_monitor.cpp
+///
+/// @brief Optional instrumentation that measures how long CAN frames spend in each stage of the
+/// stack's receive and transmit pipelines.
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#include "isobus/isobus/can_latency_monitor.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace isobus
+{
+	std::array<std::array<CANLatencyHistogram, static_cast<std::size_t>(CANLatencyMonitor::Stage::NumberOfStages)>, CAN_PORT_MAXIMUM> CANLatencyMonitor::histograms;
+
+	CANLatencyHistogram::CANLatencyHistogram()
+	{
+		reset();
+	}
+
+	void CANLatencyHistogram::record(std::uint64_t value_us)
+	{
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		std::uint32_t clampedValue = (value_us > std::numeric_limits<std::uint32_t>::max()) ? std::numeric_limits<std::uint32_t>::max() : static_cast<std::uint32_t>(value_us);
+		std::uint32_t currentMaximum = maximum_us.load(std::memory_order_relaxed);
+
+		buckets[get_bucket_index(clampedValue)].fetch_add(1, std::memory_order_relaxed);
+		sampleSum_us.fetch_add(clampedValue, std::memory_order_relaxed);
+		sampleCount.fetch_add(1, std::memory_order_relaxed);
+
+		while ((clampedValue > currentMaximum) &&
+		       (!maximum_us.compare_exchange_weak(currentMaximum, clampedValue, std::memory_order_relaxed)))
+		{
+			// currentMaximum was updated by the failed exchange, try again
+		}
+#else
+		(void)value_us;
+#endif
+	}
+
+	void CANLatencyHistogram::reset()
+	{
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		for (auto &bucket : buckets)
+		{
+			bucket.store(0, std::memory_order_relaxed);
+		}
+		sampleCount.store(0, std::memory_order_relaxed);
+		sampleSum_us.store(0, std::memory_order_relaxed);
+		maximum_us.store(0, std::memory_order_relaxed);
+#endif
+	}
+
+	std::uint64_t CANLatencyHistogram::get_sample_count() const
+	{
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		return sampleCount.load(std::memory_order_relaxed);
+#else
+		return 0;
+#endif
+	}
+
+	std::uint32_t CANLatencyHistogram::get_maximum_us() const
+	{
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		return maximum_us.load(std::memory_order_relaxed);
+#else
+		return 0;
+#endif
+	}
+
+	std::uint32_t CANLatencyHistogram::get_mean_us() const
+	{
+		std::uint32_t retVal = 0;
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		std::uint64_t count = sampleCount.load(std::memory_order_relaxed);
+
+		if (0 != count)
+		{
+			retVal = static_cast<std::uint32_t>(sampleSum_us.load(std::memory_order_relaxed) / count);
+		}
+#endif
+		return retVal;
+	}
+
+	std::uint32_t CANLatencyHistogram::get_percentile_us(float percentile) const
+	{
+		std::uint32_t retVal = 0;
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		std::uint64_t totalCount = 0;
+
+		// Sum the buckets rather than using sampleCount, since samples may be recorded while we read
+		for (const auto &bucket : buckets)
+		{
+			totalCount += bucket.load(std::memory_order_relaxed);
+		}
+
+		if (0 != totalCount)
+		{
+			if (percentile < 0.0f)
+			{
+				percentile = 0.0f;
+			}
+			else if (percentile > 100.0f)
+			{
+				percentile = 100.0f;
+			}
+
+			// Nearest rank, so the percentile is always a sample that was actually recorded
+			std::uint64_t targetCount = static_cast<std::uint64_t>(std::ceil((static_cast<double>(totalCount) * percentile) / 100.0));
+			std::uint64_t runningCount = 0;
+
+			if (0 == targetCount)
+			{
+				targetCount = 1;
+			}
+
+			for (std::uint32_t i = 0; i < NUMBER_OF_BUCKETS; i++)
+			{
+				runningCount += buckets[i].load(std::memory_order_relaxed);
+
+				if (runningCount >= targetCount)
+				{
+					retVal = get_bucket_upper_bound(i);
+					break;
+				}
+			}
+
+			// The bucket bound can overshoot the real data, but the maximum is exact
+			std::uint32_t maximum = get_maximum_us();
+			if (retVal > maximum)
+			{
+				retVal = maximum;
+			}
+		}
+#else
+		(void)percentile;
+#endif
+		return retVal;
+	}
+
+	std::uint32_t CANLatencyHistogram::get_bucket_index(std::uint32_t value)
+	{
+		std::uint32_t retVal = value;
+
+		if (value >= SUB_BUCKET_COUNT)
+		{
+			// Find the most significant bit with a binary search
+			std::uint32_t mostSignificantBit = 0;
+			for (std::uint32_t step = 16; step > 0; step >>= 1)
+			{
+				if (0 != (value >> (mostSignificantBit + step)))
+				{
+					mostSignificantBit += step;
+				}
+			}
+			std::uint32_t shift = mostSignificantBit - SUB_BUCKET_BITS;
+			retVal = ((shift + 1) * SUB_BUCKET_COUNT) + ((value >> shift) & (SUB_BUCKET_COUNT - 1));
+		}
+		return retVal;
+	}
+
+	std::uint32_t CANLatencyHistogram::get_bucket_upper_bound(std::uint32_t index)
+	{
+		std::uint32_t retVal = index;
+
+		if (index >= SUB_BUCKET_COUNT)
+		{
+			std::uint32_t shift = (index / SUB_BUCKET_COUNT) - 1;
+			std::uint64_t lowerBound = static_cast<std::uint64_t>(SUB_BUCKET_COUNT + (index % SUB_BUCKET_COUNT)) << shift;
+			std::uint64_t upperBound = lowerBound + (static_cast<std::uint64_t>(1) << shift) - 1;
+			retVal = static_cast<std::uint32_t>((upperBound > std::numeric_limits<std::uint32_t>::max()) ? std::numeric_limits<std::uint32_t>::max() : upperBound);
+		}
+		return retVal;
+	}
+
+	void CANLatencyMonitor::record(std::uint8_t channelIndex, Stage stage, std::uint64_t latency_us)
+	{
+		if ((channelIndex < CAN_PORT_MAXIMUM) &&
+		    (stage < Stage::NumberOfStages))
+		{
+			histograms[channelIndex][static_cast<std::size_t>(stage)].record(latency_us);
+		}
+	}
+
+	CANLatencyMonitor::Statistics CANLatencyMonitor::get_statistics(std::uint8_t channelIndex, Stage stage)
+	{
+		Statistics retVal = { 0, 0, 0, 0, 0 };
+
+		if ((channelIndex < CAN_PORT_MAXIMUM) &&
+		    (stage < Stage::NumberOfStages))
+		{
+			const CANLatencyHistogram &histogram = histograms[channelIndex][static_cast<std::size_t>(stage)];
+			retVal.sampleCount = histogram.get_sample_count();
+			retVal.mean_us = histogram.get_mean_us();
+			retVal.median_us = histogram.get_percentile_us(50.0f);
+			retVal.percentile99_us = histogram.get_percentile_us(99.0f);
+			retVal.maximum_us = histogram.get_maximum_us();
+		}
+		return retVal;
+	}
+
+	std::uint32_t CANLatencyMonitor::get_percentile_us(std::uint8_t channelIndex, Stage stage, float percentile)
+	{
+		std::uint32_t retVal = 0;
+
+		if ((channelIndex < CAN_PORT_MAXIMUM) &&
+		    (stage < Stage::NumberOfStages))
+		{
+			retVal = histograms[channelIndex][static_cast<std::size_t>(stage)].get_percentile_us(percentile);
+		}
+		return retVal;
+	}
+
+	void CANLatencyMonitor::reset()
+	{
+		for (auto &channelHistograms : histograms)
+		{
+			for (auto &histogram : channelHistograms)
+			{
+				histogram.reset();
+			}
+		}
+	}
+} // namespace isobus
@@ -36,12 +36,22 @@ namespace isobus
 
 	std::shared_ptr<ControlFunction> CANMessage::get_source_control_function() const
 	{
-		return source;
+		return (nullptr != source) ? source : sourceHandle.lock();
 	}
 
 	std::shared_ptr<ControlFunction> CANMessage::get_destination_control_function() const
 	{
-		return destination;
+		return (nullptr != destination) ? destination : destinationHandle.lock();
+	}
+
+	ControlFunction *CANMessage::get_source_control_function_pointer() const
+	{
+		return (nullptr != source) ? source.get() : sourceHandle.get();
+	}
+
+	ControlFunction *CANMessage::get_destination_control_function_pointer() const
+	{
+		return (nullptr != destination) ? destination.get() : destinationHandle.get();
 	}
 
 	CANIdentifier CANMessage::get_identifier() const
@@ -54,6 +64,16 @@ namespace isobus
 		return CANPortIndex;
 	}
 
+	std::uint64_t CANMessage::get_timestamp_us() const
+	{
+		return timestamp_us;
+	}
+
+	std::uint64_t CANMessage::get_completion_timestamp_us() const
+	{
+		return completionTimestamp_us;
+	}
+
 	void CANMessage::set_data(const std::uint8_t *dataBuffer, std::uint32_t length)
 	{
 		assert(length <= ABSOLUTE_MAX_MESSAGE_LENGTH && "CANMessage::set_data() called with length greater than maximum supported");
@@ -77,11 +97,25 @@ namespace isobus
 	void CANMessage::set_source_control_function(std::shared_ptr<ControlFunction> value)
 	{
 		source = value;
+		sourceHandle = ControlFunctionHandle();
 	}
 
 	void CANMessage::set_destination_control_function(std::shared_ptr<ControlFunction> value)
 	{
 		destination = value;
+		destinationHandle = ControlFunctionHandle();
+	}
+
+	void CANMessage::set_source_control_function(const ControlFunctionHandle &value)
+	{
+		source = nullptr;
+		sourceHandle = value;
+	}
+
+	void CANMessage::set_destination_control_function(const ControlFunctionHandle &value)
+	{
+		destination = nullptr;
+		destinationHandle = value;
 	}
 
 	void CANMessage::set_identifier(CANIdentifier value)
@@ -89,6 +123,35 @@ namespace isobus
 		identifier = value;
 	}
 
+	void CANMessage::set_timestamp_us(std::uint64_t value)
+	{
+		timestamp_us = value;
+		completionTimestamp_us = value;
+	}
+
+	void CANMessage::set_completion_timestamp_us(std::uint64_t value)
+	{
+		completionTimestamp_us = value;
+	}
+
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+	void CANMessage::set_pipeline_timestamps(std::uint64_t readTimestamp_us, std::uint64_t dequeueTimestamp_us)
+	{
+		pipelineReadTimestamp_us = readTimestamp_us;
+		pipelineDequeueTimestamp_us = dequeueTimestamp_us;
+	}
+
+	std::uint64_t CANMessage::get_pipeline_read_timestamp_us() const
+	{
+		return pipelineReadTimestamp_us;
+	}
+
+	std::uint64_t CANMessage::get_pipeline_dequeue_timestamp_us() const
+	{
+		return pipelineDequeueTimestamp_us;
+	}
+#endif
+
 	std::uint8_t CANMessage::get_uint8_at(const std::uint32_t index) const
 	{
 		return data.at(index);
@@ -13,6 +13,7 @@
 #include "isobus/isobus/can_constants.hpp"
 #include "isobus/isobus/can_general_parameter_group_numbers.hpp"
 #include "isobus/isobus/can_hardware_abstraction.hpp"
+#include "isobus/isobus/can_latency_monitor.hpp"
 #include "isobus/isobus/can_message.hpp"
 #include "isobus/isobus/can_partnered_control_function.hpp"
 #include "isobus/isobus/can_protocol.hpp"
@@ -132,26 +133,21 @@ namespace isobus
 		    ((parameterGroupNumber == static_cast<std::uint32_t>(CANLibParameterGroupNumber::AddressClaim)) ||
 		     (sourceControlFunction->get_address_valid())))
 		{
-			CANLibProtocol *currentProtocol;
-
 			// See if any transport layer protocol can handle this message
-			for (std::uint32_t i = 0; i < CANLibProtocol::get_number_protocols(); i++)
+			for (const auto &currentProtocol : protocolList)
 			{
-				if (CANLibProtocol::get_protocol(i, currentProtocol))
+				retVal = currentProtocol->protocol_transmit_message(parameterGroupNumber,
+				                                                    dataBuffer,
+				                                                    dataLength,
+				                                                    sourceControlFunction,
+				                                                    destinationControlFunction,
+				                                                    transmitCompleteCallback,
+				                                                    parentPointer,
+				                                                    frameChunkCallback);
+
+				if (retVal)
 				{
-					retVal = currentProtocol->protocol_transmit_message(parameterGroupNumber,
-					                                                    dataBuffer,
-					                                                    dataLength,
-					                                                    sourceControlFunction,
-					                                                    destinationControlFunction,
-					                                                    transmitCompleteCallback,
-					                                                    parentPointer,
-					                                                    frameChunkCallback);
-
-					if (retVal)
-					{
-						break;
-					}
+					break;
 				}
 			}
 
@@ -195,8 +191,9 @@ namespace isobus
 	void CANNetworkManager::update()
 	{
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
-		const std::lock_guard<std::mutex> lock(ControlFunction::controlFunctionProcessingMutex);
+		const std::lock_guard<std::mutex> lock(controlFunctionProcessingMutex);
 #endif
+		const SystemTiming::Snapshot timeSnapshot; // All protocols share one timestamp for this update
 
 		if (!initialized)
 		{
@@ -211,18 +208,13 @@ namespace isobus
 
 		prune_inactive_control_functions();
 
-		for (std::size_t i = 0; i < CANLibProtocol::get_number_protocols(); i++)
+		for (const auto &currentProtocol : protocolList)
 		{
-			CANLibProtocol *currentProtocol = nullptr;
-
-			if (CANLibProtocol::get_protocol(i, currentProtocol))
+			if (!currentProtocol->get_is_initialized())
 			{
-				if (!currentProtocol->get_is_initialized())
-				{
-					currentProtocol->initialize({});
-				}
-				currentProtocol->update({});
+				currentProtocol->initialize({});
 			}
+			currentProtocol->update({});
 		}
 		update_busload_history();
 		updateTimestamp_ms = SystemTiming::get_timestamp_ms();
@@ -267,25 +259,52 @@ namespace isobus
 	}
 
 	void CANNetworkManager::process_receive_can_message_frame(const CANMessageFrame &rxFrame)
+	{
+		CANNetwork.receive_can_message_frame(rxFrame);
+	}
+
+	void CANNetworkManager::process_transmitted_can_message_frame(const CANMessageFrame &txFrame)
+	{
+		CANNetwork.on_can_message_frame_transmitted(txFrame);
+	}
+
+	void CANNetworkManager::receive_can_message_frame(const CANMessageFrame &rxFrame)
 	{
 		CANMessage tempCANMessage(rxFrame.channel);
 
-		CANNetworkManager::CANNetwork.update_control_functions(rxFrame);
+		update_control_functions(rxFrame);
 
 		tempCANMessage.set_identifier(CANIdentifier(rxFrame.identifier));
 
-		tempCANMessage.set_source_control_function(CANNetworkManager::CANNetwork.get_control_function(rxFrame.channel, tempCANMessage.get_identifier().get_source_address()));
-		tempCANMessage.set_destination_control_function(CANNetworkManager::CANNetwork.get_control_function(rxFrame.channel, tempCANMessage.get_identifier().get_destination_address()));
+		tempCANMessage.set_source_control_function(get_control_function_handle(rxFrame.channel, tempCANMessage.get_identifier().get_source_address()));
+		tempCANMessage.set_destination_control_function(get_control_function_handle(rxFrame.channel, tempCANMessage.get_identifier().get_destination_address()));
 		tempCANMessage.set_data(rxFrame.data, rxFrame.dataLength);
+		tempCANMessage.set_timestamp_us(rxFrame.timestamp_us);
+
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+		if (0 != rxFrame.queueTimestamp_us)
+		{
+			// The frame was just taken off of the hardware interface's Rx queue
+			std::uint64_t dequeueTimestamp_us = SystemTiming::get_uncached_timestamp_us();
+			CANLatencyMonitor::record(rxFrame.channel, CANLatencyMonitor::Stage::RxQueue, dequeueTimestamp_us - rxFrame.queueTimestamp_us);
+			tempCANMessage.set_pipeline_timestamps(rxFrame.readTimestamp_us, dequeueTimestamp_us);
+		}
+#endif
 
-		CANNetworkManager::CANNetwork.update_busload(rxFrame.channel, rxFrame.get_number_bits_in_message());
+		update_busload(rxFrame.channel, rxFrame.get_number_bits_in_message());
 
-		CANNetworkManager::CANNetwork.receive_can_message(tempCANMessage);
+		receive_can_message(tempCANMessage);
 	}
 
-	void CANNetworkManager::process_transmitted_can_message_frame(const CANMessageFrame &txFrame)
+	void CANNetworkManager::on_can_message_frame_transmitted(const CANMessageFrame &txFrame)
 	{
-		CANNetworkManager::CANNetwork.update_busload(txFrame.channel, txFrame.get_number_bits_in_message());
+		update_busload(txFrame.channel, txFrame.get_number_bits_in_message());
+	}
+
+	void CANNetworkManager::set_frame_transmit_callback(FrameTransmitCallback callback, void *parentPointer)
+	{
+		frameTransmitCallback = callback;
+		frameTransmitParent = parentPointer;
 	}
 
 	void CANNetworkManager::on_control_function_destroyed(std::shared_ptr<ControlFunction> controlFunction, CANLibBadge<ControlFunction>)
@@ -299,11 +318,7 @@ namespace isobus
 			partneredControlFunctions.erase(std::remove(partneredControlFunctions.begin(), partneredControlFunctions.end(), controlFunction), partneredControlFunctions.end());
 		}
 
-		auto result = std::find(inactiveControlFunctions.begin(), inactiveControlFunctions.end(), controlFunction);
-		if (result != inactiveControlFunctions.end())
-		{
-			inactiveControlFunctions.erase(result);
-		}
+		remove_inactive_control_function(controlFunction);
 
 		for (std::uint8_t i = 0; i < NULL_CAN_ADDRESS; i++)
 		{
@@ -319,12 +334,12 @@ namespace isobus
 					if (initialized)
 					{
 						// The control function was active, replace it with an new external control function
-						controlFunctionTable[controlFunction->get_can_port()][controlFunction->address] = ControlFunction::create(controlFunction->get_NAME(), controlFunction->get_address(), controlFunction->get_can_port());
+						set_control_function_table_entry(controlFunction->get_can_port(), controlFunction->address, ControlFunction::create(controlFunction->get_NAME(), controlFunction->get_address(), controlFunction->get_can_port(), *this));
 					}
 					else
 					{
 						// The network manager is not initialized yet, just remove the control function from the table
-						controlFunctionTable[controlFunction->get_can_port()][i] = nullptr;
+						set_control_function_table_entry(controlFunction->get_can_port(), i, nullptr);
 					}
 				}
 			}
@@ -436,11 +451,15 @@ namespace isobus
 		return retVal;
 	}
 
-	CANNetworkManager::CANNetworkManager()
+	CANNetworkManager::CANNetworkManager() :
+	  extendedTransportProtocol(*this),
+	  fastPacketProtocol(*this),
+	  transportProtocol(*this)
 	{
 		currentBusloadBitAccumulator.fill(0);
 		lastAddressClaimRequestTimestamp_ms.fill(0);
 		controlFunctionTable.fill({ nullptr });
+		controlFunctionTableGenerations.fill({ 0 });
 	}
 
 	void CANNetworkManager::update_address_table(const CANMessage &message)
@@ -458,7 +477,7 @@ namespace isobus
 				// Someone is at that spot in the table, but their address was stolen
 				// Need to evict them from the table and move them to the inactive list
 				targetControlFunction->address = NULL_CAN_ADDRESS;
-				inactiveControlFunctions.push_back(targetControlFunction);
+				add_inactive_control_function(targetControlFunction);
 				CANStackLogger::info("[NM]: %s CF '%016llx' is evicted from address '%d' on channel '%d', as their address is probably stolen.",
 				                     targetControlFunction->get_type_string().c_str(),
 				                     targetControlFunction->get_NAME().get_full_name(),
@@ -479,7 +498,7 @@ namespace isobus
 					if ((currentControlFunction->get_address() == claimedAddress) &&
 					    (currentControlFunction->get_can_port() == channelIndex))
 					{
-						controlFunctionTable[channelIndex][claimedAddress] = currentControlFunction;
+						set_control_function_table_entry(channelIndex, claimedAddress, currentControlFunction);
 						CANStackLogger::debug("[NM]: %s CF '%016llx' is now active at address '%d' on channel '%d'.",
 						                      currentControlFunction->get_type_string().c_str(),
 						                      currentControlFunction->get_NAME().get_full_name(),
@@ -532,7 +551,7 @@ namespace isobus
 				{
 					if (controlFunctionTable[channelIndex][address] == currentInternalControlFunction)
 					{
-						controlFunctionTable[channelIndex][address] = nullptr;
+						set_control_function_table_entry(channelIndex, address, nullptr);
 						break;
 					}
 				}
@@ -542,11 +561,11 @@ namespace isobus
 					// Someone is at that spot in the table, but their address was stolen by an internal control function
 					// Need to evict them from the table
 					controlFunctionTable[channelIndex][claimedAddress]->address = NULL_CAN_ADDRESS;
-					controlFunctionTable[channelIndex][claimedAddress] = nullptr;
+					set_control_function_table_entry(channelIndex, claimedAddress, nullptr);
 				}
 
 				// ECU has claimed since the last update, add it to the table
-				controlFunctionTable[channelIndex][claimedAddress] = currentInternalControlFunction;
+				set_control_function_table_entry(channelIndex, claimedAddress, currentInternalControlFunction);
 			}
 		}
 	}
@@ -554,7 +573,7 @@ namespace isobus
 	void CANNetworkManager::update_busload(std::uint8_t channelIndex, std::uint32_t numberOfBitsProcessed)
 	{
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
-		const std::lock_guard<std::mutex> lock(CANNetworkManager::CANNetwork.busloadUpdateMutex);
+		const std::lock_guard<std::mutex> lock(busloadUpdateMutex);
 #endif
 		currentBusloadBitAccumulator.at(channelIndex) += numberOfBitsProcessed;
 	}
@@ -600,25 +619,28 @@ namespace isobus
 			claimedNAME |= (static_cast<std::uint64_t>(rxFrame.data[7]) << 56);
 
 			// Check if the claimed NAME is someone we already know about
-			auto activeResult = std::find_if(controlFunctionTable[rxFrame.channel].begin(),
-			                                 controlFunctionTable[rxFrame.channel].end(),
-			                                 [claimedNAME](const std::shared_ptr<ControlFunction> &cf) {
-				                                 return (nullptr != cf) && (cf->controlFunctionNAME.get_full_name() == claimedNAME);
-			                                 });
-			if (activeResult != controlFunctionTable[rxFrame.channel].end())
+			auto activeResult = controlFunctionAddressesByNAME[rxFrame.channel].find(claimedNAME);
+			if (activeResult != controlFunctionAddressesByNAME[rxFrame.channel].end())
 			{
-				foundControlFunction = *activeResult;
+				const std::shared_ptr<ControlFunction> &tableEntry = controlFunctionTable[rxFrame.channel][activeResult->second];
+
+				if ((nullptr != tableEntry) && (tableEntry->controlFunctionNAME.get_full_name() == claimedNAME))
+				{
+					foundControlFunction = tableEntry;
+				}
+				else
+				{
+					// The NAME has since been replaced in the table
+					controlFunctionAddressesByNAME[rxFrame.channel].erase(activeResult);
+				}
 			}
-			else
+
+			if (nullptr == foundControlFunction)
 			{
-				auto inActiveResult = std::find_if(inactiveControlFunctions.begin(),
-				                                   inactiveControlFunctions.end(),
-				                                   [claimedNAME, &rxFrame](const std::shared_ptr<ControlFunction> &cf) {
-					                                   return (cf->controlFunctionNAME.get_full_name() == claimedNAME) && (cf->get_can_port() == rxFrame.channel);
-				                                   });
-				if (inActiveResult != inactiveControlFunctions.end())
+				auto inActiveResult = inactiveControlFunctionsByNAME[rxFrame.channel].find(claimedNAME);
+				if (inActiveResult != inactiveControlFunctionsByNAME[rxFrame.channel].end())
 				{
-					foundControlFunction = *inActiveResult;
+					foundControlFunction = inActiveResult->second;
 				}
 			}
 
@@ -633,7 +655,7 @@ namespace isobus
 					{
 						partner->controlFunctionNAME = NAME(claimedNAME);
 						foundControlFunction = partner;
-						controlFunctionTable[rxFrame.channel][claimedAddress] = foundControlFunction;
+						set_control_function_table_entry(rxFrame.channel, claimedAddress, foundControlFunction);
 						break;
 					}
 				}
@@ -657,16 +679,16 @@ namespace isobus
 			if (nullptr == foundControlFunction)
 			{
 				// New device, need to start keeping track of it
-				foundControlFunction = ControlFunction::create(NAME(claimedNAME), claimedAddress, rxFrame.channel);
-				controlFunctionTable[rxFrame.channel][foundControlFunction->get_address()] = foundControlFunction;
+				foundControlFunction = ControlFunction::create(NAME(claimedNAME), claimedAddress, rxFrame.channel, *this);
+				set_control_function_table_entry(rxFrame.channel, foundControlFunction->get_address(), foundControlFunction);
 				CANStackLogger::debug("[NM]: A control function claimed address %u on channel %u", foundControlFunction->get_address(), foundControlFunction->get_can_port());
 			}
 			else if (foundControlFunction->address != claimedAddress)
 			{
 				if (foundControlFunction->get_address_valid())
 				{
-					controlFunctionTable[rxFrame.channel][claimedAddress] = foundControlFunction;
-					controlFunctionTable[rxFrame.channel][foundControlFunction->get_address()] = nullptr;
+					set_control_function_table_entry(rxFrame.channel, claimedAddress, foundControlFunction);
+					set_control_function_table_entry(rxFrame.channel, foundControlFunction->get_address(), nullptr);
 					CANStackLogger::info("[NM]: The %s control function at address %d changed it's address to %d on channel %u.",
 					                     foundControlFunction->get_type_string().c_str(),
 					                     foundControlFunction->get_address(),
@@ -700,7 +722,7 @@ namespace isobus
 					    (partner->get_can_port() == (*currentInactiveControlFunction)->get_can_port()) &&
 					    (ControlFunction::Type::External == (*currentInactiveControlFunction)->get_type()))
 					{
-						inactiveControlFunctions.erase(currentInactiveControlFunction);
+						remove_inactive_control_function(*currentInactiveControlFunction);
 						break;
 					}
 				}
@@ -721,7 +743,7 @@ namespace isobus
 						partner->address = currentActiveControlFunction->get_address();
 						partner->controlFunctionNAME = currentActiveControlFunction->get_NAME();
 						partner->initialized = true;
-						controlFunctionTable[partner->get_can_port()][partner->address] = std::shared_ptr<ControlFunction>(partner);
+						set_control_function_table_entry(partner->get_can_port(), partner->address, partner);
 						process_control_function_state_change_callback(partner, ControlFunctionState::Online);
 						break;
 					}
@@ -802,12 +824,78 @@ namespace isobus
 		return retVal;
 	}
 
+	ControlFunctionHandle CANNetworkManager::get_control_function_handle(std::uint8_t channelIndex, std::uint8_t address) const
+	{
+		ControlFunctionHandle retVal;
+
+		if ((address < NULL_CAN_ADDRESS) && (channelIndex < CAN_PORT_MAXIMUM))
+		{
+			retVal = ControlFunctionHandle(controlFunctionTable[channelIndex][address], controlFunctionTableGenerations[channelIndex][address]);
+		}
+		return retVal;
+	}
+
+	void CANNetworkManager::set_control_function_table_entry(std::uint8_t channelIndex, std::uint8_t address, std::shared_ptr<ControlFunction> controlFunction)
+	{
+		std::shared_ptr<ControlFunction> &tableEntry = controlFunctionTable[channelIndex][address];
+
+		// Handles stay valid if a CF is replaced by one with the same NAME, like when a partner takes over from
+		// an external CF, since messages already queued from that device still came from the same NAME.
+		if ((tableEntry != controlFunction) &&
+		    ((nullptr == tableEntry) ||
+		     (nullptr == controlFunction) ||
+		     (tableEntry->get_NAME().get_full_name() != controlFunction->get_NAME().get_full_name())))
+		{
+			controlFunctionTableGenerations[channelIndex][address]++;
+		}
+		tableEntry = controlFunction;
+
+		if (nullptr != controlFunction)
+		{
+			controlFunctionAddressesByNAME[channelIndex][controlFunction->get_NAME().get_full_name()] = address;
+		}
+	}
+
+	void CANNetworkManager::add_inactive_control_function(const std::shared_ptr<ControlFunction> &controlFunction)
+	{
+		inactiveControlFunctions.push_back(controlFunction);
+
+		if (controlFunction->get_can_port() < CAN_PORT_MAXIMUM)
+		{
+			inactiveControlFunctionsByNAME[controlFunction->get_can_port()].emplace(controlFunction->get_NAME().get_full_name(), controlFunction);
+		}
+	}
+
+	void CANNetworkManager::remove_inactive_control_function(const std::shared_ptr<ControlFunction> &controlFunction)
+	{
+		auto result = std::find(inactiveControlFunctions.begin(), inactiveControlFunctions.end(), controlFunction);
+		if (result != inactiveControlFunctions.end())
+		{
+			if (controlFunction->get_can_port() < CAN_PORT_MAXIMUM)
+			{
+				auto &channelInactiveControlFunctions = inactiveControlFunctionsByNAME[controlFunction->get_can_port()];
+				auto range = channelInactiveControlFunctions.equal_range(controlFunction->get_NAME().get_full_name());
+				auto indexEntry = std::find_if(range.first, range.second, [&controlFunction](const std::pair<const std::uint64_t, std::shared_ptr<ControlFunction>> &entry) {
+					return entry.second == controlFunction;
+				});
+
+				if (range.second != indexEntry)
+				{
+					channelInactiveControlFunctions.erase(indexEntry);
+				}
+			}
+
+			// Erased last, since the caller's reference may be to the list entry itself
+			inactiveControlFunctions.erase(result);
+		}
+	}
+
 	CANMessage CANNetworkManager::get_next_can_message_from_rx_queue()
 	{
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
 		std::lock_guard<std::mutex> lock(receiveMessageMutex);
 #endif
-		CANMessage retVal = receiveMessageList.front();
+		CANMessage retVal = std::move(receiveMessageList.front());
 		receiveMessageList.pop_front();
 		return retVal;
 	}
@@ -837,13 +925,17 @@ namespace isobus
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
 		const std::lock_guard<std::mutex> lock(anyControlFunctionCallbacksMutex);
 #endif
-		for (const auto &currentCallback : anyControlFunctionParameterGroupNumberCallbacks)
+		const ControlFunction *messageDestination = currentMessage.get_destination_control_function_pointer();
+
+		if ((nullptr == messageDestination) ||
+		    (ControlFunction::Type::Internal == messageDestination->get_type()))
 		{
-			if ((currentCallback.get_parameter_group_number() == currentMessage.get_identifier().get_parameter_group_number()) &&
-			    ((nullptr == currentMessage.get_destination_control_function()) ||
-			     (ControlFunction::Type::Internal == currentMessage.get_destination_control_function()->get_type())))
+			for (const auto &currentCallback : anyControlFunctionParameterGroupNumberCallbacks)
 			{
-				currentCallback.get_callback()(currentMessage, currentCallback.get_parent());
+				if (currentCallback.get_parameter_group_number() == currentMessage.get_identifier().get_parameter_group_number())
+				{
+					currentCallback.get_callback()(currentMessage, currentCallback.get_parent());
+				}
 			}
 		}
 	}
@@ -895,9 +987,9 @@ namespace isobus
 
 	void CANNetworkManager::process_can_message_for_global_and_partner_callbacks(const CANMessage &message)
 	{
-		std::shared_ptr<ControlFunction> messageDestination = message.get_destination_control_function();
+		const ControlFunction *messageDestination = message.get_destination_control_function_pointer();
 		if ((nullptr == messageDestination) &&
-		    ((nullptr != message.get_source_control_function()) ||
+		    ((nullptr != message.get_source_control_function_pointer()) ||
 		     ((static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest) == message.get_identifier().get_parameter_group_number()) &&
 		      (NULL_CAN_ADDRESS == message.get_identifier().get_source_address()))))
 		{
@@ -941,7 +1033,7 @@ namespace isobus
 	{
 		constexpr std::uint8_t COMMANDED_ADDRESS_LENGTH = 9;
 
-		if ((nullptr == message.get_destination_control_function()) &&
+		if ((nullptr == message.get_destination_control_function_pointer()) &&
 		    (static_cast<std::uint32_t>(CANLibParameterGroupNumber::CommandedAddress) == message.get_identifier().get_parameter_group_number()) &&
 		    (COMMANDED_ADDRESS_LENGTH == message.get_data_length()))
 		{
@@ -964,6 +1056,14 @@ namespace isobus
 		{
 			CANMessage currentMessage = get_next_can_message_from_rx_queue();
 
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+			std::uint64_t dispatchTimestamp_us = SystemTiming::get_uncached_timestamp_us();
+			if (0 != currentMessage.get_pipeline_dequeue_timestamp_us())
+			{
+				CANLatencyMonitor::record(currentMessage.get_can_port_index(), CANLatencyMonitor::Stage::RxStackQueue, dispatchTimestamp_us - currentMessage.get_pipeline_dequeue_timestamp_us());
+			}
+#endif
+
 			update_address_table(currentMessage);
 			process_can_message_for_address_violations(currentMessage);
 
@@ -973,6 +1073,15 @@ namespace isobus
 
 			// Update Others
 			process_can_message_for_global_and_partner_callbacks(currentMessage);
+
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+			if (0 != currentMessage.get_pipeline_dequeue_timestamp_us())
+			{
+				std::uint64_t callbacksCompleteTimestamp_us = SystemTiming::get_uncached_timestamp_us();
+				CANLatencyMonitor::record(currentMessage.get_can_port_index(), CANLatencyMonitor::Stage::RxCallbacks, callbacksCompleteTimestamp_us - dispatchTimestamp_us);
+				CANLatencyMonitor::record(currentMessage.get_can_port_index(), CANLatencyMonitor::Stage::RxTotal, callbacksCompleteTimestamp_us - currentMessage.get_pipeline_read_timestamp_us());
+			}
+#endif
 		}
 	}
 
@@ -991,9 +1100,9 @@ namespace isobus
 					    (!controlFunction->claimedAddressSinceLastAddressClaimRequest) &&
 					    (ControlFunction::Type::Internal != controlFunction->get_type()))
 					{
-						inactiveControlFunctions.push_back(controlFunction);
+						add_inactive_control_function(controlFunction);
 						CANStackLogger::info("[NM]: Control function with address %u and NAME %016llx is now offline on channel %u.", controlFunction->get_address(), controlFunction->get_NAME(), channelIndex);
-						controlFunctionTable[channelIndex][i] = nullptr;
+						set_control_function_table_entry(channelIndex, i, nullptr);
 						controlFunction->address = NULL_CAN_ADDRESS;
 						process_control_function_state_change_callback(controlFunction, ControlFunctionState::Offline);
 					}
@@ -1016,7 +1125,14 @@ namespace isobus
 		if ((DEFAULT_IDENTIFIER != tempFrame.identifier) &&
 		    (portIndex < CAN_PORT_MAXIMUM))
 		{
-			retVal = send_can_message_frame_to_hardware(tempFrame);
+			if (nullptr != frameTransmitCallback)
+			{
+				retVal = frameTransmitCallback(tempFrame, frameTransmitParent);
+			}
+			else
+			{
+				retVal = send_can_message_frame_to_hardware(tempFrame);
+			}
 		}
 		return retVal;
 	}
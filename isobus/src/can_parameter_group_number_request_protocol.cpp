@@ -20,17 +20,18 @@ namespace isobus
 {
 
 	ParameterGroupNumberRequestProtocol::ParameterGroupNumberRequestProtocol(std::shared_ptr<InternalControlFunction> internalControlFunction, CANLibBadge<InternalControlFunction>) :
-	  myControlFunction(internalControlFunction)
+	  myControlFunction(internalControlFunction),
+	  network(internalControlFunction->get_network())
 	{
 		assert(nullptr != myControlFunction && "ParameterGroupNumberRequestProtocol::ParameterGroupNumberRequestProtocol() called with nullptr internalControlFunction");
-		CANNetworkManager::CANNetwork.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest), process_message, this);
-		CANNetworkManager::CANNetwork.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RequestForRepetitionRate), process_message, this);
+		network.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest), process_message, this);
+		network.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RequestForRepetitionRate), process_message, this);
 	}
 
 	ParameterGroupNumberRequestProtocol::~ParameterGroupNumberRequestProtocol()
 	{
-		CANNetworkManager::CANNetwork.remove_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest), process_message, this);
-		CANNetworkManager::CANNetwork.remove_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RequestForRepetitionRate), process_message, this);
+		network.remove_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest), process_message, this);
+		network.remove_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RequestForRepetitionRate), process_message, this);
 	}
 
 	bool ParameterGroupNumberRequestProtocol::request_parameter_group_number(std::uint32_t pgn, std::shared_ptr<InternalControlFunction> source, std::shared_ptr<ControlFunction> destination)
@@ -41,11 +42,16 @@ namespace isobus
 		buffer[1] = static_cast<std::uint8_t>((pgn >> 8) & 0xFF);
 		buffer[2] = static_cast<std::uint8_t>((pgn >> 16) & 0xFF);
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest),
-		                                                      buffer.data(),
-		                                                      PGN_REQUEST_LENGTH,
-		                                                      source,
-		                                                      destination);
+		bool retVal = false;
+		if (nullptr != source)
+		{
+			retVal = source->get_network().send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ParameterGroupNumberRequest),
+			                                                buffer.data(),
+			                                                PGN_REQUEST_LENGTH,
+			                                                source,
+			                                                destination);
+		}
+		return retVal;
 	}
 
 	bool ParameterGroupNumberRequestProtocol::request_repetition_rate(std::uint32_t pgn, std::uint16_t repetitionRate_ms, std::shared_ptr<InternalControlFunction> source, std::shared_ptr<ControlFunction> destination)
@@ -61,11 +67,16 @@ namespace isobus
 		buffer[6] = 0xFF;
 		buffer[7] = 0xFF;
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RequestForRepetitionRate),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      source,
-		                                                      destination);
+		bool retVal = false;
+		if (nullptr != source)
+		{
+			retVal = source->get_network().send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RequestForRepetitionRate),
+			                                                buffer.data(),
+			                                                CAN_DATA_LENGTH,
+			                                                source,
+			                                                destination);
+		}
+		return retVal;
 	}
 
 	bool ParameterGroupNumberRequestProtocol::register_pgn_request_callback(std::uint32_t pgn, PGNRequestCallback callback, void *parentPointer)
@@ -172,16 +183,16 @@ namespace isobus
 
 	void ParameterGroupNumberRequestProtocol::process_message(const CANMessage &message)
 	{
-		if (((nullptr == message.get_destination_control_function()) &&
+		if (((nullptr == message.get_destination_control_function_pointer()) &&
 		     (BROADCAST_CAN_ADDRESS == message.get_identifier().get_destination_address())) ||
-		    (message.get_destination_control_function() == myControlFunction))
+		    (message.get_destination_control_function_pointer() == myControlFunction.get()))
 		{
 			switch (message.get_identifier().get_parameter_group_number())
 			{
 				case static_cast<std::uint32_t>(CANLibParameterGroupNumber::RequestForRepetitionRate):
 				{
 					// Can't send this request to global, and must be 8 bytes. Ignore illegal message formats
-					if ((CAN_DATA_LENGTH == message.get_data_length()) && (nullptr != message.get_destination_control_function()))
+					if ((CAN_DATA_LENGTH == message.get_data_length()) && (nullptr != message.get_destination_control_function_pointer()))
 					{
 						std::uint32_t requestedPGN = message.get_uint24_at(0);
 						std::uint16_t requestedRate = message.get_uint16_at(3);
@@ -237,7 +248,7 @@ namespace isobus
 								// Now we need to know if we shoulc ACK it.
 								// We should not ACK messages that send the actual PGN as a result of requesting it. This behavior is up to
 								// the application layer to do properly.
-								if (shouldAck && (nullptr != message.get_destination_control_function()))
+								if (shouldAck && (nullptr != message.get_destination_control_function_pointer()))
 								{
 									send_acknowledgement(ackType,
 									                     requestedPGN,
@@ -248,7 +259,7 @@ namespace isobus
 							}
 						}
 
-						if ((!anyCallbackProcessed) && (nullptr != message.get_destination_control_function()))
+						if ((!anyCallbackProcessed) && (nullptr != message.get_destination_control_function_pointer()))
 						{
 							send_acknowledgement(AcknowledgementType::Negative,
 							                     requestedPGN,
@@ -294,11 +305,11 @@ namespace isobus
 			buffer[6] = static_cast<std::uint8_t>((parameterGroupNumber >> 8) & 0xFF);
 			buffer[7] = static_cast<std::uint8_t>((parameterGroupNumber >> 16) & 0xFF);
 
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Acknowledge),
-			                                                        buffer.data(),
-			                                                        CAN_DATA_LENGTH,
-			                                                        myControlFunction,
-			                                                        nullptr);
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Acknowledge),
+			                                buffer.data(),
+			                                CAN_DATA_LENGTH,
+			                                myControlFunction,
+			                                nullptr);
 		}
 		return retVal;
 	}
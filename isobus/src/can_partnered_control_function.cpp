@@ -18,20 +18,25 @@
 
 namespace isobus
 {
-	PartneredControlFunction::PartneredControlFunction(std::uint8_t CANPort, const std::vector<NAMEFilter> NAMEFilters, CANLibBadge<PartneredControlFunction>) :
-	  ControlFunction(NAME(0), NULL_CAN_ADDRESS, CANPort, Type::Partnered),
+	PartneredControlFunction::PartneredControlFunction(std::uint8_t CANPort, const std::vector<NAMEFilter> NAMEFilters, CANNetworkManager &parentNetwork, CANLibBadge<PartneredControlFunction>) :
+	  ControlFunction(NAME(0), NULL_CAN_ADDRESS, CANPort, parentNetwork, Type::Partnered),
 	  NAMEFilterList(NAMEFilters)
 	{
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
-		const std::lock_guard<std::mutex> lock(ControlFunction::controlFunctionProcessingMutex);
+		const std::lock_guard<std::mutex> lock(network.controlFunctionProcessingMutex);
 #endif
 	}
 
 	std::shared_ptr<PartneredControlFunction> PartneredControlFunction::create(std::uint8_t CANPort, const std::vector<NAMEFilter> NAMEFilters)
+	{
+		return create(CANPort, NAMEFilters, CANNetworkManager::CANNetwork);
+	}
+
+	std::shared_ptr<PartneredControlFunction> PartneredControlFunction::create(std::uint8_t CANPort, const std::vector<NAMEFilter> NAMEFilters, CANNetworkManager &parentNetwork)
 	{
 		// Unfortunately, we can't use `std::make_shared` here because the constructor is meant to be protected
-		auto controlFunction = std::shared_ptr<PartneredControlFunction>(new PartneredControlFunction(CANPort, NAMEFilters, {}));
-		CANNetworkManager::CANNetwork.on_control_function_created(controlFunction, CANLibBadge<PartneredControlFunction>());
+		auto controlFunction = std::shared_ptr<PartneredControlFunction>(new PartneredControlFunction(CANPort, NAMEFilters, parentNetwork, {}));
+		parentNetwork.on_control_function_created(controlFunction, CANLibBadge<PartneredControlFunction>());
 		return controlFunction;
 	}
 
@@ -15,19 +15,20 @@
 
 namespace isobus
 {
-	CANLibProtocol::CANLibProtocol() :
+	CANLibProtocol::CANLibProtocol(CANNetworkManager &parentNetwork) :
+	  network(parentNetwork),
 	  initialized(false)
 	{
-		CANNetworkManager::CANNetwork.protocolList.push_back(this);
+		network.protocolList.push_back(this);
 	}
 
 	CANLibProtocol::~CANLibProtocol()
 	{
-		auto protocolLocation = find(CANNetworkManager::CANNetwork.protocolList.begin(), CANNetworkManager::CANNetwork.protocolList.end(), this);
+		auto protocolLocation = find(network.protocolList.begin(), network.protocolList.end(), this);
 
-		if (CANNetworkManager::CANNetwork.protocolList.end() != protocolLocation)
+		if (network.protocolList.end() != protocolLocation)
 		{
-			CANNetworkManager::CANNetwork.protocolList.erase(protocolLocation);
+			network.protocolList.erase(protocolLocation);
 		}
 	}
 
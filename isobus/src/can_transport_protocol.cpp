@@ -43,6 +43,11 @@ namespace isobus
 		return sessionMessage.get_data_length();
 	}
 
+	TransportProtocolManager::TransportProtocolManager(CANNetworkManager &parentNetwork) :
+	  CANLibProtocol(parentNetwork)
+	{
+	}
+
 	TransportProtocolManager::~TransportProtocolManager()
 	{
 		// No need to clean up, as this object is a member of the network manager
@@ -54,8 +59,8 @@ namespace isobus
 		if (!initialized)
 		{
 			initialized = true;
-			CANNetworkManager::CANNetwork.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand), process_message, this);
-			CANNetworkManager::CANNetwork.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolData), process_message, this);
+			network.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand), process_message, this);
+			network.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolData), process_message, this);
 		}
 	}
 
@@ -63,7 +68,7 @@ namespace isobus
 	{
 		if ((nullptr != message.get_source_control_function()) &&
 		    ((nullptr == message.get_destination_control_function()) ||
-		     (nullptr != CANNetworkManager::CANNetwork.get_internal_control_function(message.get_destination_control_function()))))
+		     (nullptr != network.get_internal_control_function(message.get_destination_control_function()))))
 		{
 			switch (message.get_identifier().get_parameter_group_number())
 			{
@@ -79,7 +84,7 @@ namespace isobus
 							if (CAN_DATA_LENGTH == message.get_data_length())
 							{
 								if ((nullptr == message.get_destination_control_function()) &&
-								    (activeSessions.size() < CANNetworkManager::CANNetwork.get_configuration().get_max_number_transport_protocol_sessions()) &&
+								    (activeSessions.size() < network.get_configuration().get_max_number_transport_protocol_sessions()) &&
 								    (!get_session(session, message.get_source_control_function(), message.get_destination_control_function(), pgn)))
 								{
 									TransportProtocolSession *newSession = new TransportProtocolSession(TransportProtocolSession::Direction::Receive, message.get_can_port_index());
@@ -89,6 +94,7 @@ namespace isobus
 									newSession->sessionMessage.set_destination_control_function(nullptr);
 									newSession->packetCount = data[3];
 									newSession->sessionMessage.set_identifier(tempIdentifierData);
+									newSession->sessionMessage.set_timestamp_us(message.get_timestamp_us());
 									newSession->state = StateMachineState::RxDataSession;
 									newSession->timestamp_ms = SystemTiming::get_timestamp_ms();
 									activeSessions.push_back(newSession);
@@ -115,7 +121,7 @@ namespace isobus
 							if (CAN_DATA_LENGTH == message.get_data_length())
 							{
 								if ((nullptr != message.get_destination_control_function()) &&
-								    (activeSessions.size() < CANNetworkManager::CANNetwork.get_configuration().get_max_number_transport_protocol_sessions()) &&
+								    (activeSessions.size() < network.get_configuration().get_max_number_transport_protocol_sessions()) &&
 								    (!get_session(session, message.get_source_control_function(), message.get_destination_control_function(), pgn)))
 								{
 									TransportProtocolSession *newSession = new TransportProtocolSession(TransportProtocolSession::Direction::Receive, message.get_can_port_index());
@@ -126,6 +132,7 @@ namespace isobus
 									newSession->packetCount = data[3];
 									newSession->clearToSendPacketMax = data[4];
 									newSession->sessionMessage.set_identifier(tempIdentifierData);
+									newSession->sessionMessage.set_timestamp_us(message.get_timestamp_us());
 									newSession->state = StateMachineState::ClearToSend;
 									newSession->timestamp_ms = SystemTiming::get_timestamp_ms();
 									activeSessions.push_back(newSession);
@@ -137,7 +144,7 @@ namespace isobus
 									abort_session(pgn, ConnectionAbortReason::AlreadyInCMSession, std::static_pointer_cast<InternalControlFunction>(message.get_destination_control_function()), message.get_source_control_function());
 									CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Error, "[TP]: Sent abort, RTS when already in CM session");
 								}
-								else if ((activeSessions.size() >= CANNetworkManager::CANNetwork.get_configuration().get_max_number_transport_protocol_sessions()) &&
+								else if ((activeSessions.size() >= network.get_configuration().get_max_number_transport_protocol_sessions()) &&
 								         (nullptr != message.get_destination_control_function()) &&
 								         (ControlFunction::Type::Internal == message.get_destination_control_function()->get_type()))
 								{
@@ -277,13 +284,15 @@ namespace isobus
 							tempSession->processedPacketsThisSession++;
 							if ((tempSession->lastPacketNumber * PROTOCOL_BYTES_PER_FRAME) >= tempSession->get_message_data_length())
 							{
+								tempSession->sessionMessage.set_completion_timestamp_us(message.get_timestamp_us());
+
 								// Send EOM Ack for CM sessions only
 								if (nullptr != tempSession->sessionMessage.get_destination_control_function())
 								{
 									send_end_of_session_acknowledgement(tempSession);
 								}
-								CANNetworkManager::CANNetwork.process_any_control_function_pgn_callbacks(tempSession->sessionMessage);
-								CANNetworkManager::CANNetwork.protocol_message_callback(tempSession->sessionMessage);
+								network.process_any_control_function_pgn_callbacks(tempSession->sessionMessage);
+								network.protocol_message_callback(tempSession->sessionMessage);
 								close_session(tempSession, true);
 							}
 							tempSession->timestamp_ms = SystemTiming::get_timestamp_ms();
@@ -431,12 +440,12 @@ namespace isobus
 
 			if (TransportProtocolSession::Direction::Transmit == session->sessionDirection)
 			{
-				myControlFunction = CANNetworkManager::CANNetwork.get_internal_control_function(session->sessionMessage.get_source_control_function());
+				myControlFunction = network.get_internal_control_function(session->sessionMessage.get_source_control_function());
 				partnerControlFunction = session->sessionMessage.get_destination_control_function();
 			}
 			else
 			{
-				myControlFunction = CANNetworkManager::CANNetwork.get_internal_control_function(session->sessionMessage.get_destination_control_function());
+				myControlFunction = network.get_internal_control_function(session->sessionMessage.get_destination_control_function());
 				partnerControlFunction = session->sessionMessage.get_source_control_function();
 			}
 
@@ -448,7 +457,7 @@ namespace isobus
 			data[5] = static_cast<std::uint8_t>(pgn & 0xFF);
 			data[6] = static_cast<std::uint8_t>((pgn >> 8) & 0xFF);
 			data[7] = static_cast<std::uint8_t>((pgn >> 16) & 0xFF);
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
 			                                                        data.data(),
 			                                                        8,
 			                                                        myControlFunction,
@@ -470,7 +479,7 @@ namespace isobus
 		data[5] = static_cast<std::uint8_t>(parameterGroupNumber & 0xFF);
 		data[6] = static_cast<std::uint8_t>((parameterGroupNumber >> 8) & 0xFF);
 		data[7] = static_cast<std::uint8_t>((parameterGroupNumber >> 16) & 0xFF);
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
 		                                                      data.data(),
 		                                                      8,
 		                                                      source,
@@ -523,7 +532,7 @@ namespace isobus
 				                                                 static_cast<std::uint8_t>(session->sessionMessage.get_identifier().get_parameter_group_number() & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 8) & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 16) & 0xFF) };
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
 			                                                        dataBuffer,
 			                                                        CAN_DATA_LENGTH,
 			                                                        std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_source_control_function()),
@@ -559,7 +568,7 @@ namespace isobus
 				                                                 static_cast<std::uint8_t>(session->sessionMessage.get_identifier().get_parameter_group_number() & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 8) & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 16) & 0xFF) };
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
 			                                                        dataBuffer,
 			                                                        CAN_DATA_LENGTH,
 			                                                        std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_destination_control_function()),
@@ -583,7 +592,7 @@ namespace isobus
 				                                                 static_cast<std::uint8_t>(session->sessionMessage.get_identifier().get_parameter_group_number() & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 8) & 0xFF),
 				                                                 static_cast<std::uint8_t>((session->sessionMessage.get_identifier().get_parameter_group_number() >> 16) & 0xFF) };
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
 			                                                        dataBuffer,
 			                                                        CAN_DATA_LENGTH,
 			                                                        std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_source_control_function()),
@@ -615,7 +624,7 @@ namespace isobus
 			// This message only needs to be sent if we're the recipient. Sanity check the destination is us
 			if (ControlFunction::Type::Internal == session->sessionMessage.get_destination_control_function()->get_type())
 			{
-				retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
+				retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolCommand),
 				                                                        dataBuffer,
 				                                                        CAN_DATA_LENGTH,
 				                                                        std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_destination_control_function()),
@@ -722,7 +731,7 @@ namespace isobus
 				{
 					bool sessionStillValid = true;
 
-					if ((nullptr != session->sessionMessage.get_destination_control_function()) || (SystemTiming::time_expired_ms(session->timestamp_ms, CANNetworkManager::CANNetwork.get_configuration().get_minimum_time_between_transport_protocol_bam_frames())))
+					if ((nullptr != session->sessionMessage.get_destination_control_function()) || (SystemTiming::time_expired_ms(session->timestamp_ms, network.get_configuration().get_minimum_time_between_transport_protocol_bam_frames())))
 					{
 						std::uint8_t dataBuffer[CAN_DATA_LENGTH];
 						std::uint32_t framesSentThisUpdate = 0;
@@ -785,7 +794,7 @@ namespace isobus
 								}
 							}
 
-							if (CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolData),
+							if (network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::TransportProtocolData),
 							                                                   dataBuffer,
 							                                                   CAN_DATA_LENGTH,
 							                                                   std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_source_control_function()),
@@ -802,7 +811,7 @@ namespace isobus
 									// Need to wait for the frame delay time before continuing BAM session
 									break;
 								}
-								else if (framesSentThisUpdate >= CANNetworkManager::CANNetwork.get_configuration().get_max_number_of_network_manager_protocol_frames_per_update())
+								else if (framesSentThisUpdate >= network.get_configuration().get_max_number_of_network_manager_protocol_frames_per_update())
 								{
 									break; // Throttle the session
 								}
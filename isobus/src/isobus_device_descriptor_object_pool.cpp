@@ -13,13 +13,550 @@
 #include "isobus/utility/to_string.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cmath>
+#include <cstdlib>
 #include <cstring>
 #include <iomanip>
+#include <limits>
+#include <locale>
+#include <ostream>
 #include <sstream>
 
 namespace isobus
 {
+	namespace
+	{
+		constexpr std::size_t ISO_XML_FLUSH_SIZE = 16384; ///< How much XML is buffered before it is written to an output stream
+		constexpr std::uint8_t ISO_XML_LABEL_LENGTH = 7; ///< The number of bytes in structure and localization labels
+
+		/// @brief Appends ISOXML text to a buffer, moving it to an output stream in chunks if there is one.
+		/// Numbers are formatted by hand, since stream formatting is much slower and has to be reset after each use.
+		class IsoXMLWriter
+		{
+		public:
+			IsoXMLWriter(std::string &outputBuffer, std::ostream *outputStream) :
+			  buffer(outputBuffer),
+			  stream(outputStream)
+			{
+			}
+
+			void write(const char *text)
+			{
+				buffer.append(text);
+			}
+
+			void write_escaped(const std::string &text)
+			{
+				for (char character : text)
+				{
+					switch (character)
+					{
+						case '&':
+						{
+							buffer.append("&amp;");
+						}
+						break;
+
+						case '<':
+						{
+							buffer.append("&lt;");
+						}
+						break;
+
+						case '>':
+						{
+							buffer.append("&gt;");
+						}
+						break;
+
+						case '"':
+						{
+							buffer.append("&quot;");
+						}
+						break;
+
+						default:
+						{
+							buffer.push_back(character);
+						}
+						break;
+					}
+				}
+			}
+
+			void write_decimal(std::int64_t value)
+			{
+				char digits[20];
+				std::size_t numberOfDigits = 0;
+				std::uint64_t magnitude = static_cast<std::uint64_t>(value);
+
+				if (value < 0)
+				{
+					buffer.push_back('-');
+					magnitude = 0 - magnitude;
+				}
+
+				do
+				{
+					digits[numberOfDigits] = static_cast<char>('0' + (magnitude % 10));
+					numberOfDigits++;
+					magnitude /= 10;
+				} while (0 != magnitude);
+
+				while (numberOfDigits > 0)
+				{
+					numberOfDigits--;
+					buffer.push_back(digits[numberOfDigits]);
+				}
+			}
+
+			void write_hex(std::uint64_t value, std::uint8_t numberOfDigits)
+			{
+				static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+				for (std::uint8_t i = numberOfDigits; i > 0; i--)
+				{
+					buffer.push_back(HEX_DIGITS[(value >> (4 * (i - 1))) & 0x0F]);
+				}
+			}
+
+			void write_fixed(float value)
+			{
+				// Matches what std::fixed with a precision of 6 writes in the classic locale, whatever the global locale is.
+				// A float times a million is exact in a double, so rounding it gives the same digits as printf would.
+				if (std::fabs(value) < MAX_HAND_FORMATTED_FIXED)
+				{
+					const double scaledMagnitude = std::nearbyint(std::fabs(static_cast<double>(value)) * FIXED_SCALE);
+					const std::int64_t magnitude = static_cast<std::int64_t>(scaledMagnitude);
+					const std::int64_t fraction = magnitude % static_cast<std::int64_t>(FIXED_SCALE);
+
+					if (std::signbit(value))
+					{
+						buffer.push_back('-');
+					}
+					write_decimal(magnitude / static_cast<std::int64_t>(FIXED_SCALE));
+					buffer.push_back('.');
+					for (std::int64_t digitScale = static_cast<std::int64_t>(FIXED_SCALE) / 10; digitScale > 0; digitScale /= 10)
+					{
+						buffer.push_back(static_cast<char>('0' + ((fraction / digitScale) % 10)));
+					}
+				}
+				else
+				{
+					std::ostringstream text;
+					text.imbue(std::locale::classic());
+					text << std::fixed << std::setprecision(6) << value;
+					buffer.append(text.str());
+				}
+			}
+
+			void end_line()
+			{
+				buffer.push_back('\n');
+
+				if ((nullptr != stream) && (buffer.size() >= ISO_XML_FLUSH_SIZE))
+				{
+					flush();
+				}
+			}
+
+			bool flush()
+			{
+				bool retVal = true;
+
+				if (nullptr != stream)
+				{
+					stream->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+					buffer.clear();
+					retVal = stream->good();
+				}
+				return retVal;
+			}
+
+		private:
+			static constexpr double FIXED_SCALE = 1000000.0; ///< Scales a value so its 6 decimal places are an integer
+			static constexpr float MAX_HAND_FORMATTED_FIXED = 1e12f; ///< Values this large or more are formatted with a stream, so the scaled value can't overflow
+
+			std::string &buffer; ///< The buffer the XML is appended to
+			std::ostream *stream; ///< The stream the buffer is moved to when it fills up, or nullptr
+		};
+
+		/// @brief Reads the elements of an ISOXML file one at a time, without building a document tree.
+		/// Only single letter attributes are kept, which is all ISOXML elements use.
+		class IsoXMLReader
+		{
+		public:
+			IsoXMLReader(const char *xmlData, std::size_t xmlSize) :
+			  data(xmlData),
+			  size(xmlSize)
+			{
+			}
+
+			bool next_element()
+			{
+				bool retVal = false;
+
+				while ((!retVal) && (!malformed) && (position < size))
+				{
+					const char *tagStart = static_cast<const char *>(std::memchr(&data[position], '<', size - position));
+
+					if (nullptr == tagStart)
+					{
+						position = size;
+					}
+					else
+					{
+						position = static_cast<std::size_t>(tagStart - data) + 1;
+
+						if (starts_with("!--"))
+						{
+							skip_past("-->");
+						}
+						else if (starts_with("?") || starts_with("!"))
+						{
+							skip_past(">");
+						}
+						else
+						{
+							retVal = read_tag();
+						}
+					}
+				}
+				return retVal;
+			}
+
+			bool get_is_malformed() const
+			{
+				return malformed;
+			}
+
+			const std::string &get_element_name() const
+			{
+				return elementName;
+			}
+
+			bool get_is_closing_tag() const
+			{
+				return closingTag;
+			}
+
+			bool get_is_self_closing() const
+			{
+				return selfClosing;
+			}
+
+			bool has_attribute(char name) const
+			{
+				return ((name >= 'A') && (name <= 'Z') && (0 != (attributesPresent & (1UL << (name - 'A')))));
+			}
+
+			const std::string &get_attribute(char name) const
+			{
+				return has_attribute(name) ? attributes[name - 'A'] : emptyAttribute;
+			}
+
+		private:
+			static bool is_whitespace(char character)
+			{
+				return ((' ' == character) || ('\t' == character) || ('\r' == character) || ('\n' == character));
+			}
+
+			bool starts_with(const char *text) const
+			{
+				std::size_t length = std::strlen(text);
+				return ((size - position) >= length) && (0 == std::memcmp(&data[position], text, length));
+			}
+
+			void skip_past(const char *text)
+			{
+				std::size_t length = std::strlen(text);
+				const char *found = std::search(&data[position], &data[size], text, text + length);
+
+				if (&data[size] == found)
+				{
+					malformed = true;
+					position = size;
+				}
+				else
+				{
+					position = static_cast<std::size_t>(found - data) + length;
+				}
+			}
+
+			void skip_whitespace()
+			{
+				while ((position < size) && is_whitespace(data[position]))
+				{
+					position++;
+				}
+			}
+
+			bool read_tag()
+			{
+				bool tagEnded = false;
+
+				attributesPresent = 0;
+				closingTag = starts_with("/");
+				selfClosing = false;
+
+				if (closingTag)
+				{
+					position++;
+				}
+
+				std::size_t nameStart = position;
+
+				while ((position < size) && (!is_whitespace(data[position])) && ('/' != data[position]) && ('>' != data[position]))
+				{
+					position++;
+				}
+				elementName.assign(&data[nameStart], position - nameStart);
+				malformed = elementName.empty();
+
+				while ((!tagEnded) && (!malformed))
+				{
+					skip_whitespace();
+
+					if (starts_with(">"))
+					{
+						position++;
+						tagEnded = true;
+					}
+					else if (starts_with("/>"))
+					{
+						position += 2;
+						selfClosing = true;
+						tagEnded = true;
+					}
+					else
+					{
+						read_attribute();
+					}
+				}
+				return !malformed;
+			}
+
+			void read_attribute()
+			{
+				std::size_t nameStart = position;
+
+				while ((position < size) && (!is_whitespace(data[position])) && ('=' != data[position]) && ('>' != data[position]))
+				{
+					position++;
+				}
+
+				std::size_t nameLength = position - nameStart;
+				skip_whitespace();
+
+				if ((0 == nameLength) || (!starts_with("=")))
+				{
+					malformed = true;
+				}
+				else
+				{
+					position++;
+					skip_whitespace();
+
+					if (starts_with("\"") || starts_with("'"))
+					{
+						char quote = data[position];
+						const char *valueStart = &data[position + 1];
+						const char *valueEnd = static_cast<const char *>(std::memchr(valueStart, quote, size - position - 1));
+
+						if (nullptr == valueEnd)
+						{
+							malformed = true;
+						}
+						else
+						{
+							char name = data[nameStart];
+
+							// Attributes with longer names, like the version on the root element, aren't needed
+							if ((1 == nameLength) && (name >= 'A') && (name <= 'Z'))
+							{
+								malformed = !unescape(valueStart, static_cast<std::size_t>(valueEnd - valueStart), attributes[name - 'A']);
+								attributesPresent |= (1UL << (name - 'A'));
+							}
+							position = static_cast<std::size_t>(valueEnd - data) + 1;
+						}
+					}
+					else
+					{
+						malformed = true;
+					}
+				}
+			}
+
+			static void append_utf8(std::uint32_t codePoint, std::string &result)
+			{
+				if (codePoint < 0x80)
+				{
+					result.push_back(static_cast<char>(codePoint));
+				}
+				else if (codePoint < 0x800)
+				{
+					result.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+					result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				else if (codePoint < 0x10000)
+				{
+					result.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+					result.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+				else
+				{
+					result.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+					result.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+					result.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+			}
+
+			static bool unescape(const char *text, std::size_t length, std::string &result)
+			{
+				bool retVal = true;
+				std::size_t i = 0;
+
+				result.clear();
+
+				while (retVal && (i < length))
+				{
+					const char *entityStart = static_cast<const char *>(std::memchr(&text[i], '&', length - i));
+					std::size_t textEnd = (nullptr != entityStart) ? static_cast<std::size_t>(entityStart - text) : length;
+
+					// Copy everything up to the next entity in one go
+					result.append(&text[i], textEnd - i);
+					i = textEnd;
+
+					if (i < length)
+					{
+						const char *entityEnd = static_cast<const char *>(std::memchr(&text[i], ';', length - i));
+						std::string entity;
+
+						if (nullptr != entityEnd)
+						{
+							entity.assign(&text[i + 1], entityEnd);
+						}
+
+						if ("amp" == entity)
+						{
+							result.push_back('&');
+						}
+						else if ("lt" == entity)
+						{
+							result.push_back('<');
+						}
+						else if ("gt" == entity)
+						{
+							result.push_back('>');
+						}
+						else if ("quot" == entity)
+						{
+							result.push_back('"');
+						}
+						else if ("apos" == entity)
+						{
+							result.push_back('\'');
+						}
+						else if ((entity.size() > 1) && ('#' == entity[0]))
+						{
+							bool hexadecimal = ('x' == entity[1]);
+							const char *digitsStart = entity.c_str() + (hexadecimal ? 2 : 1);
+							char *digitsEnd = nullptr;
+							unsigned long codePoint = std::strtoul(digitsStart, &digitsEnd, hexadecimal ? 16 : 10);
+
+							retVal = (digitsEnd != digitsStart) && ('\0' == *digitsEnd) && (codePoint > 0) && (codePoint <= 0x10FFFF);
+							if (retVal)
+							{
+								append_utf8(static_cast<std::uint32_t>(codePoint), result);
+							}
+						}
+						else
+						{
+							retVal = false;
+						}
+						i += entity.size() + 2;
+					}
+				}
+				return retVal;
+			}
+
+			const std::string emptyAttribute; ///< Returned for attributes that aren't present
+			std::array<std::string, 26> attributes; ///< The values of attributes A to Z of the current element, reused between elements
+			std::string elementName; ///< The name of the current element
+			const char *data; ///< The ISOXML text
+			std::size_t size; ///< The number of bytes of ISOXML text
+			std::size_t position = 0; ///< The offset of the next byte to read
+			std::uint32_t attributesPresent = 0; ///< A bit for each of attributes A to Z, set if the current element has it
+			bool closingTag = false; ///< If the current element is a closing tag
+			bool selfClosing = false; ///< If the current element closes itself
+			bool malformed = false; ///< Set when something that isn't valid XML is found
+		};
+
+		/// @brief Reads an unsigned number from an attribute, checking that it is in range
+		bool read_unsigned_attribute(const IsoXMLReader &reader, char name, int base, std::uint64_t maxValue, std::uint64_t &value)
+		{
+			const std::string &text = reader.get_attribute(name);
+			char *textEnd = nullptr;
+			bool retVal = (!text.empty()) && ('-' != text[0]);
+
+			if (retVal)
+			{
+				unsigned long long parsedValue = std::strtoull(text.c_str(), &textEnd, base);
+				retVal = ('\0' == *textEnd) && (parsedValue <= maxValue);
+				value = parsedValue;
+			}
+			return retVal;
+		}
+
+		/// @brief Reads a signed 32 bit number from an attribute, checking that it is in range
+		bool read_signed_attribute(const IsoXMLReader &reader, char name, std::int32_t &value)
+		{
+			const std::string &text = reader.get_attribute(name);
+			char *textEnd = nullptr;
+			bool retVal = !text.empty();
+
+			if (retVal)
+			{
+				long long parsedValue = std::strtoll(text.c_str(), &textEnd, 10);
+				retVal = ('\0' == *textEnd) &&
+				  (parsedValue >= std::numeric_limits<std::int32_t>::min()) &&
+				  (parsedValue <= std::numeric_limits<std::int32_t>::max());
+				value = static_cast<std::int32_t>(parsedValue);
+			}
+			return retVal;
+		}
+
+		/// @brief Reads a decimal number from an attribute, always with a '.' separator whatever the global locale is
+		bool read_float_attribute(const IsoXMLReader &reader, char name, float &value)
+		{
+			std::istringstream text(reader.get_attribute(name));
+			text.imbue(std::locale::classic());
+			text >> value;
+			return (!text.fail()) && text.eof();
+		}
+
+		/// @brief Reads a structure or localization label, which ISOXML writes as hex with the last byte first
+		bool read_label_attribute(const IsoXMLReader &reader, char name, std::array<std::uint8_t, ISO_XML_LABEL_LENGTH> &label)
+		{
+			const std::string &text = reader.get_attribute(name);
+			bool retVal = ((2 * ISO_XML_LABEL_LENGTH) == text.size());
+
+			for (std::uint_fast8_t i = 0; retVal && (i < ISO_XML_LABEL_LENGTH); i++)
+			{
+				char *byteEnd = nullptr;
+				char byteText[3] = { text[2 * i], text[(2 * i) + 1], '\0' };
+
+				label[ISO_XML_LABEL_LENGTH - 1 - i] = static_cast<std::uint8_t>(std::strtoul(byteText, &byteEnd, 16));
+				retVal = ((byteText + 2) == byteEnd);
+			}
+			return retVal;
+		}
+	} // namespace
+
 	DeviceDescriptorObjectPool::DeviceDescriptorObjectPool(std::uint8_t taskControllerServerVersion) :
 	  taskControllerCompatibilityLevel(taskControllerServerVersion)
 	{
@@ -124,6 +661,7 @@ namespace isobus
 			                                                                 deviceExtendedStructureLabel,
 			                                                                 clientIsoNAME,
 			                                                                 (taskControllerCompatibilityLevel >= 4)));
+			index_object(objectList.back());
 		}
 		else
 		{
@@ -166,6 +704,7 @@ namespace isobus
 			                                                                        parentObjectID,
 			                                                                        deviceElementType,
 			                                                                        uniqueID));
+			index_object(objectList.back());
 		}
 		else
 		{
@@ -228,6 +767,7 @@ namespace isobus
 			                                                                            processDataProperties,
 			                                                                            processDataTriggerMethods,
 			                                                                            uniqueID));
+			index_object(objectList.back());
 		}
 		else
 		{
@@ -281,6 +821,7 @@ namespace isobus
 			                                                                         propertyDDI,
 			                                                                         valuePresentationObject,
 			                                                                         uniqueID));
+			index_object(objectList.back());
 		}
 		else
 		{
@@ -334,6 +875,7 @@ namespace isobus
 			                                                                                  scaleFactor,
 			                                                                                  numberDecimals,
 			                                                                                  uniqueID));
+			index_object(objectList.back());
 		}
 		else
 		{
@@ -779,20 +1321,11 @@ namespace isobus
 		if (resolve_parent_ids_to_objects())
 		{
 			retVal = true;
+			resultantPool.reserve(get_binary_object_pool_size());
+
 			for (auto &currentObject : objectList)
 			{
-				auto objectBinary = currentObject->get_binary_object();
-
-				if (!objectBinary.empty())
-				{
-					resultantPool.insert(resultantPool.end(), objectBinary.begin(), objectBinary.end());
-				}
-				else
-				{
-					CANStackLogger::error("[DDOP]: Failed to create all object binaries. Your DDOP is invalid.");
-					retVal = false;
-					break;
-				}
+				currentObject->append_binary_object(resultantPool);
 			}
 		}
 		else
@@ -803,173 +1336,411 @@ namespace isobus
 		return retVal;
 	}
 
-	bool DeviceDescriptorObjectPool::generate_task_data_iso_xml(std::string &resultantString)
+	std::size_t DeviceDescriptorObjectPool::get_binary_object_pool_size() const
 	{
-		bool retVal = true;
-
-		resultantString.clear();
+		std::size_t retVal = 0;
 
-		if (taskControllerCompatibilityLevel > MAX_TC_VERSION_SUPPORTED)
+		for (const auto &currentObject : objectList)
 		{
-			CANStackLogger::warn("[DDOP]: An XML DDOP is being generated for a TC version that is unsupported. This may cause issues.");
+			retVal += currentObject->get_binary_object_size();
 		}
+		return retVal;
+	}
 
-		if (resolve_parent_ids_to_objects())
+	bool DeviceDescriptorObjectPool::generate_task_data_iso_xml(std::string &resultantString)
+	{
+		resultantString.clear();
+		resultantString.reserve(estimate_task_data_iso_xml_size());
+		return write_task_data_iso_xml(resultantString, nullptr);
+	}
+
+	bool DeviceDescriptorObjectPool::generate_task_data_iso_xml(std::ostream &output)
+	{
+		std::string buffer;
+
+		// Leave room for the longest element that can be added after the buffer fills up
+		buffer.reserve(2 * ISO_XML_FLUSH_SIZE);
+		return write_task_data_iso_xml(buffer, &output);
+	}
+
+	bool DeviceDescriptorObjectPool::deserialize_task_data_iso_xml(const std::string &isoXML)
+	{
+		return deserialize_task_data_iso_xml(isoXML.data(), isoXML.size());
+	}
+
+	bool DeviceDescriptorObjectPool::deserialize_task_data_iso_xml(const char *isoXML, std::size_t isoXMLSize)
+	{
+		bool retVal = ((nullptr != isoXML) && (0 != isoXMLSize));
+
+		clear();
+
+		if (retVal)
 		{
-			std::ostringstream xmlOutput;
-			std::ios initialStreamFormat(NULL);
-			std::size_t numberOfDevices = 1;
-			std::size_t numberOfElements = 1;
-			initialStreamFormat.copyfmt(xmlOutput);
-			retVal = true;
+			IsoXMLReader reader(isoXML, isoXMLSize);
+			std::shared_ptr<task_controller_object::DeviceElementObject> currentElement;
+			bool deviceFound = false;
+			bool deviceEnded = false;
 
-			xmlOutput << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << std::endl;
-			xmlOutput << "<ISO11783_TaskData VersionMajor=\"3\" VersionMinor=\"0\" DataTransferOrigin=\"1\">" << std::endl;
+			CANStackLogger::debug("[DDOP]: Attempting to read an ISOXML DDOP with size %u.", static_cast<unsigned int>(isoXMLSize));
 
-			// Find the device object, which will be the first object written
-			for (std::size_t i = 0; i < size(); i++)
+			while (retVal && (!deviceEnded) && reader.next_element())
 			{
-				auto currentObject = get_object_by_index(static_cast<std::uint16_t>(i));
+				const std::string &elementName = reader.get_element_name();
 
-				if ((nullptr != currentObject) &&
-				    (task_controller_object::ObjectTypes::Device == currentObject->get_object_type()))
+				if (reader.get_is_closing_tag())
 				{
-					// Found device
-					auto rootDevice = std::static_pointer_cast<task_controller_object::DeviceObject>(currentObject);
-					xmlOutput << "<DVC A=\"DVC-" << static_cast<int>(numberOfDevices);
-					numberOfDevices++;
-					xmlOutput << "\" B=\"" << rootDevice->get_designator();
-					xmlOutput << "\" C=\"" << rootDevice->get_software_version();
-					xmlOutput << "\" D=\"" << std::uppercase << std::hex << std::setfill('0') << std::setw(16) << static_cast<unsigned long long int>(rootDevice->get_iso_name());
-					xmlOutput.copyfmt(initialStreamFormat);
-					xmlOutput << "\" E=\"" << rootDevice->get_serial_number();
-					xmlOutput << "\" F=\"";
-
-					auto lStructureLabel = rootDevice->get_structure_label();
-					for (std::uint8_t j = 0; j < 7; j++)
+					if ("DET" == elementName)
 					{
-						std::uint8_t structureByte = static_cast<std::uint8_t>(lStructureLabel.at(6 - j));
-						xmlOutput << std::uppercase << std::hex << std::setfill('0') << std::setw(2) << static_cast<unsigned int>(structureByte);
+						currentElement = nullptr;
 					}
+					else if ("DVC" == elementName)
+					{
+						deviceEnded = deviceFound;
+					}
+				}
+				else if ("DVC" == elementName)
+				{
+					std::array<std::uint8_t, ISO_XML_LABEL_LENGTH> structureLabel = { 0 };
+					std::array<std::uint8_t, ISO_XML_LABEL_LENGTH> localizationLabel = { 0 };
+					std::uint64_t isoNAME = 0;
+
+					retVal = read_unsigned_attribute(reader, 'D', 16, std::numeric_limits<std::uint64_t>::max(), isoNAME) &&
+					  read_label_attribute(reader, 'F', structureLabel) &&
+					  read_label_attribute(reader, 'G', localizationLabel) &&
+					  add_device(reader.get_attribute('B'),
+					             reader.get_attribute('C'),
+					             reader.get_attribute('E'),
+					             std::string(structureLabel.begin(), structureLabel.end()),
+					             localizationLabel,
+					             std::vector<std::uint8_t>(),
+					             isoNAME);
+					deviceFound = retVal;
+					deviceEnded = reader.get_is_self_closing();
+				}
+				else if (!deviceFound)
+				{
+					// Anything before the device, like the root element, is skipped
+				}
+				else if ("DET" == elementName)
+				{
+					std::uint64_t objectID = 0;
+					std::uint64_t elementType = 0;
+					std::uint64_t elementNumber = 0;
+					std::uint64_t parentObjectID = 0;
+
+					retVal = read_unsigned_attribute(reader, 'B', 10, task_controller_object::Object::NULL_OBJECT_ID, objectID) &&
+					  read_unsigned_attribute(reader, 'C', 10, static_cast<std::uint64_t>(task_controller_object::DeviceElementObject::Type::NavigationReference), elementType) &&
+					  (0 != elementType) &&
+					  read_unsigned_attribute(reader, 'E', 10, task_controller_object::Object::NULL_OBJECT_ID, elementNumber) &&
+					  read_unsigned_attribute(reader, 'F', 10, task_controller_object::Object::NULL_OBJECT_ID, parentObjectID) &&
+					  add_device_element(reader.get_attribute('D'),
+					                     static_cast<std::uint16_t>(elementNumber),
+					                     static_cast<std::uint16_t>(parentObjectID),
+					                     static_cast<task_controller_object::DeviceElementObject::Type>(elementType),
+					                     static_cast<std::uint16_t>(objectID));
+
+					if (retVal && (!reader.get_is_self_closing()))
+					{
+						currentElement = std::static_pointer_cast<task_controller_object::DeviceElementObject>(objectList.back());
+					}
+				}
+				else if ("DOR" == elementName)
+				{
+					std::uint64_t childObjectID = 0;
 
-					xmlOutput << "\" G=\"";
+					retVal = (nullptr != currentElement) &&
+					  read_unsigned_attribute(reader, 'A', 10, task_controller_object::Object::NULL_OBJECT_ID, childObjectID);
 
-					for (std::uint_fast8_t j = 0; j < 7; j++)
+					if (retVal)
 					{
-						xmlOutput << std::uppercase << std::hex << std::setfill('0') << std::setw(2) << static_cast<unsigned int>(rootDevice->get_localization_label().at(6 - j));
+						currentElement->add_reference_to_child_object(static_cast<std::uint16_t>(childObjectID));
 					}
-					xmlOutput.copyfmt(initialStreamFormat);
-					xmlOutput << "\">" << std::endl;
+				}
+				else if ("DPD" == elementName)
+				{
+					std::uint64_t objectID = 0;
+					std::uint64_t ddi = 0;
+					std::uint64_t properties = 0;
+					std::uint64_t triggerMethods = 0;
+					std::uint64_t presentationObjectID = task_controller_object::Object::NULL_OBJECT_ID;
+
+					retVal = read_unsigned_attribute(reader, 'A', 10, task_controller_object::Object::NULL_OBJECT_ID, objectID) &&
+					  read_unsigned_attribute(reader, 'B', 16, std::numeric_limits<std::uint16_t>::max(), ddi) &&
+					  read_unsigned_attribute(reader, 'C', 10, std::numeric_limits<std::uint8_t>::max(), properties) &&
+					  read_unsigned_attribute(reader, 'D', 10, std::numeric_limits<std::uint8_t>::max(), triggerMethods) &&
+					  ((!reader.has_attribute('F')) || read_unsigned_attribute(reader, 'F', 10, task_controller_object::Object::NULL_OBJECT_ID, presentationObjectID)) &&
+					  add_device_process_data(reader.get_attribute('E'),
+					                          static_cast<std::uint16_t>(ddi),
+					                          static_cast<std::uint16_t>(presentationObjectID),
+					                          static_cast<std::uint8_t>(properties),
+					                          static_cast<std::uint8_t>(triggerMethods),
+					                          static_cast<std::uint16_t>(objectID));
+				}
+				else if ("DPT" == elementName)
+				{
+					std::uint64_t objectID = 0;
+					std::uint64_t ddi = 0;
+					std::int32_t value = 0;
+					std::uint64_t presentationObjectID = task_controller_object::Object::NULL_OBJECT_ID;
+
+					retVal = read_unsigned_attribute(reader, 'A', 10, task_controller_object::Object::NULL_OBJECT_ID, objectID) &&
+					  read_unsigned_attribute(reader, 'B', 16, std::numeric_limits<std::uint16_t>::max(), ddi) &&
+					  read_signed_attribute(reader, 'C', value) &&
+					  ((!reader.has_attribute('E')) || read_unsigned_attribute(reader, 'E', 10, task_controller_object::Object::NULL_OBJECT_ID, presentationObjectID)) &&
+					  add_device_property(reader.get_attribute('D'),
+					                      value,
+					                      static_cast<std::uint16_t>(ddi),
+					                      static_cast<std::uint16_t>(presentationObjectID),
+					                      static_cast<std::uint16_t>(objectID));
+				}
+				else if ("DVP" == elementName)
+				{
+					std::uint64_t objectID = 0;
+					std::int32_t offset = 0;
+					std::uint64_t numberOfDecimals = 0;
+					float scale = 0.0f;
+
+					retVal = read_unsigned_attribute(reader, 'A', 10, task_controller_object::Object::NULL_OBJECT_ID, objectID) &&
+					  read_signed_attribute(reader, 'B', offset) &&
+					  read_float_attribute(reader, 'C', scale) &&
+					  read_unsigned_attribute(reader, 'D', 10, std::numeric_limits<std::uint8_t>::max(), numberOfDecimals) &&
+					  add_device_value_presentation(reader.get_attribute('E'),
+					                                offset,
+					                                scale,
+					                                static_cast<std::uint8_t>(numberOfDecimals),
+					                                static_cast<std::uint16_t>(objectID));
+				}
 
-					// Next, process all elements
-					for (std::size_t j = 0; j < this->size(); j++)
-					{
-						auto currentSubObject = get_object_by_index(static_cast<std::uint16_t>(j));
+				if (!retVal)
+				{
+					CANStackLogger::error("[DDOP]: ISOXML " + elementName + " element is missing an attribute or has an invalid one.");
+				}
+			}
 
-						if ((nullptr != currentSubObject) &&
-						    (task_controller_object::ObjectTypes::DeviceElement == currentSubObject->get_object_type()))
-						{
-							auto deviceElement = std::static_pointer_cast<task_controller_object::DeviceElementObject>(currentSubObject);
+			if (retVal && reader.get_is_malformed())
+			{
+				CANStackLogger::error("[DDOP]: ISOXML DDOP is not well formed XML.");
+				retVal = false;
+			}
+			else if (retVal && (!deviceFound))
+			{
+				CANStackLogger::error("[DDOP]: ISOXML DDOP does not contain a DVC element.");
+				retVal = false;
+			}
+
+			if (!retVal)
+			{
+				clear();
+			}
+		}
+		return retVal;
+	}
 
-							xmlOutput << "\t<DET A=\"DET-" << static_cast<int>(numberOfElements);
-							numberOfElements++;
-							xmlOutput << "\" B=\"" << static_cast<int>(deviceElement->get_object_id());
-							xmlOutput << "\" C=\"" << static_cast<int>(deviceElement->get_type());
-							xmlOutput << "\" D=\"" << deviceElement->get_designator();
-							xmlOutput << "\" E=\"" << static_cast<int>(deviceElement->get_element_number());
-							xmlOutput << "\" F=\"" << static_cast<int>(deviceElement->get_parent_object());
+	bool DeviceDescriptorObjectPool::write_task_data_iso_xml(std::string &buffer, std::ostream *output)
+	{
+		bool retVal = true;
 
-							if (deviceElement->get_number_child_objects() > 0)
-							{
-								xmlOutput << "\">" << std::endl;
+		if (taskControllerCompatibilityLevel > MAX_TC_VERSION_SUPPORTED)
+		{
+			CANStackLogger::warn("[DDOP]: An XML DDOP is being generated for a TC version that is unsupported. This may cause issues.");
+		}
 
-								// Process a list of all device object references
-								for (std::size_t k = 0; k < deviceElement->get_number_child_objects(); k++)
-								{
-									xmlOutput << "\t\t<DOR A=\"" << static_cast<int>(deviceElement->get_child_object_id(k)) << "\"/>" << std::endl;
-								}
-								xmlOutput << "\t</DET>" << std::endl;
-							}
-							else
-							{
-								xmlOutput << "\"/>" << std::endl;
-							}
+		if (resolve_parent_ids_to_objects())
+		{
+			IsoXMLWriter xmlOutput(buffer, output);
+			std::shared_ptr<task_controller_object::DeviceObject> rootDevice;
+			std::vector<task_controller_object::DeviceElementObject *> deviceElements;
+			std::vector<const task_controller_object::DeviceProcessDataObject *> deviceProcessData;
+			std::vector<const task_controller_object::DevicePropertyObject *> deviceProperties;
+			std::vector<const task_controller_object::DeviceValuePresentationObject *> deviceValuePresentations;
+
+			// Sort the objects by type in one pass, since each type is written as its own group
+			for (const auto &currentObject : objectList)
+			{
+				switch (currentObject->get_object_type())
+				{
+					case task_controller_object::ObjectTypes::Device:
+					{
+						if (nullptr == rootDevice)
+						{
+							rootDevice = std::static_pointer_cast<task_controller_object::DeviceObject>(currentObject);
 						}
 					}
+					break;
 
-					// Next, process all DPDs
-					for (std::size_t j = 0; j < this->size(); j++)
+					case task_controller_object::ObjectTypes::DeviceElement:
 					{
-						auto currentSubObject = get_object_by_index(static_cast<std::uint16_t>(j));
+						deviceElements.push_back(static_cast<task_controller_object::DeviceElementObject *>(currentObject.get()));
+					}
+					break;
 
-						if ((nullptr != currentSubObject) &&
-						    (task_controller_object::ObjectTypes::DeviceProcessData == currentSubObject->get_object_type()))
-						{
-							auto deviceProcessData = std::static_pointer_cast<task_controller_object::DeviceProcessDataObject>(currentSubObject);
-
-							xmlOutput << "\t<DPD A=\"" << static_cast<int>(deviceProcessData->get_object_id());
-							xmlOutput << "\" B=\"" << std::uppercase << std::hex << std::setfill('0') << std::setw(4) << static_cast<int>(deviceProcessData->get_ddi());
-							xmlOutput.copyfmt(initialStreamFormat);
-							xmlOutput << "\" C=\"" << static_cast<int>(deviceProcessData->get_properties_bitfield());
-							xmlOutput << "\" D=\"" << static_cast<int>(deviceProcessData->get_trigger_methods_bitfield());
-							xmlOutput << "\" E=\"" << deviceProcessData->get_designator();
-							if (0xFFFF != deviceProcessData->get_device_value_presentation_object_id())
-							{
-								xmlOutput << "\" F=\"" << static_cast<int>(deviceProcessData->get_device_value_presentation_object_id());
-							}
-							xmlOutput << "\"/>" << std::endl;
-						}
+					case task_controller_object::ObjectTypes::DeviceProcessData:
+					{
+						deviceProcessData.push_back(static_cast<const task_controller_object::DeviceProcessDataObject *>(currentObject.get()));
 					}
+					break;
 
-					// Next, process all child DPTs
-					for (std::size_t j = 0; j < this->size(); j++)
+					case task_controller_object::ObjectTypes::DeviceProperty:
 					{
-						auto currentSubObject = get_object_by_index(static_cast<std::uint16_t>(j));
+						deviceProperties.push_back(static_cast<const task_controller_object::DevicePropertyObject *>(currentObject.get()));
+					}
+					break;
 
-						if ((nullptr != currentSubObject) &&
-						    (task_controller_object::ObjectTypes::DeviceProperty == currentSubObject->get_object_type()))
-						{
-							auto deviceProperty = std::static_pointer_cast<task_controller_object::DevicePropertyObject>(currentSubObject);
-
-							xmlOutput << "\t<DPT A=\"" << static_cast<int>(deviceProperty->get_object_id());
-							xmlOutput << "\" B=\"" << std::uppercase << std::hex << std::setfill('0') << std::setw(4) << static_cast<int>(deviceProperty->get_ddi());
-							xmlOutput.copyfmt(initialStreamFormat);
-							xmlOutput << "\" C=\"" << static_cast<int>(deviceProperty->get_value());
-							xmlOutput << "\" D=\"" << deviceProperty->get_designator();
-							if (0xFFFF != deviceProperty->get_device_value_presentation_object_id())
-							{
-								xmlOutput << "\" E=\"" << static_cast<int>(deviceProperty->get_device_value_presentation_object_id());
-							}
-							xmlOutput << "\"/>" << std::endl;
-						}
+					case task_controller_object::ObjectTypes::DeviceValuePresentation:
+					{
+						deviceValuePresentations.push_back(static_cast<const task_controller_object::DeviceValuePresentationObject *>(currentObject.get()));
 					}
+					break;
 
-					// Next, process all child DVPs
-					for (std::size_t j = 0; j < this->size(); j++)
+					default:
 					{
-						auto currentSubObject = get_object_by_index(static_cast<std::uint16_t>(j));
+					}
+					break;
+				}
+			}
+
+			if (nullptr != rootDevice)
+			{
+				std::string structureLabel = rootDevice->get_structure_label();
+				std::array<std::uint8_t, ISO_XML_LABEL_LENGTH> localizationLabel = rootDevice->get_localization_label();
+				std::size_t numberOfElements = 1;
+
+				xmlOutput.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>");
+				xmlOutput.end_line();
+				xmlOutput.write("<ISO11783_TaskData VersionMajor=\"3\" VersionMinor=\"0\" DataTransferOrigin=\"1\">");
+				xmlOutput.end_line();
+
+				xmlOutput.write("<DVC A=\"DVC-1\" B=\"");
+				xmlOutput.write_escaped(rootDevice->get_designator());
+				xmlOutput.write("\" C=\"");
+				xmlOutput.write_escaped(rootDevice->get_software_version());
+				xmlOutput.write("\" D=\"");
+				xmlOutput.write_hex(rootDevice->get_iso_name(), 16);
+				xmlOutput.write("\" E=\"");
+				xmlOutput.write_escaped(rootDevice->get_serial_number());
+				xmlOutput.write("\" F=\"");
+
+				// Labels are written last byte first, and a short structure label is padded with spaces like in the binary DDOP
+				for (std::uint_fast8_t j = ISO_XML_LABEL_LENGTH; j > 0; j--)
+				{
+					xmlOutput.write_hex((j <= structureLabel.size()) ? static_cast<std::uint8_t>(structureLabel[j - 1]) : ' ', 2);
+				}
+				xmlOutput.write("\" G=\"");
+
+				for (std::uint_fast8_t j = ISO_XML_LABEL_LENGTH; j > 0; j--)
+				{
+					xmlOutput.write_hex(localizationLabel[j - 1], 2);
+				}
+				xmlOutput.write("\">");
+				xmlOutput.end_line();
 
-						if ((nullptr != currentSubObject) &&
-						    (task_controller_object::ObjectTypes::DeviceValuePresentation == currentSubObject->get_object_type()))
+				for (auto deviceElement : deviceElements)
+				{
+					xmlOutput.write("\t<DET A=\"DET-");
+					xmlOutput.write_decimal(static_cast<std::int64_t>(numberOfElements));
+					numberOfElements++;
+					xmlOutput.write("\" B=\"");
+					xmlOutput.write_decimal(deviceElement->get_object_id());
+					xmlOutput.write("\" C=\"");
+					xmlOutput.write_decimal(static_cast<std::uint8_t>(deviceElement->get_type()));
+					xmlOutput.write("\" D=\"");
+					xmlOutput.write_escaped(deviceElement->get_designator());
+					xmlOutput.write("\" E=\"");
+					xmlOutput.write_decimal(deviceElement->get_element_number());
+					xmlOutput.write("\" F=\"");
+					xmlOutput.write_decimal(deviceElement->get_parent_object());
+
+					if (deviceElement->get_number_child_objects() > 0)
+					{
+						xmlOutput.write("\">");
+						xmlOutput.end_line();
+
+						// Process a list of all device object references
+						for (std::size_t k = 0; k < deviceElement->get_number_child_objects(); k++)
 						{
-							auto deviceValuePresentation = std::static_pointer_cast<task_controller_object::DeviceValuePresentationObject>(currentSubObject);
-
-							xmlOutput << "\t<DVP A=\"" << static_cast<int>(deviceValuePresentation->get_object_id());
-							xmlOutput << "\" B=\"" << static_cast<int>(deviceValuePresentation->get_offset());
-							xmlOutput << "\" C=\"" << std::fixed << std::setprecision(6) << deviceValuePresentation->get_scale();
-							xmlOutput.copyfmt(initialStreamFormat);
-							xmlOutput << "\" D=\"" << static_cast<int>(deviceValuePresentation->get_number_of_decimals());
-							xmlOutput << "\" E=\"" << deviceValuePresentation->get_designator();
-							xmlOutput << "\"/>" << std::endl;
+							xmlOutput.write("\t\t<DOR A=\"");
+							xmlOutput.write_decimal(deviceElement->get_child_object_id(k));
+							xmlOutput.write("\"/>");
+							xmlOutput.end_line();
 						}
+						xmlOutput.write("\t</DET>");
+					}
+					else
+					{
+						xmlOutput.write("\"/>");
+					}
+					xmlOutput.end_line();
+				}
+
+				for (auto processData : deviceProcessData)
+				{
+					xmlOutput.write("\t<DPD A=\"");
+					xmlOutput.write_decimal(processData->get_object_id());
+					xmlOutput.write("\" B=\"");
+					xmlOutput.write_hex(processData->get_ddi(), 4);
+					xmlOutput.write("\" C=\"");
+					xmlOutput.write_decimal(processData->get_properties_bitfield());
+					xmlOutput.write("\" D=\"");
+					xmlOutput.write_decimal(processData->get_trigger_methods_bitfield());
+					xmlOutput.write("\" E=\"");
+					xmlOutput.write_escaped(processData->get_designator());
+					if (task_controller_object::Object::NULL_OBJECT_ID != processData->get_device_value_presentation_object_id())
+					{
+						xmlOutput.write("\" F=\"");
+						xmlOutput.write_decimal(processData->get_device_value_presentation_object_id());
 					}
+					xmlOutput.write("\"/>");
+					xmlOutput.end_line();
+				}
+
+				for (auto property : deviceProperties)
+				{
+					xmlOutput.write("\t<DPT A=\"");
+					xmlOutput.write_decimal(property->get_object_id());
+					xmlOutput.write("\" B=\"");
+					xmlOutput.write_hex(property->get_ddi(), 4);
+					xmlOutput.write("\" C=\"");
+					xmlOutput.write_decimal(property->get_value());
+					xmlOutput.write("\" D=\"");
+					xmlOutput.write_escaped(property->get_designator());
+					if (task_controller_object::Object::NULL_OBJECT_ID != property->get_device_value_presentation_object_id())
+					{
+						xmlOutput.write("\" E=\"");
+						xmlOutput.write_decimal(property->get_device_value_presentation_object_id());
+					}
+					xmlOutput.write("\"/>");
+					xmlOutput.end_line();
+				}
+
+				for (auto valuePresentation : deviceValuePresentations)
+				{
+					xmlOutput.write("\t<DVP A=\"");
+					xmlOutput.write_decimal(valuePresentation->get_object_id());
+					xmlOutput.write("\" B=\"");
+					xmlOutput.write_decimal(valuePresentation->get_offset());
+					xmlOutput.write("\" C=\"");
+					xmlOutput.write_fixed(valuePresentation->get_scale());
+					xmlOutput.write("\" D=\"");
+					xmlOutput.write_decimal(valuePresentation->get_number_of_decimals());
+					xmlOutput.write("\" E=\"");
+					xmlOutput.write_escaped(valuePresentation->get_designator());
+					xmlOutput.write("\"/>");
+					xmlOutput.end_line();
+				}
 
-					// Close DVC object
-					xmlOutput << "</DVC>" << std::endl;
-					xmlOutput << "</ISO11783_TaskData>" << std::endl;
-					resultantString = xmlOutput.str();
+				xmlOutput.write("</DVC>");
+				xmlOutput.end_line();
+				xmlOutput.write("</ISO11783_TaskData>");
+				xmlOutput.end_line();
+				retVal = xmlOutput.flush();
+
+				if (retVal)
+				{
 					CANStackLogger::debug("[DDOP]: Generated ISO XML DDOP data OK");
-					break;
+				}
+				else
+				{
+					CANStackLogger::error("[DDOP]: Failed to write the ISO XML DDOP to the output stream.");
 				}
 			}
 		}
@@ -978,24 +1749,85 @@ namespace isobus
 			CANStackLogger::error("[DDOP]: Failed to resolve all object IDs in DDOP. Your DDOP contains invalid object references.");
 			retVal = false;
 		}
+
+		if (!retVal)
+		{
+			buffer.clear();
+		}
 		return retVal;
 	}
 
-	std::shared_ptr<task_controller_object::Object> DeviceDescriptorObjectPool::get_object_by_id(std::uint16_t objectID)
+	std::size_t DeviceDescriptorObjectPool::estimate_task_data_iso_xml_size() const
 	{
-		std::shared_ptr<task_controller_object::Object> retVal;
-
-		for (auto &currentObject : objectList)
+		// Roughly the size of each element with typical numbers, not counting its text
+		constexpr std::size_t HEADER_SIZE = 160;
+		constexpr std::size_t DEVICE_SIZE = 90;
+		constexpr std::size_t ELEMENT_SIZE = 60;
+		constexpr std::size_t ELEMENT_REFERENCE_SIZE = 18;
+		constexpr std::size_t PROCESS_DATA_SIZE = 50;
+		constexpr std::size_t PROPERTY_SIZE = 50;
+		constexpr std::size_t VALUE_PRESENTATION_SIZE = 50;
+		std::size_t retVal = HEADER_SIZE;
+
+		for (const auto &currentObject : objectList)
 		{
-			if (currentObject->get_object_id() == objectID)
+			retVal += currentObject->get_designator().size();
+
+			switch (currentObject->get_object_type())
 			{
-				retVal = currentObject;
+				case task_controller_object::ObjectTypes::Device:
+				{
+					auto device = std::static_pointer_cast<task_controller_object::DeviceObject>(currentObject);
+					retVal += DEVICE_SIZE + device->get_software_version().size() + device->get_serial_number().size();
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceElement:
+				{
+					retVal += ELEMENT_SIZE + (ELEMENT_REFERENCE_SIZE * std::static_pointer_cast<task_controller_object::DeviceElementObject>(currentObject)->get_number_child_objects());
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceProcessData:
+				{
+					retVal += PROCESS_DATA_SIZE;
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceProperty:
+				{
+					retVal += PROPERTY_SIZE;
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceValuePresentation:
+				{
+					retVal += VALUE_PRESENTATION_SIZE;
+				}
+				break;
+
+				default:
+				{
+				}
 				break;
 			}
 		}
 		return retVal;
 	}
 
+	std::shared_ptr<task_controller_object::Object> DeviceDescriptorObjectPool::get_object_by_id(std::uint16_t objectID)
+	{
+		std::shared_ptr<task_controller_object::Object> retVal;
+
+		update_object_index();
+		auto indexedObject = objectIndex.find(objectID);
+		if (objectIndex.end() != indexedObject)
+		{
+			retVal = indexedObject->second;
+		}
+		return retVal;
+	}
+
 	std::shared_ptr<task_controller_object::Object> DeviceDescriptorObjectPool::get_object_by_index(std::uint16_t index)
 	{
 		std::shared_ptr<task_controller_object::Object> retVal = nullptr;
@@ -1011,14 +1843,14 @@ namespace isobus
 	{
 		bool retVal = false;
 
-		for (auto object = objectList.begin(); object != objectList.end(); object++)
+		auto objectToRemove = get_object_by_id(objectID);
+
+		if (nullptr != objectToRemove)
 		{
-			if ((nullptr != *object) && (*object)->get_object_id() == objectID)
-			{
-				objectList.erase(object);
-				retVal = true;
-				break;
-			}
+			objectList.erase(std::find(objectList.begin(), objectList.end(), objectToRemove));
+			objectIndex.erase(objectID);
+			// The object keeps the counter, since a copy of this pool may still hold the object
+			retVal = true;
 		}
 		return retVal;
 	}
@@ -1050,6 +1882,7 @@ namespace isobus
 	void DeviceDescriptorObjectPool::clear()
 	{
 		objectList.clear();
+		objectIndex.clear();
 	}
 
 	std::size_t DeviceDescriptorObjectPool::size() const
@@ -1210,26 +2043,34 @@ namespace isobus
 		return retVal;
 	}
 
-	bool DeviceDescriptorObjectPool::check_object_id_unique(std::uint16_t uniqueID) const
+	bool DeviceDescriptorObjectPool::check_object_id_unique(std::uint16_t uniqueID)
 	{
-		bool retVal = true;
+		return ((0 != uniqueID) &&
+		        (task_controller_object::Object::NULL_OBJECT_ID != uniqueID) &&
+		        (nullptr == get_object_by_id(uniqueID)));
+	}
 
-		if ((0 != uniqueID) && (task_controller_object::Object::NULL_OBJECT_ID != uniqueID))
+	void DeviceDescriptorObjectPool::index_object(const std::shared_ptr<task_controller_object::Object> &object)
+	{
+		update_object_index();
+
+		// If an ID is somehow used twice, lookups find the first object with it, like they used to
+		objectIndex.insert({ object->get_object_id(), object });
+		object->set_object_id_change_counter(objectIDChangeCount, {});
+	}
+
+	void DeviceDescriptorObjectPool::update_object_index()
+	{
+		if (objectIndexChangeCount != *objectIDChangeCount)
 		{
-			for (auto &currentObject : objectList)
+			// An object's ID was changed after it was added, so the index has to be rebuilt
+			objectIndex.clear();
+			for (const auto &currentObject : objectList)
 			{
-				if (uniqueID == currentObject->get_object_id())
-				{
-					retVal = false;
-					break;
-				}
+				objectIndex.insert({ currentObject->get_object_id(), currentObject });
 			}
+			objectIndexChangeCount = *objectIDChangeCount;
 		}
-		else
-		{
-			retVal = false;
-		}
-		return retVal;
 	}
 
 } // namespace isobus
@@ -0,0 +1,671 @@
+//================================================================================================
+/// @file isobus_device_descriptor_object_pool_view.cpp
+///
+/// @brief Implements read-only access to a binary DDOP without deserializing it.
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#include "isobus/isobus/isobus_device_descriptor_object_pool_view.hpp"
+
+#include "isobus/isobus/can_stack_logger.hpp"
+#include "isobus/utility/platform_endianness.hpp"
+#include "isobus/utility/to_string.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace isobus
+{
+	DeviceDescriptorObjectPoolView::Text::Text(const std::uint8_t *textData, std::size_t textSize) :
+	  textData(textData),
+	  textSize(textSize)
+	{
+	}
+
+	const char *DeviceDescriptorObjectPoolView::Text::data() const
+	{
+		return reinterpret_cast<const char *>(textData);
+	}
+
+	std::size_t DeviceDescriptorObjectPoolView::Text::size() const
+	{
+		return textSize;
+	}
+
+	bool DeviceDescriptorObjectPoolView::Text::empty() const
+	{
+		return (0 == textSize);
+	}
+
+	std::string DeviceDescriptorObjectPoolView::Text::to_string() const
+	{
+		return std::string(data(), textSize);
+	}
+
+	bool DeviceDescriptorObjectPoolView::Text::operator==(const std::string &other) const
+	{
+		return ((other.size() == textSize) &&
+		        ((0 == textSize) || (0 == memcmp(other.data(), textData, textSize))));
+	}
+
+	bool DeviceDescriptorObjectPoolView::Text::operator!=(const std::string &other) const
+	{
+		return !(*this == other);
+	}
+
+	DeviceDescriptorObjectPoolView::ObjectView::ObjectView(const std::uint8_t *data, task_controller_object::ObjectTypes type, bool hasExtendedStructureLabel) :
+	  objectData(data),
+	  objectType(type),
+	  extendedStructureLabel(hasExtendedStructureLabel)
+	{
+	}
+
+	bool DeviceDescriptorObjectPoolView::ObjectView::get_is_valid() const
+	{
+		return (nullptr != objectData);
+	}
+
+	task_controller_object::ObjectTypes DeviceDescriptorObjectPoolView::ObjectView::get_object_type() const
+	{
+		return objectType;
+	}
+
+	std::uint16_t DeviceDescriptorObjectPoolView::ObjectView::get_object_id() const
+	{
+		return get_is_valid() ? read_uint16(3) : static_cast<std::uint16_t>(task_controller_object::Object::NULL_OBJECT_ID);
+	}
+
+	DeviceDescriptorObjectPoolView::Text DeviceDescriptorObjectPoolView::ObjectView::get_designator() const
+	{
+		Text retVal;
+
+		if (get_is_valid())
+		{
+			switch (objectType)
+			{
+				case task_controller_object::ObjectTypes::Device:
+				{
+					retVal = Text(&objectData[6], objectData[5]);
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceElement:
+				{
+					retVal = Text(&objectData[7], objectData[6]);
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceProcessData:
+				{
+					retVal = Text(&objectData[10], objectData[9]);
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceProperty:
+				{
+					retVal = Text(&objectData[12], objectData[11]);
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceValuePresentation:
+				{
+					retVal = Text(&objectData[15], objectData[14]);
+				}
+				break;
+			}
+		}
+		return retVal;
+	}
+
+	std::size_t DeviceDescriptorObjectPoolView::ObjectView::get_binary_object_size() const
+	{
+		std::size_t retVal = 0;
+
+		if (get_is_valid())
+		{
+			std::size_t designatorSize = get_designator().size();
+
+			switch (objectType)
+			{
+				case task_controller_object::ObjectTypes::Device:
+				{
+					retVal = get_device_structure_label_offset() + 14;
+
+					if (extendedStructureLabel)
+					{
+						retVal += (1 + get_extended_structure_label().size());
+					}
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceElement:
+				{
+					retVal = 13 + designatorSize + (2 * static_cast<std::size_t>(get_number_child_objects()));
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceProcessData:
+				{
+					retVal = 12 + designatorSize;
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceProperty:
+				{
+					retVal = 14 + designatorSize;
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceValuePresentation:
+				{
+					retVal = 15 + designatorSize;
+				}
+				break;
+			}
+		}
+		return retVal;
+	}
+
+	DeviceDescriptorObjectPoolView::Text DeviceDescriptorObjectPoolView::ObjectView::get_software_version() const
+	{
+		Text retVal;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::Device == objectType))
+		{
+			std::size_t lengthOffset = 6 + objectData[5];
+			retVal = Text(&objectData[lengthOffset + 1], objectData[lengthOffset]);
+		}
+		return retVal;
+	}
+
+	DeviceDescriptorObjectPoolView::Text DeviceDescriptorObjectPoolView::ObjectView::get_serial_number() const
+	{
+		Text retVal;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::Device == objectType))
+		{
+			std::size_t lengthOffset = get_device_name_offset() + 8;
+			retVal = Text(&objectData[lengthOffset + 1], objectData[lengthOffset]);
+		}
+		return retVal;
+	}
+
+	std::uint64_t DeviceDescriptorObjectPoolView::ObjectView::get_iso_name() const
+	{
+		std::uint64_t retVal = 0;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::Device == objectType))
+		{
+			std::size_t nameOffset = get_device_name_offset();
+			retVal = (static_cast<std::uint64_t>(read_uint32(nameOffset + 4)) << 32) | read_uint32(nameOffset);
+		}
+		return retVal;
+	}
+
+	DeviceDescriptorObjectPoolView::Text DeviceDescriptorObjectPoolView::ObjectView::get_structure_label() const
+	{
+		Text retVal;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::Device == objectType))
+		{
+			retVal = Text(&objectData[get_device_structure_label_offset()], 7);
+		}
+		return retVal;
+	}
+
+	std::array<std::uint8_t, 7> DeviceDescriptorObjectPoolView::ObjectView::get_localization_label() const
+	{
+		std::array<std::uint8_t, 7> retVal = { 0 };
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::Device == objectType))
+		{
+			memcpy(retVal.data(), &objectData[get_device_structure_label_offset() + 7], retVal.size());
+		}
+		return retVal;
+	}
+
+	DeviceDescriptorObjectPoolView::Text DeviceDescriptorObjectPoolView::ObjectView::get_extended_structure_label() const
+	{
+		Text retVal;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::Device == objectType) && extendedStructureLabel)
+		{
+			std::size_t lengthOffset = get_device_structure_label_offset() + 14;
+			retVal = Text(&objectData[lengthOffset + 1], objectData[lengthOffset]);
+		}
+		return retVal;
+	}
+
+	task_controller_object::DeviceElementObject::Type DeviceDescriptorObjectPoolView::ObjectView::get_element_type() const
+	{
+		task_controller_object::DeviceElementObject::Type retVal = task_controller_object::DeviceElementObject::Type::Device;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceElement == objectType))
+		{
+			retVal = static_cast<task_controller_object::DeviceElementObject::Type>(objectData[5]);
+		}
+		return retVal;
+	}
+
+	std::uint16_t DeviceDescriptorObjectPoolView::ObjectView::get_element_number() const
+	{
+		std::uint16_t retVal = 0;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceElement == objectType))
+		{
+			retVal = read_uint16(7 + objectData[6]);
+		}
+		return retVal;
+	}
+
+	std::uint16_t DeviceDescriptorObjectPoolView::ObjectView::get_parent_object() const
+	{
+		std::uint16_t retVal = task_controller_object::Object::NULL_OBJECT_ID;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceElement == objectType))
+		{
+			retVal = read_uint16(9 + objectData[6]);
+		}
+		return retVal;
+	}
+
+	std::uint16_t DeviceDescriptorObjectPoolView::ObjectView::get_number_child_objects() const
+	{
+		std::uint16_t retVal = 0;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceElement == objectType))
+		{
+			retVal = read_uint16(11 + objectData[6]);
+		}
+		return retVal;
+	}
+
+	std::uint16_t DeviceDescriptorObjectPoolView::ObjectView::get_child_object_id(std::uint16_t index) const
+	{
+		std::uint16_t retVal = task_controller_object::Object::NULL_OBJECT_ID;
+
+		if (index < get_number_child_objects())
+		{
+			retVal = read_uint16(13 + objectData[6] + (2 * static_cast<std::size_t>(index)));
+		}
+		return retVal;
+	}
+
+	std::uint16_t DeviceDescriptorObjectPoolView::ObjectView::get_ddi() const
+	{
+		std::uint16_t retVal = 0;
+
+		if (get_is_valid() &&
+		    ((task_controller_object::ObjectTypes::DeviceProcessData == objectType) ||
+		     (task_controller_object::ObjectTypes::DeviceProperty == objectType)))
+		{
+			retVal = read_uint16(5);
+		}
+		return retVal;
+	}
+
+	std::uint8_t DeviceDescriptorObjectPoolView::ObjectView::get_properties_bitfield() const
+	{
+		std::uint8_t retVal = 0;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceProcessData == objectType))
+		{
+			retVal = objectData[7];
+		}
+		return retVal;
+	}
+
+	std::uint8_t DeviceDescriptorObjectPoolView::ObjectView::get_trigger_methods_bitfield() const
+	{
+		std::uint8_t retVal = 0;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceProcessData == objectType))
+		{
+			retVal = objectData[8];
+		}
+		return retVal;
+	}
+
+	std::int32_t DeviceDescriptorObjectPoolView::ObjectView::get_value() const
+	{
+		std::int32_t retVal = 0;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceProperty == objectType))
+		{
+			retVal = static_cast<std::int32_t>(read_uint32(7));
+		}
+		return retVal;
+	}
+
+	std::uint16_t DeviceDescriptorObjectPoolView::ObjectView::get_device_value_presentation_object_id() const
+	{
+		std::uint16_t retVal = task_controller_object::Object::NULL_OBJECT_ID;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceProcessData == objectType))
+		{
+			retVal = read_uint16(10 + objectData[9]);
+		}
+		else if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceProperty == objectType))
+		{
+			retVal = read_uint16(12 + objectData[11]);
+		}
+		return retVal;
+	}
+
+	std::int32_t DeviceDescriptorObjectPoolView::ObjectView::get_offset() const
+	{
+		std::int32_t retVal = 0;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceValuePresentation == objectType))
+		{
+			retVal = static_cast<std::int32_t>(read_uint32(5));
+		}
+		return retVal;
+	}
+
+	float DeviceDescriptorObjectPoolView::ObjectView::get_scale() const
+	{
+		float retVal = 0.0f;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceValuePresentation == objectType))
+		{
+			std::array<std::uint8_t, sizeof(float)> scaleBytes = {
+				objectData[9],
+				objectData[10],
+				objectData[11],
+				objectData[12],
+			};
+
+			if (is_big_endian())
+			{
+				std::reverse(scaleBytes.begin(), scaleBytes.end());
+			}
+			memcpy(&retVal, scaleBytes.data(), sizeof(float));
+		}
+		return retVal;
+	}
+
+	std::uint8_t DeviceDescriptorObjectPoolView::ObjectView::get_number_of_decimals() const
+	{
+		std::uint8_t retVal = 0;
+
+		if (get_is_valid() && (task_controller_object::ObjectTypes::DeviceValuePresentation == objectType))
+		{
+			retVal = objectData[13];
+		}
+		return retVal;
+	}
+
+	std::shared_ptr<task_controller_object::Object> DeviceDescriptorObjectPoolView::ObjectView::materialize() const
+	{
+		std::shared_ptr<task_controller_object::Object> retVal;
+
+		if (get_is_valid())
+		{
+			switch (objectType)
+			{
+				case task_controller_object::ObjectTypes::Device:
+				{
+					Text extendedLabel = get_extended_structure_label();
+					const std::uint8_t *extendedLabelData = reinterpret_cast<const std::uint8_t *>(extendedLabel.data());
+
+					retVal = std::make_shared<task_controller_object::DeviceObject>(get_designator().to_string(),
+					                                                               get_software_version().to_string(),
+					                                                               get_serial_number().to_string(),
+					                                                               get_structure_label().to_string(),
+					                                                               get_localization_label(),
+					                                                               std::vector<std::uint8_t>(extendedLabelData, extendedLabelData + extendedLabel.size()),
+					                                                               get_iso_name(),
+					                                                               extendedStructureLabel);
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceElement:
+				{
+					auto element = std::make_shared<task_controller_object::DeviceElementObject>(get_designator().to_string(),
+					                                                                            get_element_number(),
+					                                                                            get_parent_object(),
+					                                                                            get_element_type(),
+					                                                                            get_object_id());
+
+					for (std::uint16_t i = 0; i < get_number_child_objects(); i++)
+					{
+						element->add_reference_to_child_object(get_child_object_id(i));
+					}
+					retVal = element;
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceProcessData:
+				{
+					retVal = std::make_shared<task_controller_object::DeviceProcessDataObject>(get_designator().to_string(),
+					                                                                          get_ddi(),
+					                                                                          get_device_value_presentation_object_id(),
+					                                                                          get_properties_bitfield(),
+					                                                                          get_trigger_methods_bitfield(),
+					                                                                          get_object_id());
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceProperty:
+				{
+					retVal = std::make_shared<task_controller_object::DevicePropertyObject>(get_designator().to_string(),
+					                                                                       get_value(),
+					                                                                       get_ddi(),
+					                                                                       get_device_value_presentation_object_id(),
+					                                                                       get_object_id());
+				}
+				break;
+
+				case task_controller_object::ObjectTypes::DeviceValuePresentation:
+				{
+					retVal = std::make_shared<task_controller_object::DeviceValuePresentationObject>(get_designator().to_string(),
+					                                                                                get_offset(),
+					                                                                                get_scale(),
+					                                                                                get_number_of_decimals(),
+					                                                                                get_object_id());
+				}
+				break;
+			}
+		}
+		return retVal;
+	}
+
+	std::uint16_t DeviceDescriptorObjectPoolView::ObjectView::read_uint16(std::size_t offset) const
+	{
+		return static_cast<std::uint16_t>(static_cast<std::uint16_t>(objectData[offset]) | (static_cast<std::uint16_t>(objectData[offset + 1]) << 8));
+	}
+
+	std::uint32_t DeviceDescriptorObjectPoolView::ObjectView::read_uint32(std::size_t offset) const
+	{
+		return (static_cast<std::uint32_t>(objectData[offset]) |
+		        (static_cast<std::uint32_t>(objectData[offset + 1]) << 8) |
+		        (static_cast<std::uint32_t>(objectData[offset + 2]) << 16) |
+		        (static_cast<std::uint32_t>(objectData[offset + 3]) << 24));
+	}
+
+	std::size_t DeviceDescriptorObjectPoolView::ObjectView::get_device_name_offset() const
+	{
+		std::size_t softwareVersionLengthOffset = 6 + objectData[5];
+		return (softwareVersionLengthOffset + 1 + objectData[softwareVersionLengthOffset]);
+	}
+
+	std::size_t DeviceDescriptorObjectPoolView::ObjectView::get_device_structure_label_offset() const
+	{
+		std::size_t serialNumberLengthOffset = get_device_name_offset() + 8;
+		return (serialNumberLengthOffset + 1 + objectData[serialNumberLengthOffset]);
+	}
+
+	DeviceDescriptorObjectPoolView::DeviceDescriptorObjectPoolView(std::uint8_t taskControllerServerVersion) :
+	  taskControllerCompatibilityLevel(taskControllerServerVersion)
+	{
+	}
+
+	bool DeviceDescriptorObjectPoolView::open(const std::uint8_t *binaryPool, std::uint32_t binaryPoolSizeBytes)
+	{
+		bool retVal = ((nullptr != binaryPool) && (0 != binaryPoolSizeBytes));
+		std::uint32_t offset = 0;
+
+		close();
+
+		while (retVal && (offset < binaryPoolSizeBytes))
+		{
+			task_controller_object::ObjectTypes type = task_controller_object::ObjectTypes::Device;
+			std::uint32_t objectSize = 0;
+
+			if (index_object(&binaryPool[offset], binaryPoolSizeBytes - offset, type, objectSize))
+			{
+				std::uint16_t objectID = static_cast<std::uint16_t>(static_cast<std::uint16_t>(binaryPool[offset + 3]) | (static_cast<std::uint16_t>(binaryPool[offset + 4]) << 8));
+				objects.push_back({ offset, objectID, type });
+				offset += objectSize;
+			}
+			else
+			{
+				CANStackLogger::error("[DDOP]: Binary DDOP object at offset " + isobus::to_string(offset) + " is malformed. DDOP view not opened.");
+				retVal = false;
+			}
+		}
+
+		if (retVal)
+		{
+			objectsByID.resize(objects.size());
+			for (std::uint32_t i = 0; i < objects.size(); i++)
+			{
+				objectsByID[i] = i;
+			}
+			std::sort(objectsByID.begin(), objectsByID.end(), [this](std::uint32_t a, std::uint32_t b) { return objects[a].objectID < objects[b].objectID; });
+
+			auto duplicate = std::adjacent_find(objectsByID.begin(), objectsByID.end(), [this](std::uint32_t a, std::uint32_t b) { return objects[a].objectID == objects[b].objectID; });
+
+			if (objectsByID.end() != duplicate)
+			{
+				CANStackLogger::error("[DDOP]: Object ID " + isobus::to_string(static_cast<int>(objects[*duplicate].objectID)) + " is not unique. DDOP view not opened.");
+				retVal = false;
+			}
+		}
+
+		if (retVal)
+		{
+			poolData = binaryPool;
+		}
+		else
+		{
+			close();
+		}
+		return retVal;
+	}
+
+	bool DeviceDescriptorObjectPoolView::open(const std::vector<std::uint8_t> &binaryPool)
+	{
+		return open(binaryPool.data(), static_cast<std::uint32_t>(binaryPool.size()));
+	}
+
+	void DeviceDescriptorObjectPoolView::close()
+	{
+		objects.clear();
+		objectsByID.clear();
+		poolData = nullptr;
+	}
+
+	std::size_t DeviceDescriptorObjectPoolView::size() const
+	{
+		return objects.size();
+	}
+
+	DeviceDescriptorObjectPoolView::ObjectView DeviceDescriptorObjectPoolView::get_object_by_index(std::size_t index) const
+	{
+		ObjectView retVal;
+
+		if (index < objects.size())
+		{
+			retVal = ObjectView(&poolData[objects[index].offset], objects[index].type, (taskControllerCompatibilityLevel >= 4));
+		}
+		return retVal;
+	}
+
+	DeviceDescriptorObjectPoolView::ObjectView DeviceDescriptorObjectPoolView::get_object_by_id(std::uint16_t objectID) const
+	{
+		ObjectView retVal;
+		auto result = std::lower_bound(objectsByID.begin(), objectsByID.end(), objectID, [this](std::uint32_t index, std::uint16_t id) { return objects[index].objectID < id; });
+
+		if ((objectsByID.end() != result) && (objectID == objects[*result].objectID))
+		{
+			retVal = get_object_by_index(*result);
+		}
+		return retVal;
+	}
+
+	bool DeviceDescriptorObjectPoolView::index_object(const std::uint8_t *data, std::uint32_t remainingBytes, task_controller_object::ObjectTypes &type, std::uint32_t &objectSize) const
+	{
+		bool retVal = false;
+
+		// The lengths of each object's variable length fields are checked the same way deserialize_binary_object_pool checks them
+		if (remainingBytes < 6)
+		{
+			CANStackLogger::error("[DDOP]: Binary DDOP has too few bytes left for an object.");
+		}
+		else if (0 == memcmp(data, "DVC", 3))
+		{
+			std::uint32_t designatorLength = data[5];
+			type = task_controller_object::ObjectTypes::Device;
+			retVal = ((designatorLength < 128) && (remainingBytes >= (7 + designatorLength)));
+
+			if (retVal)
+			{
+				std::uint32_t softwareVersionLength = data[6 + designatorLength];
+				retVal = ((softwareVersionLength < 128) && (remainingBytes >= (16 + designatorLength + softwareVersionLength)));
+
+				if (retVal)
+				{
+					std::uint32_t serialNumberLength = data[15 + designatorLength + softwareVersionLength];
+					objectSize = 30 + designatorLength + softwareVersionLength + serialNumberLength;
+					retVal = (serialNumberLength < 128);
+
+					if (retVal && (taskControllerCompatibilityLevel >= 4))
+					{
+						retVal = ((remainingBytes > objectSize) && (data[objectSize] <= 32));
+						objectSize += retVal ? (1 + data[objectSize]) : 0;
+					}
+				}
+			}
+		}
+		else if (0 == memcmp(data, "DET", 3))
+		{
+			std::uint32_t designatorLength = data[6];
+			type = task_controller_object::ObjectTypes::DeviceElement;
+			retVal = ((designatorLength < 128) &&
+			          (remainingBytes >= (13 + designatorLength)) &&
+			          (data[5] <= static_cast<std::uint8_t>(task_controller_object::DeviceElementObject::Type::NavigationReference)));
+
+			if (retVal)
+			{
+				std::uint32_t numberOfChildren = static_cast<std::uint32_t>(data[11 + designatorLength]) | (static_cast<std::uint32_t>(data[12 + designatorLength]) << 8);
+				objectSize = 13 + designatorLength + (2 * numberOfChildren);
+			}
+		}
+		else if (0 == memcmp(data, "DPD", 3))
+		{
+			type = task_controller_object::ObjectTypes::DeviceProcessData;
+			retVal = ((remainingBytes >= 10) && (data[9] < 128));
+			objectSize = retVal ? (12 + data[9]) : 0;
+		}
+		else if (0 == memcmp(data, "DPT", 3))
+		{
+			type = task_controller_object::ObjectTypes::DeviceProperty;
+			retVal = ((remainingBytes >= 12) && (data[11] < 128));
+			objectSize = retVal ? (14 + data[11]) : 0;
+		}
+		else if (0 == memcmp(data, "DVP", 3))
+		{
+			type = task_controller_object::ObjectTypes::DeviceValuePresentation;
+			retVal = ((remainingBytes >= 15) && (data[14] < 128));
+			objectSize = retVal ? (15 + data[14]) : 0;
+		}
+		else
+		{
+			CANStackLogger::error("[DDOP]: Cannot process an unknown XML namespace from binary DDOP.");
+		}
+		return (retVal && (remainingBytes >= objectSize));
+	}
+} // namespace isobus
@@ -77,6 +77,7 @@ namespace isobus
 	DiagnosticProtocol::DiagnosticProtocol(std::shared_ptr<InternalControlFunction> internalControlFunction, NetworkType networkType) :
 	  ControlFunctionFunctionalitiesMessageInterface(internalControlFunction),
 	  myControlFunction(internalControlFunction),
+	  network(internalControlFunction->get_network()),
 	  networkType(networkType),
 	  txFlags(static_cast<std::uint32_t>(TransmitFlags::NumberOfFlags), process_flags, this)
 	{
@@ -99,10 +100,10 @@ namespace isobus
 		if (!initialized)
 		{
 			initialized = true;
-			CANNetworkManager::CANNetwork.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage22), process_message, this);
-			CANNetworkManager::CANNetwork.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage13), process_message, this);
-			CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage13), process_message, this);
-			addressViolationEventHandle = CANNetworkManager::CANNetwork.get_address_violation_event_dispatcher().add_listener([this](std::shared_ptr<InternalControlFunction> affectedCF) { this->on_address_violation(affectedCF); });
+			network.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage22), process_message, this);
+			network.add_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage13), process_message, this);
+			network.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage13), process_message, this);
+			addressViolationEventHandle = network.get_address_violation_event_dispatcher().add_listener([this](std::shared_ptr<InternalControlFunction> affectedCF) { this->on_address_violation(affectedCF); });
 
 			if (auto requestProtocol = myControlFunction->get_pgn_request_protocol().lock())
 			{
@@ -146,9 +147,9 @@ namespace isobus
 				requestProtocol->remove_pgn_request_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::SoftwareIdentification), process_parameter_group_number_request, this);
 				requestProtocol->remove_pgn_request_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUIdentificationInformation), process_parameter_group_number_request, this);
 			}
-			CANNetworkManager::CANNetwork.remove_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage22), process_message, this);
-			CANNetworkManager::CANNetwork.remove_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage13), process_message, this);
-			CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage13), process_message, this);
+			network.remove_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage22), process_message, this);
+			network.remove_protocol_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage13), process_message, this);
+			network.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage13), process_message, this);
 			addressViolationEventHandle.reset();
 		}
 	}
@@ -679,10 +680,10 @@ namespace isobus
 					buffer[5] = 0x00;
 					buffer[6] = 0xFF;
 					buffer[7] = 0xFF;
-					retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage1),
-					                                                        buffer.data(),
-					                                                        CAN_DATA_LENGTH,
-					                                                        myControlFunction);
+					retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage1),
+					                                buffer.data(),
+					                                CAN_DATA_LENGTH,
+					                                myControlFunction);
 				}
 				else
 				{
@@ -701,10 +702,10 @@ namespace isobus
 						payloadSize = CAN_DATA_LENGTH;
 					}
 
-					retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage1),
-					                                                        buffer.data(),
-					                                                        payloadSize,
-					                                                        myControlFunction);
+					retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage1),
+					                                buffer.data(),
+					                                payloadSize,
+					                                myControlFunction);
 				}
 			}
 		}
@@ -767,10 +768,10 @@ namespace isobus
 					buffer[5] = 0x00;
 					buffer[6] = 0xFF;
 					buffer[7] = 0xFF;
-					retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage2),
-					                                                        buffer.data(),
-					                                                        CAN_DATA_LENGTH,
-					                                                        myControlFunction);
+					retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage2),
+					                                buffer.data(),
+					                                CAN_DATA_LENGTH,
+					                                myControlFunction);
 				}
 				else
 				{
@@ -789,10 +790,10 @@ namespace isobus
 						payloadSize = CAN_DATA_LENGTH;
 					}
 
-					retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage2),
-					                                                        buffer.data(),
-					                                                        payloadSize,
-					                                                        myControlFunction);
+					retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage2),
+					                                buffer.data(),
+					                                payloadSize,
+					                                myControlFunction);
 				}
 			}
 		}
@@ -811,10 +812,10 @@ namespace isobus
 
 			buffer.fill(0xFF); // Reserved bytes
 			buffer[0] = SUPPORTED_DIAGNOSTIC_PROTOCOLS_BITFIELD;
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticProtocolIdentification),
-			                                                        buffer.data(),
-			                                                        CAN_DATA_LENGTH,
-			                                                        myControlFunction);
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticProtocolIdentification),
+			                                buffer.data(),
+			                                CAN_DATA_LENGTH,
+			                                myControlFunction);
 		}
 		return retVal;
 	}
@@ -831,10 +832,10 @@ namespace isobus
 			0xFF,
 			0xFF
 		};
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage13),
-		                                                      buffer.data(),
-		                                                      buffer.size(),
-		                                                      myControlFunction);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage13),
+		                              buffer.data(),
+		                              buffer.size(),
+		                              myControlFunction);
 	}
 
 	bool DiagnosticProtocol::send_ecu_identification() const
@@ -848,10 +849,10 @@ namespace isobus
 		}
 
 		std::vector<std::uint8_t> buffer(ecuIdString.begin(), ecuIdString.end());
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUIdentificationInformation),
-		                                                      buffer.data(),
-		                                                      buffer.size(),
-		                                                      myControlFunction);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUIdentificationInformation),
+		                              buffer.data(),
+		                              buffer.size(),
+		                              myControlFunction);
 	}
 
 	bool DiagnosticProtocol::send_product_identification() const
@@ -859,10 +860,10 @@ namespace isobus
 		std::string productIdString = productIdentificationCode + "*" + productIdentificationBrand + "*" + productIdentificationModel + "*";
 		std::vector<std::uint8_t> buffer(productIdString.begin(), productIdString.end());
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProductIdentification),
-		                                                      buffer.data(),
-		                                                      buffer.size(),
-		                                                      myControlFunction);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProductIdentification),
+		                              buffer.data(),
+		                              buffer.size(),
+		                              myControlFunction);
 	}
 
 	bool DiagnosticProtocol::send_software_identification() const
@@ -881,10 +882,10 @@ namespace isobus
 			              });
 
 			std::vector<std::uint8_t> buffer(softIDString.begin(), softIDString.end());
-			retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::SoftwareIdentification),
-			                                                        buffer.data(),
-			                                                        buffer.size(),
-			                                                        myControlFunction);
+			retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::SoftwareIdentification),
+			                                buffer.data(),
+			                                buffer.size(),
+			                                myControlFunction);
 		}
 		return retVal;
 	}
@@ -937,11 +938,11 @@ namespace isobus
 				buffer[7] = static_cast<std::uint8_t>(((currentMessageData.suspectParameterNumber >> 16) << 5) & 0xE0);
 				buffer[7] |= (currentMessageData.failureModeIdentifier & 0x1F);
 
-				retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage22),
-				                                                        buffer.data(),
-				                                                        buffer.size(),
-				                                                        myControlFunction,
-				                                                        currentMessageData.destination);
+				retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::DiagnosticMessage22),
+				                                buffer.data(),
+				                                buffer.size(),
+				                                myControlFunction,
+				                                currentMessageData.destination);
 				if (retVal)
 				{
 					dm22ResponseQueue.pop_back();
@@ -953,9 +954,9 @@ namespace isobus
 
 	void DiagnosticProtocol::process_message(const CANMessage &message)
 	{
-		if (((nullptr == message.get_destination_control_function()) &&
+		if (((nullptr == message.get_destination_control_function_pointer()) &&
 		     (BROADCAST_CAN_ADDRESS == message.get_identifier().get_destination_address())) ||
-		    (message.get_destination_control_function() == myControlFunction))
+		    (message.get_destination_control_function_pointer() == myControlFunction.get()))
 		{
 			switch (message.get_identifier().get_parameter_group_number())
 			{
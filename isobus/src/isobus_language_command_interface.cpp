@@ -24,13 +24,15 @@ namespace isobus
 	LanguageCommandInterface::LanguageCommandInterface(std::shared_ptr<InternalControlFunction> sourceControlFunction, bool shouldRespondToRequests) :
 	  myControlFunction(sourceControlFunction),
 	  myPartner(nullptr),
+	  network((nullptr != sourceControlFunction) ? sourceControlFunction->get_network() : CANNetworkManager::CANNetwork),
 	  respondToRequests(shouldRespondToRequests)
 	{
 	}
 
 	LanguageCommandInterface::LanguageCommandInterface(std::shared_ptr<InternalControlFunction> sourceControlFunction, std::shared_ptr<PartneredControlFunction> filteredControlFunction) :
 	  myControlFunction(sourceControlFunction),
-	  myPartner(filteredControlFunction)
+	  myPartner(filteredControlFunction),
+	  network((nullptr != sourceControlFunction) ? sourceControlFunction->get_network() : CANNetworkManager::CANNetwork)
 	{
 	}
 
@@ -38,7 +40,7 @@ namespace isobus
 	{
 		if (initialized)
 		{
-			CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::LanguageCommand), process_rx_message, this);
+			network.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::LanguageCommand), process_rx_message, this);
 
 			if (respondToRequests && (!myControlFunction->get_pgn_request_protocol().expired()))
 			{
@@ -53,7 +55,7 @@ namespace isobus
 		{
 			if (nullptr != myControlFunction)
 			{
-				CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::LanguageCommand), process_rx_message, this);
+				network.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::LanguageCommand), process_rx_message, this);
 
 				if (respondToRequests && (!myControlFunction->get_pgn_request_protocol().expired()))
 				{
@@ -117,11 +119,11 @@ namespace isobus
 			static_cast<std::uint8_t>(countryCode[0]),
 			static_cast<std::uint8_t>(countryCode[1])
 		};
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::LanguageCommand),
-		                                                      buffer.data(),
-		                                                      buffer.size(),
-		                                                      myControlFunction,
-		                                                      nullptr);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::LanguageCommand),
+		                              buffer.data(),
+		                              buffer.size(),
+		                              myControlFunction,
+		                              nullptr);
 	}
 
 	std::string LanguageCommandInterface::get_country_code() const
@@ -322,7 +324,7 @@ namespace isobus
 		    (CAN_DATA_LENGTH <= message.get_data_length()) &&
 		    (static_cast<std::uint32_t>(CANLibParameterGroupNumber::LanguageCommand) == message.get_identifier().get_parameter_group_number()) &&
 		    ((nullptr == parentInterface->myPartner) ||
-		     (message.get_source_control_function()->get_NAME() == parentInterface->myPartner->get_NAME())))
+		     (message.get_source_control_function_pointer()->get_NAME() == parentInterface->myPartner->get_NAME())))
 		{
 			const auto &data = message.get_data();
 			parentInterface->languageCommandTimestamp_ms = SystemTiming::get_timestamp_ms();
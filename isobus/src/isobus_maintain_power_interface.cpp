@@ -12,6 +12,7 @@ namespace isobus
 {
 	MaintainPowerInterface::MaintainPowerInterface(std::shared_ptr<InternalControlFunction> sourceControlFunction) :
 	  maintainPowerTransmitData(sourceControlFunction),
+	  network((nullptr != sourceControlFunction) ? sourceControlFunction->get_network() : CANNetworkManager::CANNetwork),
 	  txFlags(static_cast<std::uint32_t>(TransmitFlags::NumberOfFlags), process_flags, this)
 	{
 	}
@@ -20,8 +21,8 @@ namespace isobus
 	{
 		if (initialized)
 		{
-			CANNetworkManager::CANNetwork.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::MaintainPower), process_rx_message, this);
-			CANNetworkManager::CANNetwork.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::WheelBasedSpeedAndDistance), process_rx_message, this);
+			network.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::MaintainPower), process_rx_message, this);
+			network.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::WheelBasedSpeedAndDistance), process_rx_message, this);
 		}
 	}
 
@@ -157,8 +158,8 @@ namespace isobus
 	{
 		if (!initialized)
 		{
-			CANNetworkManager::CANNetwork.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::MaintainPower), process_rx_message, this);
-			CANNetworkManager::CANNetwork.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::WheelBasedSpeedAndDistance), process_rx_message, this);
+			network.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::MaintainPower), process_rx_message, this);
+			network.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::WheelBasedSpeedAndDistance), process_rx_message, this);
 			initialized = true;
 		}
 	}
@@ -210,10 +211,10 @@ namespace isobus
 			0xFF
 		};
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::MaintainPower),
-		                                                      buffer.data(),
-		                                                      buffer.size(),
-		                                                      std::static_pointer_cast<InternalControlFunction>(maintainPowerTransmitData.get_sender_control_function()));
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::MaintainPower),
+		                              buffer.data(),
+		                              buffer.size(),
+		                              std::static_pointer_cast<InternalControlFunction>(maintainPowerTransmitData.get_sender_control_function()));
 	}
 
 	void MaintainPowerInterface::process_flags(std::uint32_t flag, void *parentPointer)
@@ -241,7 +242,7 @@ namespace isobus
 			// This is checked in the speed interface as well, but we need to know about it for the key switch state.
 			if (CAN_DATA_LENGTH == message.get_data_length())
 			{
-				if (nullptr != message.get_source_control_function())
+				if (nullptr != message.get_source_control_function_pointer())
 				{
 					// We don't care who's sending this really, we just need to detect a transition from not-off to off.
 					const auto decodedKeySwitchState = static_cast<KeySwitchState>((message.get_uint8_at(7) >> 2) & 0x03);
@@ -312,12 +313,12 @@ namespace isobus
 		{
 			if (CAN_DATA_LENGTH == message.get_data_length())
 			{
-				if (nullptr != message.get_source_control_function())
+				if (nullptr != message.get_source_control_function_pointer())
 				{
 					auto result = std::find_if(targetInterface->receivedMaintainPowerMessages.cbegin(),
 					                           targetInterface->receivedMaintainPowerMessages.cend(),
 					                           [&message](const std::shared_ptr<MaintainPowerData> &receivedInfo) {
-						                           return (nullptr != receivedInfo) && (receivedInfo->get_sender_control_function() == message.get_source_control_function());
+						                           return (nullptr != receivedInfo) && (receivedInfo->get_sender_control_function().get() == message.get_source_control_function_pointer());
 					                           });
 
 					if (result == targetInterface->receivedMaintainPowerMessages.end())
@@ -0,0 +1,174 @@
+//================================================================================================
+/// @file isobus_process_data_value_store.cpp
+///
+/// @brief A store of process data values that an application writes into and a task controller
+/// client reads from, without either side waiting on the other.
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#include "isobus/isobus/isobus_process_data_value_store.hpp"
+
+namespace isobus
+{
+	ProcessDataValueStore::Entry::Entry(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t initialValue, bool sendOnChange) :
+	  value(initialValue),
+	  changed(false),
+	  elementNumber(elementNumber),
+	  ddi(ddi),
+	  sendOnChange(sendOnChange)
+	{
+	}
+
+	bool ProcessDataValueStore::add_value(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t initialValue, bool sendOnChange)
+	{
+		bool retVal = false;
+
+		if (NO_ENTRY == find_entry(elementNumber, ddi))
+		{
+			entryIndex[get_key(elementNumber, ddi)] = static_cast<std::uint32_t>(entries.size());
+			entries.emplace_back(elementNumber, ddi, initialValue, sendOnChange);
+
+			if ((nullptr == changedQueue) || (entries.size() > (static_cast<std::size_t>(changedQueueMask) + 1)))
+			{
+				// Grow the queue so it can hold every entry at once, keeping anything already queued
+				std::uint32_t newSize = 8;
+				while (newSize < entries.size())
+				{
+					newSize <<= 1;
+				}
+
+				std::unique_ptr<std::atomic<std::uint32_t>[]> newQueue(new std::atomic<std::uint32_t>[newSize]);
+				std::uint32_t numberQueued = 0;
+
+				for (std::uint32_t i = 0; i < newSize; i++)
+				{
+					newQueue[i].store(NO_ENTRY, std::memory_order_relaxed);
+				}
+
+				if (nullptr != changedQueue)
+				{
+					for (std::uint32_t i = changedQueueReadIndex; i != changedQueueWriteIndex.load(std::memory_order_relaxed); i++)
+					{
+						newQueue[numberQueued].store(changedQueue[i & changedQueueMask].load(std::memory_order_relaxed), std::memory_order_relaxed);
+						numberQueued++;
+					}
+				}
+				changedQueue = std::move(newQueue);
+				changedQueueMask = newSize - 1;
+				changedQueueReadIndex = 0;
+				changedQueueWriteIndex.store(numberQueued, std::memory_order_release);
+			}
+			retVal = true;
+		}
+		return retVal;
+	}
+
+	bool ProcessDataValueStore::set_value(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t value)
+	{
+		std::uint32_t index = find_entry(elementNumber, ddi);
+		bool retVal = false;
+
+		if (NO_ENTRY != index)
+		{
+			Entry &entry = entries[index];
+
+			// Only the writer that marks the entry as changed queues it, so it's never in the queue twice
+			if ((value != entry.value.exchange(value, std::memory_order_acq_rel)) &&
+			    (!entry.changed.exchange(true, std::memory_order_acq_rel)))
+			{
+				std::uint32_t slot = changedQueueWriteIndex.fetch_add(1, std::memory_order_relaxed) & changedQueueMask;
+				changedQueue[slot].store(index, std::memory_order_release);
+
+				auto callback = valueChangedCallback.load(std::memory_order_acquire);
+				if (nullptr != callback)
+				{
+					callback(valueChangedParent.load(std::memory_order_acquire));
+				}
+			}
+			retVal = true;
+		}
+		return retVal;
+	}
+
+	bool ProcessDataValueStore::get_value(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t &value) const
+	{
+		std::uint32_t index = find_entry(elementNumber, ddi);
+		bool retVal = false;
+
+		if (NO_ENTRY != index)
+		{
+			value = entries[index].value.load(std::memory_order_acquire);
+			retVal = true;
+		}
+		return retVal;
+	}
+
+	bool ProcessDataValueStore::has_value(std::uint16_t elementNumber, std::uint16_t ddi) const
+	{
+		return (NO_ENTRY != find_entry(elementNumber, ddi));
+	}
+
+	bool ProcessDataValueStore::take_changed_value(ChangedValue &changedValue)
+	{
+		bool retVal = false;
+
+		if (nullptr != changedQueue)
+		{
+			std::atomic<std::uint32_t> &slot = changedQueue[changedQueueReadIndex & changedQueueMask];
+			std::uint32_t index = slot.load(std::memory_order_acquire);
+
+			// A writer may have claimed this slot but not filled it yet, in which case it's picked up next time
+			if (NO_ENTRY != index)
+			{
+				Entry &entry = entries[index];
+
+				slot.store(NO_ENTRY, std::memory_order_relaxed);
+				changedQueueReadIndex++;
+
+				// Clear the flag before reading the value, so a change made after this point queues the entry again.
+				// This has to be a read-modify-write, so that it acquires from any writer that found the flag still
+				// set and didn't queue the entry, and the value read below includes that writer's change.
+				entry.changed.exchange(false, std::memory_order_acq_rel);
+				changedValue.value = entry.value.load(std::memory_order_acquire);
+				changedValue.elementNumber = entry.elementNumber;
+				changedValue.ddi = entry.ddi;
+				changedValue.sendOnChange = entry.sendOnChange;
+				retVal = true;
+			}
+		}
+		return retVal;
+	}
+
+	std::size_t ProcessDataValueStore::size() const
+	{
+		return entries.size();
+	}
+
+	void ProcessDataValueStore::set_value_changed_callback(void (*callback)(void *parentPointer), void *parentPointer)
+	{
+		// The parent is stored first when adding a callback and last when removing one, so it's never
+		// passed to a callback it wasn't meant for
+		if (nullptr != callback)
+		{
+			valueChangedParent.store(parentPointer, std::memory_order_release);
+			valueChangedCallback.store(callback, std::memory_order_release);
+		}
+		else
+		{
+			valueChangedCallback.store(nullptr, std::memory_order_release);
+			valueChangedParent.store(parentPointer, std::memory_order_release);
+		}
+	}
+
+	std::uint32_t ProcessDataValueStore::get_key(std::uint16_t elementNumber, std::uint16_t ddi)
+	{
+		return ((static_cast<std::uint32_t>(elementNumber) << 16) | ddi);
+	}
+
+	std::uint32_t ProcessDataValueStore::find_entry(std::uint16_t elementNumber, std::uint16_t ddi) const
+	{
+		auto result = entryIndex.find(get_key(elementNumber, ddi));
+		return (entryIndex.end() != result) ? result->second : static_cast<std::uint32_t>(NO_ENTRY);
+	}
+} // namespace isobus
@@ -21,6 +21,7 @@ namespace isobus
 {
 	ShortcutButtonInterface::ShortcutButtonInterface(std::shared_ptr<InternalControlFunction> internalControlFunction, bool serverEnabled) :
 	  sourceControlFunction(internalControlFunction),
+	  network((nullptr != internalControlFunction) ? internalControlFunction->get_network() : CANNetworkManager::CANNetwork),
 	  txFlags(static_cast<std::uint32_t>(TransmitFlags::NumberOfFlags), process_flags, this),
 	  actAsISBServer(serverEnabled)
 	{
@@ -31,7 +32,7 @@ namespace isobus
 	{
 		if (initialized)
 		{
-			CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AllImplementsStopOperationsSwitchState), process_rx_message, this);
+			network.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AllImplementsStopOperationsSwitchState), process_rx_message, this);
 		}
 	}
 
@@ -39,9 +40,9 @@ namespace isobus
 	{
 		if (!initialized)
 		{
-			CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AllImplementsStopOperationsSwitchState),
-			                                                                         process_rx_message,
-			                                                                         this);
+			network.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AllImplementsStopOperationsSwitchState),
+			                                                 process_rx_message,
+			                                                 this);
 			initialized = true;
 		}
 	}
@@ -154,7 +155,7 @@ namespace isobus
 		{
 			if (CAN_DATA_LENGTH == message.get_data_length())
 			{
-				auto messageNAME = message.get_source_control_function()->get_NAME();
+				auto messageNAME = message.get_source_control_function_pointer()->get_NAME();
 				auto matches_isoname = [messageNAME](ISBServerData &isb) { return isb.ISONAME == messageNAME; };
 				auto ISB = std::find_if(isobusShorcutButtonList.begin(), isobusShorcutButtonList.end(), matches_isoname);
 				auto &messageData = message.get_data();
@@ -226,11 +227,11 @@ namespace isobus
 			static_cast<std::uint8_t>(0xFC | static_cast<std::uint8_t>(commandedState))
 		};
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AllImplementsStopOperationsSwitchState),
-		                                                      buffer.data(),
-		                                                      buffer.size(),
-		                                                      sourceControlFunction,
-		                                                      nullptr,
-		                                                      CANIdentifier::Priority3);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::AllImplementsStopOperationsSwitchState),
+		                              buffer.data(),
+		                              buffer.size(),
+		                              sourceControlFunction,
+		                              nullptr,
+		                              CANIdentifier::Priority3);
 	}
 }
@@ -11,7 +11,10 @@
 #include "isobus/isobus/can_general_parameter_group_numbers.hpp"
 #include "isobus/isobus/can_network_manager.hpp"
 #include "isobus/isobus/can_stack_logger.hpp"
+#include "isobus/isobus/isobus_device_descriptor_object_pool_view.hpp"
+#include "isobus/isobus/isobus_task_controller_client_executor.hpp"
 #include "isobus/isobus/isobus_virtual_terminal_client.hpp"
+#include "isobus/utility/iop_file_interface.hpp"
 #include "isobus/utility/system_timing.hpp"
 #include "isobus/utility/to_string.hpp"
 
@@ -27,6 +30,7 @@ namespace isobus
 	  languageCommandInterface(clientSource, partner),
 	  partnerControlFunction(partner),
 	  myControlFunction(clientSource),
+	  network((nullptr != clientSource) ? clientSource->get_network() : CANNetworkManager::CANNetwork),
 	  primaryVirtualTerminal(primaryVT)
 	{
 	}
@@ -44,7 +48,7 @@ namespace isobus
 
 		partnerControlFunction->add_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData), process_rx_message, this);
 		partnerControlFunction->add_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Acknowledge), process_rx_message, this);
-		CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData), process_rx_message, this);
+		network.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData), process_rx_message, this);
 
 		if (!languageCommandInterface.get_initialized())
 		{
@@ -119,6 +123,108 @@ namespace isobus
 		}
 	}
 
+	void TaskControllerClient::add_request_value_callback(std::uint16_t elementNumber, std::uint16_t ddi, RequestValueCommandCallback callback, void *parentPointer)
+	{
+		add_request_value_callback(elementNumber, ddi, ddi, callback, parentPointer);
+	}
+
+	void TaskControllerClient::add_request_value_callback(std::uint16_t elementNumber, std::uint16_t firstDDI, std::uint16_t lastDDI, RequestValueCommandCallback callback, void *parentPointer)
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(clientMutex);
+#endif
+
+		RequestValueCommandCallbackInfo callbackData = { callback, parentPointer };
+		for (std::uint32_t ddi = firstDDI; ddi <= lastDDI; ddi++)
+		{
+			routedRequestValueCallbacks[get_process_data_key(elementNumber, static_cast<std::uint16_t>(ddi))].push_back(callbackData);
+		}
+	}
+
+	void TaskControllerClient::add_value_command_callback(std::uint16_t elementNumber, std::uint16_t ddi, ValueCommandCallback callback, void *parentPointer)
+	{
+		add_value_command_callback(elementNumber, ddi, ddi, callback, parentPointer);
+	}
+
+	void TaskControllerClient::add_value_command_callback(std::uint16_t elementNumber, std::uint16_t firstDDI, std::uint16_t lastDDI, ValueCommandCallback callback, void *parentPointer)
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(clientMutex);
+#endif
+
+		ValueCommandCallbackInfo callbackData = { callback, parentPointer };
+		for (std::uint32_t ddi = firstDDI; ddi <= lastDDI; ddi++)
+		{
+			routedValueCommandCallbacks[get_process_data_key(elementNumber, static_cast<std::uint16_t>(ddi))].push_back(callbackData);
+		}
+	}
+
+	void TaskControllerClient::remove_request_value_callback(std::uint16_t elementNumber, std::uint16_t ddi, RequestValueCommandCallback callback, void *parentPointer)
+	{
+		remove_request_value_callback(elementNumber, ddi, ddi, callback, parentPointer);
+	}
+
+	void TaskControllerClient::remove_request_value_callback(std::uint16_t elementNumber, std::uint16_t firstDDI, std::uint16_t lastDDI, RequestValueCommandCallback callback, void *parentPointer)
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(clientMutex);
+#endif
+
+		RequestValueCommandCallbackInfo callbackData = { callback, parentPointer };
+		for (std::uint32_t ddi = firstDDI; ddi <= lastDDI; ddi++)
+		{
+			auto route = routedRequestValueCallbacks.find(get_process_data_key(elementNumber, static_cast<std::uint16_t>(ddi)));
+
+			if (routedRequestValueCallbacks.end() != route)
+			{
+				auto callbackLocation = std::find(route->second.begin(), route->second.end(), callbackData);
+
+				if (route->second.end() != callbackLocation)
+				{
+					route->second.erase(callbackLocation);
+				}
+
+				if (route->second.empty())
+				{
+					routedRequestValueCallbacks.erase(route);
+				}
+			}
+		}
+	}
+
+	void TaskControllerClient::remove_value_command_callback(std::uint16_t elementNumber, std::uint16_t ddi, ValueCommandCallback callback, void *parentPointer)
+	{
+		remove_value_command_callback(elementNumber, ddi, ddi, callback, parentPointer);
+	}
+
+	void TaskControllerClient::remove_value_command_callback(std::uint16_t elementNumber, std::uint16_t firstDDI, std::uint16_t lastDDI, ValueCommandCallback callback, void *parentPointer)
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(clientMutex);
+#endif
+
+		ValueCommandCallbackInfo callbackData = { callback, parentPointer };
+		for (std::uint32_t ddi = firstDDI; ddi <= lastDDI; ddi++)
+		{
+			auto route = routedValueCommandCallbacks.find(get_process_data_key(elementNumber, static_cast<std::uint16_t>(ddi)));
+
+			if (routedValueCommandCallbacks.end() != route)
+			{
+				auto callbackLocation = std::find(route->second.begin(), route->second.end(), callbackData);
+
+				if (route->second.end() != callbackLocation)
+				{
+					route->second.erase(callbackLocation);
+				}
+
+				if (route->second.empty())
+				{
+					routedValueCommandCallbacks.erase(route);
+				}
+			}
+		}
+	}
+
 	void TaskControllerClient::configure(std::shared_ptr<DeviceDescriptorObjectPool> DDOP,
 	                                     std::uint8_t maxNumberBoomsSupported,
 	                                     std::uint8_t maxNumberSectionsSupported,
@@ -133,6 +239,7 @@ namespace isobus
 		{
 			assert(nullptr != DDOP); // Client will not work without a DDOP.
 			generatedBinaryDDOP.clear();
+			generatedDDOPHash = 0;
 			ddopStructureLabel.clear();
 			userSuppliedVectorDDOP = nullptr;
 			ddopLocalizationLabel.fill(0x00);
@@ -172,6 +279,7 @@ namespace isobus
 			assert(nullptr != binaryDDOP); // Client will not work without a DDOP.
 			assert(0 != DDOPSize);
 			generatedBinaryDDOP.clear();
+			generatedDDOPHash = 0;
 			ddopStructureLabel.clear();
 			userSuppliedVectorDDOP = nullptr;
 			ddopLocalizationLabel.fill(0x00);
@@ -209,6 +317,7 @@ namespace isobus
 			assert(nullptr != binaryDDOP); // Client will not work without a DDOP.
 			ddopStructureLabel.clear();
 			generatedBinaryDDOP.clear();
+			generatedDDOPHash = 0;
 			ddopLocalizationLabel.fill(0x00);
 			userSuppliedVectorDDOP = binaryDDOP;
 			ddopUploadMode = DDOPUploadType::UserProvidedVector;
@@ -249,7 +358,7 @@ namespace isobus
 			{
 				partnerControlFunction->remove_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData), process_rx_message, this);
 				partnerControlFunction->remove_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Acknowledge), process_rx_message, this);
-				CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData), process_rx_message, this);
+				network.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData), process_rx_message, this);
 			}
 
 			shouldTerminate = true;
@@ -343,6 +452,7 @@ namespace isobus
 			assert(!binaryDDOP->empty()); // Client will not work without a DDOP.
 			ddopStructureLabel.clear();
 			generatedBinaryDDOP.clear();
+			generatedDDOPHash = 0;
 			ddopLocalizationLabel.fill(0x00);
 			userSuppliedVectorDDOP = binaryDDOP;
 			ddopUploadMode = DDOPUploadType::UserProvidedVector;
@@ -369,6 +479,7 @@ namespace isobus
 			assert(nullptr != binaryDDOP); // Client will not work without a DDOP.
 			assert(0 != DDOPSize);
 			generatedBinaryDDOP.clear();
+			generatedDDOPHash = 0;
 			ddopStructureLabel.clear();
 			userSuppliedVectorDDOP = nullptr;
 			ddopLocalizationLabel.fill(0x00);
@@ -394,7 +505,11 @@ namespace isobus
 		if (StateMachineState::Connected == get_state())
 		{
 			assert(nullptr != DDOP); // Client will not work without a DDOP.
+			std::uint64_t activeDDOPHash = (DDOPUploadType::ProgramaticallyGenerated == ddopUploadMode) ? generatedDDOPHash : 0;
+			const std::array<std::uint8_t, 7> activeLocalizationLabel = ddopLocalizationLabel;
+
 			generatedBinaryDDOP.clear();
+			generatedDDOPHash = 0;
 			ddopStructureLabel.clear();
 			userSuppliedVectorDDOP = nullptr;
 			ddopLocalizationLabel.fill(0x00);
@@ -402,17 +517,32 @@ namespace isobus
 			clientDDOP = DDOP;
 			userSuppliedBinaryDDOP = nullptr;
 			userSuppliedBinaryDDOPSize_bytes = 0;
-			shouldReuploadAfterDDOPDeletion = true;
-			set_state(StateMachineState::DeactivateObjectPool);
-			clear_queues();
 			retVal = true;
-			CANStackLogger::info("[TC]: Requested to change the DDOP. Object pool will be deactivated for a little while.");
+
+			// With automatic labels, the pool can be generated now to see if it actually changed.
+			// The hash leaves out the localization label, so a language change has to be checked separately.
+			if (automaticDDOPLabels &&
+			    generate_binary_ddop() &&
+			    (0 != activeDDOPHash) &&
+			    (activeDDOPHash == generatedDDOPHash) &&
+			    (activeLocalizationLabel == ddopLocalizationLabel))
+			{
+				CANStackLogger::info("[TC]: Requested to change the DDOP, but it is unchanged. The active object pool will be kept.");
+			}
+			else
+			{
+				shouldReuploadAfterDDOPDeletion = true;
+				set_state(StateMachineState::DeactivateObjectPool);
+				clear_queues();
+				CANStackLogger::info("[TC]: Requested to change the DDOP. Object pool will be deactivated for a little while.");
+			}
 		}
 		return retVal;
 	}
 
 	void TaskControllerClient::update()
 	{
+		const SystemTiming::Snapshot timeSnapshot; // Evaluate all timeouts this update against the same time
 		switch (currentState)
 		{
 			case StateMachineState::Disconnected:
@@ -559,22 +689,14 @@ namespace isobus
 				{
 					assert(0 != clientDDOP->size()); // Need to have a valid object pool!
 
-					if (serverVersion < clientDDOP->get_task_controller_compatibility_level())
-					{
-						clientDDOP->set_task_controller_compatibility_level(serverVersion); // Manipulate the DDOP slightly if needed to upload a version compatible DDOP
-						CANStackLogger::info("[TC]: DDOP will be generated using the server's version instead of the specified version. New version: " +
-						                     isobus::to_string(static_cast<int>(serverVersion)));
-					}
-
 					if (generatedBinaryDDOP.empty())
 					{
 						// Binary DDOP has not been generated before.
-						if (clientDDOP->generate_binary_object_pool(generatedBinaryDDOP))
+						if (generate_binary_ddop())
 						{
-							process_labels_from_ddop();
 							CANStackLogger::debug("[TC]: DDOP Generated, size: " + isobus::to_string(static_cast<int>(generatedBinaryDDOP.size())));
 
-							if ((!previousStructureLabel.empty()) && (ddopStructureLabel == previousStructureLabel))
+							if ((!automaticDDOPLabels) && (!previousStructureLabel.empty()) && (ddopStructureLabel == previousStructureLabel))
 							{
 								CANStackLogger::error("[TC]: You didn't properly update your new DDOP's structure label. ISO11783-10 states that an update to an object pool must include an updated structure label.");
 							}
@@ -744,15 +866,15 @@ namespace isobus
 				}
 
 				assert(0 != dataLength);
-				transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
-				                                                                    nullptr,
-				                                                                    dataLength,
-				                                                                    myControlFunction,
-				                                                                    partnerControlFunction,
-				                                                                    CANIdentifier::CANPriority::PriorityLowest7,
-				                                                                    process_tx_callback,
-				                                                                    this,
-				                                                                    process_internal_object_pool_upload_callback);
+				transmitSuccessful = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
+				                                            nullptr,
+				                                            dataLength,
+				                                            myControlFunction,
+				                                            partnerControlFunction,
+				                                            CANIdentifier::CANPriority::PriorityLowest7,
+				                                            process_tx_callback,
+				                                            this,
+				                                            process_internal_object_pool_upload_callback);
 				if (transmitSuccessful)
 				{
 					set_state(StateMachineState::WaitForDDOPTransfer);
@@ -815,8 +937,10 @@ namespace isobus
 				}
 				else
 				{
+					process_changed_values();
 					process_queued_commands();
 					process_queued_threshold_commands();
+					process_outbound_values();
 				}
 			}
 			break;
@@ -871,6 +995,86 @@ namespace isobus
 		}
 	}
 
+	std::uint32_t TaskControllerClient::get_time_until_update_due_ms()
+	{
+		const std::uint32_t timestamp_ms = SystemTiming::get_timestamp_ms();
+		std::uint32_t retVal = 0xFFFFFFFF;
+
+		// Clamps a deadline that has already passed to 0
+		auto get_time_until = [timestamp_ms](std::uint32_t deadline_ms) {
+			std::int32_t timeUntilDeadline_ms = static_cast<std::int32_t>(deadline_ms - timestamp_ms);
+			return static_cast<std::uint32_t>(std::max(timeUntilDeadline_ms, 0));
+		};
+
+		if ((initialized) && (!shouldTerminate))
+		{
+			switch (currentState)
+			{
+				case StateMachineState::Disconnected:
+				{
+					if (get_was_ddop_supplied())
+					{
+						retVal = 0;
+					}
+				}
+				break;
+
+				case StateMachineState::WaitForStartUpDelay:
+				{
+					retVal = get_time_until(stateMachineTimestamp_ms + SIX_SECOND_TIMEOUT_MS);
+				}
+				break;
+
+				case StateMachineState::WaitForDDOPTransfer:
+				case StateMachineState::WaitForServerStatusMessage:
+				{
+					// These only move on when a message or transfer callback changes the state
+				}
+				break;
+
+				case StateMachineState::Connected:
+				{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+					const std::lock_guard<std::mutex> lock(clientMutex);
+#endif
+					retVal = get_time_until(serverStatusMessageTimestamp_ms + SIX_SECOND_TIMEOUT_MS);
+
+					if (!measurementSchedule.empty())
+					{
+						retVal = std::min(retVal, get_time_until(measurementSchedule.front().dueTimestamp_ms));
+					}
+
+					if ((!queuedValueRequests.empty()) ||
+					    (!queuedValueCommands.empty()) ||
+					    (!publishedProcessDataKeys.empty()) ||
+					    (!outboundValues.empty()))
+					{
+						retVal = 0;
+					}
+				}
+				break;
+
+				default:
+				{
+					retVal = STATE_MACHINE_UPDATE_INTERVAL_MS;
+				}
+				break;
+			}
+
+			if (enableStatusMessage)
+			{
+				retVal = std::min(retVal, get_time_until(statusMessageTimestamp_ms + TWO_SECOND_TIMEOUT_MS));
+			}
+
+			// Anything still due straight after an update couldn't be done, such as a message that failed to send, so retry it a bit later
+			if ((0 == retVal) && (StateMachineState::Disconnected != currentState))
+			{
+				retVal = STATE_MACHINE_UPDATE_INTERVAL_MS;
+			}
+		}
+		return retVal;
+	}
+
 	bool TaskControllerClient::ProcessDataCallbackInfo::operator==(const ProcessDataCallbackInfo &obj) const
 	{
 		return ((obj.ddi == this->ddi) && (obj.elementNumber == this->elementNumber));
@@ -894,6 +1098,10 @@ namespace isobus
 		measurementMinimumThresholdCommands.clear();
 		measurementMaximumThresholdCommands.clear();
 		measurementOnChangeThresholdCommands.clear();
+		measurementSchedule.clear();
+		publishedProcessDataKeys.clear();
+		outboundValues.clear();
+		outboundValueIndex.clear();
 	}
 
 	bool TaskControllerClient::get_was_ddop_supplied() const
@@ -928,6 +1136,82 @@ namespace isobus
 		return retVal;
 	}
 
+	bool TaskControllerClient::generate_binary_ddop()
+	{
+		bool retVal;
+
+		if (serverVersion < clientDDOP->get_task_controller_compatibility_level())
+		{
+			clientDDOP->set_task_controller_compatibility_level(serverVersion); // Manipulate the DDOP slightly if needed to upload a version compatible DDOP
+			CANStackLogger::info("[TC]: DDOP will be generated using the server's version instead of the specified version. New version: " +
+			                     isobus::to_string(static_cast<int>(serverVersion)));
+		}
+
+		if (automaticDDOPLabels)
+		{
+			auto deviceObject = clientDDOP->get_object_by_id(0);
+
+			if ((nullptr != deviceObject) && (task_controller_object::ObjectTypes::Device == deviceObject->get_object_type()))
+			{
+				std::static_pointer_cast<task_controller_object::DeviceObject>(deviceObject)->set_localization_label(languageCommandInterface.get_localization_raw_data());
+			}
+		}
+
+		retVal = clientDDOP->generate_binary_object_pool(generatedBinaryDDOP);
+
+		if (retVal && automaticDDOPLabels)
+		{
+			retVal = set_structure_label_from_hash();
+		}
+
+		if (retVal)
+		{
+			process_labels_from_ddop();
+		}
+		else
+		{
+			generatedBinaryDDOP.clear();
+			generatedDDOPHash = 0;
+		}
+		return retVal;
+	}
+
+	bool TaskControllerClient::set_structure_label_from_hash()
+	{
+		// Letters that are easy to tell apart, so a label can be read back from a TC's display
+		static const char LABEL_CHARACTERS[] = "0123456789ABCDEFGHJKMNPQRSTVWXYZ";
+		DeviceDescriptorObjectPoolView view(clientDDOP->get_task_controller_compatibility_level());
+		bool retVal = view.open(generatedBinaryDDOP);
+		DeviceDescriptorObjectPoolView::ObjectView deviceObject = view.get_object_by_id(0);
+
+		if (retVal && deviceObject.get_is_valid() && (task_controller_object::ObjectTypes::Device == deviceObject.get_object_type()))
+		{
+			// The localization label directly follows the structure label, and both are left out of the hash
+			const std::size_t labelsLength = 2 * task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH;
+			const std::size_t labelOffset = static_cast<std::size_t>(reinterpret_cast<const std::uint8_t *>(deviceObject.get_structure_label().data()) - generatedBinaryDDOP.data());
+			ObjectPoolHasher hasher;
+			std::string structureLabel;
+
+			hasher.update(generatedBinaryDDOP.data(), labelOffset);
+			hasher.update(&generatedBinaryDDOP[labelOffset + labelsLength], generatedBinaryDDOP.size() - labelOffset - labelsLength);
+			generatedDDOPHash = hasher.get_hash();
+
+			for (std::uint_fast8_t i = 0; i < task_controller_object::DeviceObject::MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH; i++)
+			{
+				structureLabel.push_back(LABEL_CHARACTERS[(generatedDDOPHash >> (5 * i)) & 0x1F]);
+			}
+			memcpy(&generatedBinaryDDOP[labelOffset], structureLabel.data(), structureLabel.size());
+			std::static_pointer_cast<task_controller_object::DeviceObject>(clientDDOP->get_object_by_id(0))->set_structure_label(structureLabel);
+			CANStackLogger::debug("[TC]: Structure label set from DDOP hash: " + structureLabel);
+		}
+		else
+		{
+			CANStackLogger::error("[TC]: Cannot set the DDOP structure label, since the generated DDOP has no device object.");
+			retVal = false;
+		}
+		return retVal;
+	}
+
 	void TaskControllerClient::process_labels_from_ddop()
 	{
 		std::uint32_t currentByteIndex = 0;
@@ -1036,18 +1320,14 @@ namespace isobus
 #endif
 		bool transmitSuccessful = true;
 
-		while (!queuedValueRequests.empty() && transmitSuccessful)
+		while (!queuedValueRequests.empty())
 		{
 			const auto &currentRequest = queuedValueRequests.front();
+			std::uint32_t newValue = 0;
 
-			for (auto &currentCallback : requestValueCallbacks)
+			if (get_process_data_value(currentRequest.elementNumber, currentRequest.ddi, newValue))
 			{
-				std::uint32_t newValue = 0;
-				if (currentCallback.callback(currentRequest.elementNumber, currentRequest.ddi, newValue, currentCallback.parent))
-				{
-					transmitSuccessful = send_value_command(currentRequest.elementNumber, currentRequest.ddi, newValue);
-					break;
-				}
+				queue_value_command(currentRequest.elementNumber, currentRequest.ddi, newValue);
 			}
 			queuedValueRequests.pop_front();
 		}
@@ -1055,13 +1335,7 @@ namespace isobus
 		{
 			const auto &currentRequest = queuedValueCommands.front();
 
-			for (auto &currentCallback : valueCommandsCallbacks)
-			{
-				if (currentCallback.callback(currentRequest.elementNumber, currentRequest.ddi, currentRequest.processDataValue, currentCallback.parent))
-				{
-					break;
-				}
-			}
+			dispatch_value_command(currentRequest.elementNumber, currentRequest.ddi, currentRequest.processDataValue);
 			queuedValueCommands.pop_front();
 
 			//! @todo process PDACKs better
@@ -1072,113 +1346,321 @@ namespace isobus
 		}
 	}
 
+	void TaskControllerClient::process_changed_values()
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(clientMutex);
+#endif
+		ProcessDataValueStore::ChangedValue changedValue = { 0, 0, 0, false };
+
+		while (processDataValues.take_changed_value(changedValue))
+		{
+			if (changedValue.sendOnChange)
+			{
+				ProcessDataCallbackInfo requestData = { 0, 0, 0, 0, false, false };
+				requestData.elementNumber = changedValue.elementNumber;
+				requestData.ddi = changedValue.ddi;
+				queuedValueRequests.push_back(requestData);
+			}
+			publish_process_data_key(get_process_data_key(changedValue.elementNumber, changedValue.ddi));
+		}
+	}
+
 	void TaskControllerClient::process_queued_threshold_commands()
 	{
-		bool transmitSuccessful = false;
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(clientMutex);
+#endif
+		const std::uint32_t timestamp_ms = SystemTiming::get_timestamp_ms();
+		std::vector<ScheduledMeasurement> rescheduledMeasurements;
+
+		if (!publishedProcessDataKeys.empty())
+		{
+			std::sort(publishedProcessDataKeys.begin(), publishedProcessDataKeys.end());
+			publishedProcessDataKeys.erase(std::unique(publishedProcessDataKeys.begin(), publishedProcessDataKeys.end()), publishedProcessDataKeys.end());
 
-		for (auto &measurementTimeCommand : measurementTimeIntervalCommands)
+			for (auto processDataKey : publishedProcessDataKeys)
+			{
+				check_threshold_commands(processDataKey);
+			}
+			publishedProcessDataKeys.clear();
+		}
+
+		while ((!measurementSchedule.empty()) &&
+		       (static_cast<std::int32_t>(timestamp_ms - measurementSchedule.front().dueTimestamp_ms) >= 0))
 		{
-			if (SystemTiming::time_expired_ms(measurementTimeCommand.lastValue, measurementTimeCommand.processDataValue))
+			ScheduledMeasurement dueMeasurement = measurementSchedule.front();
+			std::pop_heap(measurementSchedule.begin(), measurementSchedule.end(), is_measurement_due_later);
+			measurementSchedule.pop_back();
+
+			if (ProcessDataCommands::MeasurementTimeInterval == dueMeasurement.command)
 			{
-				// Time to update this time interval variable
-				transmitSuccessful = false;
-				for (auto &currentCallback : requestValueCallbacks)
+				auto measurementTimeCommand = measurementTimeIntervalCommands.find(dueMeasurement.processDataKey);
+
+				if (measurementTimeIntervalCommands.end() != measurementTimeCommand)
 				{
 					std::uint32_t newValue = 0;
-					if (currentCallback.callback(measurementTimeCommand.elementNumber, measurementTimeCommand.ddi, newValue, currentCallback.parent))
+
+					if (get_process_data_value(measurementTimeCommand->second.elementNumber, measurementTimeCommand->second.ddi, newValue))
 					{
-						transmitSuccessful = send_value_command(measurementTimeCommand.elementNumber, measurementTimeCommand.ddi, newValue);
-						break;
+						queue_value_command(measurementTimeCommand->second.elementNumber, measurementTimeCommand->second.ddi, newValue);
+						measurementTimeCommand->second.lastValue = timestamp_ms;
+						dueMeasurement.dueTimestamp_ms = timestamp_ms + measurementTimeCommand->second.processDataValue;
+					}
+					else
+					{
+						dueMeasurement.dueTimestamp_ms = timestamp_ms + STATE_MACHINE_UPDATE_INTERVAL_MS;
 					}
+					rescheduledMeasurements.push_back(dueMeasurement);
 				}
+			}
+			else
+			{
+				check_threshold_commands(dueMeasurement.processDataKey);
 
-				if (transmitSuccessful)
+				if (0 != thresholdCheckInterval_ms)
 				{
-					measurementTimeCommand.lastValue = SystemTiming::get_timestamp_ms();
+					dueMeasurement.dueTimestamp_ms = timestamp_ms + thresholdCheckInterval_ms;
+					rescheduledMeasurements.push_back(dueMeasurement);
 				}
 			}
 		}
-		for (auto &measurementMaxCommand : measurementMaximumThresholdCommands)
+
+		// Rescheduled entries are added afterwards so that a zero interval can't keep the loop above going
+		// They were popped from the heap above, so they can be pushed back without looking for an existing entry
+		for (const auto &measurement : rescheduledMeasurements)
 		{
-			// Get the current process data value
-			std::uint32_t newValue = 0;
-			for (auto &currentCallback : requestValueCallbacks)
+			measurementSchedule.push_back(measurement);
+			std::push_heap(measurementSchedule.begin(), measurementSchedule.end(), is_measurement_due_later);
+		}
+	}
+
+	void TaskControllerClient::queue_value_command(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t value)
+	{
+		const std::uint32_t processDataKey = get_process_data_key(elementNumber, ddi);
+		auto existingValue = outboundValueIndex.find(processDataKey);
+
+		if (outboundValueIndex.end() != existingValue)
+		{
+			// Only the latest value is worth sending
+			outboundValues[existingValue->second].value = value;
+		}
+		else
+		{
+			outboundValueIndex[processDataKey] = outboundValues.size();
+			outboundValues.push_back({ processDataKey, value, is_section_control_ddi(ddi) });
+		}
+	}
+
+	void TaskControllerClient::process_outbound_values()
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(clientMutex);
+#endif
+
+		if (!outboundValues.empty())
+		{
+			std::size_t numberOfValuesSent = 0;
+
+			// Section states go first, otherwise values keep the order they were queued in
+			std::stable_partition(outboundValues.begin(), outboundValues.end(), [](const OutboundValue &outboundValue) { return outboundValue.highPriority; });
+
+			while ((numberOfValuesSent < outboundValues.size()) &&
+			       ((0 == processDataFramesPerUpdate) || (numberOfValuesSent < processDataFramesPerUpdate)) &&
+			       (send_value_command(static_cast<std::uint16_t>(outboundValues[numberOfValuesSent].processDataKey >> 16),
+			                           static_cast<std::uint16_t>(outboundValues[numberOfValuesSent].processDataKey & 0xFFFF),
+			                           outboundValues[numberOfValuesSent].value)))
 			{
-				if (currentCallback.callback(measurementMaxCommand.elementNumber, measurementMaxCommand.ddi, newValue, currentCallback.parent))
-				{
-					break;
-				}
+				numberOfValuesSent++;
 			}
 
-			if (!measurementMaxCommand.thresholdPassed)
+			// Anything left over is sent on a later update
+			outboundValues.erase(outboundValues.begin(), outboundValues.begin() + static_cast<std::ptrdiff_t>(numberOfValuesSent));
+			outboundValueIndex.clear();
+			for (std::size_t i = 0; i < outboundValues.size(); i++)
 			{
-				if ((newValue > measurementMaxCommand.processDataValue) &&
-				    (send_value_command(measurementMaxCommand.elementNumber, measurementMaxCommand.ddi, newValue)))
-				{
-					measurementMaxCommand.thresholdPassed = true;
-				}
+				outboundValueIndex[outboundValues[i].processDataKey] = i;
 			}
-			else
+		}
+	}
+
+	bool TaskControllerClient::is_section_control_ddi(std::uint16_t ddi)
+	{
+		return ((static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState) == ddi) ||
+		        (static_cast<std::uint16_t>(DataDescriptionIndex::SetpointWorkState) == ddi) ||
+		        (static_cast<std::uint16_t>(DataDescriptionIndex::SectionControlState) == ddi) ||
+		        ((ddi >= static_cast<std::uint16_t>(DataDescriptionIndex::ActualCondensedWorkState1_16)) &&
+		         (ddi <= static_cast<std::uint16_t>(DataDescriptionIndex::ActualCondensedWorkState241_256))) ||
+		        ((ddi >= static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState1_16)) &&
+		         (ddi <= static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState241_256))));
+	}
+
+	std::uint32_t TaskControllerClient::get_process_data_key(std::uint16_t elementNumber, std::uint16_t ddi)
+	{
+		return ((static_cast<std::uint32_t>(elementNumber) << 16) | ddi);
+	}
+
+	bool TaskControllerClient::is_measurement_due_later(const ScheduledMeasurement &lhs, const ScheduledMeasurement &rhs)
+	{
+		// Compared as a signed difference so that the order survives the millisecond timestamp wrapping
+		return (static_cast<std::int32_t>(lhs.dueTimestamp_ms - rhs.dueTimestamp_ms) > 0);
+	}
+
+	void TaskControllerClient::schedule_measurement(ProcessDataCommands command, std::uint32_t processDataKey, std::uint32_t dueTimestamp_ms)
+	{
+		auto existingMeasurement = std::find_if(measurementSchedule.begin(), measurementSchedule.end(), [command, processDataKey](const ScheduledMeasurement &measurement) {
+			return ((measurement.command == command) && (measurement.processDataKey == processDataKey));
+		});
+
+		if (measurementSchedule.end() != existingMeasurement)
+		{
+			existingMeasurement->dueTimestamp_ms = dueTimestamp_ms;
+			std::make_heap(measurementSchedule.begin(), measurementSchedule.end(), is_measurement_due_later);
+		}
+		else
+		{
+			measurementSchedule.push_back({ dueTimestamp_ms, processDataKey, command });
+			std::push_heap(measurementSchedule.begin(), measurementSchedule.end(), is_measurement_due_later);
+		}
+	}
+
+	bool TaskControllerClient::get_process_data_value(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t &value) const
+	{
+		bool retVal = processDataValues.get_value(elementNumber, ddi, value);
+
+		if ((!retVal) &&
+		    (!routedRequestValueCallbacks.empty()))
+		{
+			auto route = routedRequestValueCallbacks.find(get_process_data_key(elementNumber, ddi));
+
+			if (routedRequestValueCallbacks.end() != route)
 			{
-				if (newValue < measurementMaxCommand.processDataValue)
+				for (auto &currentCallback : route->second)
 				{
-					measurementMaxCommand.thresholdPassed = false;
+					if (currentCallback.callback(elementNumber, ddi, value, currentCallback.parent))
+					{
+						retVal = true;
+						break;
+					}
 				}
 			}
 		}
-		for (auto &measurementMinCommand : measurementMinimumThresholdCommands)
+
+		if (!retVal)
 		{
-			// Get the current process data value
-			std::uint32_t newValue = 0;
 			for (auto &currentCallback : requestValueCallbacks)
 			{
-				if (currentCallback.callback(measurementMinCommand.elementNumber, measurementMinCommand.ddi, newValue, currentCallback.parent))
+				if (currentCallback.callback(elementNumber, ddi, value, currentCallback.parent))
 				{
+					retVal = true;
 					break;
 				}
 			}
+		}
+		return retVal;
+	}
 
-			if (!measurementMinCommand.thresholdPassed)
+	bool TaskControllerClient::dispatch_value_command(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t value) const
+	{
+		bool retVal = false;
+
+		if (!routedValueCommandCallbacks.empty())
+		{
+			auto route = routedValueCommandCallbacks.find(get_process_data_key(elementNumber, ddi));
+
+			if (routedValueCommandCallbacks.end() != route)
 			{
-				if ((newValue < measurementMinCommand.processDataValue) &&
-				    (send_value_command(measurementMinCommand.elementNumber, measurementMinCommand.ddi, newValue)))
+				for (auto &currentCallback : route->second)
 				{
-					measurementMinCommand.thresholdPassed = true;
+					if (currentCallback.callback(elementNumber, ddi, value, currentCallback.parent))
+					{
+						retVal = true;
+						break;
+					}
 				}
 			}
-			else
+		}
+
+		if (!retVal)
+		{
+			for (auto &currentCallback : valueCommandsCallbacks)
 			{
-				if (newValue > measurementMinCommand.processDataValue)
+				if (currentCallback.callback(elementNumber, ddi, value, currentCallback.parent))
 				{
-					measurementMinCommand.thresholdPassed = false;
+					retVal = true;
+					break;
 				}
 			}
 		}
-		for (auto &measurementChangeCommand : measurementOnChangeThresholdCommands)
+		return retVal;
+	}
+
+	void TaskControllerClient::check_threshold_commands(std::uint32_t processDataKey)
+	{
+		auto measurementMaxCommand = measurementMaximumThresholdCommands.find(processDataKey);
+		auto measurementMinCommand = measurementMinimumThresholdCommands.find(processDataKey);
+		auto measurementChangeCommand = measurementOnChangeThresholdCommands.find(processDataKey);
+		const std::uint16_t elementNumber = static_cast<std::uint16_t>(processDataKey >> 16);
+		const std::uint16_t ddi = static_cast<std::uint16_t>(processDataKey & 0xFFFF);
+		std::uint32_t newValue = 0;
+
+		if (((measurementMaximumThresholdCommands.end() != measurementMaxCommand) ||
+		     (measurementMinimumThresholdCommands.end() != measurementMinCommand) ||
+		     (measurementOnChangeThresholdCommands.end() != measurementChangeCommand)) &&
+		    (get_process_data_value(elementNumber, ddi, newValue)))
 		{
-			// Get the current process data value
-			std::uint32_t newValue = 0;
-			for (auto &currentCallback : requestValueCallbacks)
+			if (measurementMaximumThresholdCommands.end() != measurementMaxCommand)
 			{
-				if (currentCallback.callback(measurementChangeCommand.elementNumber, measurementChangeCommand.ddi, newValue, currentCallback.parent))
+				if (!measurementMaxCommand->second.thresholdPassed)
 				{
-					break;
+					if (newValue > measurementMaxCommand->second.processDataValue)
+					{
+						queue_value_command(elementNumber, ddi, newValue);
+						measurementMaxCommand->second.thresholdPassed = true;
+					}
+				}
+				else
+				{
+					if (newValue < measurementMaxCommand->second.processDataValue)
+					{
+						measurementMaxCommand->second.thresholdPassed = false;
+					}
 				}
 			}
 
-			std::int64_t lowerLimit = (static_cast<int64_t>(measurementChangeCommand.lastValue) - measurementChangeCommand.processDataValue);
-			if (lowerLimit < 0)
+			if (measurementMinimumThresholdCommands.end() != measurementMinCommand)
 			{
-				lowerLimit = 0;
+				if (!measurementMinCommand->second.thresholdPassed)
+				{
+					if (newValue < measurementMinCommand->second.processDataValue)
+					{
+						queue_value_command(elementNumber, ddi, newValue);
+						measurementMinCommand->second.thresholdPassed = true;
+					}
+				}
+				else
+				{
+					if (newValue > measurementMinCommand->second.processDataValue)
+					{
+						measurementMinCommand->second.thresholdPassed = false;
+					}
+				}
 			}
 
-			if ((newValue != measurementChangeCommand.lastValue) &&
-			    ((newValue >= (measurementChangeCommand.lastValue + measurementChangeCommand.processDataValue)) ||
-			     (newValue <= lowerLimit)))
+			if (measurementOnChangeThresholdCommands.end() != measurementChangeCommand)
 			{
-				if (send_value_command(measurementChangeCommand.elementNumber, measurementChangeCommand.ddi, newValue))
+				std::int64_t lowerLimit = (static_cast<int64_t>(measurementChangeCommand->second.lastValue) - measurementChangeCommand->second.processDataValue);
+				if (lowerLimit < 0)
+				{
+					lowerLimit = 0;
+				}
+
+				if ((newValue != measurementChangeCommand->second.lastValue) &&
+				    ((newValue >= (measurementChangeCommand->second.lastValue + measurementChangeCommand->second.processDataValue)) ||
+				     (newValue <= lowerLimit)))
 				{
-					measurementChangeCommand.lastValue = newValue;
+					queue_value_command(elementNumber, ddi, newValue);
+					measurementChangeCommand->second.lastValue = newValue;
 				}
 			}
 		}
@@ -1188,7 +1670,7 @@ namespace isobus
 	{
 		if ((nullptr != parentPointer) &&
 		    (CAN_DATA_LENGTH <= message.get_data_length()) &&
-		    (nullptr != message.get_source_control_function()))
+		    (nullptr != message.get_source_control_function_pointer()))
 		{
 			auto parentTC = static_cast<TaskControllerClient *>(parentPointer);
 			const auto &messageData = message.get_data();
@@ -1535,7 +2017,7 @@ namespace isobus
 
 						case ProcessDataCommands::StatusMessage:
 						{
-							if (parentTC->partnerControlFunction->get_NAME() == message.get_source_control_function()->get_NAME())
+							if (parentTC->partnerControlFunction->get_NAME() == message.get_source_control_function_pointer()->get_NAME())
 							{
 								// Many values in the status message were undefined in version 2 and before, so the
 								// standard explicitly tells us to ignore those attributes. The only things that really
@@ -1631,10 +2113,12 @@ namespace isobus
 							                                (static_cast<std::uint16_t>(messageData[7]) << 24));
 							commandData.lastValue = SystemTiming::get_timestamp_ms();
 
-							auto previousCommand = std::find(parentTC->measurementTimeIntervalCommands.begin(), parentTC->measurementTimeIntervalCommands.end(), commandData);
+							const std::uint32_t processDataKey = get_process_data_key(commandData.elementNumber, commandData.ddi);
+							auto previousCommand = parentTC->measurementTimeIntervalCommands.find(processDataKey);
 							if (parentTC->measurementTimeIntervalCommands.end() == previousCommand)
 							{
-								parentTC->measurementTimeIntervalCommands.push_back(commandData);
+								parentTC->measurementTimeIntervalCommands[processDataKey] = commandData;
+								parentTC->schedule_measurement(ProcessDataCommands::MeasurementTimeInterval, processDataKey, commandData.lastValue + commandData.processDataValue);
 								CANStackLogger::debug("[TC]: TC Requests element: " +
 								                      isobus::to_string(static_cast<int>(commandData.elementNumber)) +
 								                      " DDI: " +
@@ -1645,8 +2129,12 @@ namespace isobus
 							}
 							else
 							{
-								// Use the existing one and update the value
-								previousCommand->processDataValue = commandData.processDataValue;
+								// Use the existing one and update the value, which moves when it is next due
+								if (previousCommand->second.processDataValue != commandData.processDataValue)
+								{
+									previousCommand->second.processDataValue = commandData.processDataValue;
+									parentTC->schedule_measurement(ProcessDataCommands::MeasurementTimeInterval, processDataKey, previousCommand->second.lastValue + commandData.processDataValue);
+								}
 								CANStackLogger::debug("[TC]: TC Altered time interval request for element: " +
 								                      isobus::to_string(static_cast<int>(commandData.elementNumber)) +
 								                      " DDI: " +
@@ -1673,10 +2161,20 @@ namespace isobus
 							                                (static_cast<std::uint16_t>(messageData[6]) << 16) |
 							                                (static_cast<std::uint16_t>(messageData[7]) << 24));
 
-							auto previousCommand = std::find(parentTC->measurementMaximumThresholdCommands.begin(), parentTC->measurementMaximumThresholdCommands.end(), commandData);
+							const std::uint32_t processDataKey = get_process_data_key(commandData.elementNumber, commandData.ddi);
+							auto previousCommand = parentTC->measurementMaximumThresholdCommands.find(processDataKey);
+
+							// Check the new threshold against the current value on the next update
+							parentTC->publishedProcessDataKeys.push_back(processDataKey);
+
 							if (parentTC->measurementMaximumThresholdCommands.end() == previousCommand)
 							{
-								parentTC->measurementMaximumThresholdCommands.push_back(commandData);
+								parentTC->measurementMaximumThresholdCommands[processDataKey] = commandData;
+
+								if (0 != parentTC->thresholdCheckInterval_ms)
+								{
+									parentTC->schedule_measurement(ProcessDataCommands::MeasurementMaximumWithinThreshold, processDataKey, SystemTiming::get_timestamp_ms() + parentTC->thresholdCheckInterval_ms);
+								}
 								CANStackLogger::debug("[TC]: TC Requests element: " +
 								                      isobus::to_string(static_cast<int>(commandData.elementNumber)) +
 								                      " DDI: " +
@@ -1687,8 +2185,8 @@ namespace isobus
 							else
 							{
 								// Just update the existing one with the new value
-								previousCommand->processDataValue = commandData.processDataValue;
-								previousCommand->thresholdPassed = false;
+								previousCommand->second.processDataValue = commandData.processDataValue;
+								previousCommand->second.thresholdPassed = false;
 							}
 						}
 						break;
@@ -1708,10 +2206,20 @@ namespace isobus
 							                                (static_cast<std::uint16_t>(messageData[6]) << 16) |
 							                                (static_cast<std::uint16_t>(messageData[7]) << 24));
 
-							auto previousCommand = std::find(parentTC->measurementMinimumThresholdCommands.begin(), parentTC->measurementMinimumThresholdCommands.end(), commandData);
+							const std::uint32_t processDataKey = get_process_data_key(commandData.elementNumber, commandData.ddi);
+							auto previousCommand = parentTC->measurementMinimumThresholdCommands.find(processDataKey);
+
+							// Check the new threshold against the current value on the next update
+							parentTC->publishedProcessDataKeys.push_back(processDataKey);
+
 							if (parentTC->measurementMinimumThresholdCommands.end() == previousCommand)
 							{
-								parentTC->measurementMinimumThresholdCommands.push_back(commandData);
+								parentTC->measurementMinimumThresholdCommands[processDataKey] = commandData;
+
+								if (0 != parentTC->thresholdCheckInterval_ms)
+								{
+									parentTC->schedule_measurement(ProcessDataCommands::MeasurementMinimumWithinThreshold, processDataKey, SystemTiming::get_timestamp_ms() + parentTC->thresholdCheckInterval_ms);
+								}
 								CANStackLogger::debug("[TC]: TC Requests Element " +
 								                      isobus::to_string(static_cast<int>(commandData.elementNumber)) +
 								                      " DDI: " +
@@ -1722,8 +2230,8 @@ namespace isobus
 							else
 							{
 								// Just update the existing one with the new value
-								previousCommand->processDataValue = commandData.processDataValue;
-								previousCommand->thresholdPassed = false;
+								previousCommand->second.processDataValue = commandData.processDataValue;
+								previousCommand->second.thresholdPassed = false;
 							}
 						}
 						break;
@@ -1743,10 +2251,20 @@ namespace isobus
 							                                (static_cast<std::uint16_t>(messageData[6]) << 16) |
 							                                (static_cast<std::uint16_t>(messageData[7]) << 24));
 
-							auto previousCommand = std::find(parentTC->measurementOnChangeThresholdCommands.begin(), parentTC->measurementOnChangeThresholdCommands.end(), commandData);
+							const std::uint32_t processDataKey = get_process_data_key(commandData.elementNumber, commandData.ddi);
+							auto previousCommand = parentTC->measurementOnChangeThresholdCommands.find(processDataKey);
+
+							// Check the new threshold against the current value on the next update
+							parentTC->publishedProcessDataKeys.push_back(processDataKey);
+
 							if (parentTC->measurementOnChangeThresholdCommands.end() == previousCommand)
 							{
-								parentTC->measurementOnChangeThresholdCommands.push_back(commandData);
+								parentTC->measurementOnChangeThresholdCommands[processDataKey] = commandData;
+
+								if (0 != parentTC->thresholdCheckInterval_ms)
+								{
+									parentTC->schedule_measurement(ProcessDataCommands::MeasurementChangeThreshold, processDataKey, SystemTiming::get_timestamp_ms() + parentTC->thresholdCheckInterval_ms);
+								}
 								CANStackLogger::debug("[TC]: TC Requests element " +
 								                      isobus::to_string(static_cast<int>(commandData.elementNumber)) +
 								                      " DDI: " +
@@ -1757,8 +2275,8 @@ namespace isobus
 							else
 							{
 								// Just update the existing one with the new value
-								previousCommand->processDataValue = commandData.processDataValue;
-								previousCommand->thresholdPassed = false;
+								previousCommand->second.processDataValue = commandData.processDataValue;
+								previousCommand->second.thresholdPassed = false;
 							}
 						}
 						break;
@@ -1786,6 +2304,30 @@ namespace isobus
 				}
 				break;
 			}
+			parentTC->request_update();
+		}
+	}
+
+	void TaskControllerClient::request_update()
+	{
+		// The executor only has to be woken up by the first request since the client was last updated
+		if (!updateRequested.exchange(true))
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> lock(executorMutex);
+#endif
+			if (nullptr != executor)
+			{
+				executor->wake_up();
+			}
+		}
+	}
+
+	void TaskControllerClient::process_value_changed(void *parentPointer)
+	{
+		if (nullptr != parentPointer)
+		{
+			static_cast<TaskControllerClient *>(parentPointer)->request_update();
 		}
 	}
 
@@ -1888,11 +2430,11 @@ namespace isobus
 			                                                         0xFF,
 			                                                         0xFF };
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction);
 	}
 
 	bool TaskControllerClient::send_object_pool_activate() const
@@ -1913,11 +2455,11 @@ namespace isobus
 			                                                         0xFF,
 			                                                         0xFF };
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction);
 	}
 
 	bool TaskControllerClient::send_pdack(std::uint16_t elementNumber, std::uint16_t ddi) const
@@ -1931,11 +2473,11 @@ namespace isobus
 			                                                         0xFF,
 			                                                         0xFF,
 			                                                         0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction);
 	}
 
 	bool TaskControllerClient::send_request_localization_label() const
@@ -1963,11 +2505,11 @@ namespace isobus
 			                                                         0xFF,
 			                                                         0xFF };
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction);
 	}
 
 	bool TaskControllerClient::send_request_structure_label() const
@@ -1992,11 +2534,11 @@ namespace isobus
 			                                                         numberSectionsSupported,
 			                                                         numberChannelsSupportedForPositionBasedControl };
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction);
 	}
 
 	bool TaskControllerClient::send_status() const
@@ -2010,11 +2552,11 @@ namespace isobus
 			                                                         0x00, // Reserved (0)
 			                                                         0x00 }; // Reserved (0)
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction);
 	}
 
 	bool TaskControllerClient::send_value_command(std::uint16_t elementNumber, std::uint16_t ddi, std::uint32_t value) const
@@ -2028,11 +2570,11 @@ namespace isobus
 			                                                         static_cast<std::uint8_t>(value >> 8),
 			                                                         static_cast<std::uint8_t>(value >> 16),
 			                                                         static_cast<std::uint8_t>(value >> 24) };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction);
 	}
 
 	bool TaskControllerClient::send_version_request() const
@@ -2044,11 +2586,11 @@ namespace isobus
 	{
 		const std::array<std::uint8_t, CAN_DATA_LENGTH> buffer = { numberOfWorkingSetMembers, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::WorkingSetMaster),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      nullptr);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::WorkingSetMaster),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              nullptr);
 	}
 
 	void TaskControllerClient::set_common_config_items(std::uint8_t maxNumberBoomsSupported,
@@ -2081,6 +2623,7 @@ namespace isobus
 			{
 				clear_queues();
 			}
+			request_update();
 		}
 	}
 
@@ -2088,6 +2631,7 @@ namespace isobus
 	{
 		stateMachineTimestamp_ms = timestamp;
 		currentState = newState;
+		request_update();
 	}
 
 	void TaskControllerClient::worker_thread_function()
@@ -2100,7 +2644,7 @@ namespace isobus
 				break;
 			}
 			update();
-			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<std::uint32_t>(STATE_MACHINE_UPDATE_INTERVAL_MS)));
 		}
 #endif
 	}
@@ -2149,15 +2693,70 @@ namespace isobus
 	void TaskControllerClient::on_value_changed_trigger(std::uint16_t elementNumber, std::uint16_t DDI)
 	{
 		ProcessDataCallbackInfo requestData = { 0, 0, 0, 0, false, false };
+
+		{
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
-		const std::lock_guard<std::mutex> lock(clientMutex);
+			const std::lock_guard<std::mutex> lock(clientMutex);
 #endif
+			requestData.ackRequested = false;
+			requestData.elementNumber = elementNumber;
+			requestData.ddi = DDI;
+			requestData.processDataValue = 0;
+			queuedValueRequests.push_back(requestData);
+		}
+		request_update();
+	}
 
-		requestData.ackRequested = false;
-		requestData.elementNumber = elementNumber;
-		requestData.ddi = DDI;
-		requestData.processDataValue = 0;
-		queuedValueRequests.push_back(requestData);
+	void TaskControllerClient::on_value_published(std::uint16_t elementNumber, std::uint16_t DDI)
+	{
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> lock(clientMutex);
+#endif
+			publish_process_data_key(get_process_data_key(elementNumber, DDI));
+		}
+		request_update();
+	}
+
+	void TaskControllerClient::publish_process_data_key(std::uint32_t processDataKey)
+	{
+		// Values that the TC has not set a threshold for don't need to be checked
+		if ((measurementMaximumThresholdCommands.end() != measurementMaximumThresholdCommands.find(processDataKey)) ||
+		    (measurementMinimumThresholdCommands.end() != measurementMinimumThresholdCommands.find(processDataKey)) ||
+		    (measurementOnChangeThresholdCommands.end() != measurementOnChangeThresholdCommands.find(processDataKey)))
+		{
+			publishedProcessDataKeys.push_back(processDataKey);
+		}
+	}
+
+	void TaskControllerClient::set_process_data_frames_per_update(std::uint8_t numberOfFrames)
+	{
+		processDataFramesPerUpdate = numberOfFrames;
+	}
+
+	std::uint8_t TaskControllerClient::get_process_data_frames_per_update() const
+	{
+		return processDataFramesPerUpdate;
+	}
+
+	void TaskControllerClient::set_automatic_ddop_labels(bool enabled)
+	{
+		automaticDDOPLabels = enabled;
+	}
+
+	bool TaskControllerClient::get_automatic_ddop_labels() const
+	{
+		return automaticDDOPLabels;
+	}
+
+	void TaskControllerClient::set_threshold_check_interval(std::uint32_t interval_ms)
+	{
+		thresholdCheckInterval_ms = interval_ms;
+	}
+
+	std::uint32_t TaskControllerClient::get_threshold_check_interval() const
+	{
+		return thresholdCheckInterval_ms;
 	}
 
 	bool TaskControllerClient::request_task_controller_identification() const
@@ -2171,11 +2770,11 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      nullptr);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ProcessData),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              nullptr);
 	}
 
 } // namespace isobus
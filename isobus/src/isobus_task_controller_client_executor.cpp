@@ -0,0 +1,302 @@
+//================================================================================================
+/// @file isobus_task_controller_client_executor.cpp
+///
+/// @brief Drives any number of task controller clients from a shared set of threads.
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#include "isobus/isobus/isobus_task_controller_client_executor.hpp"
+
+#include "isobus/utility/system_timing.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace isobus
+{
+	TaskControllerClientExecutor::TaskControllerClientExecutor(std::size_t numberOfThreads)
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		for (std::size_t i = 0; i < numberOfThreads; i++)
+		{
+			workerThreads.emplace_back([this]() { worker_thread_function(); });
+		}
+#else
+		(void)numberOfThreads;
+#endif
+	}
+
+	TaskControllerClientExecutor::~TaskControllerClientExecutor()
+	{
+		std::vector<ScheduledClient> removedClients;
+
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> lock(executorMutex);
+#endif
+			shouldStop = true;
+		}
+
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		wakeupCondition.notify_all();
+		for (auto &workerThread : workerThreads)
+		{
+			workerThread.join();
+		}
+		workerThreads.clear();
+#endif
+
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> lock(executorMutex);
+#endif
+			removedClients.swap(clients);
+		}
+
+		// Clients lock their own mutex before the executor's, so the executor's must not be held here
+		for (const auto &removedClient : removedClients)
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> clientLock(removedClient.client->executorMutex);
+#endif
+			removedClient.client->processDataValues.set_value_changed_callback(nullptr, nullptr);
+			removedClient.client->executor = nullptr;
+		}
+	}
+
+	bool TaskControllerClientExecutor::add_client(std::shared_ptr<TaskControllerClient> client)
+	{
+		bool retVal = (nullptr != client);
+
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		retVal = retVal && (nullptr == client->workerThread);
+#endif
+
+		if (retVal)
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> clientLock(client->executorMutex);
+#endif
+			retVal = (nullptr == client->executor);
+
+			if (retVal)
+			{
+				client->executor = this;
+				client->updateRequested = true;
+				client->processDataValues.set_value_changed_callback(TaskControllerClient::process_value_changed, client.get());
+			}
+		}
+
+		if (retVal)
+		{
+			ScheduledClient newClient = { client, SystemTiming::get_timestamp_ms(), false };
+
+			{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+				const std::lock_guard<std::mutex> lock(executorMutex);
+#endif
+				clients.push_back(newClient);
+			}
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			wakeupCondition.notify_all();
+#endif
+		}
+		return retVal;
+	}
+
+	bool TaskControllerClientExecutor::remove_client(std::shared_ptr<TaskControllerClient> client)
+	{
+		bool retVal = false;
+
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			std::unique_lock<std::mutex> lock(executorMutex);
+#endif
+			auto findClient = [&client](const ScheduledClient &scheduledClient) { return scheduledClient.client == client; };
+			auto scheduledClient = std::find_if(clients.begin(), clients.end(), findClient);
+
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			// Let an update that's already running on another thread finish first
+			while ((clients.end() != scheduledClient) && (scheduledClient->updating))
+			{
+				wakeupCondition.wait(lock);
+				scheduledClient = std::find_if(clients.begin(), clients.end(), findClient);
+			}
+#endif
+
+			if (clients.end() != scheduledClient)
+			{
+				clients.erase(scheduledClient);
+				retVal = true;
+			}
+		}
+
+		if (retVal)
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> clientLock(client->executorMutex);
+#endif
+			client->processDataValues.set_value_changed_callback(nullptr, nullptr);
+			client->executor = nullptr;
+		}
+		return retVal;
+	}
+
+	std::size_t TaskControllerClientExecutor::get_number_of_clients() const
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(executorMutex);
+#endif
+		return clients.size();
+	}
+
+	std::size_t TaskControllerClientExecutor::get_number_of_threads() const
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		return workerThreads.size();
+#else
+		return 0;
+#endif
+	}
+
+	std::uint32_t TaskControllerClientExecutor::update()
+	{
+		ScheduledClient dueClient = { nullptr, 0, false };
+		std::size_t numberOfClients = get_number_of_clients();
+
+		// Each client is updated at most once, even if it asks for another update straight away
+		for (std::size_t i = 0; (i < numberOfClients) && take_due_client(dueClient); i++)
+		{
+			update_client(dueClient);
+		}
+
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(executorMutex);
+#endif
+		return get_time_until_next_client_due_ms();
+	}
+
+	void TaskControllerClientExecutor::wake_up()
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		// A thread counts itself as sleeping before it checks the clients' request flags, so either it sees the
+		// flag the client just set, or it is counted here. Locking the mutex makes sure it is actually waiting
+		// before it's notified.
+		if (0 != numberOfSleepingThreads)
+		{
+			{
+				const std::lock_guard<std::mutex> lock(executorMutex);
+			}
+			wakeupCondition.notify_all();
+		}
+#endif
+	}
+
+	bool TaskControllerClientExecutor::take_due_client(ScheduledClient &dueClient)
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(executorMutex);
+#endif
+		const std::uint32_t timestamp_ms = SystemTiming::get_timestamp_ms();
+		bool retVal = false;
+
+		for (std::size_t i = 0; (i < clients.size()) && (!retVal) && (!shouldStop); i++)
+		{
+			ScheduledClient &scheduledClient = clients[(nextClientIndex + i) % clients.size()];
+
+			if ((!scheduledClient.updating) &&
+			    ((scheduledClient.client->updateRequested) || (static_cast<std::int32_t>(timestamp_ms - scheduledClient.dueTimestamp_ms) >= 0)))
+			{
+				scheduledClient.updating = true;
+				scheduledClient.client->updateRequested = false;
+				dueClient = scheduledClient;
+				nextClientIndex = (nextClientIndex + i + 1) % clients.size();
+				retVal = true;
+			}
+		}
+		return retVal;
+	}
+
+	std::uint32_t TaskControllerClientExecutor::get_time_until_next_client_due_ms() const
+	{
+		const std::uint32_t timestamp_ms = SystemTiming::get_timestamp_ms();
+		std::uint32_t retVal = MAX_WAIT_TIME_MS;
+
+		for (const auto &scheduledClient : clients)
+		{
+			if (!scheduledClient.updating)
+			{
+				std::int32_t timeUntilDue_ms = static_cast<std::int32_t>(scheduledClient.dueTimestamp_ms - timestamp_ms);
+
+				if ((scheduledClient.client->updateRequested) || (timeUntilDue_ms <= 0))
+				{
+					retVal = 0;
+				}
+				else
+				{
+					retVal = std::min(retVal, static_cast<std::uint32_t>(timeUntilDue_ms));
+				}
+			}
+		}
+		return retVal;
+	}
+
+	void TaskControllerClientExecutor::update_client(const ScheduledClient &dueClient)
+	{
+		dueClient.client->update();
+		std::uint32_t timeUntilDue_ms = std::min(dueClient.client->get_time_until_update_due_ms(), static_cast<std::uint32_t>(MAX_WAIT_TIME_MS));
+
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> lock(executorMutex);
+#endif
+			for (auto &scheduledClient : clients)
+			{
+				if (scheduledClient.client == dueClient.client)
+				{
+					scheduledClient.dueTimestamp_ms = SystemTiming::get_timestamp_ms() + timeUntilDue_ms;
+					scheduledClient.updating = false;
+					break;
+				}
+			}
+		}
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		// Other threads may be waiting to remove this client, or for it to be free to update again
+		wakeupCondition.notify_all();
+#endif
+	}
+
+	void TaskControllerClientExecutor::worker_thread_function()
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		ScheduledClient dueClient = { nullptr, 0, false };
+
+		for (;;)
+		{
+			if (take_due_client(dueClient))
+			{
+				update_client(dueClient);
+				dueClient.client = nullptr;
+			}
+			else
+			{
+				std::unique_lock<std::mutex> lock(executorMutex);
+
+				if (shouldStop)
+				{
+					break;
+				}
+
+				numberOfSleepingThreads++;
+				std::uint32_t waitTime_ms = get_time_until_next_client_due_ms();
+				if (0 != waitTime_ms)
+				{
+					wakeupCondition.wait_for(lock, std::chrono::milliseconds(waitTime_ms));
+				}
+				numberOfSleepingThreads--;
+			}
+		}
+#endif
+	}
+} // namespace isobus
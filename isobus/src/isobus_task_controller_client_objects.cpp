@@ -42,6 +42,25 @@ namespace isobus
 		void Object::set_object_id(std::uint16_t id)
 		{
 			objectID = id;
+
+			if (nullptr != objectIDChangeCounter)
+			{
+				(*objectIDChangeCounter)++;
+			}
+		}
+
+		void Object::set_object_id_change_counter(std::shared_ptr<std::uint32_t> counter, CANLibBadge<DeviceDescriptorObjectPool>)
+		{
+			objectIDChangeCounter = counter;
+		}
+
+		std::vector<std::uint8_t> Object::get_binary_object() const
+		{
+			std::vector<std::uint8_t> retVal;
+
+			retVal.reserve(get_binary_object_size());
+			append_binary_object(retVal);
+			return retVal;
 		}
 
 		const std::string DeviceObject::tableID = "DVC";
@@ -75,75 +94,75 @@ namespace isobus
 			return ObjectTypes::Device;
 		}
 
-		std::vector<std::uint8_t> DeviceObject::get_binary_object() const
+		std::size_t DeviceObject::get_binary_object_size() const
 		{
-			std::vector<std::uint8_t> retVal;
+			return (30 +
+			        designator.size() +
+			        softwareVersion.size() +
+			        serialNumber.size() +
+			        (useExtendedStructureLabel ? (1 + extendedStructureLabel.size()) : 0));
+		}
 
-			retVal.reserve(31 +
-			               designator.size() +
-			               softwareVersion.size() +
-			               serialNumber.size() +
-			               extendedStructureLabel.size());
-
-			retVal.push_back(tableID[0]);
-			retVal.push_back(tableID[1]);
-			retVal.push_back(tableID[2]);
-			retVal.push_back(static_cast<std::uint8_t>(get_object_id() & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((get_object_id() >> 8) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>(designator.size()));
+		void DeviceObject::append_binary_object(std::vector<std::uint8_t> &buffer) const
+		{
+			buffer.push_back(tableID[0]);
+			buffer.push_back(tableID[1]);
+			buffer.push_back(tableID[2]);
+			buffer.push_back(static_cast<std::uint8_t>(get_object_id() & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((get_object_id() >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>(designator.size()));
 			for (std::size_t i = 0; i < designator.size(); i++)
 			{
-				retVal.push_back(designator[i]);
+				buffer.push_back(designator[i]);
 			}
-			retVal.push_back(static_cast<std::uint8_t>(softwareVersion.size()));
+			buffer.push_back(static_cast<std::uint8_t>(softwareVersion.size()));
 			for (std::size_t i = 0; i < softwareVersion.size(); i++)
 			{
-				retVal.push_back(softwareVersion[i]);
+				buffer.push_back(softwareVersion[i]);
 			}
-			retVal.push_back(static_cast<std::uint8_t>(NAME & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((NAME >> 8) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((NAME >> 16) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((NAME >> 24) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((NAME >> 32) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((NAME >> 40) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((NAME >> 48) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((NAME >> 56) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>(serialNumber.size()));
+			buffer.push_back(static_cast<std::uint8_t>(NAME & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((NAME >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((NAME >> 16) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((NAME >> 24) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((NAME >> 32) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((NAME >> 40) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((NAME >> 48) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((NAME >> 56) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>(serialNumber.size()));
 			for (std::size_t i = 0; i < serialNumber.size(); i++)
 			{
-				retVal.push_back(serialNumber[i]);
+				buffer.push_back(serialNumber[i]);
 			}
 			for (std::uint_fast8_t i = 0; i < MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH; i++)
 			{
 				if (i < structureLabel.size())
 				{
-					retVal.push_back(structureLabel[i]);
+					buffer.push_back(structureLabel[i]);
 				}
 				else
 				{
-					retVal.push_back(' ');
+					buffer.push_back(' ');
 				}
 			}
 			for (std::uint_fast8_t i = 0; i < MAX_STRUCTURE_AND_LOCALIZATION_LABEL_LENGTH; i++)
 			{
 				if (i < localizationLabel.size())
 				{
-					retVal.push_back(localizationLabel[i]);
+					buffer.push_back(localizationLabel[i]);
 				}
 				else
 				{
-					retVal.push_back(' ');
+					buffer.push_back(' ');
 				}
 			}
 			if (useExtendedStructureLabel)
 			{
-				retVal.push_back(static_cast<std::uint8_t>(extendedStructureLabel.size()));
+				buffer.push_back(static_cast<std::uint8_t>(extendedStructureLabel.size()));
 				for (std::size_t i = 0; i < extendedStructureLabel.size(); i++)
 				{
-					retVal.push_back(extendedStructureLabel[i]);
+					buffer.push_back(extendedStructureLabel[i]);
 				}
 			}
-			return retVal;
 		}
 
 		std::string DeviceObject::get_software_version() const
@@ -240,38 +259,36 @@ namespace isobus
 			return ObjectTypes::DeviceElement;
 		}
 
-		std::vector<std::uint8_t> DeviceElementObject::get_binary_object() const
+		std::size_t DeviceElementObject::get_binary_object_size() const
 		{
-			std::vector<std::uint8_t> retVal;
+			return (13 + designator.size() + (2 * referenceList.size()));
+		}
 
-			retVal.reserve(14 +
-			               designator.size() +
-			               2 * referenceList.size());
-
-			retVal.push_back(tableID[0]);
-			retVal.push_back(tableID[1]);
-			retVal.push_back(tableID[2]);
-			retVal.push_back(static_cast<std::uint8_t>(get_object_id() & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((get_object_id() >> 8) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>(elementType));
-			retVal.push_back(static_cast<std::uint8_t>(designator.size()));
+		void DeviceElementObject::append_binary_object(std::vector<std::uint8_t> &buffer) const
+		{
+			buffer.push_back(tableID[0]);
+			buffer.push_back(tableID[1]);
+			buffer.push_back(tableID[2]);
+			buffer.push_back(static_cast<std::uint8_t>(get_object_id() & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((get_object_id() >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>(elementType));
+			buffer.push_back(static_cast<std::uint8_t>(designator.size()));
 			for (std::size_t i = 0; i < designator.size(); i++)
 			{
-				retVal.push_back(designator[i]);
+				buffer.push_back(designator[i]);
 			}
-			retVal.push_back(static_cast<std::uint8_t>(elementNumber & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((elementNumber >> 8) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>(parentObject & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((parentObject >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>(elementNumber & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((elementNumber >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>(parentObject & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((parentObject >> 8) & 0xFF));
 			std::uint16_t tempSize = static_cast<std::uint16_t>(referenceList.size());
-			retVal.push_back(tempSize & 0xFF);
-			retVal.push_back((tempSize >> 8) & 0xFF);
+			buffer.push_back(tempSize & 0xFF);
+			buffer.push_back((tempSize >> 8) & 0xFF);
 			for (std::size_t i = 0; i < tempSize; i++)
 			{
-				retVal.push_back(static_cast<std::uint8_t>(referenceList[i] & 0xFF));
-				retVal.push_back(static_cast<std::uint8_t>((referenceList[i] >> 8) & 0xFF));
+				buffer.push_back(static_cast<std::uint8_t>(referenceList[i] & 0xFF));
+				buffer.push_back(static_cast<std::uint8_t>((referenceList[i] >> 8) & 0xFF));
 			}
-			return retVal;
 		}
 
 		std::uint16_t DeviceElementObject::get_element_number() const
@@ -359,29 +376,29 @@ namespace isobus
 			return ObjectTypes::DeviceProcessData;
 		}
 
-		std::vector<std::uint8_t> DeviceProcessDataObject::get_binary_object() const
+		std::size_t DeviceProcessDataObject::get_binary_object_size() const
 		{
-			std::vector<std::uint8_t> retVal;
+			return (12 + designator.size());
+		}
 
-			retVal.reserve(11 + designator.size());
-
-			retVal.push_back(tableID[0]);
-			retVal.push_back(tableID[1]);
-			retVal.push_back(tableID[2]);
-			retVal.push_back(static_cast<std::uint8_t>(get_object_id() & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((get_object_id() >> 8) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>(ddi & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((ddi >> 8) & 0xFF));
-			retVal.push_back(propertiesBitfield);
-			retVal.push_back(triggerMethodsBitfield);
-			retVal.push_back(static_cast<std::uint8_t>(designator.size()));
+		void DeviceProcessDataObject::append_binary_object(std::vector<std::uint8_t> &buffer) const
+		{
+			buffer.push_back(tableID[0]);
+			buffer.push_back(tableID[1]);
+			buffer.push_back(tableID[2]);
+			buffer.push_back(static_cast<std::uint8_t>(get_object_id() & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((get_object_id() >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>(ddi & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((ddi >> 8) & 0xFF));
+			buffer.push_back(propertiesBitfield);
+			buffer.push_back(triggerMethodsBitfield);
+			buffer.push_back(static_cast<std::uint8_t>(designator.size()));
 			for (std::size_t i = 0; i < designator.size(); i++)
 			{
-				retVal.push_back(designator[i]);
+				buffer.push_back(designator[i]);
 			}
-			retVal.push_back(deviceValuePresentationObject & 0xFF);
-			retVal.push_back((deviceValuePresentationObject >> 8) & 0xFF);
-			return retVal;
+			buffer.push_back(deviceValuePresentationObject & 0xFF);
+			buffer.push_back((deviceValuePresentationObject >> 8) & 0xFF);
 		}
 
 		std::uint16_t DeviceProcessDataObject::get_ddi() const
@@ -448,31 +465,31 @@ namespace isobus
 			return ObjectTypes::DeviceProperty;
 		}
 
-		std::vector<std::uint8_t> DevicePropertyObject::get_binary_object() const
+		std::size_t DevicePropertyObject::get_binary_object_size() const
 		{
-			std::vector<std::uint8_t> retVal;
+			return (14 + designator.size());
+		}
 
-			retVal.reserve(13 + designator.size());
-
-			retVal.push_back(tableID[0]);
-			retVal.push_back(tableID[1]);
-			retVal.push_back(tableID[2]);
-			retVal.push_back(static_cast<std::uint8_t>(get_object_id() & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((get_object_id() >> 8) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>(ddi & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((ddi >> 8) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>(value & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((value >> 8) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((value >> 16) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((value >> 24) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>(designator.size()));
+		void DevicePropertyObject::append_binary_object(std::vector<std::uint8_t> &buffer) const
+		{
+			buffer.push_back(tableID[0]);
+			buffer.push_back(tableID[1]);
+			buffer.push_back(tableID[2]);
+			buffer.push_back(static_cast<std::uint8_t>(get_object_id() & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((get_object_id() >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>(ddi & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((ddi >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>(value & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((value >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((value >> 16) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((value >> 24) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>(designator.size()));
 			for (std::size_t i = 0; i < designator.size(); i++)
 			{
-				retVal.push_back(designator[i]);
+				buffer.push_back(designator[i]);
 			}
-			retVal.push_back(deviceValuePresentationObject & 0xFF);
-			retVal.push_back((deviceValuePresentationObject >> 8) & 0xFF);
-			return retVal;
+			buffer.push_back(deviceValuePresentationObject & 0xFF);
+			buffer.push_back((deviceValuePresentationObject >> 8) & 0xFF);
 		}
 
 		std::int32_t DevicePropertyObject::get_value() const
@@ -529,21 +546,22 @@ namespace isobus
 			return ObjectTypes::DeviceValuePresentation;
 		}
 
-		std::vector<std::uint8_t> DeviceValuePresentationObject::get_binary_object() const
+		std::size_t DeviceValuePresentationObject::get_binary_object_size() const
 		{
-			std::vector<std::uint8_t> retVal;
+			return (15 + designator.size());
+		}
 
-			retVal.reserve(16 + designator.size());
-
-			retVal.push_back(tableID[0]);
-			retVal.push_back(tableID[1]);
-			retVal.push_back(tableID[2]);
-			retVal.push_back(static_cast<std::uint8_t>(get_object_id() & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((get_object_id() >> 8) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>(offset & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((offset >> 8) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((offset >> 16) & 0xFF));
-			retVal.push_back(static_cast<std::uint8_t>((offset >> 24) & 0xFF));
+		void DeviceValuePresentationObject::append_binary_object(std::vector<std::uint8_t> &buffer) const
+		{
+			buffer.push_back(tableID[0]);
+			buffer.push_back(tableID[1]);
+			buffer.push_back(tableID[2]);
+			buffer.push_back(static_cast<std::uint8_t>(get_object_id() & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((get_object_id() >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>(offset & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((offset >> 8) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((offset >> 16) & 0xFF));
+			buffer.push_back(static_cast<std::uint8_t>((offset >> 24) & 0xFF));
 			static_assert(sizeof(float) == 4, "Float must be 4 bytes");
 			std::array<std::uint8_t, sizeof(float)> floatBytes = { 0 };
 			memcpy(floatBytes.data(), &scale, sizeof(float));
@@ -555,15 +573,14 @@ namespace isobus
 
 			for (std::uint_fast8_t i = 0; i < 4; i++)
 			{
-				retVal.push_back(floatBytes[i]);
+				buffer.push_back(floatBytes[i]);
 			}
-			retVal.push_back(numberOfDecimals);
-			retVal.push_back(static_cast<std::uint8_t>(designator.size()));
+			buffer.push_back(numberOfDecimals);
+			buffer.push_back(static_cast<std::uint8_t>(designator.size()));
 			for (std::size_t i = 0; i < designator.size(); i++)
 			{
-				retVal.push_back(designator[i]);
+				buffer.push_back(designator[i]);
 			}
-			return retVal;
 		}
 
 		std::int32_t DeviceValuePresentationObject::get_offset() const
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdio>
 #include <cstring>
 #include <functional>
 #include <limits>
@@ -29,8 +30,10 @@ namespace isobus
 	  languageCommandInterface(clientSource, partner),
 	  partnerControlFunction(partner),
 	  myControlFunction(clientSource),
+	  network((nullptr != clientSource) ? clientSource->get_network() : CANNetworkManager::CANNetwork),
 	  txFlags(static_cast<std::uint32_t>(TransmitFlags::NumberFlags), process_flags, this)
 	{
+		reset_command_pacing(true);
 	}
 
 	VirtualTerminalClient::~VirtualTerminalClient()
@@ -52,8 +55,8 @@ namespace isobus
 			{
 				partnerControlFunction->add_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU), process_rx_message, this);
 				partnerControlFunction->add_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Acknowledge), process_rx_message, this);
-				CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU), process_rx_message, this);
-				CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal), process_rx_message, this);
+				network.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU), process_rx_message, this);
+				network.add_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal), process_rx_message, this);
 			}
 
 			if (!languageCommandInterface.get_initialized())
@@ -93,8 +96,8 @@ namespace isobus
 				}
 				partnerControlFunction->remove_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU), process_rx_message, this);
 				partnerControlFunction->remove_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Acknowledge), process_rx_message, this);
-				CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU), process_rx_message, this);
-				CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal), process_rx_message, this);
+				network.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU), process_rx_message, this);
+				network.remove_global_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal), process_rx_message, this);
 			}
 
 			shouldTerminate = true;
@@ -255,6 +258,19 @@ namespace isobus
 		commandQueueEnabled = shouldQueueCommands;
 	}
 
+	void VirtualTerminalClient::set_should_pace_commands(const bool shouldPaceCommands)
+	{
+		commandPacingEnabled = shouldPaceCommands;
+	}
+
+	VirtualTerminalClient::CommandStatistics VirtualTerminalClient::get_command_statistics() const
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(commandPacingMutex);
+#endif
+		return commandStatistics;
+	}
+
 	isobus::VirtualTerminalClient::AssignedAuxiliaryFunction::AssignedAuxiliaryFunction(const std::uint16_t functionObjectID, const std::uint16_t inputObjectID, const AuxiliaryTypeTwoFunctionType functionType) :
 	  functionObjectID(functionObjectID), inputObjectID(inputObjectID), functionType(functionType)
 	{
@@ -301,7 +317,7 @@ namespace isobus
 			                                         0xFF,
 			                                         0xFF,
 			                                         0xFF };
-		return queue_command(buffer, true);
+		return queue_command(buffer, CANIdentifier::CANPriority::PriorityDefault6);
 	}
 
 	bool VirtualTerminalClient::send_ESC()
@@ -314,7 +330,7 @@ namespace isobus
 			                                         0xFF,
 			                                         0xFF,
 			                                         0xFF };
-		return queue_command(buffer, true);
+		return queue_command(buffer, CANIdentifier::CANPriority::PriorityDefault6);
 	}
 
 	bool VirtualTerminalClient::send_control_audio_signal(std::uint8_t activations, std::uint16_t frequency_hz, std::uint16_t duration_ms, std::uint16_t offTimeDuration_ms)
@@ -327,7 +343,7 @@ namespace isobus
 			                                         static_cast<std::uint8_t>(duration_ms >> 8),
 			                                         static_cast<std::uint8_t>(offTimeDuration_ms & 0xFF),
 			                                         static_cast<std::uint8_t>(offTimeDuration_ms >> 8) };
-		return queue_command(buffer, true);
+		return queue_command(buffer, CANIdentifier::CANPriority::PriorityDefault6);
 	}
 
 	bool VirtualTerminalClient::send_set_audio_volume(std::uint8_t volume_percent)
@@ -348,7 +364,7 @@ namespace isobus
 			                                         0xFF,
 			                                         0xFF,
 			                                         0xFF };
-		return queue_command(buffer, true);
+		return queue_command(buffer, CANIdentifier::CANPriority::PriorityDefault6);
 	}
 
 	bool VirtualTerminalClient::send_change_child_location(std::uint16_t objectID, std::uint16_t parentObjectID, std::uint8_t relativeXPositionChange, std::uint8_t relativeYPositionChange)
@@ -515,7 +531,7 @@ namespace isobus
 			                                         0xFF,
 			                                         0xFF,
 			                                         0xFF };
-		return queue_command(buffer, true);
+		return queue_command(buffer, CANIdentifier::CANPriority::PriorityDefault6);
 	}
 
 	bool VirtualTerminalClient::send_change_softkey_mask(MaskType type, std::uint16_t dataOrAlarmMaskObjectID, std::uint16_t newSoftKeyMaskObjectID)
@@ -528,7 +544,7 @@ namespace isobus
 			                                         static_cast<std::uint8_t>(newSoftKeyMaskObjectID >> 8),
 			                                         0xFF,
 			                                         0xFF };
-		return queue_command(buffer, true);
+		return queue_command(buffer, CANIdentifier::CANPriority::PriorityDefault6);
 	}
 
 	bool VirtualTerminalClient::send_change_attribute(std::uint16_t objectID, std::uint8_t attributeID, std::uint32_t value)
@@ -602,7 +618,7 @@ namespace isobus
 			                                         static_cast<std::uint8_t>(timeout_ms >> 8),
 			                                         0xFF,
 			                                         0xFF };
-		return queue_command(buffer, true);
+		return queue_command(buffer, CANIdentifier::CANPriority::PriorityDefault6);
 	}
 
 	bool VirtualTerminalClient::send_execute_macro(std::uint16_t objectID)
@@ -667,7 +683,7 @@ namespace isobus
 			                                         0xFF,
 			                                         0xFF,
 			                                         0xFF };
-		return queue_command(buffer, true);
+		return queue_command(buffer, CANIdentifier::CANPriority::PriorityDefault6);
 	}
 
 	bool VirtualTerminalClient::send_execute_extended_macro(std::uint16_t objectID)
@@ -694,7 +710,7 @@ namespace isobus
 			                                         static_cast<std::uint8_t>((NAMEofWorkingSetMasterForDesiredWorkingSet >> 40) & 0xFF),
 			                                         static_cast<std::uint8_t>((NAMEofWorkingSetMasterForDesiredWorkingSet >> 48) & 0xFF),
 			                                         static_cast<std::uint8_t>((NAMEofWorkingSetMasterForDesiredWorkingSet >> 56) & 0xFF) };
-		return queue_command(buffer, true);
+		return queue_command(buffer, CANIdentifier::CANPriority::PriorityDefault6);
 	}
 
 	bool VirtualTerminalClient::send_set_graphics_cursor(std::uint16_t objectID, std::int16_t xPosition, std::int16_t yPosition)
@@ -1040,7 +1056,7 @@ namespace isobus
 			                                         0xFF,
 			                                         0xFF,
 			                                         0xFF };
-		return queue_command(buffer, true);
+		return queue_command(buffer, CANIdentifier::CANPriority::PriorityDefault6);
 	}
 
 	std::uint8_t VirtualTerminalClient::get_softkey_x_axis_pixels() const
@@ -1243,12 +1259,12 @@ namespace isobus
 
 			if (poolIndex < objectPools.size())
 			{
-				objectPools[poolIndex] = tempData;
+				objectPools[poolIndex] = std::move(tempData);
 			}
 			else
 			{
 				objectPools.resize(poolIndex + 1);
-				objectPools[poolIndex] = tempData;
+				objectPools[poolIndex] = std::move(tempData);
 			}
 		}
 	}
@@ -1260,7 +1276,7 @@ namespace isobus
 		{
 			ObjectPoolDataStruct tempData;
 
-			tempData.objectPoolDataPointer = nullptr;
+			tempData.objectPoolDataPointer = pool->data();
 			tempData.objectPoolVectorPointer = pool;
 			tempData.dataCallback = nullptr;
 			tempData.objectPoolSize = pool->size();
@@ -1272,16 +1288,35 @@ namespace isobus
 
 			if (poolIndex < objectPools.size())
 			{
-				objectPools[poolIndex] = tempData;
+				objectPools[poolIndex] = std::move(tempData);
 			}
 			else
 			{
 				objectPools.resize(poolIndex + 1);
-				objectPools[poolIndex] = tempData;
+				objectPools[poolIndex] = std::move(tempData);
 			}
 		}
 	}
 
+	void VirtualTerminalClient::set_object_pool(std::uint8_t poolIndex, VTVersion poolSupportedVTVersion, const MappedIOPFile *pool, std::string version)
+	{
+		if ((nullptr != pool) &&
+		    (pool->get_is_valid()))
+		{
+			set_object_pool(poolIndex, poolSupportedVTVersion, pool->get_data(), pool->get_size(), version);
+		}
+	}
+
+	void VirtualTerminalClient::set_mutable_object_pool(std::uint8_t poolIndex, VTVersion poolSupportedVTVersion, std::uint8_t *pool, std::uint32_t size, std::string version)
+	{
+		if ((nullptr != pool) &&
+		    (0 != size))
+		{
+			set_object_pool(poolIndex, poolSupportedVTVersion, static_cast<const std::uint8_t *>(pool), size, version);
+			objectPools[poolIndex].mutableObjectPoolPointer = pool;
+		}
+	}
+
 	void VirtualTerminalClient::set_object_pool_scaling(std::uint8_t poolIndex,
 	                                                    std::uint32_t originalDataMaskDimensions_px,
 	                                                    std::uint32_t originalSoftKyeDesignatorHeight_px)
@@ -1292,6 +1327,45 @@ namespace isobus
 		objectPools[poolIndex].autoScaleSoftKeyDesignatorOriginalHeight = originalSoftKyeDesignatorHeight_px;
 	}
 
+	void VirtualTerminalClient::set_scaled_object_pool_cache_directory(const std::string &directory)
+	{
+		scaledObjectPoolCacheDirectory = directory;
+	}
+
+	std::string VirtualTerminalClient::get_scaled_object_pool_cache_directory() const
+	{
+		return scaledObjectPoolCacheDirectory;
+	}
+
+	void VirtualTerminalClient::set_object_pool_delta_upload_directory(const std::string &directory)
+	{
+		objectPoolDeltaDirectory = directory;
+	}
+
+	std::string VirtualTerminalClient::get_object_pool_delta_upload_directory() const
+	{
+		return objectPoolDeltaDirectory;
+	}
+
+	void VirtualTerminalClient::set_object_pool_picture_optimization(std::uint8_t poolIndex, bool runLengthEncode, bool reduceColourDepth)
+	{
+		// You have to call set_object_pool or register_object_pool_data_chunk_callback before calling this function
+		assert(poolIndex < objectPools.size());
+		objectPools[poolIndex].runLengthEncodePictures = runLengthEncode;
+		objectPools[poolIndex].reducePictureColourDepth = reduceColourDepth;
+	}
+
+	std::uint32_t VirtualTerminalClient::get_object_pool_bytes_saved(std::uint8_t poolIndex) const
+	{
+		std::uint32_t retVal = 0;
+
+		if (poolIndex < objectPools.size())
+		{
+			retVal = objectPools[poolIndex].pictureBytesSaved;
+		}
+		return retVal;
+	}
+
 	void VirtualTerminalClient::register_object_pool_data_chunk_callback(std::uint8_t poolIndex, VTVersion poolSupportedVTVersion, std::uint32_t poolTotalSize, DataChunkCallback value, std::string version)
 	{
 		if ((nullptr != value) &&
@@ -1311,18 +1385,19 @@ namespace isobus
 
 			if (poolIndex < objectPools.size())
 			{
-				objectPools[poolIndex] = tempData;
+				objectPools[poolIndex] = std::move(tempData);
 			}
 			else
 			{
 				objectPools.resize(poolIndex + 1);
-				objectPools[poolIndex] = tempData;
+				objectPools[poolIndex] = std::move(tempData);
 			}
 		}
 	}
 
 	void VirtualTerminalClient::update()
 	{
+		const SystemTiming::Snapshot timeSnapshot; // Evaluate all timeouts this update against the same time
 		StateMachineState previousStateMachineState = state; // Save state to see if it changes this update
 
 		if (nullptr != partnerControlFunction)
@@ -1511,9 +1586,12 @@ namespace isobus
 						tempVersionBuffer[5] = ' ';
 						tempVersionBuffer[6] = ' ';
 
-						for (std::size_t i = 0; ((i < VERSION_LABEL_LENGTH) && (i < objectPools[0].versionLabel.size())); i++)
+						// A delta upload starts from an older version of the pool
+						const std::string &versionLabel = deltaBaseVersionLabel.empty() ? objectPools[0].versionLabel : deltaBaseVersionLabel;
+
+						for (std::size_t i = 0; ((i < VERSION_LABEL_LENGTH) && (i < versionLabel.size())); i++)
 						{
-							tempVersionBuffer[i] = objectPools[0].versionLabel[i];
+							tempVersionBuffer[i] = versionLabel[i];
 						}
 
 						if (send_load_version(tempVersionBuffer))
@@ -1592,6 +1670,12 @@ namespace isobus
 								set_state(StateMachineState::Failed);
 							}
 						}
+
+						if (StateMachineState::Failed != state)
+						{
+							optimize_object_pools();
+							prepare_object_pool_delta();
+						}
 					}
 
 					for (std::uint32_t i = 0; i < objectPools.size(); i++)
@@ -1607,17 +1691,24 @@ namespace isobus
 
 							if (CurrentObjectPoolUploadState::Uninitialized == currentObjectPoolState)
 							{
-								if (!objectPools[i].uploaded)
+								if ((!objectPools[i].uploaded) &&
+								    (0 == get_object_pool_upload_size(objectPools[i])))
+								{
+									// None of this pool's objects changed since the version that was loaded
+									objectPools[i].uploaded = true;
+									CANStackLogger::debug("[VT]: Object pool " + isobus::to_string(i + 1) + " is unchanged, skipping it.");
+								}
+								else if (!objectPools[i].uploaded)
 								{
-									bool transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-									                                                                         nullptr,
-									                                                                         objectPools[i].objectPoolSize + 1, // Account for Mux byte
-									                                                                         myControlFunction,
-									                                                                         partnerControlFunction,
-									                                                                         CANIdentifier::CANPriority::Priority5,
-									                                                                         process_callback,
-									                                                                         this,
-									                                                                         process_internal_object_pool_upload_callback);
+									bool transmitSuccessful = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+									                                                 nullptr,
+									                                                 get_object_pool_upload_size(objectPools[i]) + 1, // Account for Mux byte
+									                                                 myControlFunction,
+									                                                 partnerControlFunction,
+									                                                 CANIdentifier::CANPriority::Priority5,
+									                                                 process_callback,
+									                                                 this,
+									                                                 process_internal_object_pool_upload_callback);
 
 									if (transmitSuccessful)
 									{
@@ -1753,12 +1844,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_working_set_maintenance(bool initializing) const
@@ -1776,12 +1867,12 @@ namespace isobus
 			                                                         0xFF,
 			                                                         0xFF,
 			                                                         0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_get_memory(std::uint32_t requiredMemory) const
@@ -1794,12 +1885,12 @@ namespace isobus
 			                                                         static_cast<std::uint8_t>((requiredMemory >> 24) & 0xFF),
 			                                                         0xFF,
 			                                                         0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_get_number_of_softkeys() const
@@ -1812,12 +1903,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_get_text_font_data() const
@@ -1830,12 +1921,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_get_hardware() const
@@ -1848,12 +1939,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_get_supported_widechars() const
@@ -1866,12 +1957,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_get_window_mask_data() const
@@ -1884,12 +1975,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_get_supported_objects() const
@@ -1902,12 +1993,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_get_versions() const
@@ -1920,12 +2011,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_store_version(std::array<std::uint8_t, 7> versionLabel) const
@@ -1938,12 +2029,12 @@ namespace isobus
 			                                                         versionLabel[4],
 			                                                         versionLabel[5],
 			                                                         versionLabel[6] };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_load_version(std::array<std::uint8_t, 7> versionLabel) const
@@ -1956,12 +2047,12 @@ namespace isobus
 			                                                         versionLabel[4],
 			                                                         versionLabel[5],
 			                                                         versionLabel[6] };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_delete_version(std::array<std::uint8_t, 7> versionLabel) const
@@ -1974,12 +2065,12 @@ namespace isobus
 			                                                         versionLabel[4],
 			                                                         versionLabel[5],
 			                                                         versionLabel[6] };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_extended_get_versions() const
@@ -1992,12 +2083,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_extended_store_version(std::array<std::uint8_t, 32> versionLabel) const
@@ -2005,12 +2096,12 @@ namespace isobus
 		std::array<std::uint8_t, 33> buffer;
 		buffer[0] = static_cast<std::uint8_t>(Function::ExtendedStoreVersionCommand);
 		memcpy(&buffer[1], versionLabel.data(), 32);
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      buffer.size(),
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              buffer.size(),
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_extended_load_version(std::array<std::uint8_t, 32> versionLabel) const
@@ -2018,12 +2109,12 @@ namespace isobus
 		std::array<std::uint8_t, 33> buffer;
 		buffer[0] = static_cast<std::uint8_t>(Function::ExtendedLoadVersionCommand);
 		memcpy(&buffer[1], versionLabel.data(), 32);
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      buffer.size(),
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              buffer.size(),
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_extended_delete_version(std::array<std::uint8_t, 32> versionLabel) const
@@ -2031,12 +2122,12 @@ namespace isobus
 		std::array<std::uint8_t, 33> buffer;
 		buffer[0] = static_cast<std::uint8_t>(Function::ExtendedDeleteVersionCommand);
 		memcpy(&buffer[1], versionLabel.data(), 32);
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      buffer.size(),
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              buffer.size(),
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_end_of_object_pool() const
@@ -2049,12 +2140,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_working_set_master() const
@@ -2067,12 +2158,12 @@ namespace isobus
 			                                                             0xFF,
 			                                                             0xFF,
 			                                                             0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::WorkingSetMaster),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      nullptr,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::WorkingSetMaster),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              nullptr,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_auxiliary_functions_preferred_assignment() const
@@ -2083,12 +2174,12 @@ namespace isobus
 		{
 			buffer.resize(CAN_DATA_LENGTH);
 		}
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      buffer.size(),
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              buffer.size(),
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_auxiliary_function_assignment_response(std::uint16_t functionObjectID, bool hasError, bool isAlreadyAssigned) const
@@ -2110,12 +2201,12 @@ namespace isobus
 			                                                         0xFF,
 			                                                         0xFF,
 			                                                         0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	bool VirtualTerminalClient::send_auxiliary_input_maintenance() const
@@ -2128,12 +2219,12 @@ namespace isobus
 			                                                         0xFF,
 			                                                         0xFF,
 			                                                         0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      nullptr,
-		                                                      CANIdentifier::Priority3);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              nullptr,
+		                              CANIdentifier::Priority3);
 	}
 
 	bool VirtualTerminalClient::send_auxiliary_input_status_enable_response(std::uint16_t objectID, bool isEnabled, bool invalidObjectID) const
@@ -2146,12 +2237,12 @@ namespace isobus
 			                                                         0xFF,
 			                                                         0xFF,
 			                                                         0xFF };
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      buffer.data(),
-		                                                      CAN_DATA_LENGTH,
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              buffer.data(),
+		                              CAN_DATA_LENGTH,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
 	void VirtualTerminalClient::update_auxiliary_input_status()
@@ -2204,21 +2295,21 @@ namespace isobus
 				                                                         operatingState };
 			if (get_auxiliary_input_learn_mode_enabled())
 			{
-				retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-				                                                        buffer.data(),
-				                                                        CAN_DATA_LENGTH,
-				                                                        myControlFunction,
-				                                                        partnerControlFunction,
-				                                                        CANIdentifier::Priority3);
+				retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+				                                buffer.data(),
+				                                CAN_DATA_LENGTH,
+				                                myControlFunction,
+				                                partnerControlFunction,
+				                                CANIdentifier::Priority3);
 			}
 			else
 			{
-				retVal = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU),
-				                                                        buffer.data(),
-				                                                        CAN_DATA_LENGTH,
-				                                                        myControlFunction,
-				                                                        nullptr,
-				                                                        CANIdentifier::Priority3);
+				retVal = network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU),
+				                                buffer.data(),
+				                                CAN_DATA_LENGTH,
+				                                myControlFunction,
+				                                nullptr,
+				                                CANIdentifier::Priority3);
 			}
 		}
 		return retVal;
@@ -2233,10 +2324,17 @@ namespace isobus
 			firstTimeInState = true;
 		}
 
+		if ((StateMachineState::WaitForPartnerVTStatusMessage == value) && (value != state))
+		{
+			// Starting to look for a VT server, which may not be the one the statistics are for
+			reset_command_pacing(true);
+		}
+
 		state = value;
 
 		if (StateMachineState::Disconnected == value)
 		{
+			reset_command_pacing(false);
 			lastVTStatusTimestamp_ms = 0;
 			for (std::size_t i = 0; i < objectPools.size(); i++)
 			{
@@ -2300,8 +2398,8 @@ namespace isobus
 		VirtualTerminalClient *parentVT = static_cast<VirtualTerminalClient *>(parentPointer);
 		if ((nullptr != parentPointer) &&
 		    (CAN_DATA_LENGTH <= message.get_data_length()) &&
-		    ((nullptr == message.get_destination_control_function()) ||
-		     (parentVT->myControlFunction == message.get_destination_control_function())))
+		    ((nullptr == message.get_destination_control_function_pointer()) ||
+		     (parentVT->myControlFunction.get() == message.get_destination_control_function_pointer())))
 		{
 			switch (message.get_identifier().get_parameter_group_number())
 			{
@@ -2321,6 +2419,8 @@ namespace isobus
 
 				case static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU):
 				{
+					parentVT->on_command_response(message.get_uint8_at(0));
+
 					switch (message.get_uint8_at(0))
 					{
 						case static_cast<std::uint8_t>(Function::SoftKeyActivationMessage):
@@ -2797,6 +2897,8 @@ namespace isobus
 
 									if (message.get_data_length() >= remainingLength)
 									{
+										std::vector<std::string> otherLabels;
+
 										for (std::uint_fast8_t i = 0; i < numberOfLabels; i++)
 										{
 											char tempStringLabel[8] = { 0 };
@@ -2809,45 +2911,79 @@ namespace isobus
 											tempStringLabel[6] = message.get_uint8_at(8 + (LABEL_LENGTH * i));
 											tempStringLabel[7] = '\0';
 											std::string labelDecoded(tempStringLabel);
-											std::string tempActualLabel(parentVT->objectPools[0].versionLabel);
-
-											// Check if we need to manipulate the passed in label by padding with spaces
-											while (tempActualLabel.size() < LABEL_LENGTH)
-											{
-												tempActualLabel.push_back(' ');
-											}
 
-											if (tempActualLabel.size() > LABEL_LENGTH)
-											{
-												tempActualLabel.resize(LABEL_LENGTH);
-											}
-
-											if (tempActualLabel == labelDecoded)
+											if (get_padded_version_label(parentVT->objectPools[0].versionLabel) == labelDecoded)
 											{
 												labelMatched = true;
 												parentVT->set_state(StateMachineState::SendLoadVersion);
 												CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Info, "[VT]: VT Server has a matching label for " + isobus::to_string(labelDecoded) + ". It will be loaded and upload will be skipped.");
 												break;
 											}
-											else
+											otherLabels.push_back(labelDecoded);
+										}
+
+										parentVT->deltaBaseVersionLabel.clear();
+										parentVT->deltaBaseObjectHashes.clear();
+
+										if ((!labelMatched) &&
+										    (!parentVT->objectPoolDeltaDirectory.empty()))
+										{
+											// Look for an older version we uploaded, so only what changed since needs to be sent
+											for (const auto &label : otherLabels)
+											{
+												constexpr std::size_t INDEX_ENTRY_LENGTH = 10;
+												const std::vector<std::uint8_t> objectIndex = IOPFileInterface::read_iop_file(parentVT->get_object_pool_delta_index_path(label));
+
+												if ((!objectIndex.empty()) &&
+												    (0 == (objectIndex.size() % INDEX_ENTRY_LENGTH)))
+												{
+													for (std::size_t j = 0; j < objectIndex.size(); j += INDEX_ENTRY_LENGTH)
+													{
+														std::uint64_t objectHash = 0;
+
+														for (std::size_t k = 0; k < 8; k++)
+														{
+															objectHash |= (static_cast<std::uint64_t>(objectIndex[j + 2 + k]) << (8 * k));
+														}
+														parentVT->deltaBaseObjectHashes[static_cast<std::uint16_t>(objectIndex[j] | (objectIndex[j + 1] << 8))] = objectHash;
+													}
+													parentVT->deltaBaseVersionLabel = label;
+													break;
+												}
+											}
+										}
+
+										for (const auto &label : otherLabels)
+										{
+											if (label != parentVT->deltaBaseVersionLabel)
 											{
-												CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Info, "[VT]: VT Server has a label for " + isobus::to_string(labelDecoded) + ". This version will be deleted.");
+												CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Info, "[VT]: VT Server has a label for " + isobus::to_string(label) + ". This version will be deleted.");
 												const std::array<std::uint8_t, 7> deleteBuffer = {
-													static_cast<std::uint8_t>(labelDecoded[0]),
-													static_cast<std::uint8_t>(labelDecoded[1]),
-													static_cast<std::uint8_t>(labelDecoded[2]),
-													static_cast<std::uint8_t>(labelDecoded[3]),
-													static_cast<std::uint8_t>(labelDecoded[4]),
-													static_cast<std::uint8_t>(labelDecoded[5]),
-													static_cast<std::uint8_t>(labelDecoded[6])
+													static_cast<std::uint8_t>(label[0]),
+													static_cast<std::uint8_t>(label[1]),
+													static_cast<std::uint8_t>(label[2]),
+													static_cast<std::uint8_t>(label[3]),
+													static_cast<std::uint8_t>(label[4]),
+													static_cast<std::uint8_t>(label[5]),
+													static_cast<std::uint8_t>(label[6])
 												};
 												if (!parentVT->send_delete_version(deleteBuffer))
 												{
-													CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Warning, "[VT]: Failed to send the delete version message for label " + isobus::to_string(labelDecoded));
+													CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Warning, "[VT]: Failed to send the delete version message for label " + isobus::to_string(label));
 												}
 											}
 										}
-										if (!labelMatched)
+
+										if (labelMatched)
+										{
+											// Already handled
+										}
+										else if (!parentVT->deltaBaseVersionLabel.empty())
+										{
+											CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Info, "[VT]: VT Server has an earlier version " + isobus::to_string(parentVT->deltaBaseVersionLabel) + ". It will be loaded and only changed objects will be uploaded.");
+											parentVT->set_state(StateMachineState::SendLoadVersion);
+										}
+										else
 										{
 											CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Info, "[VT]: No version label from the VT matched. Client will upload the pool and store it instead.");
 											parentVT->set_state(StateMachineState::UploadObjectPool);
@@ -2878,10 +3014,20 @@ namespace isobus
 								if (0 == message.get_uint8_at(5))
 								{
 									CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Info, "[VT]: Loaded object pool version from VT non-volatile memory with no errors.");
-									parentVT->set_state(StateMachineState::Connected);
+
+									if (!parentVT->deltaBaseVersionLabel.empty())
+									{
+										// Send what changed since this version
+										parentVT->set_state(StateMachineState::UploadObjectPool);
+									}
+									else
+									{
+										parentVT->set_state(StateMachineState::Connected);
+									}
 
 									//! @todo maybe a better way available than relying on aux function callbacks registered?
-									if (parentVT->auxiliaryFunctionEventDispatcher.get_listener_count() > 0)
+									if ((parentVT->deltaBaseVersionLabel.empty()) &&
+									    (parentVT->auxiliaryFunctionEventDispatcher.get_listener_count() > 0))
 									{
 										if (parentVT->send_auxiliary_functions_preferred_assignment())
 										{
@@ -2911,6 +3057,8 @@ namespace isobus
 
 									// Not sure what happened here... should be mostly impossible. Try to upload instead.
 									CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Warning, "[VT]: Switching to pool upload instead.");
+									parentVT->deltaBaseVersionLabel.clear();
+									parentVT->deltaBaseObjectHashes.clear();
 									parentVT->set_state(StateMachineState::UploadObjectPool);
 								}
 							}
@@ -2930,6 +3078,7 @@ namespace isobus
 									// Stored with no error
 									parentVT->set_state(StateMachineState::Connected);
 									CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Info, "[VT]: Stored object pool with no error.");
+									parentVT->on_object_pool_version_stored();
 								}
 								else
 								{
@@ -2993,6 +3142,8 @@ namespace isobus
 									for (auto &objectPool : parentVT->objectPools)
 									{
 										objectPool.scaledObjectPool.clear();
+										objectPool.cachedScaledObjectPool = MappedIOPFile();
+										objectPool.uploadingDelta = false;
 									}
 
 									// Check if we need to store this pool
@@ -3053,7 +3204,7 @@ namespace isobus
 								});
 								if (result == std::end(parentVT->assignedAuxiliaryInputDevices))
 								{
-									AssignedAuxiliaryInputDevice inputDevice{ message.get_source_control_function()->get_NAME().get_full_name(), modelIdentificationCode, {} };
+									AssignedAuxiliaryInputDevice inputDevice{ message.get_source_control_function_pointer()->get_NAME().get_full_name(), modelIdentificationCode, {} };
 									parentVT->assignedAuxiliaryInputDevices.push_back(inputDevice);
 									CANStackLogger::CAN_stack_log(CANStackLogger::LoggingLevel::Info, "[AUX-N]: New auxiliary input device with name: " + isobus::to_string(inputDevice.name) + " and model identification code: " + isobus::to_string(modelIdentificationCode));
 								}
@@ -3133,54 +3284,54 @@ namespace isobus
 
 			// If pool index is FFs, something is wrong with the state machine state, return false.
 			if ((std::numeric_limits<std::uint32_t>::max() != poolIndex) &&
-			    (bytesOffset + numberOfBytesNeeded) <= parentVTClient->objectPools[poolIndex].objectPoolSize + 1)
+			    (bytesOffset + numberOfBytesNeeded) <= get_object_pool_upload_size(parentVTClient->objectPools[poolIndex]) + 1)
 			{
 				// We've got more data to transfer
-				if ((0 != parentVTClient->objectPools[poolIndex].autoScaleDataMaskOriginalDimension) && (0 != parentVTClient->objectPools[poolIndex].autoScaleSoftKeyDesignatorOriginalHeight))
+				const ObjectPoolDataStruct &objectPool = parentVTClient->objectPools[poolIndex];
+				const std::uint8_t *poolData = objectPool.objectPoolDataPointer;
+
+				if (!objectPool.scaledObjectPool.empty())
 				{
-					// Object pool has been pre-scaled. Use the scaling buffer instead
-					retVal = true;
+					// Object pool has been pre-scaled or optimized. Use that buffer instead
+					poolData = objectPool.scaledObjectPool.data();
+				}
+				else if (objectPool.cachedScaledObjectPool.get_is_valid())
+				{
+					// A scaled copy of the pool was loaded from the cache
+					poolData = objectPool.cachedScaledObjectPool.get_data();
+				}
+				else if (usingExternalCallback)
+				{
+					poolData = nullptr;
+				}
+
+				if (nullptr == poolData)
+				{
+					// We're using the user's supplied callback to get a chunk of info
 					if (0 == bytesOffset)
 					{
 						chunkBuffer[0] = static_cast<std::uint8_t>(Function::ObjectPoolTransferMessage);
-						memcpy(&chunkBuffer[1], &parentVTClient->objectPools[poolIndex].scaledObjectPool[bytesOffset], numberOfBytesNeeded - 1);
+						retVal = objectPool.dataCallback(callbackIndex, bytesOffset, numberOfBytesNeeded - 1, &chunkBuffer[1], parentVTClient);
 					}
 					else
 					{
 						// Subtract off 1 to account for the mux in the first byte of the message
-						memcpy(chunkBuffer, &parentVTClient->objectPools[poolIndex].scaledObjectPool[bytesOffset - 1], numberOfBytesNeeded);
+						retVal = objectPool.dataCallback(callbackIndex, bytesOffset - 1, numberOfBytesNeeded, chunkBuffer, parentVTClient);
 					}
 				}
 				else
 				{
-					if (usingExternalCallback)
+					// We already have the whole pool in memory
+					retVal = true;
+					if (0 == bytesOffset)
 					{
-						// We're using the user's supplied callback to get a chunk of info
-						if (0 == bytesOffset)
-						{
-							chunkBuffer[0] = static_cast<std::uint8_t>(Function::ObjectPoolTransferMessage);
-							retVal = parentVTClient->objectPools[poolIndex].dataCallback(callbackIndex, bytesOffset, numberOfBytesNeeded - 1, &chunkBuffer[1], parentVTClient);
-						}
-						else
-						{
-							// Subtract off 1 to account for the mux in the first byte of the message
-							retVal = parentVTClient->objectPools[poolIndex].dataCallback(callbackIndex, bytesOffset - 1, numberOfBytesNeeded, chunkBuffer, parentVTClient);
-						}
+						chunkBuffer[0] = static_cast<std::uint8_t>(Function::ObjectPoolTransferMessage);
+						memcpy(&chunkBuffer[1], &poolData[bytesOffset], numberOfBytesNeeded - 1);
 					}
 					else
 					{
-						// We already have the whole pool in RAM
-						retVal = true;
-						if (0 == bytesOffset)
-						{
-							chunkBuffer[0] = static_cast<std::uint8_t>(Function::ObjectPoolTransferMessage);
-							memcpy(&chunkBuffer[1], &parentVTClient->objectPools[poolIndex].objectPoolDataPointer[bytesOffset], numberOfBytesNeeded - 1);
-						}
-						else
-						{
-							// Subtract off 1 to account for the mux in the first byte of the message
-							memcpy(chunkBuffer, &parentVTClient->objectPools[poolIndex].objectPoolDataPointer[bytesOffset - 1], numberOfBytesNeeded);
-						}
+						// Subtract off 1 to account for the mux in the first byte of the message
+						memcpy(chunkBuffer, &poolData[bytesOffset - 1], numberOfBytesNeeded);
 					}
 				}
 			}
@@ -3194,8 +3345,7 @@ namespace isobus
 
 		for (auto &objectPool : objectPools)
 		{
-			if ((0 != objectPool.autoScaleDataMaskOriginalDimension) &&
-			    (0 != objectPool.autoScaleSoftKeyDesignatorOriginalHeight))
+			if (get_pool_needs_scaling(objectPool))
 			{
 				retVal = true;
 				break;
@@ -3204,158 +3354,838 @@ namespace isobus
 		return retVal;
 	}
 
+	bool VirtualTerminalClient::get_pool_needs_scaling(const ObjectPoolDataStruct &objectPool)
+	{
+		return ((0 != objectPool.autoScaleDataMaskOriginalDimension) &&
+		        (0 != objectPool.autoScaleSoftKeyDesignatorOriginalHeight));
+	}
+
 	bool VirtualTerminalClient::scale_object_pools()
 	{
+		/// @brief A range of objects in one pool that a scaling thread can resize on its own
+		struct ScalingTask
+		{
+			std::uint8_t *pool; ///< The pool the objects are in
+			const std::uint32_t *objectOffsets; ///< The offsets of the objects to resize
+			std::size_t numberOfObjects; ///< The number of objects to resize
+			float dataMaskScaleFactor; ///< The scale factor for objects other than soft keys
+			float softKeyScaleFactor; ///< The scale factor for soft keys
+		};
+
 		bool retVal = true;
+		std::vector<std::vector<std::uint32_t>> objectOffsets(objectPools.size());
+		std::vector<std::string> cachePaths(objectPools.size());
+		std::vector<std::vector<std::uint8_t>> cacheKeys(objectPools.size());
+		std::vector<ScalingTask> tasks;
 
-		for (auto &objectPool : objectPools)
+		for (std::size_t i = 0; (i < objectPools.size()) && retVal; i++)
 		{
-			// Step 1: Make a read/write copy of the pool
-			if (nullptr != objectPool.objectPoolDataPointer)
+			auto &objectPool = objectPools[i];
+			std::uint8_t *poolData = nullptr;
+
+			objectPool.scaledObjectPool.clear();
+			objectPool.cachedScaledObjectPool = MappedIOPFile();
+
+			if (!get_pool_needs_scaling(objectPool))
 			{
-				objectPool.scaledObjectPool.resize(objectPool.objectPoolSize);
-				memcpy(&objectPool.scaledObjectPool[0], objectPool.objectPoolDataPointer, objectPool.objectPoolSize);
+				// This pool will be uploaded as-is
+				continue;
+			}
+
+			if ((!scaledObjectPoolCacheDirectory.empty()) &&
+			    (nullptr == objectPool.mutableObjectPoolPointer) &&
+			    get_scaled_object_pool_cache_path(objectPool, cachePaths[i], cacheKeys[i]))
+			{
+				MappedIOPFile cachedPool = IOPFileInterface::map_iop_file(cachePaths[i]);
+
+				if (get_is_scaled_object_pool_cache_valid(cachedPool, objectPool.objectPoolSize, cacheKeys[i]))
+				{
+					CANStackLogger::debug("[VT]: Using cached scaled object pool " + cachePaths[i]);
+					objectPool.cachedScaledObjectPool = std::move(cachedPool);
+					cachePaths[i].clear();
+					continue;
+				}
+			}
+
+			const float dataMaskScaleFactor = static_cast<float>(get_number_x_pixels()) / static_cast<float>(objectPool.autoScaleDataMaskOriginalDimension);
+			const float softKeyScaleFactor = static_cast<float>(get_softkey_x_axis_pixels()) / static_cast<float>(objectPool.autoScaleSoftKeyDesignatorOriginalHeight);
+
+			// Step 1: Get a writable version of the pool
+			if (nullptr != objectPool.mutableObjectPoolPointer)
+			{
+				if ((1.0f == dataMaskScaleFactor) && (1.0f == softKeyScaleFactor))
+				{
+					// Already scaled for this VT
+					continue;
+				}
+				poolData = objectPool.mutableObjectPoolPointer;
 			}
-			else if (nullptr != objectPool.objectPoolVectorPointer)
+			else if (nullptr != objectPool.objectPoolDataPointer)
 			{
-				objectPool.scaledObjectPool.resize(objectPool.objectPoolVectorPointer->size());
-				std::copy(objectPool.objectPoolVectorPointer->begin(), objectPool.objectPoolVectorPointer->end(), objectPool.scaledObjectPool.begin());
+				objectPool.scaledObjectPool.assign(objectPool.objectPoolDataPointer, objectPool.objectPoolDataPointer + objectPool.objectPoolSize);
+				poolData = objectPool.scaledObjectPool.data();
 			}
 			else if (objectPool.useDataCallback)
 			{
 				objectPool.scaledObjectPool.resize(objectPool.objectPoolSize);
 
-				for (std::uint32_t i = 0; i < objectPool.objectPoolSize; i++)
+				for (std::uint32_t offset = 0, callbackIndex = 0; (offset < objectPool.objectPoolSize) && retVal; offset += SCALING_CHUNK_SIZE, callbackIndex++)
 				{
-					retVal &= objectPool.dataCallback(i, i, 1, &objectPool.scaledObjectPool[i], this);
+					std::uint32_t chunkSize = ((objectPool.objectPoolSize - offset) < SCALING_CHUNK_SIZE) ? (objectPool.objectPoolSize - offset) : SCALING_CHUNK_SIZE;
+					retVal = objectPool.dataCallback(callbackIndex, offset, chunkSize, &objectPool.scaledObjectPool[offset], this);
 				}
+				poolData = objectPool.scaledObjectPool.data();
+			}
 
-				if (!retVal)
-				{
-					break;
-				}
+			if ((!retVal) || (nullptr == poolData))
+			{
+				CANStackLogger::error("[VT]: Failed to read object pool " + isobus::to_string(static_cast<int>(i)) + " for scaling");
+				retVal = false;
+				break;
 			}
 
-			// Step 2, Parse the pool and resize each object as we iterate through it
-			auto poolIterator = objectPool.scaledObjectPool.begin();
+			// Step 2: Find every object in the pool
+			if (!index_object_pool(poolData, objectPool.objectPoolSize, objectOffsets[i]))
+			{
+				CANStackLogger::error("[VT]: Failed to parse object pool " + isobus::to_string(static_cast<int>(i)) + " for scaling");
+				retVal = false;
+				break;
+			}
 
-			while ((poolIterator != objectPool.scaledObjectPool.end()) &&
-			       retVal)
+			for (std::size_t j = 0; j < objectOffsets[i].size(); j += SCALING_OBJECTS_PER_TASK)
 			{
-				if (VirtualTerminalObjectType::Key == static_cast<VirtualTerminalObjectType>(poolIterator[2]))
+				tasks.push_back({ poolData,
+				                  &objectOffsets[i][j],
+				                  ((objectOffsets[i].size() - j) < SCALING_OBJECTS_PER_TASK) ? (objectOffsets[i].size() - j) : SCALING_OBJECTS_PER_TASK,
+				                  dataMaskScaleFactor,
+				                  softKeyScaleFactor });
+			}
+		}
+
+		// Step 3: Resize the objects. They don't change size, so the ranges can be done in any order.
+		if (retVal && (!tasks.empty()))
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			std::atomic<std::size_t> nextTask = { 0 };
+			std::atomic<bool> allTasksSucceeded = { true };
+			auto process_tasks = [this, &tasks, &nextTask, &allTasksSucceeded]() {
+				for (std::size_t taskIndex = nextTask++; taskIndex < tasks.size(); taskIndex = nextTask++)
 				{
-					retVal &= resize_object(&poolIterator[0],
-					                        static_cast<float>(get_softkey_x_axis_pixels()) / static_cast<float>(objectPool.autoScaleSoftKeyDesignatorOriginalHeight),
-					                        static_cast<VirtualTerminalObjectType>(poolIterator[2]));
+					const ScalingTask &task = tasks[taskIndex];
+					if (!resize_objects(task.pool, task.objectOffsets, task.numberOfObjects, task.dataMaskScaleFactor, task.softKeyScaleFactor))
+					{
+						allTasksSucceeded = false;
+					}
 				}
-				else
+			};
+			std::size_t numberOfThreads = std::min(static_cast<std::size_t>(std::thread::hardware_concurrency()), tasks.size());
+			std::vector<std::thread> workers;
+
+			for (std::size_t i = 1; i < numberOfThreads; i++)
+			{
+				workers.emplace_back(process_tasks);
+			}
+			process_tasks();
+
+			for (auto &worker : workers)
+			{
+				worker.join();
+			}
+			retVal = allTasksSucceeded;
+#else
+			for (const auto &task : tasks)
+			{
+				retVal &= resize_objects(task.pool, task.objectOffsets, task.numberOfObjects, task.dataMaskScaleFactor, task.softKeyScaleFactor);
+			}
+#endif
+		}
+
+		if (retVal)
+		{
+			CANStackLogger::debug("[VT]: Scaled " + isobus::to_string(static_cast<int>(tasks.size())) + " ranges of objects");
+
+			for (std::size_t i = 0; i < objectPools.size(); i++)
+			{
+				std::vector<std::uint8_t> &scaledPool = objectPools[i].scaledObjectPool;
+
+				// A pool scaled in place is only marked as scaled for this VT once every step has succeeded,
+				// so that a pool left unscaled by a failure isn't mistaken for a scaled one on the next connect
+				if ((nullptr != objectPools[i].mutableObjectPoolPointer) &&
+				    (!objectOffsets[i].empty()))
 				{
-					retVal &= resize_object(&poolIterator[0],
-					                        static_cast<float>(get_number_x_pixels()) / static_cast<float>(objectPool.autoScaleDataMaskOriginalDimension),
-					                        static_cast<VirtualTerminalObjectType>(poolIterator[2]));
+					objectPools[i].autoScaleDataMaskOriginalDimension = get_number_x_pixels();
+					objectPools[i].autoScaleSoftKeyDesignatorOriginalHeight = get_softkey_x_axis_pixels();
 				}
 
-				std::uint32_t objectSize = get_number_bytes_in_object(&poolIterator[0]);
-				if (retVal)
+				if ((!cachePaths[i].empty()) &&
+				    (!scaledPool.empty()))
 				{
-					if (get_is_object_scalable(static_cast<VirtualTerminalObjectType>(*(poolIterator + 2))))
+					// The key and a hash of the scaled pool go after the pool, so they don't affect the upload
+					const std::uint64_t scaledPoolHash = ObjectPoolHasher::hash(scaledPool.data(), objectPools[i].objectPoolSize);
+
+					scaledPool.insert(scaledPool.end(), cacheKeys[i].begin(), cacheKeys[i].end());
+					for (std::uint8_t j = 0; j < sizeof(scaledPoolHash); j++)
 					{
-						CANStackLogger::debug("[VT]: Resized an object: " +
-						                      isobus::to_string(static_cast<int>((*poolIterator)) | (static_cast<int>((*poolIterator + 1))) << 8) +
-						                      " with type " +
-						                      isobus::to_string(static_cast<int>((*(poolIterator + 2)))) +
-						                      " with size " +
-						                      isobus::to_string(static_cast<int>(objectSize)));
+						scaledPool.push_back(static_cast<std::uint8_t>(scaledPoolHash >> (8 * j)));
 					}
+
+					if (!IOPFileInterface::write_iop_file(cachePaths[i], scaledPool.data(), static_cast<std::uint32_t>(scaledPool.size())))
+					{
+						CANStackLogger::warn("[VT]: Failed to write scaled object pool cache file " + cachePaths[i]);
+					}
+					scaledPool.resize(objectPools[i].objectPoolSize);
 				}
-				else
-				{
-					CANStackLogger::error("[VT]: Failed to resize an object: " +
-					                      isobus::to_string(static_cast<int>((*poolIterator)) | (static_cast<int>((*poolIterator + 1))) << 8) +
-					                      " with type " +
-					                      isobus::to_string(static_cast<int>((*poolIterator + 2))) +
-					                      " with size " +
-					                      isobus::to_string(static_cast<int>(objectSize)));
-				}
-				poolIterator += objectSize;
 			}
 		}
 		return retVal;
 	}
 
-	bool VirtualTerminalClient::get_is_object_scalable(VirtualTerminalObjectType type)
+	bool VirtualTerminalClient::get_scaled_object_pool_cache_path(const ObjectPoolDataStruct &objectPool, std::string &path, std::vector<std::uint8_t> &cacheKey)
 	{
-		bool retVal = false;
+		ObjectPoolHasher poolHasher;
+		bool retVal = true;
 
-		switch (type)
+		if (nullptr != objectPool.objectPoolDataPointer)
 		{
-			case VirtualTerminalObjectType::WorkingSet:
-			{
-				retVal = false;
-			}
-			break;
+			poolHasher.update(objectPool.objectPoolDataPointer, objectPool.objectPoolSize);
+		}
+		else if (objectPool.useDataCallback)
+		{
+			std::vector<std::uint8_t> chunk(SCALING_CHUNK_SIZE);
 
-			case VirtualTerminalObjectType::DataMask:
-			case VirtualTerminalObjectType::AlarmMask:
-			case VirtualTerminalObjectType::Container:
-			case VirtualTerminalObjectType::Key:
-			case VirtualTerminalObjectType::Button:
-			case VirtualTerminalObjectType::InputBoolean:
-			case VirtualTerminalObjectType::InputString:
-			case VirtualTerminalObjectType::InputNumber:
-			case VirtualTerminalObjectType::InputList:
-			case VirtualTerminalObjectType::OutputString:
-			case VirtualTerminalObjectType::OutputNumber:
-			case VirtualTerminalObjectType::OutputList:
-			case VirtualTerminalObjectType::OutputLine:
-			case VirtualTerminalObjectType::OutputRectangle:
-			case VirtualTerminalObjectType::OutputEllipse:
-			case VirtualTerminalObjectType::OutputPolygon:
-			case VirtualTerminalObjectType::OutputMeter:
-			case VirtualTerminalObjectType::OutputLinearBarGraph:
-			case VirtualTerminalObjectType::OutputArchedBarGraph:
-			case VirtualTerminalObjectType::PictureGraphic:
-			case VirtualTerminalObjectType::AuxiliaryFunctionType1:
-			case VirtualTerminalObjectType::AuxiliaryInputType1:
-			case VirtualTerminalObjectType::AuxiliaryFunctionType2:
-			case VirtualTerminalObjectType::AuxiliaryInputType2:
-			case VirtualTerminalObjectType::FontAttributes:
+			for (std::uint32_t offset = 0, callbackIndex = 0; (offset < objectPool.objectPoolSize) && retVal; offset += SCALING_CHUNK_SIZE, callbackIndex++)
 			{
-				retVal = true;
+				std::uint32_t chunkSize = ((objectPool.objectPoolSize - offset) < SCALING_CHUNK_SIZE) ? (objectPool.objectPoolSize - offset) : SCALING_CHUNK_SIZE;
+				retVal = objectPool.dataCallback(callbackIndex, offset, chunkSize, chunk.data(), this);
+				poolHasher.update(chunk.data(), chunkSize);
 			}
-			break;
+		}
+		else
+		{
+			retVal = false;
+		}
 
-			default:
+		if (retVal)
+		{
+			// Everything that changes the result of scaling is part of the key
+			const std::uint64_t poolHash = poolHasher.get_hash();
+			const std::uint8_t key[] = {
+				static_cast<std::uint8_t>(poolHash),
+				static_cast<std::uint8_t>(poolHash >> 8),
+				static_cast<std::uint8_t>(poolHash >> 16),
+				static_cast<std::uint8_t>(poolHash >> 24),
+				static_cast<std::uint8_t>(poolHash >> 32),
+				static_cast<std::uint8_t>(poolHash >> 40),
+				static_cast<std::uint8_t>(poolHash >> 48),
+				static_cast<std::uint8_t>(poolHash >> 56),
+				static_cast<std::uint8_t>(objectPool.autoScaleDataMaskOriginalDimension),
+				static_cast<std::uint8_t>(objectPool.autoScaleDataMaskOriginalDimension >> 8),
+				static_cast<std::uint8_t>(objectPool.autoScaleDataMaskOriginalDimension >> 16),
+				static_cast<std::uint8_t>(objectPool.autoScaleDataMaskOriginalDimension >> 24),
+				static_cast<std::uint8_t>(objectPool.autoScaleSoftKeyDesignatorOriginalHeight),
+				static_cast<std::uint8_t>(objectPool.autoScaleSoftKeyDesignatorOriginalHeight >> 8),
+				static_cast<std::uint8_t>(objectPool.autoScaleSoftKeyDesignatorOriginalHeight >> 16),
+				static_cast<std::uint8_t>(objectPool.autoScaleSoftKeyDesignatorOriginalHeight >> 24),
+				static_cast<std::uint8_t>(xPixels),
+				static_cast<std::uint8_t>(xPixels >> 8),
+				softKeyXAxisPixels,
+				softKeyYAxisPixels,
+				smallFontSizesBitfield,
+				largeFontSizesBitfield,
+				connectedVTVersion
+			};
+			const std::uint64_t keyHash = ObjectPoolHasher::hash(key, sizeof(key));
+
+			cacheKey.assign(key, key + sizeof(key));
+			char filename[24];
+
+			snprintf(filename, sizeof(filename), "%016llx.iop", static_cast<unsigned long long>(keyHash));
+			path = scaledObjectPoolCacheDirectory;
+
+			if ((!path.empty()) && ('/' != path.back()) && ('\\' != path.back()))
 			{
-				retVal = false;
+				path += '/';
 			}
-			break;
+			path += filename;
 		}
 		return retVal;
 	}
 
-	VirtualTerminalClient::FontSize VirtualTerminalClient::get_font_or_next_smallest_font(FontSize originalFont) const
+	bool VirtualTerminalClient::get_is_scaled_object_pool_cache_valid(const MappedIOPFile &cachedPool, std::uint32_t poolSize, const std::vector<std::uint8_t> &cacheKey)
 	{
-		FontSize retVal = originalFont;
+		constexpr std::uint32_t HASH_LENGTH = sizeof(std::uint64_t);
+		bool retVal = false;
 
-		while ((!get_font_size_supported(retVal)) && (FontSize::Size6x8 != retVal))
+		if (cachedPool.get_is_valid() &&
+		    (cachedPool.get_size() == (poolSize + cacheKey.size() + HASH_LENGTH)) &&
+		    (0 == std::memcmp(cachedPool.get_data() + poolSize, cacheKey.data(), cacheKey.size())))
 		{
-			retVal = static_cast<FontSize>(static_cast<std::uint8_t>(originalFont) - 1);
+			const std::uint8_t *storedHash = cachedPool.get_data() + poolSize + cacheKey.size();
+			std::uint64_t expectedHash = 0;
+
+			for (std::uint8_t i = 0; i < HASH_LENGTH; i++)
+			{
+				expectedHash |= static_cast<std::uint64_t>(storedHash[i]) << (8 * i);
+			}
+			retVal = (expectedHash == ObjectPoolHasher::hash(cachedPool.get_data(), poolSize));
 		}
 		return retVal;
 	}
 
-	VirtualTerminalClient::FontSize VirtualTerminalClient::remap_font_to_scale(FontSize originalFont, float scaleFactor)
+	bool VirtualTerminalClient::index_object_pool(const std::uint8_t *pool, std::uint32_t size, std::vector<std::uint32_t> &objectOffsets)
 	{
-		static constexpr float SCALE_FACTOR_POSITIVE_FUDGE = 1.05f;
-		static constexpr float SCALE_FACTOR_NEGATIVE_FUDGE = 0.95f;
-		FontSize retVal = originalFont;
+		// Every object has at least an ID and a type
+		constexpr std::uint32_t OBJECT_HEADER_LENGTH = 3;
+		bool retVal = true;
+		std::uint32_t offset = 0;
 
-		if (scaleFactor > SCALE_FACTOR_POSITIVE_FUDGE || scaleFactor < SCALE_FACTOR_NEGATIVE_FUDGE)
+		objectOffsets.clear();
+
+		while (offset < size)
 		{
-			const std::unordered_map<FontSize, std::map<float, FontSize, std::greater<float>>> FONT_SCALING_MAPPER{
-				{ FontSize::Size6x8,
-				  { { 23.95f, FontSize::Size128x192 },
+			std::uint32_t objectSize = 0;
+
+			if (((size - offset) >= OBJECT_HEADER_LENGTH) &&
+			    (get_is_object_length_readable(&pool[offset], size - offset)))
+			{
+				objectSize = get_number_bytes_in_object(&pool[offset]);
+			}
+
+			if ((0 == objectSize) || (objectSize > (size - offset)))
+			{
+				retVal = false;
+				break;
+			}
+			objectOffsets.push_back(offset);
+			offset += objectSize;
+		}
+		return retVal;
+	}
+
+	std::uint32_t VirtualTerminalClient::get_object_pool_upload_size(const ObjectPoolDataStruct &objectPool)
+	{
+		std::uint32_t retVal = objectPool.objectPoolSize;
+
+		if ((objectPool.uploadingDelta) ||
+		    (!objectPool.scaledObjectPool.empty()))
+		{
+			retVal = static_cast<std::uint32_t>(objectPool.scaledObjectPool.size());
+		}
+		return retVal;
+	}
+
+	const std::uint8_t *VirtualTerminalClient::get_object_pool_upload_data(ObjectPoolDataStruct &objectPool)
+	{
+		const std::uint8_t *retVal = nullptr;
+
+		if (!objectPool.scaledObjectPool.empty())
+		{
+			retVal = objectPool.scaledObjectPool.data();
+		}
+		else if (objectPool.cachedScaledObjectPool.get_is_valid())
+		{
+			retVal = objectPool.cachedScaledObjectPool.get_data();
+		}
+		else if (nullptr != objectPool.objectPoolDataPointer)
+		{
+			retVal = objectPool.objectPoolDataPointer;
+		}
+		else if (objectPool.useDataCallback)
+		{
+			bool readSuccessful = true;
+
+			objectPool.scaledObjectPool.resize(objectPool.objectPoolSize);
+
+			for (std::uint32_t offset = 0, callbackIndex = 0; (offset < objectPool.objectPoolSize) && readSuccessful; offset += SCALING_CHUNK_SIZE, callbackIndex++)
+			{
+				std::uint32_t chunkSize = ((objectPool.objectPoolSize - offset) < SCALING_CHUNK_SIZE) ? (objectPool.objectPoolSize - offset) : SCALING_CHUNK_SIZE;
+				readSuccessful = objectPool.dataCallback(callbackIndex, offset, chunkSize, &objectPool.scaledObjectPool[offset], this);
+			}
+
+			if (readSuccessful)
+			{
+				retVal = objectPool.scaledObjectPool.data();
+			}
+			else
+			{
+				// Fall back to uploading through the callback
+				objectPool.scaledObjectPool.clear();
+			}
+		}
+		return retVal;
+	}
+
+	void VirtualTerminalClient::prepare_object_pool_delta()
+	{
+		bool indexComplete = true;
+
+		uploadedObjectHashes.clear();
+
+		if ((objectPoolDeltaDirectory.empty()) ||
+		    (objectPools.empty()) ||
+		    (objectPools[0].versionLabel.empty()))
+		{
+			// Delta uploads are disabled, so there is nothing to compare against later
+			deltaBaseVersionLabel.clear();
+			deltaBaseObjectHashes.clear();
+		}
+		else
+		{
+			for (std::size_t i = 0; i < objectPools.size(); i++)
+			{
+				auto &objectPool = objectPools[i];
+
+				if (((nullptr == objectPool.objectPoolDataPointer) && (nullptr == objectPool.dataCallback)) ||
+				    (0 == objectPool.objectPoolSize))
+				{
+					// The upload will skip this pool
+					continue;
+				}
+
+				const std::uint8_t *poolData = get_object_pool_upload_data(objectPool);
+				const std::uint32_t poolSize = get_object_pool_upload_size(objectPool);
+				std::vector<std::uint32_t> objectOffsets;
+
+				if ((nullptr == poolData) ||
+				    (!index_object_pool(poolData, poolSize, objectOffsets)))
+				{
+					CANStackLogger::warn("[VT]: Failed to index object pool " + isobus::to_string(static_cast<int>(i)) + ", it will be uploaded in full");
+					indexComplete = false;
+					continue;
+				}
+
+				std::vector<std::uint8_t> changedObjects;
+
+				for (std::size_t j = 0; j < objectOffsets.size(); j++)
+				{
+					const std::uint32_t offset = objectOffsets[j];
+					const std::uint32_t objectSize = (((j + 1) < objectOffsets.size()) ? objectOffsets[j + 1] : poolSize) - offset;
+					const std::uint16_t objectID = static_cast<std::uint16_t>(poolData[offset] | (poolData[offset + 1] << 8));
+					const std::uint64_t objectHash = ObjectPoolHasher::hash(&poolData[offset], objectSize);
+
+					uploadedObjectHashes[objectID] = objectHash;
+
+					if (!deltaBaseVersionLabel.empty())
+					{
+						auto baseObject = deltaBaseObjectHashes.find(objectID);
+
+						if ((deltaBaseObjectHashes.end() == baseObject) ||
+						    (baseObject->second != objectHash))
+						{
+							changedObjects.insert(changedObjects.end(), &poolData[offset], &poolData[offset] + objectSize);
+						}
+					}
+				}
+
+				if (!deltaBaseVersionLabel.empty())
+				{
+					CANStackLogger::info("[VT]: Uploading " + isobus::to_string(changedObjects.size()) + " of " + isobus::to_string(poolSize) + " bytes of object pool " + isobus::to_string(static_cast<int>(i)) + " as a delta");
+					objectPool.scaledObjectPool = std::move(changedObjects);
+					objectPool.uploadingDelta = true;
+				}
+			}
+
+			if (!indexComplete)
+			{
+				// A partial index would make a later delta upload miss objects
+				uploadedObjectHashes.clear();
+			}
+		}
+	}
+
+	std::string VirtualTerminalClient::get_object_pool_delta_index_path(const std::string &versionLabel) const
+	{
+		const std::uint64_t vtNAME = (nullptr != partnerControlFunction) ? partnerControlFunction->get_NAME().get_full_name() : 0;
+		std::string retVal = objectPoolDeltaDirectory;
+		char filename[24];
+
+		if ((!retVal.empty()) && ('/' != retVal.back()) && ('\\' != retVal.back()))
+		{
+			retVal += '/';
+		}
+
+		// Labels can hold characters that aren't allowed in file names, so they are written in hex
+		snprintf(filename, sizeof(filename), "%016llx_", static_cast<unsigned long long>(vtNAME));
+		retVal += filename;
+
+		for (char labelCharacter : versionLabel)
+		{
+			snprintf(filename, sizeof(filename), "%02x", static_cast<unsigned int>(static_cast<std::uint8_t>(labelCharacter)));
+			retVal += filename;
+		}
+		retVal += ".idx";
+		return retVal;
+	}
+
+	void VirtualTerminalClient::on_object_pool_version_stored()
+	{
+		if ((!objectPoolDeltaDirectory.empty()) &&
+		    (!uploadedObjectHashes.empty()) &&
+		    (!objectPools.empty()))
+		{
+			const std::string indexPath = get_object_pool_delta_index_path(get_padded_version_label(objectPools[0].versionLabel));
+			std::vector<std::uint8_t> objectIndex;
+
+			objectIndex.reserve(uploadedObjectHashes.size() * 10);
+
+			for (const auto &object : uploadedObjectHashes)
+			{
+				objectIndex.push_back(static_cast<std::uint8_t>(object.first & 0xFF));
+				objectIndex.push_back(static_cast<std::uint8_t>(object.first >> 8));
+
+				for (std::size_t i = 0; i < 8; i++)
+				{
+					objectIndex.push_back(static_cast<std::uint8_t>(object.second >> (8 * i)));
+				}
+			}
+
+			if (!IOPFileInterface::write_iop_file(indexPath, objectIndex.data(), static_cast<std::uint32_t>(objectIndex.size())))
+			{
+				CANStackLogger::warn("[VT]: Failed to write object pool index file " + indexPath);
+			}
+		}
+		uploadedObjectHashes.clear();
+
+		if ((!deltaBaseVersionLabel.empty()) &&
+		    (!objectPools.empty()) &&
+		    (get_padded_version_label(objectPools[0].versionLabel) != deltaBaseVersionLabel))
+		{
+			// The new version replaces the one it was based on
+			const std::array<std::uint8_t, 7> deleteBuffer = {
+				static_cast<std::uint8_t>(deltaBaseVersionLabel[0]),
+				static_cast<std::uint8_t>(deltaBaseVersionLabel[1]),
+				static_cast<std::uint8_t>(deltaBaseVersionLabel[2]),
+				static_cast<std::uint8_t>(deltaBaseVersionLabel[3]),
+				static_cast<std::uint8_t>(deltaBaseVersionLabel[4]),
+				static_cast<std::uint8_t>(deltaBaseVersionLabel[5]),
+				static_cast<std::uint8_t>(deltaBaseVersionLabel[6])
+			};
+
+			if (!send_delete_version(deleteBuffer))
+			{
+				CANStackLogger::warn("[VT]: Failed to send the delete version message for label " + deltaBaseVersionLabel);
+			}
+			std::remove(get_object_pool_delta_index_path(deltaBaseVersionLabel).c_str());
+		}
+		deltaBaseVersionLabel.clear();
+		deltaBaseObjectHashes.clear();
+	}
+
+	std::string VirtualTerminalClient::get_padded_version_label(const std::string &versionLabel)
+	{
+		constexpr std::size_t LABEL_LENGTH = 7;
+		std::string retVal(versionLabel);
+
+		// Unused characters are filled with spaces
+		retVal.resize(LABEL_LENGTH, ' ');
+		return retVal;
+	}
+
+	void VirtualTerminalClient::optimize_object_pools()
+	{
+		for (std::size_t i = 0; i < objectPools.size(); i++)
+		{
+			auto &objectPool = objectPools[i];
+
+			objectPool.pictureBytesSaved = 0;
+			objectPool.uploadingDelta = false;
+
+			if (!get_pool_needs_scaling(objectPool))
+			{
+				// Discard anything left over from preparing the pool for a previous connection
+				objectPool.scaledObjectPool.clear();
+				objectPool.cachedScaledObjectPool = MappedIOPFile();
+			}
+
+			if ((!objectPool.runLengthEncodePictures) &&
+			    (!objectPool.reducePictureColourDepth))
+			{
+				continue;
+			}
+
+			// Start from the scaled pool if there is one
+			const std::uint8_t *poolData = get_object_pool_upload_data(objectPool);
+			std::vector<std::uint8_t> optimizedPool;
+
+			if (nullptr == poolData)
+			{
+				CANStackLogger::warn("[VT]: Failed to read object pool " + isobus::to_string(static_cast<int>(i)) + " for picture optimization, it will be uploaded as-is");
+			}
+			else if (!optimize_object_pool(poolData, objectPool.objectPoolSize, objectPool.runLengthEncodePictures, objectPool.reducePictureColourDepth, supportedGraphicsMode, optimizedPool))
+			{
+				CANStackLogger::warn("[VT]: Failed to parse object pool " + isobus::to_string(static_cast<int>(i)) + " for picture optimization, it will be uploaded as-is");
+			}
+			else if (optimizedPool.size() < objectPool.objectPoolSize)
+			{
+				objectPool.pictureBytesSaved = objectPool.objectPoolSize - static_cast<std::uint32_t>(optimizedPool.size());
+				objectPool.scaledObjectPool = std::move(optimizedPool);
+				CANStackLogger::info("[VT]: Picture optimization saved " + isobus::to_string(objectPool.pictureBytesSaved) + " bytes in object pool " + isobus::to_string(static_cast<int>(i)));
+			}
+		}
+	}
+
+	bool VirtualTerminalClient::optimize_object_pool(const std::uint8_t *pool,
+	                                                 std::uint32_t size,
+	                                                 bool runLengthEncode,
+	                                                 bool reduceColourDepth,
+	                                                 GraphicMode graphicMode,
+	                                                 std::vector<std::uint8_t> &optimizedPool)
+	{
+		std::vector<std::uint32_t> objectOffsets;
+		bool retVal = index_object_pool(pool, size, objectOffsets);
+
+		optimizedPool.clear();
+
+		if (retVal)
+		{
+			for (auto offset : objectOffsets)
+			{
+				if (VirtualTerminalObjectType::ColourMap == static_cast<VirtualTerminalObjectType>(pool[offset + 2]))
+				{
+					// The colour map may not apply to every picture format in the same way
+					reduceColourDepth = false;
+					break;
+				}
+			}
+
+			optimizedPool.reserve(size);
+
+			for (std::size_t i = 0; i < objectOffsets.size(); i++)
+			{
+				const std::uint32_t offset = objectOffsets[i];
+				const std::uint32_t objectSize = (((i + 1) < objectOffsets.size()) ? objectOffsets[i + 1] : size) - offset;
+
+				if (VirtualTerminalObjectType::PictureGraphic == static_cast<VirtualTerminalObjectType>(pool[offset + 2]))
+				{
+					optimize_picture_graphic(&pool[offset], objectSize, runLengthEncode, reduceColourDepth, graphicMode, optimizedPool);
+				}
+				else
+				{
+					optimizedPool.insert(optimizedPool.end(), &pool[offset], &pool[offset] + objectSize);
+				}
+			}
+		}
+		return retVal;
+	}
+
+	void VirtualTerminalClient::optimize_picture_graphic(const std::uint8_t *object,
+	                                                     std::uint32_t objectSize,
+	                                                     bool runLengthEncode,
+	                                                     bool reduceColourDepth,
+	                                                     GraphicMode graphicMode,
+	                                                     std::vector<std::uint8_t> &optimizedPool)
+	{
+		constexpr std::uint32_t PICTURE_GRAPHIC_HEADER_LENGTH = 17;
+		constexpr std::uint8_t TRANSPARENT_OPTION = 0x01;
+		constexpr std::uint8_t RUN_LENGTH_ENCODED_OPTION = 0x04;
+		const std::uint32_t actualWidth = (static_cast<std::uint32_t>(object[5]) | (static_cast<std::uint32_t>(object[6]) << 8));
+		const std::uint32_t actualHeight = (static_cast<std::uint32_t>(object[7]) | (static_cast<std::uint32_t>(object[8]) << 8));
+		const std::uint32_t rawDataSize = (static_cast<std::uint32_t>(object[12]) |
+		                                   (static_cast<std::uint32_t>(object[13]) << 8) |
+		                                   (static_cast<std::uint32_t>(object[14]) << 16) |
+		                                   (static_cast<std::uint32_t>(object[15]) << 24));
+		const std::uint8_t *rawData = &object[PICTURE_GRAPHIC_HEADER_LENGTH];
+		std::uint32_t newDataSize = rawDataSize;
+		std::uint8_t format = object[9];
+		std::uint8_t options = object[10];
+		std::vector<std::uint8_t> reducedData;
+		std::vector<std::uint8_t> encodedData;
+
+		if (0 == (options & RUN_LENGTH_ENCODED_OPTION))
+		{
+			// Uncompressed 8 bit data has exactly one byte per pixel
+			if (reduceColourDepth &&
+			    (static_cast<std::uint8_t>(PictureGraphic::Format::EightBitColour) == format) &&
+			    (0 != rawDataSize) &&
+			    ((actualWidth * actualHeight) == rawDataSize))
+			{
+				std::uint8_t highestColour = *std::max_element(rawData, rawData + rawDataSize);
+				std::uint32_t bitsPerPixel = 8;
+
+				if ((0 != (options & TRANSPARENT_OPTION)) &&
+				    (object[11] > highestColour))
+				{
+					highestColour = object[11];
+				}
+
+				if (highestColour < 2)
+				{
+					format = static_cast<std::uint8_t>(PictureGraphic::Format::Monochrome);
+					bitsPerPixel = 1;
+				}
+				else if ((highestColour < 16) &&
+				         (GraphicMode::Monochrome != graphicMode))
+				{
+					format = static_cast<std::uint8_t>(PictureGraphic::Format::FourBitColour);
+					bitsPerPixel = 4;
+				}
+
+				if (bitsPerPixel < 8)
+				{
+					// Each row starts on a byte boundary, with the first pixel in the most significant bits
+					const std::uint32_t pixelsPerByte = 8 / bitsPerPixel;
+					const std::uint32_t bytesPerRow = (actualWidth + pixelsPerByte - 1) / pixelsPerByte;
+
+					reducedData.resize(bytesPerRow * actualHeight);
+
+					for (std::uint32_t row = 0; row < actualHeight; row++)
+					{
+						for (std::uint32_t column = 0; column < actualWidth; column++)
+						{
+							const std::uint32_t shift = 8 - bitsPerPixel - ((column % pixelsPerByte) * bitsPerPixel);
+							reducedData[(row * bytesPerRow) + (column / pixelsPerByte)] |= static_cast<std::uint8_t>(rawData[(row * actualWidth) + column] << shift);
+						}
+					}
+					rawData = reducedData.data();
+					newDataSize = static_cast<std::uint32_t>(reducedData.size());
+				}
+			}
+
+			if (runLengthEncode)
+			{
+				run_length_encode(rawData, newDataSize, encodedData);
+
+				if (encodedData.size() < newDataSize)
+				{
+					options |= RUN_LENGTH_ENCODED_OPTION;
+					rawData = encodedData.data();
+					newDataSize = static_cast<std::uint32_t>(encodedData.size());
+				}
+			}
+		}
+
+		optimizedPool.insert(optimizedPool.end(), object, object + PICTURE_GRAPHIC_HEADER_LENGTH);
+		std::uint8_t *header = &optimizedPool[optimizedPool.size() - PICTURE_GRAPHIC_HEADER_LENGTH];
+		header[9] = format;
+		header[10] = options;
+		header[12] = static_cast<std::uint8_t>(newDataSize & 0xFF);
+		header[13] = static_cast<std::uint8_t>((newDataSize >> 8) & 0xFF);
+		header[14] = static_cast<std::uint8_t>((newDataSize >> 16) & 0xFF);
+		header[15] = static_cast<std::uint8_t>((newDataSize >> 24) & 0xFF);
+		optimizedPool.insert(optimizedPool.end(), rawData, rawData + newDataSize);
+
+		// Macro references follow the raw data
+		optimizedPool.insert(optimizedPool.end(), object + PICTURE_GRAPHIC_HEADER_LENGTH + rawDataSize, object + objectSize);
+	}
+
+	void VirtualTerminalClient::run_length_encode(const std::uint8_t *data, std::uint32_t size, std::vector<std::uint8_t> &encodedData)
+	{
+		constexpr std::uint32_t MAXIMUM_RUN_LENGTH = 255;
+		std::uint32_t offset = 0;
+
+		encodedData.clear();
+
+		while (offset < size)
+		{
+			std::uint32_t runLength = 1;
+
+			while (((offset + runLength) < size) &&
+			       (runLength < MAXIMUM_RUN_LENGTH) &&
+			       (data[offset + runLength] == data[offset]))
+			{
+				runLength++;
+			}
+			encodedData.push_back(static_cast<std::uint8_t>(runLength));
+			encodedData.push_back(data[offset]);
+			offset += runLength;
+		}
+	}
+
+	bool VirtualTerminalClient::resize_objects(std::uint8_t *pool, const std::uint32_t *objectOffsets, std::size_t numberOfObjects, float dataMaskScaleFactor, float softKeyScaleFactor) const
+	{
+		bool retVal = true;
+
+		for (std::size_t i = 0; i < numberOfObjects; i++)
+		{
+			std::uint8_t *object = &pool[objectOffsets[i]];
+			auto type = static_cast<VirtualTerminalObjectType>(object[2]);
+
+			if (get_is_object_scalable(type) &&
+			    (!resize_object(object, (VirtualTerminalObjectType::Key == type) ? softKeyScaleFactor : dataMaskScaleFactor, type)))
+			{
+				CANStackLogger::error("[VT]: Failed to resize an object: " +
+				                      isobus::to_string(static_cast<int>(object[0]) | (static_cast<int>(object[1]) << 8)) +
+				                      " with type " +
+				                      isobus::to_string(static_cast<int>(type)));
+				retVal = false;
+			}
+		}
+		return retVal;
+	}
+
+	bool VirtualTerminalClient::get_is_object_scalable(VirtualTerminalObjectType type)
+	{
+		bool retVal = false;
+
+		switch (type)
+		{
+			case VirtualTerminalObjectType::WorkingSet:
+			{
+				retVal = false;
+			}
+			break;
+
+			case VirtualTerminalObjectType::DataMask:
+			case VirtualTerminalObjectType::AlarmMask:
+			case VirtualTerminalObjectType::Container:
+			case VirtualTerminalObjectType::Key:
+			case VirtualTerminalObjectType::Button:
+			case VirtualTerminalObjectType::InputBoolean:
+			case VirtualTerminalObjectType::InputString:
+			case VirtualTerminalObjectType::InputNumber:
+			case VirtualTerminalObjectType::InputList:
+			case VirtualTerminalObjectType::OutputString:
+			case VirtualTerminalObjectType::OutputNumber:
+			case VirtualTerminalObjectType::OutputList:
+			case VirtualTerminalObjectType::OutputLine:
+			case VirtualTerminalObjectType::OutputRectangle:
+			case VirtualTerminalObjectType::OutputEllipse:
+			case VirtualTerminalObjectType::OutputPolygon:
+			case VirtualTerminalObjectType::OutputMeter:
+			case VirtualTerminalObjectType::OutputLinearBarGraph:
+			case VirtualTerminalObjectType::OutputArchedBarGraph:
+			case VirtualTerminalObjectType::PictureGraphic:
+			case VirtualTerminalObjectType::AuxiliaryFunctionType1:
+			case VirtualTerminalObjectType::AuxiliaryInputType1:
+			case VirtualTerminalObjectType::AuxiliaryFunctionType2:
+			case VirtualTerminalObjectType::AuxiliaryInputType2:
+			case VirtualTerminalObjectType::FontAttributes:
+			{
+				retVal = true;
+			}
+			break;
+
+			default:
+			{
+				retVal = false;
+			}
+			break;
+		}
+		return retVal;
+	}
+
+	VirtualTerminalClient::FontSize VirtualTerminalClient::get_font_or_next_smallest_font(FontSize originalFont) const
+	{
+		FontSize retVal = originalFont;
+
+		while ((!get_font_size_supported(retVal)) && (FontSize::Size6x8 != retVal))
+		{
+			retVal = static_cast<FontSize>(static_cast<std::uint8_t>(originalFont) - 1);
+		}
+		return retVal;
+	}
+
+	VirtualTerminalClient::FontSize VirtualTerminalClient::remap_font_to_scale(FontSize originalFont, float scaleFactor)
+	{
+		static constexpr float SCALE_FACTOR_POSITIVE_FUDGE = 1.05f;
+		static constexpr float SCALE_FACTOR_NEGATIVE_FUDGE = 0.95f;
+		FontSize retVal = originalFont;
+
+		if (scaleFactor > SCALE_FACTOR_POSITIVE_FUDGE || scaleFactor < SCALE_FACTOR_NEGATIVE_FUDGE)
+		{
+			const std::unordered_map<FontSize, std::map<float, FontSize, std::greater<float>>> FONT_SCALING_MAPPER{
+				{ FontSize::Size6x8,
+				  { { 23.95f, FontSize::Size128x192 },
 				    { 21.30f, FontSize::Size128x128 },
 				    { 15.95f, FontSize::Size96x128 },
 				    { 11.95f, FontSize::Size64x96 },
@@ -3719,7 +4549,41 @@ namespace isobus
 		return retVal;
 	}
 
-	std::uint32_t VirtualTerminalClient::get_number_bytes_in_object(std::uint8_t *buffer)
+	bool VirtualTerminalClient::get_is_object_length_readable(const std::uint8_t *buffer, std::uint32_t bufferLength)
+	{
+		auto objectType = static_cast<VirtualTerminalObjectType>(buffer[2]);
+		std::uint32_t lengthNeeded = get_minimum_object_length(objectType);
+
+		if (lengthNeeded <= bufferLength)
+		{
+			switch (objectType)
+			{
+				case VirtualTerminalObjectType::InputString:
+				{
+					lengthNeeded += buffer[16];
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputString:
+				{
+					lengthNeeded += (static_cast<std::uint16_t>(buffer[14]) | (static_cast<std::uint16_t>(buffer[15]) << 8));
+				}
+				break;
+
+				case VirtualTerminalObjectType::InputAttributes:
+				{
+					lengthNeeded += buffer[4];
+				}
+				break;
+
+				default:
+					break;
+			}
+		}
+		return (lengthNeeded <= bufferLength);
+	}
+
+	std::uint32_t VirtualTerminalClient::get_number_bytes_in_object(const std::uint8_t *buffer)
 	{
 		auto currentObjectType = static_cast<VirtualTerminalObjectType>(buffer[2]);
 		std::uint32_t retVal = get_minimum_object_length(currentObjectType);
@@ -4020,7 +4884,7 @@ namespace isobus
 		buffer[6] = (height >> 8);
 	}
 
-	bool VirtualTerminalClient::resize_object(std::uint8_t *buffer, float scaleFactor, VirtualTerminalObjectType type)
+	bool VirtualTerminalClient::resize_object(std::uint8_t *buffer, float scaleFactor, VirtualTerminalObjectType type) const
 	{
 		bool retVal = false;
 
@@ -4289,6 +5153,11 @@ namespace isobus
 	}
 
 	bool VirtualTerminalClient::send_command(const std::vector<std::uint8_t> &data) const
+	{
+		return send_command(data.data(), static_cast<std::uint32_t>(data.size()));
+	}
+
+	bool VirtualTerminalClient::send_command(const std::uint8_t *data, std::uint32_t length) const
 	{
 		if (!get_is_connected())
 		{
@@ -4296,73 +5165,384 @@ namespace isobus
 			return false;
 		}
 
-		return CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
-		                                                      data.data(),
-		                                                      data.size(),
-		                                                      myControlFunction,
-		                                                      partnerControlFunction,
-		                                                      CANIdentifier::Priority5);
+		return network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::ECUtoVirtualTerminal),
+		                              data,
+		                              length,
+		                              myControlFunction,
+		                              partnerControlFunction,
+		                              CANIdentifier::Priority5);
 	}
 
-	bool VirtualTerminalClient::queue_command(const std::vector<std::uint8_t> &data, bool replace)
+	bool VirtualTerminalClient::queue_command(const std::vector<std::uint8_t> &data, CANIdentifier::CANPriority priority)
 	{
-		if (send_command(data))
+		if (data.empty())
 		{
-			return true;
+			return false;
 		}
 
-		if (!commandQueueEnabled)
+		std::uint64_t key = 0;
+		bool coalescable = get_command_coalescing_key(data.data(), static_cast<std::uint32_t>(data.size()), key);
+		QueuedCommand *pendingCommand = nullptr;
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		// Held while sending too, so a command sent right away can't overtake an older one the update thread is sending
+		const std::lock_guard<std::mutex> lock(commandQueueMutex);
+#endif
+
+		if (coalescable)
 		{
-			return false;
+			auto queuedCommand = queuedCommandsByKey.find(key);
+
+			if (queuedCommandsByKey.end() != queuedCommand)
+			{
+				pendingCommand = &commandQueue[queuedCommand->second.priority][queuedCommand->second.index];
+			}
 		}
 
-		if (replace && replace_command(data))
+		if (nullptr == pendingCommand)
 		{
-			return true;
+			// Sending right away while an older command for the same thing is still queued would let the old one overwrite it later
+			if (((!commandQueueEnabled) || get_command_window_available(data[0])) &&
+			    send_command(data))
+			{
+				on_command_sent(data[0]);
+				return true;
+			}
+
+			if (!commandQueueEnabled)
+			{
+				return false;
+			}
+
+			// Commands of the same priority are sent in the order they were queued
+			const std::uint8_t priorityLevel = static_cast<std::uint8_t>(priority) % NUMBER_OF_COMMAND_PRIORITIES;
+			std::vector<QueuedCommand> &priorityQueue = commandQueue[priorityLevel];
+
+			if (coalescable)
+			{
+				queuedCommandsByKey[key] = { priorityLevel, priorityQueue.size() };
+			}
+			priorityQueue.emplace_back();
+			pendingCommand = &priorityQueue.back();
+			pendingCommand->key = key;
+			pendingCommand->coalescable = coalescable;
 		}
 
-		commandQueue.emplace_back(data);
+		pendingCommand->length = static_cast<std::uint32_t>(data.size());
+		if (data.size() <= pendingCommand->inlineData.size())
+		{
+			std::copy(data.begin(), data.end(), pendingCommand->inlineData.begin());
+			pendingCommand->extendedData.clear();
+		}
+		else
+		{
+			pendingCommand->extendedData.assign(data.begin(), data.end());
+		}
 		return true;
 	}
 
-	bool VirtualTerminalClient::replace_command(const std::vector<std::uint8_t> &data)
+	bool VirtualTerminalClient::get_command_coalescing_key(const std::uint8_t *data, std::uint32_t length, std::uint64_t &key)
 	{
-		bool alreadyReplaced = false;
-		for (auto it = commandQueue.begin(); it != commandQueue.end();)
+		bool retVal = true;
+		std::uint16_t objectID = NULL_OBJECT_ID;
+		std::uint16_t subKey = 0xFFFF;
+
+		switch (static_cast<Function>(data[0]))
 		{
-			bool matchesFunctionCode = (it->at(0) == data[0]);
-			if (matchesFunctionCode)
+			// Only one of each of these can be in effect at a time, so the latest one wins
+			case Function::SelectActiveWorkingSet:
+			case Function::ESCCommand:
+			case Function::SelectInputObjectCommand:
+			case Function::ControlAudioSignalCommand:
+			case Function::SetAudioVolumeCommand:
+			case Function::SelectColourMapCommand:
 			{
-				if (!alreadyReplaced)
+			}
+			break;
+
+			case Function::HideShowObjectCommand:
+			case Function::EnableDisableObjectCommand:
+			case Function::ChangeSizeCommand:
+			case Function::ChangeBackgroundColourCommand:
+			case Function::ChangeNumericValueCommand:
+			case Function::ChangeEndPointCommand:
+			case Function::ChangeFontAttributesCommand:
+			case Function::ChangeLineAttributesCommand:
+			case Function::ChangeFillAttributesCommand:
+			case Function::ChangeActiveMaskCommand:
+			case Function::ChangePriorityCommand:
+			case Function::ChangeStringValueCommand:
+			case Function::ChangeObjectLabelCommand:
+			case Function::ChangePolygonScaleCommand:
+			{
+				retVal = (length >= 3);
+				if (retVal)
 				{
-					*it = data;
-					alreadyReplaced = true;
-					it++;
+					objectID = static_cast<std::uint16_t>(data[1] | (static_cast<std::uint16_t>(data[2]) << 8));
 				}
-				else
+			}
+			break;
+
+			case Function::ChangeSoftKeyMaskCommand:
+			case Function::LockUnlockMaskCommand:
+			{
+				retVal = (length >= 4);
+				if (retVal)
 				{
-					it = commandQueue.erase(it);
+					objectID = static_cast<std::uint16_t>(data[2] | (static_cast<std::uint16_t>(data[3]) << 8));
 				}
 			}
+			break;
+
+			case Function::ChangeAttributeCommand:
+			case Function::ChangeListItemCommand:
+			case Function::ChangePolygonPointCommand:
+			{
+				retVal = (length >= 4);
+				if (retVal)
+				{
+					objectID = static_cast<std::uint16_t>(data[1] | (static_cast<std::uint16_t>(data[2]) << 8));
+					subKey = data[3];
+				}
+			}
+			break;
+
+			case Function::ChangeChildPositionCommand:
+			{
+				retVal = (length >= 5);
+				if (retVal)
+				{
+					subKey = static_cast<std::uint16_t>(data[1] | (static_cast<std::uint16_t>(data[2]) << 8));
+					objectID = static_cast<std::uint16_t>(data[3] | (static_cast<std::uint16_t>(data[4]) << 8));
+				}
+			}
+			break;
+
+			default:
+			{
+				// Relative moves, macros, and graphics context drawing all depend on being sent every time
+				retVal = false;
+			}
+			break;
 		}
-		return alreadyReplaced;
+
+		key = ((static_cast<std::uint64_t>(data[0]) << 32) |
+		       (static_cast<std::uint64_t>(objectID) << 16) |
+		       static_cast<std::uint64_t>(subKey));
+		return retVal;
 	}
 
 	void VirtualTerminalClient::process_command_queue()
 	{
-		for (auto it = commandQueue.begin(); it != commandQueue.end();)
+		update_command_pacing();
+
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(commandQueueMutex);
+#endif
+		for (std::uint8_t priority = 0; priority < NUMBER_OF_COMMAND_PRIORITIES; priority++)
 		{
-			if (send_command(*it))
+			std::vector<QueuedCommand> &priorityQueue = commandQueue[priority];
+			std::size_t numberOfRemainingCommands = 0;
+
+			for (std::size_t i = 0; i < priorityQueue.size(); i++)
 			{
-				it = commandQueue.erase(it);
+				QueuedCommand &queuedCommand = priorityQueue[i];
+				const std::uint8_t *data = (queuedCommand.length <= queuedCommand.inlineData.size()) ? queuedCommand.inlineData.data() : queuedCommand.extendedData.data();
+				bool sent = false;
+
+				if (get_command_window_available(data[0]))
+				{
+					sent = send_command(data, queuedCommand.length);
+
+					if (sent)
+					{
+						on_command_sent(data[0]);
+					}
+				}
+
+				if (sent)
+				{
+					if (queuedCommand.coalescable)
+					{
+						queuedCommandsByKey.erase(queuedCommand.key);
+					}
+				}
+				else
+				{
+					if (numberOfRemainingCommands != i)
+					{
+						if (queuedCommand.coalescable)
+						{
+							queuedCommandsByKey[queuedCommand.key].index = numberOfRemainingCommands;
+						}
+						priorityQueue[numberOfRemainingCommands] = std::move(queuedCommand);
+					}
+					numberOfRemainingCommands++;
+				}
 			}
-			else
+			// Shrinking keeps the capacity, so later bursts reuse the same slots
+			priorityQueue.resize(numberOfRemainingCommands);
+		}
+	}
+
+	bool VirtualTerminalClient::get_command_expects_response(std::uint8_t functionCode)
+	{
+		// Every command from select active working set up to execute macro is answered with a response of the same function code
+		return ((functionCode >= static_cast<std::uint8_t>(Function::SelectActiveWorkingSet)) &&
+		        (functionCode <= static_cast<std::uint8_t>(Function::ExecuteMacroCommand)));
+	}
+
+	bool VirtualTerminalClient::get_command_window_available(std::uint8_t functionCode) const
+	{
+		bool retVal = true;
+
+		if (commandPacingEnabled && get_command_expects_response(functionCode))
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> lock(commandPacingMutex);
+#endif
+			retVal = (commandStatistics.commandsInFlight < commandStatistics.windowSize);
+		}
+		return retVal;
+	}
+
+	void VirtualTerminalClient::on_command_sent(std::uint8_t functionCode)
+	{
+		if (get_command_expects_response(functionCode))
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> lock(commandPacingMutex);
+#endif
+			if (commandStatistics.commandsInFlight >= inFlightCommands.size())
 			{
-				it++;
+				// Only possible with pacing disabled, so stop tracking the oldest command to make room
+				std::move(inFlightCommands.begin() + 1, inFlightCommands.end(), inFlightCommands.begin());
+				commandStatistics.commandsInFlight--;
+			}
+			inFlightCommands[commandStatistics.commandsInFlight] = { SystemTiming::get_timestamp_us(), functionCode };
+			commandStatistics.commandsInFlight++;
+			commandStatistics.commandsSent++;
+		}
+	}
+
+	void VirtualTerminalClient::on_command_response(std::uint8_t functionCode)
+	{
+		if (get_command_expects_response(functionCode))
+		{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+			const std::lock_guard<std::mutex> lock(commandPacingMutex);
+#endif
+			// The VT processes commands in the order they are received, so the response is for the oldest matching command
+			for (std::uint8_t i = 0; i < commandStatistics.commandsInFlight; i++)
+			{
+				if (inFlightCommands[i].functionCode == functionCode)
+				{
+					std::uint64_t roundTripTime_us = SystemTiming::get_time_elapsed_us(inFlightCommands[i].timestamp_us);
+					std::uint32_t roundTripTime = (roundTripTime_us > std::numeric_limits<std::uint32_t>::max()) ? std::numeric_limits<std::uint32_t>::max() : static_cast<std::uint32_t>(roundTripTime_us);
+
+					std::move(inFlightCommands.begin() + i + 1, inFlightCommands.begin() + commandStatistics.commandsInFlight, inFlightCommands.begin() + i);
+					commandStatistics.commandsInFlight--;
+
+					if (0 == commandStatistics.responsesReceived)
+					{
+						commandStatistics.smoothedRoundTripTime_us = roundTripTime;
+						commandStatistics.minimumRoundTripTime_us = roundTripTime;
+						commandStatistics.maximumRoundTripTime_us = roundTripTime;
+					}
+					else
+					{
+						// Same smoothing as TCP, each sample has 1/8 weight
+						std::int64_t difference = static_cast<std::int64_t>(roundTripTime) - static_cast<std::int64_t>(commandStatistics.smoothedRoundTripTime_us);
+						commandStatistics.smoothedRoundTripTime_us = static_cast<std::uint32_t>(static_cast<std::int64_t>(commandStatistics.smoothedRoundTripTime_us) + (difference / 8));
+
+						if (roundTripTime < commandStatistics.minimumRoundTripTime_us)
+						{
+							commandStatistics.minimumRoundTripTime_us = roundTripTime;
+						}
+						if (roundTripTime > commandStatistics.maximumRoundTripTime_us)
+						{
+							commandStatistics.maximumRoundTripTime_us = roundTripTime;
+						}
+					}
+					commandStatistics.responsesReceived++;
+
+					// Responses taking much longer than the fastest one mean commands are piling up inside the VT
+					if (roundTripTime <= ((2ull * commandStatistics.minimumRoundTripTime_us) + COMMAND_RTT_TOLERANCE_US))
+					{
+						fastResponsesSinceWindowIncrease++;
+
+						if (fastResponsesSinceWindowIncrease >= commandStatistics.windowSize)
+						{
+							fastResponsesSinceWindowIncrease = 0;
+
+							if (commandStatistics.windowSize < MAXIMUM_COMMAND_WINDOW)
+							{
+								commandStatistics.windowSize++;
+							}
+						}
+					}
+					else if (SystemTiming::time_expired_us(lastWindowDecreaseTimestamp_us, commandStatistics.smoothedRoundTripTime_us))
+					{
+						std::uint8_t halvedWindow = commandStatistics.windowSize / 2;
+						commandStatistics.windowSize = (halvedWindow > MINIMUM_COMMAND_WINDOW) ? halvedWindow : MINIMUM_COMMAND_WINDOW;
+						fastResponsesSinceWindowIncrease = 0;
+						lastWindowDecreaseTimestamp_us = SystemTiming::get_timestamp_us();
+					}
+					break;
+				}
 			}
 		}
 	}
 
+	void VirtualTerminalClient::update_command_pacing()
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(commandPacingMutex);
+#endif
+		bool timedOut = false;
+
+		while ((commandStatistics.commandsInFlight > 0) &&
+		       (SystemTiming::time_expired_us(inFlightCommands[0].timestamp_us, static_cast<std::uint64_t>(COMMAND_RESPONSE_TIMEOUT_MS) * 1000)))
+		{
+			std::move(inFlightCommands.begin() + 1, inFlightCommands.begin() + commandStatistics.commandsInFlight, inFlightCommands.begin());
+			commandStatistics.commandsInFlight--;
+			commandStatistics.responseTimeouts++;
+			timedOut = true;
+		}
+
+		if (timedOut)
+		{
+			std::uint8_t halvedWindow = commandStatistics.windowSize / 2;
+			commandStatistics.windowSize = (halvedWindow > MINIMUM_COMMAND_WINDOW) ? halvedWindow : MINIMUM_COMMAND_WINDOW;
+			fastResponsesSinceWindowIncrease = 0;
+			lastWindowDecreaseTimestamp_us = SystemTiming::get_timestamp_us();
+		}
+
+		if (SystemTiming::time_expired_ms(lastThroughputUpdateTimestamp_ms, COMMAND_THROUGHPUT_INTERVAL_MS))
+		{
+			std::uint32_t elapsed_ms = SystemTiming::get_time_elapsed_ms(lastThroughputUpdateTimestamp_ms);
+			commandStatistics.responsesPerSecond = static_cast<std::uint32_t>(((commandStatistics.responsesReceived - responsesAtLastThroughputUpdate) * 1000) / elapsed_ms);
+			responsesAtLastThroughputUpdate = commandStatistics.responsesReceived;
+			lastThroughputUpdateTimestamp_ms = SystemTiming::get_timestamp_ms();
+		}
+	}
+
+	void VirtualTerminalClient::reset_command_pacing(bool resetStatistics)
+	{
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		const std::lock_guard<std::mutex> lock(commandPacingMutex);
+#endif
+		if (resetStatistics)
+		{
+			commandStatistics = {};
+			responsesAtLastThroughputUpdate = 0;
+			lastThroughputUpdateTimestamp_ms = SystemTiming::get_timestamp_ms();
+		}
+		commandStatistics.commandsInFlight = 0;
+		commandStatistics.windowSize = INITIAL_COMMAND_WINDOW;
+		fastResponsesSinceWindowIncrease = 0;
+		lastWindowDecreaseTimestamp_us = 0;
+	}
+
 	void VirtualTerminalClient::worker_thread_function()
 	{
 #if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
@@ -0,0 +1,911 @@
+//================================================================================================
+/// @file isobus_virtual_terminal_object_pool_parser.cpp
+///
+/// @brief Builds a table of VT objects from a binary (IOP) object pool.
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#include "isobus/isobus/isobus_virtual_terminal_object_pool_parser.hpp"
+
+#include "isobus/isobus/can_stack_logger.hpp"
+#include "isobus/utility/to_string.hpp"
+
+#include <cstring>
+
+namespace isobus
+{
+	namespace
+	{
+		constexpr std::uint32_t OBJECT_HEADER_LENGTH = 3; ///< Every object starts with its ID and type
+		constexpr std::uint32_t NUMBER_OF_OBJECT_IDS = 65536; ///< The number of values an object ID can have
+
+		/// @brief A reference from one object to another, checked once the whole pool has been read
+		struct ObjectReference
+		{
+			std::uint32_t offset; ///< The offset of the object that holds the reference
+			std::uint16_t objectID; ///< The ID of the object that holds the reference
+			std::uint16_t referencedObjectID; ///< The ID of the object being referred to
+		};
+
+		/// @brief Reads the little endian fields of one object, without reading past the end of the pool.
+		/// Reads past the end return zero and mark the object as truncated.
+		class ObjectReader
+		{
+		public:
+			ObjectReader(const std::uint8_t *objectData,
+			             std::uint32_t remainingPoolSize,
+			             std::uint32_t objectOffset,
+			             std::uint16_t objectID,
+			             std::vector<ObjectReference> &references) :
+			  data(objectData),
+			  size(remainingPoolSize),
+			  offset(objectOffset),
+			  id(objectID),
+			  referenceList(references)
+			{
+			}
+
+			const std::uint8_t *read_bytes(std::uint32_t length)
+			{
+				const std::uint8_t *retVal = nullptr;
+
+				if ((size - position) >= length)
+				{
+					retVal = &data[position];
+					position += length;
+				}
+				else
+				{
+					position = size;
+					truncated = true;
+				}
+				return retVal;
+			}
+
+			void skip(std::uint32_t length)
+			{
+				read_bytes(length);
+			}
+
+			std::uint8_t read_uint8()
+			{
+				const std::uint8_t *field = read_bytes(1);
+				return (nullptr != field) ? field[0] : 0;
+			}
+
+			std::uint16_t read_uint16()
+			{
+				const std::uint8_t *field = read_bytes(2);
+				return (nullptr != field) ? static_cast<std::uint16_t>(static_cast<std::uint16_t>(field[0]) | (static_cast<std::uint16_t>(field[1]) << 8)) : 0;
+			}
+
+			std::int16_t read_int16()
+			{
+				return static_cast<std::int16_t>(read_uint16());
+			}
+
+			std::uint32_t read_uint32()
+			{
+				const std::uint8_t *field = read_bytes(4);
+				std::uint32_t retVal = 0;
+
+				if (nullptr != field)
+				{
+					retVal = static_cast<std::uint32_t>(field[0]) |
+					  (static_cast<std::uint32_t>(field[1]) << 8) |
+					  (static_cast<std::uint32_t>(field[2]) << 16) |
+					  (static_cast<std::uint32_t>(field[3]) << 24);
+				}
+				return retVal;
+			}
+
+			std::int32_t read_int32()
+			{
+				return static_cast<std::int32_t>(read_uint32());
+			}
+
+			float read_float()
+			{
+				std::uint32_t rawValue = read_uint32();
+				float retVal;
+				std::memcpy(&retVal, &rawValue, sizeof(retVal));
+				return retVal;
+			}
+
+			std::string read_string(std::uint32_t length)
+			{
+				const std::uint8_t *field = read_bytes(length);
+				return (nullptr != field) ? std::string(reinterpret_cast<const char *>(field), length) : std::string();
+			}
+
+			/// @brief Reads an object ID, and remembers it so it can be checked against the finished pool
+			std::uint16_t read_reference()
+			{
+				std::uint16_t retVal = read_uint16();
+
+				if ((NULL_OBJECT_ID != retVal) && (!truncated))
+				{
+					referenceList.push_back({ offset, id, retVal });
+				}
+				return retVal;
+			}
+
+			/// @brief Reads a list of children that each have an ID and a position
+			void read_children(VTObject &object, std::uint8_t numberOfChildren)
+			{
+				for (std::uint_fast8_t i = 0; (i < numberOfChildren) && (!truncated); i++)
+				{
+					std::uint16_t childID = read_reference();
+					std::int16_t childX = read_int16();
+					std::int16_t childY = read_int16();
+					object.add_child(childID, childX, childY);
+				}
+			}
+
+			/// @brief Reads a list of children that are only an ID, such as list items or soft keys
+			void read_child_ids(VTObject &object, std::uint8_t numberOfChildren)
+			{
+				for (std::uint_fast8_t i = 0; (i < numberOfChildren) && (!truncated); i++)
+				{
+					object.add_child(read_reference(), 0, 0);
+				}
+			}
+
+			/// @brief Skips a list of macro references, which are an event ID and a macro ID each
+			void skip_macros(std::uint8_t numberOfMacros)
+			{
+				skip(static_cast<std::uint32_t>(numberOfMacros) * 2);
+			}
+
+			std::uint32_t get_position() const
+			{
+				return position;
+			}
+
+			bool get_is_truncated() const
+			{
+				return truncated;
+			}
+
+		private:
+			const std::uint8_t *data; ///< The start of the object
+			std::uint32_t size; ///< The number of bytes from the start of the object to the end of the pool
+			std::uint32_t position = OBJECT_HEADER_LENGTH; ///< The offset of the next field to read
+			std::uint32_t offset; ///< The offset of the object in the pool
+			std::uint16_t id; ///< The ID of the object
+			std::vector<ObjectReference> &referenceList; ///< Where references to other objects are recorded
+			bool truncated = false; ///< Set if a read went past the end of the pool
+		};
+
+		/// @brief Creates an object in the table and reads its attributes from the pool
+		/// @param[in] type The type of the object
+		/// @param[in] objectID The ID of the object
+		/// @param[in] reader A reader positioned after the object's header
+		/// @param[in] objectPool The table to create the object in
+		/// @param[out] skipped Set if the object type has no VTObject class, and so was read but not stored
+		/// @returns false if the object type is unknown, so its length can't be determined
+		bool parse_object(VirtualTerminalObjectType type, std::uint16_t objectID, ObjectReader &reader, VTObjectTable &objectPool, bool &skipped)
+		{
+			bool retVal = true;
+			skipped = false;
+
+			switch (type)
+			{
+				case VirtualTerminalObjectType::WorkingSet:
+				{
+					auto object = objectPool.create_object<WorkingSet>(objectID);
+					object->set_background_color(reader.read_uint8());
+					object->set_selectable(0 != reader.read_uint8());
+					object->set_active_mask(reader.read_reference());
+					const std::uint8_t numberOfChildren = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					const std::uint8_t numberOfLanguages = reader.read_uint8();
+					reader.read_children(*object, numberOfChildren);
+					reader.skip_macros(numberOfMacros);
+					reader.skip(static_cast<std::uint32_t>(numberOfLanguages) * 2);
+				}
+				break;
+
+				case VirtualTerminalObjectType::DataMask:
+				{
+					auto object = objectPool.create_object<DataMask>(objectID);
+					object->set_background_color(reader.read_uint8());
+					object->set_soft_key_mask(reader.read_reference());
+					const std::uint8_t numberOfChildren = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					reader.read_children(*object, numberOfChildren);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::AlarmMask:
+				{
+					auto object = objectPool.create_object<AlarmMask>(objectID);
+					object->set_background_color(reader.read_uint8());
+					object->set_soft_key_mask(reader.read_reference());
+					object->set_mask_priority(static_cast<AlarmMask::Priority>(reader.read_uint8()));
+					object->set_signal_priority(static_cast<AlarmMask::AcousticSignal>(reader.read_uint8()));
+					const std::uint8_t numberOfChildren = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					reader.read_children(*object, numberOfChildren);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::Container:
+				{
+					auto object = objectPool.create_object<Container>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_hidden(0 != reader.read_uint8());
+					const std::uint8_t numberOfChildren = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					reader.read_children(*object, numberOfChildren);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::SoftKeyMask:
+				{
+					auto object = objectPool.create_object<SoftKeyMask>(objectID);
+					object->set_background_color(reader.read_uint8());
+					const std::uint8_t numberOfChildren = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					reader.read_child_ids(*object, numberOfChildren);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::Key:
+				{
+					auto object = objectPool.create_object<Key>(objectID);
+					object->set_background_color(reader.read_uint8());
+					object->set_key_code(reader.read_uint8());
+					const std::uint8_t numberOfChildren = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					reader.read_children(*object, numberOfChildren);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::Button:
+				{
+					auto object = objectPool.create_object<Button>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_background_color(reader.read_uint8());
+					object->set_border_colour(reader.read_uint8());
+					object->set_key_code(reader.read_uint8());
+					object->set_options(reader.read_uint8());
+					const std::uint8_t numberOfChildren = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					reader.read_children(*object, numberOfChildren);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::InputBoolean:
+				{
+					auto object = objectPool.create_object<InputBoolean>(objectID);
+					object->set_background_color(reader.read_uint8());
+					object->set_width(reader.read_uint16());
+					object->set_foreground_colour_object_id(reader.read_reference());
+					object->set_variable_reference(reader.read_reference());
+					object->set_value(reader.read_uint8());
+					object->set_enabled(0 != reader.read_uint8());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::InputString:
+				{
+					auto object = objectPool.create_object<InputString>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_background_color(reader.read_uint8());
+					object->set_font_attributes(reader.read_reference());
+					object->set_input_attributes(reader.read_reference());
+					object->set_options(reader.read_uint8());
+					object->set_variable_reference(reader.read_reference());
+					object->set_justification_bitfield(reader.read_uint8());
+					object->set_value(reader.read_string(reader.read_uint8()));
+					object->set_enabled(0 != reader.read_uint8());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::InputNumber:
+				{
+					auto object = objectPool.create_object<InputNumber>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_background_color(reader.read_uint8());
+					object->set_font_attributes(reader.read_reference());
+					object->set_options(reader.read_uint8());
+					object->set_variable_reference(reader.read_reference());
+					object->set_value(reader.read_uint32());
+					object->set_minimum_value(reader.read_uint32());
+					object->set_maximum_value(reader.read_uint32());
+					object->set_offset(reader.read_int32());
+					object->set_scale(reader.read_float());
+					object->set_number_of_decimals(reader.read_uint8());
+					object->set_format(0 != reader.read_uint8());
+					object->set_justification_bitfield(reader.read_uint8());
+					object->set_options2(reader.read_uint8());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::InputList:
+				{
+					auto object = objectPool.create_object<InputList>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_variable_reference(reader.read_reference());
+					object->set_value(reader.read_uint8());
+					const std::uint8_t numberOfListItems = reader.read_uint8();
+					object->set_options(reader.read_uint8());
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					object->set_number_of_list_items(numberOfListItems);
+					reader.read_child_ids(*object, numberOfListItems);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputString:
+				{
+					auto object = objectPool.create_object<OutputString>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_background_color(reader.read_uint8());
+					object->set_font_attributes(reader.read_reference());
+					object->set_options(reader.read_uint8());
+					object->set_variable_reference(reader.read_reference());
+					object->set_justification_bitfield(reader.read_uint8());
+					object->set_value(reader.read_string(reader.read_uint16()));
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputNumber:
+				{
+					auto object = objectPool.create_object<OutputNumber>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_background_color(reader.read_uint8());
+					object->set_font_attributes(reader.read_reference());
+					object->set_options(reader.read_uint8());
+					object->set_variable_reference(reader.read_reference());
+					object->set_value(reader.read_uint32());
+					object->set_offset(reader.read_int32());
+					object->set_scale(reader.read_float());
+					object->set_number_of_decimals(reader.read_uint8());
+					object->set_format(0 != reader.read_uint8());
+					object->set_justification_bitfield(reader.read_uint8());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputList:
+				{
+					auto object = objectPool.create_object<OutputList>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_variable_reference(reader.read_reference());
+					object->set_value(reader.read_uint8());
+					const std::uint8_t numberOfListItems = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					object->set_number_of_list_items(numberOfListItems);
+					reader.read_child_ids(*object, numberOfListItems);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputLine:
+				{
+					auto object = objectPool.create_object<OutputLine>(objectID);
+					object->set_line_attributes(reader.read_reference());
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_line_direction(static_cast<OutputLine::LineDirection>(reader.read_uint8()));
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputRectangle:
+				{
+					auto object = objectPool.create_object<OutputRectangle>(objectID);
+					object->set_line_attributes(reader.read_reference());
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_line_suppression_bitfield(reader.read_uint8());
+					object->set_fill_attributes(reader.read_reference());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputEllipse:
+				{
+					auto object = objectPool.create_object<OutputEllipse>(objectID);
+					object->set_line_attributes(reader.read_reference());
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_ellipse_type(static_cast<OutputEllipse::EllipseType>(reader.read_uint8()));
+					object->set_start_angle(reader.read_uint8());
+					object->set_end_angle(reader.read_uint8());
+					object->set_fill_attributes(reader.read_reference());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputPolygon:
+				{
+					auto object = objectPool.create_object<OutputPolygon>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_line_attributes(reader.read_reference());
+					object->set_fill_attributes(reader.read_reference());
+					object->set_type(static_cast<OutputPolygon::PolygonType>(reader.read_uint8()));
+					const std::uint8_t numberOfPoints = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+
+					for (std::uint_fast8_t i = 0; (i < numberOfPoints) && (!reader.get_is_truncated()); i++)
+					{
+						const std::uint16_t x = reader.read_uint16();
+						const std::uint16_t y = reader.read_uint16();
+						object->add_point(x, y);
+					}
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputMeter:
+				{
+					auto object = objectPool.create_object<OutputMeter>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_needle_colour(reader.read_uint8());
+					object->set_border_colour(reader.read_uint8());
+					object->set_arc_and_tick_colour(reader.read_uint8());
+					object->set_options(reader.read_uint8());
+					object->set_number_of_ticks(reader.read_uint8());
+					object->set_start_angle(reader.read_uint8());
+					object->set_end_angle(reader.read_uint8());
+					object->set_min_value(reader.read_uint16());
+					object->set_max_value(reader.read_uint16());
+					object->set_variable_reference(reader.read_reference());
+					object->set_value(reader.read_uint16());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputLinearBarGraph:
+				{
+					auto object = objectPool.create_object<OutputLinearBarGraph>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_colour(reader.read_uint8());
+					object->set_target_line_colour(reader.read_uint8());
+					object->set_options(reader.read_uint8());
+					object->set_number_of_ticks(reader.read_uint8());
+					object->set_min_value(reader.read_uint16());
+					object->set_max_value(reader.read_uint16());
+					object->set_variable_reference(reader.read_reference());
+					object->set_value(reader.read_uint16());
+					object->set_target_value_reference(reader.read_reference());
+					object->set_target_value(reader.read_uint16());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::OutputArchedBarGraph:
+				{
+					auto object = objectPool.create_object<OutputArchedBarGraph>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_height(reader.read_uint16());
+					object->set_colour(reader.read_uint8());
+					object->set_target_line_colour(reader.read_uint8());
+					object->set_options(reader.read_uint8());
+					object->set_start_angle(reader.read_uint8());
+					object->set_end_angle(reader.read_uint8());
+					object->set_bar_graph_width(reader.read_uint16());
+					object->set_min_value(reader.read_uint16());
+					object->set_max_value(reader.read_uint16());
+					object->set_variable_reference(reader.read_reference());
+					object->set_value(reader.read_uint16());
+					object->set_target_value_reference(reader.read_reference());
+					object->set_target_value(reader.read_uint16());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::PictureGraphic:
+				{
+					auto object = objectPool.create_object<PictureGraphic>(objectID);
+					object->set_width(reader.read_uint16());
+					object->set_actual_width(reader.read_uint16());
+					object->set_actual_height(reader.read_uint16());
+					object->set_format(static_cast<PictureGraphic::Format>(reader.read_uint8()));
+					object->set_options(reader.read_uint8());
+					object->set_transparency_colour(reader.read_uint8());
+					const std::uint32_t numberOfRawBytes = reader.read_uint32();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					const std::uint8_t *rawData = reader.read_bytes(numberOfRawBytes);
+
+					if (nullptr != rawData)
+					{
+						object->set_number_of_bytes_in_raw_data(numberOfRawBytes);
+						object->set_raw_data(rawData, numberOfRawBytes);
+					}
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::NumberVariable:
+				{
+					auto object = objectPool.create_object<NumberVariable>(objectID);
+					object->set_value(reader.read_uint32());
+				}
+				break;
+
+				case VirtualTerminalObjectType::StringVariable:
+				{
+					auto object = objectPool.create_object<StringVariable>(objectID);
+					object->set_value(reader.read_string(reader.read_uint16()));
+				}
+				break;
+
+				case VirtualTerminalObjectType::FontAttributes:
+				{
+					auto object = objectPool.create_object<FontAttributes>(objectID);
+					object->set_colour(reader.read_uint8());
+					object->set_size(static_cast<FontAttributes::FontSize>(reader.read_uint8()));
+					object->set_type(static_cast<FontAttributes::FontType>(reader.read_uint8()));
+					object->set_style(reader.read_uint8());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::LineAttributes:
+				{
+					auto object = objectPool.create_object<LineAttributes>(objectID);
+					object->set_background_color(reader.read_uint8());
+					object->set_width(reader.read_uint8());
+					object->set_line_art_bit_pattern(reader.read_uint16());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::FillAttributes:
+				{
+					auto object = objectPool.create_object<FillAttributes>(objectID);
+					object->set_type(static_cast<FillAttributes::FillType>(reader.read_uint8()));
+					object->set_background_color(reader.read_uint8());
+					object->set_fill_pattern(reader.read_reference());
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::InputAttributes:
+				{
+					auto object = objectPool.create_object<InputAttributes>(objectID);
+					object->set_validation_type(static_cast<InputAttributes::ValidationType>(reader.read_uint8()));
+					object->set_validation_string(reader.read_string(reader.read_uint8()));
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::ExtendedInputAttributes:
+				{
+					auto object = objectPool.create_object<ExtendedInputAttributes>(objectID);
+					object->set_validation_type(static_cast<ExtendedInputAttributes::ValidationType>(reader.read_uint8()));
+					const std::uint8_t numberOfCodePlanes = reader.read_uint8();
+					object->set_number_of_code_planes(numberOfCodePlanes);
+
+					// The character ranges have no storage in the object yet, so just step over them
+					for (std::uint_fast8_t i = 0; (i < numberOfCodePlanes) && (!reader.get_is_truncated()); i++)
+					{
+						reader.skip(1);
+						reader.skip(static_cast<std::uint32_t>(reader.read_uint8()) * 4);
+					}
+				}
+				break;
+
+				case VirtualTerminalObjectType::ObjectPointer:
+				{
+					auto object = objectPool.create_object<ObjectPointer>(objectID);
+					object->set_value(reader.read_reference());
+				}
+				break;
+
+				case VirtualTerminalObjectType::ExternalObjectPointer:
+				{
+					auto object = objectPool.create_object<ExternalObjectPointer>(objectID);
+					object->set_default_object_id(reader.read_reference());
+					object->set_external_reference_name_id(reader.read_reference());
+					object->set_external_object_id(reader.read_uint16()); // In the other working set's pool, so not checked
+				}
+				break;
+
+				case VirtualTerminalObjectType::Macro:
+				{
+					auto object = objectPool.create_object<Macro>(objectID);
+					const std::uint16_t numberOfBytes = reader.read_uint16();
+					const std::uint8_t *commands = reader.read_bytes(numberOfBytes);
+
+					if (nullptr != commands)
+					{
+						for (std::uint32_t i = 0; i < numberOfBytes; i += CAN_DATA_LENGTH)
+						{
+							std::array<std::uint8_t, CAN_DATA_LENGTH> command;
+							const std::uint32_t commandLength = ((numberOfBytes - i) < CAN_DATA_LENGTH) ? (numberOfBytes - i) : CAN_DATA_LENGTH;
+							command.fill(0xFF);
+							std::memcpy(command.data(), &commands[i], commandLength);
+							object->add_command_packet(command);
+						}
+					}
+				}
+				break;
+
+				case VirtualTerminalObjectType::ColourMap:
+				{
+					auto object = objectPool.create_object<ColourMap>(objectID);
+					const std::uint16_t numberOfIndexes = reader.read_uint16();
+					const std::uint8_t *indexes = reader.read_bytes(numberOfIndexes);
+
+					if ((nullptr != indexes) && (object->set_number_of_colour_indexes(numberOfIndexes)))
+					{
+						for (std::uint16_t i = 0; i < numberOfIndexes; i++)
+						{
+							object->set_colour_map_index(static_cast<std::uint8_t>(i), indexes[i]);
+						}
+					}
+				}
+				break;
+
+				case VirtualTerminalObjectType::WindowMask:
+				{
+					auto object = objectPool.create_object<WindowMask>(objectID);
+					object->set_width(reader.read_uint8());
+					object->set_height(reader.read_uint8());
+					object->set_window_type(static_cast<WindowMask::WindowType>(reader.read_uint8()));
+					object->set_background_color(reader.read_uint8());
+					object->set_options(reader.read_uint8());
+					object->set_name_object_id(reader.read_reference());
+					object->set_title_object_id(reader.read_reference());
+					object->set_icon_object_id(reader.read_reference());
+					const std::uint8_t numberOfObjectReferences = reader.read_uint8();
+					const std::uint8_t numberOfChildren = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					reader.read_child_ids(*object, numberOfObjectReferences);
+					reader.read_children(*object, numberOfChildren);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::KeyGroup:
+				{
+					auto object = objectPool.create_object<KeyGroup>(objectID);
+					object->set_options(reader.read_uint8());
+					object->set_name_object_id(reader.read_reference());
+					object->set_key_group_icon(reader.read_reference());
+					const std::uint8_t numberOfChildren = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					reader.read_child_ids(*object, numberOfChildren);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::GraphicsContext:
+				{
+					skipped = true;
+					reader.skip(31);
+				}
+				break;
+
+				case VirtualTerminalObjectType::Animation:
+				{
+					skipped = true;
+					reader.skip(12);
+					const std::uint8_t numberOfChildren = reader.read_uint8();
+					const std::uint8_t numberOfMacros = reader.read_uint8();
+					reader.skip(static_cast<std::uint32_t>(numberOfChildren) * 6);
+					reader.skip_macros(numberOfMacros);
+				}
+				break;
+
+				case VirtualTerminalObjectType::GraphicData:
+				{
+					skipped = true;
+					reader.skip(1);
+					reader.skip(reader.read_uint32());
+				}
+				break;
+
+				case VirtualTerminalObjectType::ScaledGraphic:
+				{
+					skipped = true;
+					reader.skip(6);
+					reader.skip_macros(reader.read_uint8());
+				}
+				break;
+
+				case VirtualTerminalObjectType::ObjectLabelRefrenceList:
+				{
+					skipped = true;
+					reader.skip(static_cast<std::uint32_t>(reader.read_uint16()) * 7);
+				}
+				break;
+
+				case VirtualTerminalObjectType::ExternalObjectDefinition:
+				{
+					skipped = true;
+					reader.skip(9);
+					reader.skip(static_cast<std::uint32_t>(reader.read_uint8()) * 2);
+				}
+				break;
+
+				case VirtualTerminalObjectType::ExternalReferenceNAME:
+				{
+					skipped = true;
+					reader.skip(9);
+				}
+				break;
+
+				case VirtualTerminalObjectType::AuxiliaryFunctionType1:
+				case VirtualTerminalObjectType::AuxiliaryFunctionType2:
+				case VirtualTerminalObjectType::AuxiliaryInputType2:
+				{
+					skipped = true;
+					reader.skip(2);
+					reader.skip(static_cast<std::uint32_t>(reader.read_uint8()) * 6);
+				}
+				break;
+
+				case VirtualTerminalObjectType::AuxiliaryInputType1:
+				{
+					skipped = true;
+					reader.skip(3);
+					reader.skip(static_cast<std::uint32_t>(reader.read_uint8()) * 6);
+				}
+				break;
+
+				case VirtualTerminalObjectType::AuxiliaryControlDesignatorType2:
+				{
+					skipped = true;
+					reader.skip(3);
+				}
+				break;
+
+				default:
+				{
+					retVal = false;
+				}
+				break;
+			}
+			return retVal;
+		}
+	} // namespace
+
+	VTObjectPoolParser::Result VTObjectPoolParser::parse(const std::uint8_t *binaryPool, std::uint32_t binaryPoolSizeBytes, VTObjectTable &objectPool)
+	{
+		Result retVal = { Error::None, NULL_OBJECT_ID, 0, 0, 0 };
+		std::vector<bool> usedObjectIDs(NUMBER_OF_OBJECT_IDS, false);
+		std::vector<ObjectReference> references;
+		std::vector<std::uint32_t> objectOffsets;
+		std::uint32_t offset = 0;
+
+		objectPool.clear();
+
+		if ((nullptr == binaryPool) && (0 != binaryPoolSizeBytes))
+		{
+			retVal.error = Error::TruncatedObject;
+		}
+
+		// First pass, create every object and note what they refer to
+		while ((Error::None == retVal.error) && (offset < binaryPoolSizeBytes))
+		{
+			retVal.offset = offset;
+			retVal.objectID = NULL_OBJECT_ID;
+
+			if ((binaryPoolSizeBytes - offset) < OBJECT_HEADER_LENGTH)
+			{
+				retVal.error = Error::TruncatedObject;
+				break;
+			}
+
+			const std::uint16_t objectID = static_cast<std::uint16_t>(static_cast<std::uint16_t>(binaryPool[offset]) | (static_cast<std::uint16_t>(binaryPool[offset + 1]) << 8));
+			const auto type = static_cast<VirtualTerminalObjectType>(binaryPool[offset + 2]);
+			retVal.objectID = objectID;
+
+			if ((NULL_OBJECT_ID == objectID) || (usedObjectIDs[objectID]))
+			{
+				retVal.error = Error::DuplicateObjectID;
+				break;
+			}
+
+			ObjectReader reader(&binaryPool[offset], binaryPoolSizeBytes - offset, offset, objectID, references);
+			bool skipped = false;
+
+			if (!parse_object(type, objectID, reader, objectPool, skipped))
+			{
+				retVal.error = Error::UnsupportedObjectType;
+			}
+			else if (reader.get_is_truncated())
+			{
+				retVal.error = Error::TruncatedObject;
+			}
+			else
+			{
+				usedObjectIDs[objectID] = true;
+
+				if (skipped)
+				{
+					retVal.numberOfSkippedObjects++;
+				}
+				else
+				{
+					objectOffsets.push_back(offset);
+					retVal.numberOfObjects++;
+				}
+				offset += reader.get_position();
+			}
+		}
+
+		// Second pass, now that every ID is known
+		if (Error::None == retVal.error)
+		{
+			for (const auto &reference : references)
+			{
+				if (!usedObjectIDs[reference.referencedObjectID])
+				{
+					retVal.error = Error::MissingObjectReference;
+					retVal.objectID = reference.objectID;
+					retVal.offset = reference.offset;
+					CANStackLogger::error("[VT]: Object " + isobus::to_string(static_cast<int>(reference.objectID)) + " refers to object " + isobus::to_string(static_cast<int>(reference.referencedObjectID)) + " which is not in the pool");
+					break;
+				}
+			}
+		}
+
+		if (Error::None == retVal.error)
+		{
+			std::size_t index = 0;
+
+			for (const auto &object : objectPool)
+			{
+				if (!object.second->get_is_valid(objectPool))
+				{
+					retVal.error = Error::InvalidObject;
+					retVal.objectID = object.first;
+					retVal.offset = (index < objectOffsets.size()) ? objectOffsets[index] : 0;
+					CANStackLogger::error("[VT]: Object " + isobus::to_string(static_cast<int>(object.first)) + " of type " + isobus::to_string(static_cast<int>(object.second->get_object_type())) + " failed validation");
+					break;
+				}
+				index++;
+			}
+		}
+
+		if (Error::None == retVal.error)
+		{
+			retVal.objectID = NULL_OBJECT_ID;
+			retVal.offset = 0;
+		}
+		else
+		{
+			if ((Error::MissingObjectReference != retVal.error) && (Error::InvalidObject != retVal.error))
+			{
+				CANStackLogger::error("[VT]: Failed to parse object pool at offset " + isobus::to_string(retVal.offset) + ", object " + isobus::to_string(static_cast<int>(retVal.objectID)) + ", error " + isobus::to_string(static_cast<int>(retVal.error)));
+			}
+			objectPool.clear();
+			retVal.numberOfObjects = 0;
+			retVal.numberOfSkippedObjects = 0;
+		}
+		return retVal;
+	}
+
+	VTObjectPoolParser::Result VTObjectPoolParser::parse(const std::vector<std::uint8_t> &binaryPool, VTObjectTable &objectPool)
+	{
+		return parse(binaryPool.data(), static_cast<std::uint32_t>(binaryPool.size()), objectPool);
+	}
+} // namespace isobus
@@ -193,19 +193,9 @@ namespace isobus
 		}
 	}
 
-	std::shared_ptr<VTObject> VTObject::get_object_by_id(std::uint16_t objectID, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool)
+	std::shared_ptr<VTObject> VTObject::get_object_by_id(std::uint16_t objectID, const VTObjectTable &objectPool)
 	{
-		std::shared_ptr<VTObject> retVal = nullptr;
-
-		if ((NULL_OBJECT_ID != objectID) && (objectPool.find(objectID) != objectPool.end()))
-		{
-			auto object = objectPool.at(objectID);
-			if (nullptr != object)
-			{
-				retVal = object;
-			}
-		}
-		return retVal;
+		return objectPool.get_object(objectID);
 	}
 
 	VTObject::ChildObjectData::ChildObjectData(std::uint16_t objectId,
@@ -217,6 +207,151 @@ namespace isobus
 	{
 	}
 
+	VTObjectTable::VTObjectTable() :
+	  arena(std::make_shared<Arena>())
+	{
+	}
+
+	VTObjectTable::VTObjectTable(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objects) :
+	  arena(std::make_shared<Arena>())
+	{
+		this->objects.reserve(objects.size());
+
+		for (const auto &object : objects)
+		{
+			insert(object.second);
+		}
+	}
+
+	bool VTObjectTable::insert(std::shared_ptr<VTObject> object)
+	{
+		bool retVal = false;
+
+		if ((nullptr != object) &&
+		    (NULL_OBJECT_ID != object->get_id()))
+		{
+			if (slotsByObjectID.empty())
+			{
+				slotsByObjectID.resize(NULL_OBJECT_ID, static_cast<std::uint16_t>(EMPTY_SLOT));
+			}
+
+			std::uint16_t &slot = slotsByObjectID[object->get_id()];
+
+			if (EMPTY_SLOT == slot)
+			{
+				slot = static_cast<std::uint16_t>(objects.size());
+				objects.emplace_back(object->get_id(), std::move(object));
+				retVal = true;
+			}
+		}
+		return retVal;
+	}
+
+	std::size_t VTObjectTable::erase(std::uint16_t objectID)
+	{
+		std::size_t retVal = 0;
+
+		if ((objectID < slotsByObjectID.size()) &&
+		    (EMPTY_SLOT != slotsByObjectID[objectID]))
+		{
+			std::uint16_t slot = slotsByObjectID[objectID];
+
+			// Keep the list dense by moving the last object into the removed object's slot
+			if (slot != (objects.size() - 1))
+			{
+				objects[slot] = std::move(objects.back());
+				slotsByObjectID[objects[slot].first] = slot;
+			}
+			objects.pop_back();
+			slotsByObjectID[objectID] = EMPTY_SLOT;
+			retVal = 1;
+		}
+		return retVal;
+	}
+
+	void VTObjectTable::clear()
+	{
+		slotsByObjectID.clear();
+		objects.clear();
+
+		// Objects still in use elsewhere keep the old arena alive
+		arena = std::make_shared<Arena>();
+	}
+
+	std::shared_ptr<VTObject> VTObjectTable::get_object(std::uint16_t objectID) const
+	{
+		std::shared_ptr<VTObject> retVal;
+
+		if ((objectID < slotsByObjectID.size()) &&
+		    (EMPTY_SLOT != slotsByObjectID[objectID]))
+		{
+			retVal = objects[slotsByObjectID[objectID]].second;
+		}
+		return retVal;
+	}
+
+	VTObjectTable::const_iterator VTObjectTable::find(std::uint16_t objectID) const
+	{
+		const_iterator retVal = objects.end();
+
+		if ((objectID < slotsByObjectID.size()) &&
+		    (EMPTY_SLOT != slotsByObjectID[objectID]))
+		{
+			retVal = objects.begin() + slotsByObjectID[objectID];
+		}
+		return retVal;
+	}
+
+	std::size_t VTObjectTable::count(std::uint16_t objectID) const
+	{
+		return ((objectID < slotsByObjectID.size()) && (EMPTY_SLOT != slotsByObjectID[objectID])) ? 1 : 0;
+	}
+
+	VTObjectTable::const_iterator VTObjectTable::begin() const
+	{
+		return objects.begin();
+	}
+
+	VTObjectTable::const_iterator VTObjectTable::end() const
+	{
+		return objects.end();
+	}
+
+	std::size_t VTObjectTable::size() const
+	{
+		return objects.size();
+	}
+
+	bool VTObjectTable::empty() const
+	{
+		return objects.empty();
+	}
+
+	void *VTObjectTable::Arena::allocate(std::size_t size, std::size_t alignment)
+	{
+		std::size_t alignedOffset = (blockUsed + alignment - 1) & ~(alignment - 1);
+		void *retVal;
+
+		if (size > (BLOCK_SIZE / 4))
+		{
+			// Large objects get their own block, so they don't waste the rest of the current one
+			std::unique_ptr<std::uint8_t[]> largeBlock(new std::uint8_t[size]);
+			retVal = largeBlock.get();
+			blocks.insert(blocks.begin(), std::move(largeBlock));
+		}
+		else
+		{
+			if ((alignedOffset + size) > BLOCK_SIZE)
+			{
+				blocks.emplace_back(new std::uint8_t[BLOCK_SIZE]);
+				alignedOffset = 0;
+			}
+			retVal = blocks.back().get() + alignedOffset;
+			blockUsed = alignedOffset + size;
+		}
+		return retVal;
+	}
+
 	VirtualTerminalObjectType WorkingSet::get_object_type() const
 	{
 		return VirtualTerminalObjectType::WorkingSet;
@@ -227,7 +362,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool WorkingSet::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool WorkingSet::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -269,7 +404,7 @@ namespace isobus
 		        (NULL_OBJECT_ID != objectID));
 	}
 
-	bool WorkingSet::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool WorkingSet::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -388,7 +523,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool DataMask::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool DataMask::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 		std::uint8_t numberOfSoftKeyMasks = 0;
@@ -455,7 +590,7 @@ namespace isobus
 		        (NULL_OBJECT_ID != objectID));
 	}
 
-	bool DataMask::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool DataMask::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -530,8 +665,9 @@ namespace isobus
 		return retVal;
 	}
 
-	bool DataMask::change_soft_key_mask(std::uint16_t newMaskID, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool)
+	bool DataMask::change_soft_key_mask(std::uint16_t newMaskID, const VTObjectTable &objectPool)
 	{
+		auto newMask = get_object_by_id(newMaskID, objectPool);
 		bool retVal = false;
 
 		if (NULL_OBJECT_ID == newMaskID)
@@ -539,9 +675,8 @@ namespace isobus
 			set_soft_key_mask(newMaskID);
 			retVal = true;
 		}
-		else if ((objectPool.end() != objectPool.find(newMaskID)) &&
-		         (nullptr != objectPool.at(newMaskID)) &&
-		         (VirtualTerminalObjectType::SoftKeyMask == objectPool.at(newMaskID)->get_object_type()))
+		else if ((nullptr != newMask) &&
+		         (VirtualTerminalObjectType::SoftKeyMask == newMask->get_object_type()))
 		{
 			set_soft_key_mask(newMaskID);
 			retVal = true;
@@ -569,7 +704,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool AlarmMask::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool AlarmMask::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -623,7 +758,7 @@ namespace isobus
 		        (NULL_OBJECT_ID != objectID));
 	}
 
-	bool AlarmMask::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool AlarmMask::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -760,8 +895,9 @@ namespace isobus
 		signalPriority = value;
 	}
 
-	bool AlarmMask::change_soft_key_mask(std::uint16_t newMaskID, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool)
+	bool AlarmMask::change_soft_key_mask(std::uint16_t newMaskID, const VTObjectTable &objectPool)
 	{
+		auto newMask = get_object_by_id(newMaskID, objectPool);
 		bool retVal = false;
 
 		if (NULL_OBJECT_ID == newMaskID)
@@ -769,8 +905,8 @@ namespace isobus
 			set_soft_key_mask(newMaskID);
 			retVal = true;
 		}
-		else if ((nullptr != objectPool.at(newMaskID)) &&
-		         (VirtualTerminalObjectType::SoftKeyMask == objectPool.at(newMaskID)->get_object_type()))
+		else if ((nullptr != newMask) &&
+		         (VirtualTerminalObjectType::SoftKeyMask == newMask->get_object_type()))
 		{
 			set_soft_key_mask(newMaskID);
 			retVal = true;
@@ -798,7 +934,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool Container::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool Container::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -852,7 +988,7 @@ namespace isobus
 		        (NULL_OBJECT_ID != objectID));
 	}
 
-	bool Container::set_attribute(std::uint8_t, std::uint32_t, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &, AttributeError &returnedError)
+	bool Container::set_attribute(std::uint8_t, std::uint32_t, const VTObjectTable &, AttributeError &returnedError)
 	{
 		// All attributes are read only
 		returnedError = AttributeError::InvalidAttributeID;
@@ -925,7 +1061,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool SoftKeyMask::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool SoftKeyMask::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -957,7 +1093,7 @@ namespace isobus
 		        (NULL_OBJECT_ID != objectID));
 	}
 
-	bool SoftKeyMask::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool SoftKeyMask::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -1028,7 +1164,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool Key::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool Key::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -1074,7 +1210,7 @@ namespace isobus
 		        (NULL_OBJECT_ID != objectID));
 	}
 
-	bool Key::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool Key::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -1169,7 +1305,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool KeyGroup::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool KeyGroup::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -1234,7 +1370,7 @@ namespace isobus
 		        (NULL_OBJECT_ID != objectID));
 	}
 
-	bool KeyGroup::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool KeyGroup::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -1253,10 +1389,9 @@ namespace isobus
 				{
 					returnedError = AttributeError::InvalidValue;
 
-					if (objectPool.find(objectID) != objectPool.end())
+					if (0 != objectPool.count(objectID))
 					{
 						auto newName = static_cast<std::uint16_t>(rawAttributeData);
-						auto newNameObject = objectPool.at(newName);
 
 						if (validate_name(newName, objectPool))
 						{
@@ -1366,9 +1501,9 @@ namespace isobus
 		}
 	}
 
-	bool KeyGroup::validate_name(std::uint16_t nameIDToValidate, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool KeyGroup::validate_name(std::uint16_t nameIDToValidate, const VTObjectTable &objectPool) const
 	{
-		auto newNameObject = objectPool.at(nameIDToValidate);
+		auto newNameObject = get_object_by_id(nameIDToValidate, objectPool);
 		bool retVal = false;
 
 		if ((NULL_OBJECT_ID != nameIDToValidate) &&
@@ -1380,7 +1515,7 @@ namespace isobus
 			{
 				if (newNameObject->get_number_children() > 0)
 				{
-					auto label = objectPool.at(std::static_pointer_cast<ObjectPointer>(newNameObject)->get_child_id(0));
+					auto label = get_object_by_id(newNameObject->get_child_id(0), objectPool);
 
 					if ((nullptr != label) &&
 					    (VirtualTerminalObjectType::OutputString == label->get_object_type()))
@@ -1407,7 +1542,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool Button::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool Button::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -1452,7 +1587,7 @@ namespace isobus
 		        (NULL_OBJECT_ID != objectID));
 	}
 
-	bool Button::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool Button::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -1635,7 +1770,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool InputBoolean::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool InputBoolean::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -1689,7 +1824,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool InputBoolean::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool InputBoolean::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -1720,10 +1855,12 @@ namespace isobus
 						set_foreground_colour_object_id(static_cast<std::uint16_t>(rawAttributeData));
 						retVal = true;
 					}
-					else if (objectPool.find(static_cast<std::uint16_t>(rawAttributeData)) != objectPool.end())
+					else if (0 != objectPool.count(static_cast<std::uint16_t>(rawAttributeData)))
 					{
-						if (nullptr != objectPool.at(static_cast<std::uint16_t>(rawAttributeData)) &&
-						    (VirtualTerminalObjectType::FontAttributes == objectPool.at(static_cast<std::uint16_t>(rawAttributeData))->get_object_type()))
+						auto referencedObject = get_object_by_id(static_cast<std::uint16_t>(rawAttributeData), objectPool);
+
+						if ((nullptr != referencedObject) &&
+						    (VirtualTerminalObjectType::FontAttributes == referencedObject->get_object_type()))
 						{
 							set_foreground_colour_object_id(static_cast<std::uint16_t>(rawAttributeData));
 							retVal = true;
@@ -1745,10 +1882,12 @@ namespace isobus
 						set_variable_reference(static_cast<std::uint16_t>(rawAttributeData));
 						retVal = true;
 					}
-					else if (objectPool.find(static_cast<std::uint16_t>(rawAttributeData)) != objectPool.end())
+					else if (0 != objectPool.count(static_cast<std::uint16_t>(rawAttributeData)))
 					{
-						if (nullptr != objectPool.at(static_cast<std::uint16_t>(rawAttributeData)) &&
-						    (VirtualTerminalObjectType::NumberVariable == objectPool.at(static_cast<std::uint16_t>(rawAttributeData))->get_object_type()))
+						auto referencedObject = get_object_by_id(static_cast<std::uint16_t>(rawAttributeData), objectPool);
+
+						if ((nullptr != referencedObject) &&
+						    (VirtualTerminalObjectType::NumberVariable == referencedObject->get_object_type()))
 						{
 							set_variable_reference(static_cast<std::uint16_t>(rawAttributeData));
 							retVal = true;
@@ -1907,7 +2046,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool InputString::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool InputString::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -1976,7 +2115,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool InputString::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool InputString::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -2279,7 +2418,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool InputNumber::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool InputNumber::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -2333,7 +2472,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool InputNumber::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool InputNumber::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -2761,7 +2900,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool InputList::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool InputList::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -2806,7 +2945,7 @@ namespace isobus
 		        (NULL_OBJECT_ID != objectID));
 	}
 
-	bool InputList::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool InputList::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -2966,7 +3105,7 @@ namespace isobus
 		value = inputValue;
 	}
 
-	bool InputList::change_list_item(std::uint8_t index, std::uint16_t newListItem, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool)
+	bool InputList::change_list_item(std::uint8_t index, std::uint16_t newListItem, const VTObjectTable &objectPool)
 	{
 		bool retVal = false;
 
@@ -3047,7 +3186,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool OutputString::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool OutputString::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -3101,7 +3240,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool OutputString::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool OutputString::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -3345,7 +3484,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool OutputNumber::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool OutputNumber::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -3399,7 +3538,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool OutputNumber::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool OutputNumber::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -3743,7 +3882,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool OutputList::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool OutputList::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -3814,7 +3953,7 @@ namespace isobus
 		        (NULL_OBJECT_ID != objectID));
 	}
 
-	bool OutputList::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool OutputList::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -3948,7 +4087,7 @@ namespace isobus
 		value = aValue;
 	}
 
-	bool OutputList::change_list_item(std::uint8_t index, std::uint16_t newListItem, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool)
+	bool OutputList::change_list_item(std::uint8_t index, std::uint16_t newListItem, const VTObjectTable &objectPool)
 	{
 		bool retVal = false;
 
@@ -3978,7 +4117,7 @@ namespace isobus
 		return VirtualTerminalObjectType::OutputLine;
 	}
 
-	bool OutputLine::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool OutputLine::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -4014,7 +4153,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool OutputLine::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool OutputLine::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -4170,7 +4309,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool OutputRectangle::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool OutputRectangle::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -4224,7 +4363,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool OutputRectangle::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool OutputRectangle::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -4403,7 +4542,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool OutputEllipse::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool OutputEllipse::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -4457,7 +4596,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool OutputEllipse::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool OutputEllipse::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -4691,7 +4830,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool OutputPolygon::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool OutputPolygon::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -4745,7 +4884,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool OutputPolygon::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool OutputPolygon::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -4952,7 +5091,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool OutputMeter::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool OutputMeter::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -4988,7 +5127,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool OutputMeter::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool OutputMeter::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -5346,7 +5485,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool OutputLinearBarGraph::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool OutputLinearBarGraph::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -5400,7 +5539,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool OutputLinearBarGraph::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool OutputLinearBarGraph::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -5748,7 +5887,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool OutputArchedBarGraph::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool OutputArchedBarGraph::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -5802,7 +5941,7 @@ namespace isobus
 		return (!anyWrongChildType);
 	}
 
-	bool OutputArchedBarGraph::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool OutputArchedBarGraph::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -6184,12 +6323,12 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool PictureGraphic::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &) const
+	bool PictureGraphic::get_is_valid(const VTObjectTable &) const
 	{
 		return true;
 	}
 
-	bool PictureGraphic::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool PictureGraphic::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -6306,13 +6445,7 @@ namespace isobus
 
 	void PictureGraphic::set_raw_data(const std::uint8_t *data, std::uint32_t size)
 	{
-		rawData.clear();
-		rawData.resize(size);
-
-		for (std::uint32_t i = 0; i < size; i++)
-		{
-			rawData[i] = data[i];
-		}
+		rawData.assign(data, data + size);
 	}
 
 	void PictureGraphic::add_raw_data(std::uint8_t dataByte)
@@ -6403,12 +6536,12 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool NumberVariable::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &) const
+	bool NumberVariable::get_is_valid(const VTObjectTable &) const
 	{
 		return true;
 	}
 
-	bool NumberVariable::set_attribute(std::uint8_t, std::uint32_t, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &, AttributeError &returnedError)
+	bool NumberVariable::set_attribute(std::uint8_t, std::uint32_t, const VTObjectTable &, AttributeError &returnedError)
 	{
 		returnedError = AttributeError::InvalidAttributeID;
 		return false;
@@ -6466,12 +6599,12 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool StringVariable::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &) const
+	bool StringVariable::get_is_valid(const VTObjectTable &) const
 	{
 		return true;
 	}
 
-	bool StringVariable::set_attribute(std::uint8_t, std::uint32_t, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &, AttributeError &returnedError)
+	bool StringVariable::set_attribute(std::uint8_t, std::uint32_t, const VTObjectTable &, AttributeError &returnedError)
 	{
 		returnedError = AttributeError::InvalidAttributeID;
 		return false;
@@ -6522,12 +6655,12 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool FontAttributes::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &) const
+	bool FontAttributes::get_is_valid(const VTObjectTable &) const
 	{
 		return true;
 	}
 
-	bool FontAttributes::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool FontAttributes::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -6851,12 +6984,12 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool LineAttributes::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool LineAttributes::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		return true;
 	}
 
-	bool LineAttributes::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool LineAttributes::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -6965,14 +7098,14 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool FillAttributes::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool FillAttributes::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		return ((NULL_OBJECT_ID == get_fill_pattern()) ||
 		        ((nullptr != get_object_by_id(get_fill_pattern(), objectPool)) &&
 		         (VirtualTerminalObjectType::PictureGraphic == get_object_by_id(get_fill_pattern(), objectPool)->get_object_type())));
 	}
 
-	bool FillAttributes::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool FillAttributes::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -7113,12 +7246,12 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool InputAttributes::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &) const
+	bool InputAttributes::get_is_valid(const VTObjectTable &) const
 	{
 		return true;
 	}
 
-	bool InputAttributes::set_attribute(std::uint8_t, std::uint32_t, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &, AttributeError &returnedError)
+	bool InputAttributes::set_attribute(std::uint8_t, std::uint32_t, const VTObjectTable &, AttributeError &returnedError)
 	{
 		returnedError = AttributeError::InvalidAttributeID;
 		return false;
@@ -7186,12 +7319,12 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool ExtendedInputAttributes::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &) const
+	bool ExtendedInputAttributes::get_is_valid(const VTObjectTable &) const
 	{
 		return true;
 	}
 
-	bool ExtendedInputAttributes::set_attribute(std::uint8_t, std::uint32_t, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &, AttributeError &returnedError)
+	bool ExtendedInputAttributes::set_attribute(std::uint8_t, std::uint32_t, const VTObjectTable &, AttributeError &returnedError)
 	{
 		returnedError = AttributeError::InvalidAttributeID;
 		return false;
@@ -7259,12 +7392,12 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool ObjectPointer::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool ObjectPointer::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		return ((NULL_OBJECT_ID == value) || (nullptr != get_object_by_id(value, objectPool)));
 	}
 
-	bool ObjectPointer::set_attribute(std::uint8_t, std::uint32_t, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &, AttributeError &returnedError)
+	bool ObjectPointer::set_attribute(std::uint8_t, std::uint32_t, const VTObjectTable &, AttributeError &returnedError)
 	{
 		returnedError = AttributeError::InvalidAttributeID;
 		return false;
@@ -7328,16 +7461,16 @@ namespace isobus
 		return 9;
 	}
 
-	bool ExternalObjectPointer::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool ExternalObjectPointer::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool isDefaultObjectValid = (NULL_OBJECT_ID == get_default_object_id()) ||
-		  (nullptr != objectPool.at(get_default_object_id()));
+		  (nullptr != get_object_by_id(get_default_object_id(), objectPool));
 		bool isExternalNAMEIDValid = (NULL_OBJECT_ID == get_external_reference_name_id()) ||
-		  (nullptr != objectPool.at(get_external_reference_name_id()));
+		  (nullptr != get_object_by_id(get_external_reference_name_id(), objectPool));
 		return (isDefaultObjectValid && isExternalNAMEIDValid);
 	}
 
-	bool ExternalObjectPointer::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool ExternalObjectPointer::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -7512,12 +7645,12 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool Macro::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &) const
+	bool Macro::get_is_valid(const VTObjectTable &) const
 	{
 		return get_are_command_packets_valid();
 	}
 
-	bool Macro::set_attribute(std::uint8_t, std::uint32_t, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &, AttributeError &returnedError)
+	bool Macro::set_attribute(std::uint8_t, std::uint32_t, const VTObjectTable &, AttributeError &returnedError)
 	{
 		returnedError = AttributeError::InvalidAttributeID;
 		return false;
@@ -7632,12 +7765,12 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool ColourMap::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &) const
+	bool ColourMap::get_is_valid(const VTObjectTable &) const
 	{
 		return true;
 	}
 
-	bool ColourMap::set_attribute(std::uint8_t, std::uint32_t, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &, AttributeError &returnedError)
+	bool ColourMap::set_attribute(std::uint8_t, std::uint32_t, const VTObjectTable &, AttributeError &returnedError)
 	{
 		returnedError = AttributeError::InvalidAttributeID;
 		return false;
@@ -7727,7 +7860,7 @@ namespace isobus
 		return MIN_OBJECT_LENGTH;
 	}
 
-	bool WindowMask::get_is_valid(const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool) const
+	bool WindowMask::get_is_valid(const VTObjectTable &objectPool) const
 	{
 		bool anyWrongChildType = false;
 
@@ -8084,7 +8217,7 @@ namespace isobus
 		return !anyWrongChildType;
 	}
 
-	bool WindowMask::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const std::map<std::uint16_t, std::shared_ptr<VTObject>> &objectPool, AttributeError &returnedError)
+	bool WindowMask::set_attribute(std::uint8_t attributeID, std::uint32_t rawAttributeData, const VTObjectTable &objectPool, AttributeError &returnedError)
 	{
 		bool retVal = false;
 
@@ -53,6 +53,11 @@ namespace isobus
 	{
 	}
 
+	FastPacketProtocol::FastPacketProtocol(CANNetworkManager &parentNetwork) :
+	  CANLibProtocol(parentNetwork)
+	{
+	}
+
 	void FastPacketProtocol::initialize(CANLibBadge<CANNetworkManager>)
 	{
 		if (!initialized)
@@ -64,7 +69,7 @@ namespace isobus
 	void FastPacketProtocol::register_multipacket_message_callback(std::uint32_t parameterGroupNumber, CANLibCallback callback, void *parent, std::shared_ptr<InternalControlFunction> internalControlFunction)
 	{
 		parameterGroupNumberCallbacks.push_back(ParameterGroupNumberCallbackData(parameterGroupNumber, callback, parent, internalControlFunction));
-		CANNetworkManager::CANNetwork.add_protocol_parameter_group_number_callback(parameterGroupNumber, process_message, this);
+		network.add_protocol_parameter_group_number_callback(parameterGroupNumber, process_message, this);
 	}
 
 	void FastPacketProtocol::remove_multipacket_message_callback(std::uint32_t parameterGroupNumber, CANLibCallback callback, void *parent, std::shared_ptr<InternalControlFunction> internalControlFunction)
@@ -75,7 +80,7 @@ namespace isobus
 		{
 			parameterGroupNumberCallbacks.erase(callbackLocation);
 		}
-		CANNetworkManager::CANNetwork.remove_protocol_parameter_group_number_callback(parameterGroupNumber, process_message, this);
+		network.remove_protocol_parameter_group_number_callback(parameterGroupNumber, process_message, this);
 	}
 
 	bool FastPacketProtocol::send_multipacket_message(std::uint32_t parameterGroupNumber,
@@ -304,6 +309,8 @@ namespace isobus
 							if (static_cast<std::uint32_t>((currentSession->processedPacketsThisSession * PROTOCOL_BYTES_PER_FRAME) - 1) >= currentSession->sessionMessage.get_data_length())
 							{
 								// Complete
+								currentSession->sessionMessage.set_completion_timestamp_us(message.get_timestamp_us());
+
 								// Find the appropriate callback and let them know
 								for (auto &callback : parameterGroupNumberCallbacks)
 								{
@@ -343,6 +350,7 @@ namespace isobus
 								currentSession->processedPacketsThisSession = 1;
 								currentSession->sessionMessage.set_data_size(messageData[1]);
 								currentSession->sessionMessage.set_identifier(message.get_identifier());
+								currentSession->sessionMessage.set_timestamp_us(message.get_timestamp_us());
 								currentSession->sessionMessage.set_source_control_function(message.get_source_control_function());
 								currentSession->sessionMessage.set_destination_control_function(message.get_destination_control_function());
 								currentSession->timestamp_ms = SystemTiming::get_timestamp_ms();
@@ -501,7 +509,7 @@ namespace isobus
 								}
 							}
 						}
-						if (CANNetworkManager::CANNetwork.send_can_message(session->sessionMessage.get_identifier().get_parameter_group_number(),
+						if (network.send_can_message(session->sessionMessage.get_identifier().get_parameter_group_number(),
 						                                                   dataBuffer.data(),
 						                                                   CAN_DATA_LENGTH,
 						                                                   std::static_pointer_cast<InternalControlFunction>(session->sessionMessage.get_source_control_function()),
@@ -37,6 +37,7 @@ namespace isobus
 	                                                   bool enableSendingPositionRapidUpdateCyclically,
 	                                                   bool enableSendingRateOfTurnCyclically,
 	                                                   bool enableSendingVesselHeadingCyclically) :
+	  network((nullptr != sendingControlFunction) ? sendingControlFunction->get_network() : CANNetworkManager::CANNetwork),
 	  txFlags(static_cast<std::uint32_t>(TransmitFlags::NumberOfFlags), process_flags, this),
 	  cogSogTransmitMessage(sendingControlFunction),
 	  datumTransmitMessage(sendingControlFunction),
@@ -316,13 +317,13 @@ namespace isobus
 	{
 		if (!initialized)
 		{
-			CANNetworkManager::CANNetwork.get_fast_packet_protocol().register_multipacket_message_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Datum), process_rx_message, this);
-			CANNetworkManager::CANNetwork.get_fast_packet_protocol().register_multipacket_message_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::GNSSPositionData), process_rx_message, this);
-			CANNetworkManager::CANNetwork.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::CourseOverGroundSpeedOverGroundRapidUpdate), process_rx_message, this);
-			CANNetworkManager::CANNetwork.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionDeltaHighPrecisionRapidUpdate), process_rx_message, this);
-			CANNetworkManager::CANNetwork.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionRapidUpdate), process_rx_message, this);
-			CANNetworkManager::CANNetwork.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RateOfTurn), process_rx_message, this);
-			CANNetworkManager::CANNetwork.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VesselHeading), process_rx_message, this);
+			network.get_fast_packet_protocol().register_multipacket_message_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Datum), process_rx_message, this);
+			network.get_fast_packet_protocol().register_multipacket_message_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::GNSSPositionData), process_rx_message, this);
+			network.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::CourseOverGroundSpeedOverGroundRapidUpdate), process_rx_message, this);
+			network.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionDeltaHighPrecisionRapidUpdate), process_rx_message, this);
+			network.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionRapidUpdate), process_rx_message, this);
+			network.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RateOfTurn), process_rx_message, this);
+			network.add_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VesselHeading), process_rx_message, this);
 			initialized = true;
 		}
 	}
@@ -336,13 +337,13 @@ namespace isobus
 	{
 		if (initialized)
 		{
-			CANNetworkManager::CANNetwork.get_fast_packet_protocol().remove_multipacket_message_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Datum), process_rx_message, this);
-			CANNetworkManager::CANNetwork.get_fast_packet_protocol().remove_multipacket_message_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::GNSSPositionData), process_rx_message, this);
-			CANNetworkManager::CANNetwork.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::CourseOverGroundSpeedOverGroundRapidUpdate), process_rx_message, this);
-			CANNetworkManager::CANNetwork.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionDeltaHighPrecisionRapidUpdate), process_rx_message, this);
-			CANNetworkManager::CANNetwork.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionRapidUpdate), process_rx_message, this);
-			CANNetworkManager::CANNetwork.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RateOfTurn), process_rx_message, this);
-			CANNetworkManager::CANNetwork.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VesselHeading), process_rx_message, this);
+			network.get_fast_packet_protocol().remove_multipacket_message_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Datum), process_rx_message, this);
+			network.get_fast_packet_protocol().remove_multipacket_message_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::GNSSPositionData), process_rx_message, this);
+			network.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::CourseOverGroundSpeedOverGroundRapidUpdate), process_rx_message, this);
+			network.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionDeltaHighPrecisionRapidUpdate), process_rx_message, this);
+			network.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionRapidUpdate), process_rx_message, this);
+			network.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RateOfTurn), process_rx_message, this);
+			network.remove_any_control_function_parameter_group_number_callback(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VesselHeading), process_rx_message, this);
 			initialized = false;
 		}
 	}
@@ -377,12 +378,12 @@ namespace isobus
 					if (nullptr != targetInterface->cogSogTransmitMessage.get_control_function())
 					{
 						targetInterface->cogSogTransmitMessage.serialize(messageBuffer);
-						transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::CourseOverGroundSpeedOverGroundRapidUpdate),
-						                                                                    messageBuffer.data(),
-						                                                                    messageBuffer.size(),
-						                                                                    std::static_pointer_cast<InternalControlFunction>(targetInterface->cogSogTransmitMessage.get_control_function()),
-						                                                                    nullptr,
-						                                                                    CANIdentifier::Priority2);
+						transmitSuccessful = targetInterface->network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::CourseOverGroundSpeedOverGroundRapidUpdate),
+						                                                             messageBuffer.data(),
+						                                                             messageBuffer.size(),
+						                                                             std::static_pointer_cast<InternalControlFunction>(targetInterface->cogSogTransmitMessage.get_control_function()),
+						                                                             nullptr,
+						                                                             CANIdentifier::Priority2);
 					}
 				}
 				break;
@@ -392,12 +393,12 @@ namespace isobus
 					if (nullptr != targetInterface->datumTransmitMessage.get_control_function())
 					{
 						targetInterface->datumTransmitMessage.serialize(messageBuffer);
-						transmitSuccessful = CANNetworkManager::CANNetwork.get_fast_packet_protocol().send_multipacket_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Datum),
-						                                                                                                       messageBuffer.data(),
-						                                                                                                       messageBuffer.size(),
-						                                                                                                       std::static_pointer_cast<InternalControlFunction>(targetInterface->datumTransmitMessage.get_control_function()),
-						                                                                                                       nullptr,
-						                                                                                                       CANIdentifier::PriorityDefault6);
+						transmitSuccessful = targetInterface->network.get_fast_packet_protocol().send_multipacket_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::Datum),
+						                                                                                                messageBuffer.data(),
+						                                                                                                messageBuffer.size(),
+						                                                                                                std::static_pointer_cast<InternalControlFunction>(targetInterface->datumTransmitMessage.get_control_function()),
+						                                                                                                nullptr,
+						                                                                                                CANIdentifier::PriorityDefault6);
 					}
 				}
 				break;
@@ -407,12 +408,12 @@ namespace isobus
 					if (nullptr != targetInterface->gnssPositionDataTransmitMessage.get_control_function())
 					{
 						targetInterface->gnssPositionDataTransmitMessage.serialize(messageBuffer);
-						transmitSuccessful = CANNetworkManager::CANNetwork.get_fast_packet_protocol().send_multipacket_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::GNSSPositionData),
-						                                                                                                       messageBuffer.data(),
-						                                                                                                       messageBuffer.size(),
-						                                                                                                       std::static_pointer_cast<InternalControlFunction>(targetInterface->gnssPositionDataTransmitMessage.get_control_function()),
-						                                                                                                       nullptr,
-						                                                                                                       CANIdentifier::Priority3);
+						transmitSuccessful = targetInterface->network.get_fast_packet_protocol().send_multipacket_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::GNSSPositionData),
+						                                                                                                messageBuffer.data(),
+						                                                                                                messageBuffer.size(),
+						                                                                                                std::static_pointer_cast<InternalControlFunction>(targetInterface->gnssPositionDataTransmitMessage.get_control_function()),
+						                                                                                                nullptr,
+						                                                                                                CANIdentifier::Priority3);
 					}
 				}
 				break;
@@ -422,12 +423,12 @@ namespace isobus
 					if (nullptr != targetInterface->positionDeltaHighPrecisionRapidUpdateTransmitMessage.get_control_function())
 					{
 						targetInterface->positionDeltaHighPrecisionRapidUpdateTransmitMessage.serialize(messageBuffer);
-						transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionDeltaHighPrecisionRapidUpdate),
-						                                                                    messageBuffer.data(),
-						                                                                    messageBuffer.size(),
-						                                                                    std::static_pointer_cast<InternalControlFunction>(targetInterface->positionDeltaHighPrecisionRapidUpdateTransmitMessage.get_control_function()),
-						                                                                    nullptr,
-						                                                                    CANIdentifier::Priority2);
+						transmitSuccessful = targetInterface->network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionDeltaHighPrecisionRapidUpdate),
+						                                                             messageBuffer.data(),
+						                                                             messageBuffer.size(),
+						                                                             std::static_pointer_cast<InternalControlFunction>(targetInterface->positionDeltaHighPrecisionRapidUpdateTransmitMessage.get_control_function()),
+						                                                             nullptr,
+						                                                             CANIdentifier::Priority2);
 					}
 				}
 				break;
@@ -437,12 +438,12 @@ namespace isobus
 					if (nullptr != targetInterface->positionRapidUpdateTransmitMessage.get_control_function())
 					{
 						targetInterface->positionRapidUpdateTransmitMessage.serialize(messageBuffer);
-						transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionRapidUpdate),
-						                                                                    messageBuffer.data(),
-						                                                                    messageBuffer.size(),
-						                                                                    std::static_pointer_cast<InternalControlFunction>(targetInterface->positionRapidUpdateTransmitMessage.get_control_function()),
-						                                                                    nullptr,
-						                                                                    CANIdentifier::Priority2);
+						transmitSuccessful = targetInterface->network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::PositionRapidUpdate),
+						                                                             messageBuffer.data(),
+						                                                             messageBuffer.size(),
+						                                                             std::static_pointer_cast<InternalControlFunction>(targetInterface->positionRapidUpdateTransmitMessage.get_control_function()),
+						                                                             nullptr,
+						                                                             CANIdentifier::Priority2);
 					}
 				}
 				break;
@@ -452,12 +453,12 @@ namespace isobus
 					if (nullptr != targetInterface->rateOfTurnTransmitMessage.get_control_function())
 					{
 						targetInterface->rateOfTurnTransmitMessage.serialize(messageBuffer);
-						transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RateOfTurn),
-						                                                                    messageBuffer.data(),
-						                                                                    messageBuffer.size(),
-						                                                                    std::static_pointer_cast<InternalControlFunction>(targetInterface->rateOfTurnTransmitMessage.get_control_function()),
-						                                                                    nullptr,
-						                                                                    CANIdentifier::Priority2);
+						transmitSuccessful = targetInterface->network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::RateOfTurn),
+						                                                             messageBuffer.data(),
+						                                                             messageBuffer.size(),
+						                                                             std::static_pointer_cast<InternalControlFunction>(targetInterface->rateOfTurnTransmitMessage.get_control_function()),
+						                                                             nullptr,
+						                                                             CANIdentifier::Priority2);
 					}
 				}
 				break;
@@ -467,12 +468,12 @@ namespace isobus
 					if (nullptr != targetInterface->vesselHeadingTransmitMessage.get_control_function())
 					{
 						targetInterface->vesselHeadingTransmitMessage.serialize(messageBuffer);
-						transmitSuccessful = CANNetworkManager::CANNetwork.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VesselHeading),
-						                                                                    messageBuffer.data(),
-						                                                                    messageBuffer.size(),
-						                                                                    std::static_pointer_cast<InternalControlFunction>(targetInterface->vesselHeadingTransmitMessage.get_control_function()),
-						                                                                    nullptr,
-						                                                                    CANIdentifier::Priority2);
+						transmitSuccessful = targetInterface->network.send_can_message(static_cast<std::uint32_t>(CANLibParameterGroupNumber::VesselHeading),
+						                                                             messageBuffer.data(),
+						                                                             messageBuffer.size(),
+						                                                             std::static_pointer_cast<InternalControlFunction>(targetInterface->vesselHeadingTransmitMessage.get_control_function()),
+						                                                             nullptr,
+						                                                             CANIdentifier::Priority2);
 					}
 				}
 				break;
@@ -343,3 +343,287 @@ TEST(CORE_TESTS, SimilarControlFunctions)
 	EXPECT_EQ(TestPartner->get_NAME().get_full_name(), 0xa0000F000425e9f8);
 	EXPECT_TRUE(TestPartner->destroy());
 }
+
+static std::uint64_t lastReceivedTimestamp_us = 0;
+static std::uint64_t lastReceivedCompletionTimestamp_us = 0;
+static void test_timestamp_callback(const CANMessage &message, void *)
+{
+	lastReceivedTimestamp_us = message.get_timestamp_us();
+	lastReceivedCompletionTimestamp_us = message.get_completion_timestamp_us();
+}
+
+TEST(CORE_TESTS, ReceiveTimestamps)
+{
+	CANMessageFrame testFrame;
+	testFrame.channel = 0;
+	testFrame.isExtendedFrame = true;
+	testFrame.timestamp_us = 0;
+	CANNetworkManager::CANNetwork.update();
+	CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(0xFEEC, test_timestamp_callback, nullptr);
+
+	// Force claim some other ECU
+	testFrame.dataLength = 8;
+	testFrame.identifier = 0x18EEFFF7;
+	testFrame.data[0] = 0x03;
+	testFrame.data[1] = 0x04;
+	testFrame.data[2] = 0x00;
+	testFrame.data[3] = 0x12;
+	testFrame.data[4] = 0x00;
+	testFrame.data[5] = 0x8A;
+	testFrame.data[6] = 0x00;
+	testFrame.data[7] = 0xA0;
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+
+	// Single frame messages have the same first and last frame timestamps
+	testFrame.identifier = 0x18FEECF7;
+	testFrame.timestamp_us = 1000;
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_EQ(1000u, lastReceivedTimestamp_us);
+	EXPECT_EQ(1000u, lastReceivedCompletionTimestamp_us);
+
+	// A BAM session should report the BAM frame and last data frame timestamps
+	testFrame.identifier = 0x18ECFFF7; // TP Command broadcast
+	testFrame.data[0] = 0x20; // BAM Mux
+	testFrame.data[1] = 9; // Data Length
+	testFrame.data[2] = 0; // Data Length MSB
+	testFrame.data[3] = 2; // Packet count
+	testFrame.data[4] = 0xFF; // Reserved
+	testFrame.data[5] = 0xEC; // PGN LSB
+	testFrame.data[6] = 0xFE; // PGN middle byte
+	testFrame.data[7] = 0x00; // PGN MSB
+	testFrame.timestamp_us = 2000;
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+
+	testFrame.identifier = 0x18EBFFF7;
+	testFrame.data[0] = 1;
+	testFrame.timestamp_us = 3000;
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+
+	testFrame.data[0] = 2;
+	testFrame.timestamp_us = 4000;
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+
+	EXPECT_EQ(2000u, lastReceivedTimestamp_us);
+	EXPECT_EQ(4000u, lastReceivedCompletionTimestamp_us);
+	CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(0xFEEC, test_timestamp_callback, nullptr);
+}
+
+static std::shared_ptr<ControlFunction> lastReceivedSource = nullptr;
+static ControlFunction *lastReceivedSourcePointer = nullptr;
+static std::uint32_t receivedMessageCount = 0;
+static void test_source_callback(const CANMessage &message, void *)
+{
+	lastReceivedSource = message.get_source_control_function();
+	lastReceivedSourcePointer = message.get_source_control_function_pointer();
+	receivedMessageCount++;
+}
+
+TEST(CORE_TESTS, ControlFunctionHandles)
+{
+	ControlFunctionHandle emptyHandle;
+	EXPECT_FALSE(emptyHandle.get_is_valid());
+	EXPECT_EQ(nullptr, emptyHandle.get());
+	EXPECT_EQ(nullptr, emptyHandle.lock());
+
+	std::shared_ptr<ControlFunction> tableEntry = ControlFunction::create(NAME(0x123), 0x10, 0);
+	std::uint32_t tableEntryGeneration = 5;
+	ControlFunctionHandle handle(tableEntry, tableEntryGeneration);
+	EXPECT_TRUE(handle.get_is_valid());
+	EXPECT_EQ(tableEntry.get(), handle.get());
+	EXPECT_EQ(tableEntry, handle.lock());
+
+	tableEntryGeneration++;
+	EXPECT_FALSE(handle.get_is_valid());
+	EXPECT_EQ(nullptr, handle.lock());
+}
+
+TEST(CORE_TESTS, ReceivedMessageSources)
+{
+	CANMessageFrame testFrame;
+	testFrame.channel = 0;
+	testFrame.isExtendedFrame = true;
+	testFrame.timestamp_us = 0;
+	testFrame.dataLength = 8;
+	CANNetworkManager::CANNetwork.update();
+	CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(0xFEEB, test_source_callback, nullptr);
+
+	auto send_address_claim = [&testFrame](std::uint8_t address, std::uint64_t claimedNAME) {
+		testFrame.identifier = 0x18EEFF00 | address;
+		for (std::uint8_t i = 0; i < 8; i++)
+		{
+			testFrame.data[i] = static_cast<std::uint8_t>(claimedNAME >> (8 * i));
+		}
+		CANNetworkManager::process_receive_can_message_frame(testFrame);
+	};
+	auto send_test_message = [&testFrame](std::uint8_t address) {
+		testFrame.identifier = 0x18FEEB00 | address;
+		CANNetworkManager::process_receive_can_message_frame(testFrame);
+	};
+
+	constexpr std::uint64_t FIRST_NAME = 0xA00E840000000001;
+	constexpr std::uint64_t SECOND_NAME = 0xA00E840000000002;
+
+	send_address_claim(0xF5, FIRST_NAME);
+	send_test_message(0xF5);
+	CANNetworkManager::CANNetwork.update();
+	ASSERT_NE(nullptr, lastReceivedSource);
+	EXPECT_EQ(FIRST_NAME, lastReceivedSource->get_NAME().get_full_name());
+	EXPECT_EQ(lastReceivedSource.get(), lastReceivedSourcePointer);
+	std::shared_ptr<ControlFunction> firstControlFunction = lastReceivedSource;
+
+	// Re-claiming at a new address moves the same control function
+	send_address_claim(0xF4, FIRST_NAME);
+	send_test_message(0xF4);
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_EQ(firstControlFunction, lastReceivedSource);
+	EXPECT_EQ(0xF4, firstControlFunction->get_address());
+
+	// A message queued before its sender's address was taken no longer has a source
+	receivedMessageCount = 0;
+	send_test_message(0xF4);
+	send_address_claim(0xF4, SECOND_NAME);
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_EQ(0u, receivedMessageCount);
+
+	send_test_message(0xF4);
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_EQ(1u, receivedMessageCount);
+	ASSERT_NE(nullptr, lastReceivedSource);
+	EXPECT_EQ(SECOND_NAME, lastReceivedSource->get_NAME().get_full_name());
+	EXPECT_EQ(lastReceivedSource.get(), lastReceivedSourcePointer);
+
+	std::shared_ptr<ControlFunction> secondControlFunction = lastReceivedSource;
+
+	// A control function that went offline is found again by its NAME when it claims a new address
+	ManualClock clock(1000000);
+	SystemTiming::set_clock(&clock);
+	testFrame.identifier = 0x18EAFFF0;
+	testFrame.dataLength = 3;
+	testFrame.data[0] = 0x00;
+	testFrame.data[1] = 0xEE;
+	testFrame.data[2] = 0x00;
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+	testFrame.dataLength = 8;
+	CANNetworkManager::CANNetwork.update();
+	clock.advance_ms(1000);
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_FALSE(secondControlFunction->get_address_valid());
+
+	send_address_claim(0xF2, SECOND_NAME);
+	send_test_message(0xF2);
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_EQ(secondControlFunction, lastReceivedSource);
+	EXPECT_EQ(0xF2, secondControlFunction->get_address());
+	SystemTiming::set_clock(nullptr);
+
+	CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(0xFEEB, test_source_callback, nullptr);
+	lastReceivedSourcePointer = nullptr;
+	lastReceivedSource.reset();
+	firstControlFunction.reset();
+	secondControlFunction.reset();
+}
+
+static std::vector<CANMessageFrame> secondNetworkTransmittedFrames;
+static std::shared_ptr<ControlFunction> secondNetworkLastSource = nullptr;
+static bool second_network_transmit(const CANMessageFrame &frame, void *)
+{
+	secondNetworkTransmittedFrames.push_back(frame);
+	return true;
+}
+
+static void count_second_network_test_messages(const CANMessage &message, void *parent)
+{
+	(*static_cast<std::uint32_t *>(parent))++;
+	secondNetworkLastSource = message.get_source_control_function();
+}
+
+TEST(CORE_TESTS, IndependentNetworkInstances)
+{
+	ManualClock clock(1000000);
+	SystemTiming::set_clock(&clock);
+	CANNetworkManager::CANNetwork.update();
+	secondNetworkTransmittedFrames.clear();
+
+	CANNetworkManager secondNetwork;
+	secondNetwork.set_frame_transmit_callback(second_network_transmit, nullptr);
+
+	NAME testNAME(0);
+	testNAME.set_arbitrary_address_capable(true);
+	testNAME.set_function_code(static_cast<std::uint8_t>(NAME::Function::SteeringControl));
+	testNAME.set_identity_number(30);
+	testNAME.set_manufacturer_code(1407);
+
+	auto internalControlFunction = InternalControlFunction::create(testNAME, 0x1C, 0, secondNetwork);
+	EXPECT_EQ(&secondNetwork, &internalControlFunction->get_network());
+
+	ASSERT_EQ(1u, secondNetwork.get_internal_control_functions().size());
+	for (const auto &defaultInternalControlFunction : CANNetworkManager::CANNetwork.get_internal_control_functions())
+	{
+		EXPECT_NE(internalControlFunction, defaultInternalControlFunction);
+	}
+
+	for (std::uint32_t i = 0; (i < 100) && (!internalControlFunction->get_address_valid()); i++)
+	{
+		clock.advance_ms(10);
+		secondNetwork.update();
+	}
+	ASSERT_TRUE(internalControlFunction->get_address_valid());
+	EXPECT_EQ(0x1C, internalControlFunction->get_address());
+
+	// The claim went out through this instance's callback rather than the hardware interface
+	bool addressClaimSent = false;
+	for (const auto &frame : secondNetworkTransmittedFrames)
+	{
+		if (0x18EEFF1C == frame.identifier)
+		{
+			addressClaimSent = true;
+			std::uint64_t claimedNAME = 0;
+			for (std::uint8_t i = 0; i < 8; i++)
+			{
+				claimedNAME |= static_cast<std::uint64_t>(frame.data[i]) << (8 * i);
+			}
+			EXPECT_EQ(testNAME.get_full_name(), claimedNAME);
+		}
+	}
+	EXPECT_TRUE(addressClaimSent);
+
+	// Frames fed to one instance are not seen by the other
+	std::uint32_t defaultNetworkMessageCount = 0;
+	std::uint32_t secondNetworkMessageCount = 0;
+	CANNetworkManager::CANNetwork.add_global_parameter_group_number_callback(0xFEEB, count_second_network_test_messages, &defaultNetworkMessageCount);
+	secondNetwork.add_global_parameter_group_number_callback(0xFEEB, count_second_network_test_messages, &secondNetworkMessageCount);
+
+	CANMessageFrame testFrame;
+	testFrame.channel = 0;
+	testFrame.isExtendedFrame = true;
+	testFrame.identifier = 0x18EEFFB5;
+	testFrame.dataLength = 8;
+	testFrame.timestamp_us = clock.get_time_us();
+	std::uint64_t externalNAME = 0xA00E840000000123;
+	for (std::uint8_t i = 0; i < 8; i++)
+	{
+		testFrame.data[i] = static_cast<std::uint8_t>(externalNAME >> (8 * i));
+	}
+	secondNetwork.receive_can_message_frame(testFrame);
+	testFrame.identifier = 0x18FEEBB5;
+	secondNetwork.receive_can_message_frame(testFrame);
+	secondNetwork.update();
+	CANNetworkManager::CANNetwork.update();
+
+	EXPECT_EQ(1u, secondNetworkMessageCount);
+	EXPECT_EQ(0u, defaultNetworkMessageCount);
+	ASSERT_NE(nullptr, secondNetworkLastSource);
+	EXPECT_EQ(externalNAME, secondNetworkLastSource->get_NAME().get_full_name());
+	EXPECT_EQ(&secondNetwork, &secondNetworkLastSource->get_network());
+
+	CANNetworkManager::CANNetwork.remove_global_parameter_group_number_callback(0xFEEB, count_second_network_test_messages, &defaultNetworkMessageCount);
+	secondNetwork.remove_global_parameter_group_number_callback(0xFEEB, count_second_network_test_messages, &secondNetworkMessageCount);
+	secondNetworkLastSource.reset();
+
+	EXPECT_TRUE(internalControlFunction->destroy());
+	EXPECT_EQ(0u, secondNetwork.get_internal_control_functions().size());
+	SystemTiming::set_clock(nullptr);
+}
@@ -1,10 +1,15 @@
 #include <gtest/gtest.h>
 
 #include "isobus/isobus/isobus_device_descriptor_object_pool.hpp"
+#include "isobus/isobus/isobus_device_descriptor_object_pool_view.hpp"
 #include "isobus/isobus/isobus_language_command_interface.hpp"
 #include "isobus/isobus/isobus_standard_data_description_indices.hpp"
 #include "isobus/utility/to_string.hpp"
 
+#include <clocale>
+#include <cmath>
+#include <sstream>
+
 using namespace isobus;
 
 static constexpr std::size_t NUMBER_SECTIONS_TO_CREATE = 16;
@@ -726,4 +731,275 @@ TEST(DDOP_TESTS, ISOXMLOutput)
 </ISO11783_TaskData>
 )ISOXML";
 	EXPECT_EQ(textXML, isoxml);
+
+	// Streaming the XML should give the same document
+	std::ostringstream streamedXML;
+	ASSERT_TRUE(testDDOPVersion3.generate_task_data_iso_xml(streamedXML));
+	EXPECT_EQ(textXML, streamedXML.str());
+
+	// Importing the XML should give back the same pool
+	DeviceDescriptorObjectPool importedDDOP(3);
+	std::string reexportedXML;
+	ASSERT_TRUE(importedDDOP.deserialize_task_data_iso_xml(isoxml));
+	EXPECT_EQ(testDDOPVersion3.size(), importedDDOP.size());
+	EXPECT_EQ(sizeof(testObjectPool), importedDDOP.get_binary_object_pool_size());
+	ASSERT_TRUE(importedDDOP.generate_task_data_iso_xml(reexportedXML));
+	EXPECT_EQ(textXML, reexportedXML);
+
+	for (std::uint16_t i = 0; i < testDDOPVersion3.size(); i++)
+	{
+		auto object = testDDOPVersion3.get_object_by_index(i);
+		auto importedObject = importedDDOP.get_object_by_id(object->get_object_id());
+		ASSERT_NE(nullptr, importedObject);
+		EXPECT_EQ(object->get_binary_object(), importedObject->get_binary_object());
+	}
+
+	// Serializing the pool again should reproduce it exactly, with every object's size known up front
+	std::vector<std::uint8_t> binaryDDOP;
+	ASSERT_TRUE(testDDOPVersion3.generate_binary_object_pool(binaryDDOP));
+	EXPECT_EQ(sizeof(testObjectPool), testDDOPVersion3.get_binary_object_pool_size());
+	ASSERT_EQ(sizeof(testObjectPool), binaryDDOP.size());
+	EXPECT_EQ(0, memcmp(testObjectPool, binaryDDOP.data(), binaryDDOP.size()));
+
+	for (std::uint16_t i = 0; i < testDDOPVersion3.size(); i++)
+	{
+		auto object = testDDOPVersion3.get_object_by_index(i);
+		ASSERT_NE(nullptr, object);
+		EXPECT_EQ(object->get_binary_object_size(), object->get_binary_object().size());
+	}
+}
+
+TEST(DDOP_TESTS, ISOXMLLocaleIndependence)
+{
+	// Decimal numbers have to use a '.' even when the global locale uses a ',', if one is installed
+	const std::string previousLocale = std::setlocale(LC_NUMERIC, nullptr);
+	for (const char *commaLocale : { "de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR.utf8", "nl_NL.UTF-8" })
+	{
+		if (nullptr != std::setlocale(LC_NUMERIC, commaLocale))
+		{
+			break;
+		}
+	}
+
+	DeviceDescriptorObjectPool testDDOP;
+	LanguageCommandInterface testLanguageInterface(nullptr, nullptr);
+	std::string isoxml;
+
+	ASSERT_TRUE(testDDOP.add_device("Locale Test", "1.0.0", "123", "I++1.0", testLanguageInterface.get_localization_raw_data(), std::vector<std::uint8_t>(), 0));
+	ASSERT_TRUE(testDDOP.add_device_value_presentation("m", 0, 0.001f, 3, 100));
+	ASSERT_TRUE(testDDOP.add_device_value_presentation("m", 0, -2.5f, 1, 101));
+	ASSERT_TRUE(testDDOP.add_device_value_presentation("m", 0, 0.0078125f, 0, 102)); // Exactly halfway, so it rounds to even
+	ASSERT_TRUE(testDDOP.add_device_value_presentation("m", 0, 1e13f, 0, 103)); // Too large to format by hand
+	ASSERT_TRUE(testDDOP.generate_task_data_iso_xml(isoxml));
+
+	EXPECT_NE(std::string::npos, isoxml.find("C=\"0.001000\""));
+	EXPECT_NE(std::string::npos, isoxml.find("C=\"-2.500000\""));
+	EXPECT_NE(std::string::npos, isoxml.find("C=\"0.007812\""));
+	EXPECT_NE(std::string::npos, isoxml.find("C=\"9999999827968.000000\""));
+
+	DeviceDescriptorObjectPool importedDDOP;
+	ASSERT_TRUE(importedDDOP.deserialize_task_data_iso_xml(isoxml));
+	for (std::uint16_t objectID = 100; objectID <= 103; objectID++)
+	{
+		auto object = std::static_pointer_cast<task_controller_object::DeviceValuePresentationObject>(testDDOP.get_object_by_id(objectID));
+		auto importedObject = std::static_pointer_cast<task_controller_object::DeviceValuePresentationObject>(importedDDOP.get_object_by_id(objectID));
+		ASSERT_NE(nullptr, importedObject);
+		// Six decimal places are written, so small scales can be off by half of the last place
+		EXPECT_NEAR(object->get_scale(), importedObject->get_scale(), 0.0000005f + (0.000001f * std::fabs(object->get_scale())));
+	}
+
+	std::setlocale(LC_NUMERIC, previousLocale.c_str());
+}
+
+TEST(DDOP_TESTS, ISOXMLImport)
+{
+	DeviceDescriptorObjectPool testDDOP;
+	LanguageCommandInterface testLanguageInterface(nullptr, nullptr);
+	std::string isoxml;
+
+	// Text that has to be escaped should survive being exported and imported
+	ASSERT_TRUE(testDDOP.add_device("Fert & \"Seed\" <1>", "1.0.0", "123", "I++1.0", testLanguageInterface.get_localization_raw_data(), std::vector<std::uint8_t>(), 0xA000820000000001));
+	ASSERT_TRUE(testDDOP.add_device_element("Tank", 0, 0, task_controller_object::DeviceElementObject::Type::Bin, 1));
+	ASSERT_TRUE(testDDOP.add_device_property("Capacity", -1500, static_cast<std::uint16_t>(DataDescriptionIndex::MaximumVolumeContent), 3, 2));
+	ASSERT_TRUE(testDDOP.add_device_value_presentation("L", 10, 0.001f, 2, 3));
+	ASSERT_TRUE(testDDOP.generate_task_data_iso_xml(isoxml));
+	EXPECT_NE(std::string::npos, isoxml.find("B=\"Fert &amp; &quot;Seed&quot; &lt;1&gt;\""));
+	EXPECT_NE(std::string::npos, isoxml.find("F=\"20302E312B2B49\""));
+	EXPECT_NE(std::string::npos, isoxml.find("<DET A=\"DET-1\" B=\"1\" C=\"3\" D=\"Tank\" E=\"0\" F=\"0\"/>"));
+
+	DeviceDescriptorObjectPool importedDDOP;
+	ASSERT_TRUE(importedDDOP.deserialize_task_data_iso_xml(isoxml));
+	ASSERT_EQ(4u, importedDDOP.size());
+
+	auto device = std::static_pointer_cast<task_controller_object::DeviceObject>(importedDDOP.get_object_by_id(0));
+	ASSERT_NE(nullptr, device);
+	EXPECT_EQ("Fert & \"Seed\" <1>", device->get_designator());
+	EXPECT_EQ("I++1.0 ", device->get_structure_label());
+	EXPECT_EQ(testLanguageInterface.get_localization_raw_data(), device->get_localization_label());
+	EXPECT_EQ(0xA000820000000001, device->get_iso_name());
+
+	auto element = std::static_pointer_cast<task_controller_object::DeviceElementObject>(importedDDOP.get_object_by_id(1));
+	ASSERT_NE(nullptr, element);
+	EXPECT_EQ(task_controller_object::DeviceElementObject::Type::Bin, element->get_type());
+	EXPECT_EQ(0u, element->get_number_child_objects());
+
+	auto property = std::static_pointer_cast<task_controller_object::DevicePropertyObject>(importedDDOP.get_object_by_id(2));
+	ASSERT_NE(nullptr, property);
+	EXPECT_EQ(-1500, property->get_value());
+	EXPECT_EQ(static_cast<std::uint16_t>(DataDescriptionIndex::MaximumVolumeContent), property->get_ddi());
+	EXPECT_EQ(3, property->get_device_value_presentation_object_id());
+
+	auto presentation = std::static_pointer_cast<task_controller_object::DeviceValuePresentationObject>(importedDDOP.get_object_by_id(3));
+	ASSERT_NE(nullptr, presentation);
+	EXPECT_EQ(10, presentation->get_offset());
+	EXPECT_EQ(0.001f, presentation->get_scale());
+	EXPECT_EQ(2, presentation->get_number_of_decimals());
+	EXPECT_EQ("L", presentation->get_designator());
+
+	// Other ISOXML content around the device is skipped
+	const std::string fullTaskData = R"ISOXML(<?xml version="1.0" encoding="UTF-8"?>
+<!-- Exported by a farm management system -->
+<ISO11783_TaskData VersionMajor="4" VersionMinor="2" DataTransferOrigin="1">
+<CTR A="CTR1" B="Customer &#x26; Sons"/>
+<DVC A="DVC-1" B="Seeder&#233;" C="2.0" D="A000820000000001" E="9" F="30302E3232444D" G="FF000000006E65">
+	<DET A="DET-1" B="1" C="1" D="Seeder" E="0" F="0">
+		<DOR A="2"/>
+	</DET>
+	<DPD A='2' B='0074' C='1' D='8' E='Area'/>
+</DVC>
+<DVC A="DVC-2" B="Second" C="1" D="A000820000000002" E="1" F="30302E3232444D" G="FF000000006E65"/>
+<TSK A="TSK1" G="1"/>
+</ISO11783_TaskData>
+)ISOXML";
+	ASSERT_TRUE(importedDDOP.deserialize_task_data_iso_xml(fullTaskData));
+	EXPECT_EQ(3u, importedDDOP.size());
+	EXPECT_EQ("Seeder\xC3\xA9", importedDDOP.get_object_by_id(0)->get_designator());
+	EXPECT_EQ("MD22.00", std::static_pointer_cast<task_controller_object::DeviceObject>(importedDDOP.get_object_by_id(0))->get_structure_label());
+	ASSERT_NE(nullptr, importedDDOP.get_object_by_id(2));
+	EXPECT_EQ(static_cast<std::uint16_t>(task_controller_object::Object::NULL_OBJECT_ID), std::static_pointer_cast<task_controller_object::DeviceProcessDataObject>(importedDDOP.get_object_by_id(2))->get_device_value_presentation_object_id());
+	EXPECT_EQ(2, std::static_pointer_cast<task_controller_object::DeviceElementObject>(importedDDOP.get_object_by_id(1))->get_child_object_id(0));
+
+	// Bad input is rejected, and leaves the pool empty
+	EXPECT_FALSE(importedDDOP.deserialize_task_data_iso_xml(nullptr, 0));
+	EXPECT_FALSE(importedDDOP.deserialize_task_data_iso_xml(std::string("<ISO11783_TaskData/>")));
+	EXPECT_EQ(0u, importedDDOP.size());
+	EXPECT_FALSE(importedDDOP.deserialize_task_data_iso_xml(std::string("<DVC B=\"Bad\" C=\"1\" D=\"XYZ\" E=\"1\" F=\"30302E3232444D\" G=\"FF000000006E65\"/>")));
+	EXPECT_FALSE(importedDDOP.deserialize_task_data_iso_xml(std::string("<DVC B=\"Bad\" C=\"1\" D=\"A000820000000001\" E=\"1\" F=\"3030\" G=\"FF000000006E65\"/>")));
+	EXPECT_FALSE(importedDDOP.deserialize_task_data_iso_xml(std::string("<DVC B=\"Bad\" C=\"1\" D=\"A000820000000001\" E=\"1\" F=\"30302E3232444D\" G=\"FF000000006E65\"><DOR A=\"2\"/></DVC>")));
+	EXPECT_FALSE(importedDDOP.deserialize_task_data_iso_xml(std::string("<DVC B=\"Bad\" C=\"1\" D=\"A000820000000001\" E=\"1\" F=\"30302E3232444D\" G=\"FF000000006E65\"><DPD A=\"2\" B=\"0074\" C=\"1\" D=\"300\"/></DVC>")));
+	EXPECT_FALSE(importedDDOP.deserialize_task_data_iso_xml(std::string("<DVC B=\"Bad &bogus; \" C=\"1\" D=\"A000820000000001\" E=\"1\" F=\"30302E3232444D\" G=\"FF000000006E65\"/>")));
+	EXPECT_FALSE(importedDDOP.deserialize_task_data_iso_xml(std::string("<DVC B=\"Unterminated C=\"1\"")));
+	EXPECT_EQ(0u, importedDDOP.size());
+}
+
+TEST(DDOP_TESTS, ObjectIDIndex)
+{
+	DeviceDescriptorObjectPool testDDOP;
+	LanguageCommandInterface testLanguageInterface(nullptr, nullptr);
+
+	EXPECT_TRUE(testDDOP.add_device("AgIsoStack++ UnitTest", "1.0.0", "123", "I++1.0", testLanguageInterface.get_localization_raw_data(), std::vector<std::uint8_t>(), 0));
+	EXPECT_TRUE(testDDOP.add_device_value_presentation("m", 0, 0.001f, 0, 100));
+	EXPECT_TRUE(testDDOP.add_device_value_presentation("mm", 0, 1.0f, 0, 101));
+	ASSERT_NE(nullptr, testDDOP.get_object_by_id(100));
+	EXPECT_EQ(100, testDDOP.get_object_by_id(100)->get_object_id());
+	EXPECT_EQ(nullptr, testDDOP.get_object_by_id(102));
+
+	// Changing an object's ID after it was added has to be reflected in lookups
+	testDDOP.get_object_by_id(100)->set_object_id(102);
+	EXPECT_EQ(nullptr, testDDOP.get_object_by_id(100));
+	ASSERT_NE(nullptr, testDDOP.get_object_by_id(102));
+	EXPECT_EQ(102, testDDOP.get_object_by_id(102)->get_object_id());
+	EXPECT_TRUE(testDDOP.add_device_value_presentation("m", 0, 0.001f, 0, 100));
+	EXPECT_FALSE(testDDOP.add_device_value_presentation("m", 0, 0.001f, 0, 102));
+
+	// A copy of a pool shares its objects, so both see an ID change made through either one
+	DeviceDescriptorObjectPool copiedDDOP = testDDOP;
+	ASSERT_NE(nullptr, copiedDDOP.get_object_by_id(102));
+	copiedDDOP.get_object_by_id(102)->set_object_id(103);
+	EXPECT_EQ(nullptr, copiedDDOP.get_object_by_id(102));
+	EXPECT_EQ(nullptr, testDDOP.get_object_by_id(102));
+	EXPECT_NE(nullptr, copiedDDOP.get_object_by_id(103));
+	EXPECT_NE(nullptr, testDDOP.get_object_by_id(103));
+	testDDOP.get_object_by_id(103)->set_object_id(102);
+
+	// Removing a shared object from one copy doesn't stop the other from seeing its ID change
+	EXPECT_TRUE(copiedDDOP.remove_object_by_id(102));
+	ASSERT_NE(nullptr, testDDOP.get_object_by_id(102));
+	testDDOP.get_object_by_id(102)->set_object_id(104);
+	EXPECT_EQ(nullptr, testDDOP.get_object_by_id(102));
+	EXPECT_NE(nullptr, testDDOP.get_object_by_id(104));
+	testDDOP.get_object_by_id(104)->set_object_id(102);
+
+	EXPECT_TRUE(testDDOP.remove_object_by_id(101));
+	EXPECT_FALSE(testDDOP.remove_object_by_id(101));
+	EXPECT_EQ(nullptr, testDDOP.get_object_by_id(101));
+	EXPECT_EQ(3u, testDDOP.size());
+
+	testDDOP.clear();
+	EXPECT_EQ(nullptr, testDDOP.get_object_by_id(0));
+	EXPECT_EQ(nullptr, testDDOP.get_object_by_id(102));
+}
+
+TEST(DDOP_TESTS, LargeDDOPScaling)
+{
+	constexpr std::uint16_t CHILDREN_PER_ELEMENT = 4;
+	LanguageCommandInterface testLanguageInterface(nullptr, nullptr);
+
+	// Build pools with a device, a presentation, and then elements that each have a few process data children
+	for (std::size_t numberOfObjects : { 100, 1000, 10000 })
+	{
+		DeviceDescriptorObjectPool testDDOP;
+		std::uint16_t nextObjectID = 2;
+		std::uint16_t elementNumber = 1;
+
+		ASSERT_TRUE(testDDOP.add_device("AgIsoStack++ UnitTest", "1.0.0", "123", "I++1.0 ", testLanguageInterface.get_localization_raw_data(), std::vector<std::uint8_t>(), 0));
+		ASSERT_TRUE(testDDOP.add_device_value_presentation("m", 0, 0.001f, 0, 1));
+
+		while (testDDOP.size() < numberOfObjects)
+		{
+			std::uint16_t elementID = nextObjectID++;
+			bool isRootElement = (1 == elementNumber);
+
+			ASSERT_TRUE(testDDOP.add_device_element(isRootElement ? "Implement" : "Section",
+			                                        elementNumber,
+			                                        isRootElement ? 0 : 2,
+			                                        isRootElement ? task_controller_object::DeviceElementObject::Type::Device : task_controller_object::DeviceElementObject::Type::Section,
+			                                        elementID));
+			auto element = std::static_pointer_cast<task_controller_object::DeviceElementObject>(testDDOP.get_object_by_id(elementID));
+			ASSERT_NE(nullptr, element);
+
+			for (std::uint16_t i = 0; (i < CHILDREN_PER_ELEMENT) && (testDDOP.size() < numberOfObjects); i++)
+			{
+				ASSERT_TRUE(testDDOP.add_device_process_data("Width", static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkingWidth), 1, static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::PropertiesBit::MemberOfDefaultSet), static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::OnChange), nextObjectID));
+				element->add_reference_to_child_object(nextObjectID);
+				nextObjectID++;
+			}
+			elementNumber++;
+		}
+
+		std::vector<std::uint8_t> binaryDDOP;
+		ASSERT_TRUE(testDDOP.generate_binary_object_pool(binaryDDOP));
+		EXPECT_EQ(testDDOP.get_binary_object_pool_size(), binaryDDOP.size());
+
+		std::string isoxml;
+		ASSERT_TRUE(testDDOP.generate_task_data_iso_xml(isoxml));
+
+		DeviceDescriptorObjectPool deserializedDDOP;
+		ASSERT_TRUE(deserializedDDOP.deserialize_binary_object_pool(binaryDDOP));
+
+		DeviceDescriptorObjectPoolView view;
+		ASSERT_TRUE(view.open(binaryDDOP));
+		EXPECT_EQ(numberOfObjects, view.size());
+		EXPECT_EQ(nextObjectID - 1, view.get_object_by_id(nextObjectID - 1).get_object_id());
+
+		DeviceDescriptorObjectPool importedDDOP;
+		ASSERT_TRUE(importedDDOP.deserialize_task_data_iso_xml(isoxml));
+
+		EXPECT_EQ(numberOfObjects, testDDOP.size());
+		EXPECT_EQ(numberOfObjects, deserializedDDOP.size());
+		EXPECT_EQ(numberOfObjects, importedDDOP.size());
+		ASSERT_NE(nullptr, deserializedDDOP.get_object_by_id(nextObjectID - 1));
+		ASSERT_NE(nullptr, importedDDOP.get_object_by_id(nextObjectID - 1));
+		EXPECT_EQ(binaryDDOP.size(), importedDDOP.get_binary_object_pool_size());
+	}
 }
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include "isobus/isobus/isobus_device_descriptor_object_pool.hpp"
+#include "isobus/isobus/isobus_device_descriptor_object_pool_view.hpp"
+#include "isobus/isobus/isobus_language_command_interface.hpp"
+#include "isobus/isobus/isobus_standard_data_description_indices.hpp"
+
+using namespace isobus;
+
+static std::vector<std::uint8_t> build_test_pool(std::uint8_t version)
+{
+	DeviceDescriptorObjectPool testDDOP(version);
+	LanguageCommandInterface testLanguageInterface(nullptr, nullptr);
+	std::vector<std::uint8_t> retVal;
+
+	EXPECT_TRUE(testDDOP.add_device("View Test", "1.2.3", "456", "View1.0", testLanguageInterface.get_localization_raw_data(), { 'E', 'x', 't' }, 0xA000820000000001));
+	EXPECT_TRUE(testDDOP.add_device_element("Sprayer", 0, 0, task_controller_object::DeviceElementObject::Type::Device, 1));
+	EXPECT_TRUE(testDDOP.add_device_process_data("Actual Work State", static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState), task_controller_object::Object::NULL_OBJECT_ID, static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::PropertiesBit::MemberOfDefaultSet), static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::OnChange), 2));
+	EXPECT_TRUE(testDDOP.add_device_property("Width", 12000, static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkingWidth), 4, 3));
+	EXPECT_TRUE(testDDOP.add_device_value_presentation("m", -5, 0.001f, 3, 4));
+
+	auto element = std::static_pointer_cast<task_controller_object::DeviceElementObject>(testDDOP.get_object_by_id(1));
+	element->add_reference_to_child_object(2);
+	element->add_reference_to_child_object(3);
+	EXPECT_TRUE(testDDOP.generate_binary_object_pool(retVal));
+	return retVal;
+}
+
+TEST(DDOP_VIEW_TESTS, ReadObjects)
+{
+	std::vector<std::uint8_t> binaryDDOP = build_test_pool(4);
+	DeviceDescriptorObjectPoolView view;
+
+	ASSERT_TRUE(view.open(binaryDDOP));
+	ASSERT_EQ(5u, view.size());
+
+	auto device = view.get_object_by_id(0);
+	ASSERT_TRUE(device.get_is_valid());
+	EXPECT_EQ(task_controller_object::ObjectTypes::Device, device.get_object_type());
+	EXPECT_TRUE(device.get_designator() == "View Test");
+	EXPECT_TRUE(device.get_software_version() == "1.2.3");
+	EXPECT_TRUE(device.get_serial_number() == "456");
+	EXPECT_TRUE(device.get_structure_label() == "View1.0");
+	EXPECT_TRUE(device.get_extended_structure_label() == "Ext");
+	EXPECT_EQ(0xA000820000000001, device.get_iso_name());
+	EXPECT_EQ(0xFF, device.get_localization_label()[6]);
+
+	auto element = view.get_object_by_id(1);
+	ASSERT_TRUE(element.get_is_valid());
+	EXPECT_EQ(task_controller_object::ObjectTypes::DeviceElement, element.get_object_type());
+	EXPECT_EQ("Sprayer", element.get_designator().to_string());
+	EXPECT_EQ(task_controller_object::DeviceElementObject::Type::Device, element.get_element_type());
+	EXPECT_EQ(0, element.get_element_number());
+	EXPECT_EQ(0, element.get_parent_object());
+	ASSERT_EQ(2, element.get_number_child_objects());
+	EXPECT_EQ(2, element.get_child_object_id(0));
+	EXPECT_EQ(3, element.get_child_object_id(1));
+	EXPECT_EQ(static_cast<std::uint16_t>(task_controller_object::Object::NULL_OBJECT_ID), element.get_child_object_id(2));
+
+	auto processData = view.get_object_by_id(2);
+	EXPECT_EQ(task_controller_object::ObjectTypes::DeviceProcessData, processData.get_object_type());
+	EXPECT_EQ(static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState), processData.get_ddi());
+	EXPECT_EQ(static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::PropertiesBit::MemberOfDefaultSet), processData.get_properties_bitfield());
+	EXPECT_EQ(static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::OnChange), processData.get_trigger_methods_bitfield());
+	EXPECT_EQ(static_cast<std::uint16_t>(task_controller_object::Object::NULL_OBJECT_ID), processData.get_device_value_presentation_object_id());
+
+	auto property = view.get_object_by_id(3);
+	EXPECT_EQ(task_controller_object::ObjectTypes::DeviceProperty, property.get_object_type());
+	EXPECT_EQ(12000, property.get_value());
+	EXPECT_EQ(4, property.get_device_value_presentation_object_id());
+	EXPECT_EQ(0, property.get_element_number());
+
+	auto presentation = view.get_object_by_id(4);
+	EXPECT_EQ(task_controller_object::ObjectTypes::DeviceValuePresentation, presentation.get_object_type());
+	EXPECT_TRUE(presentation.get_designator() == "m");
+	EXPECT_EQ(-5, presentation.get_offset());
+	EXPECT_NEAR(0.001f, presentation.get_scale(), 0.0001f);
+	EXPECT_EQ(3, presentation.get_number_of_decimals());
+
+	EXPECT_FALSE(view.get_object_by_id(5).get_is_valid());
+	EXPECT_FALSE(view.get_object_by_index(5).get_is_valid());
+	EXPECT_EQ(static_cast<std::uint16_t>(task_controller_object::Object::NULL_OBJECT_ID), view.get_object_by_index(5).get_object_id());
+
+	// Materializing every object should give back the same binary
+	std::vector<std::uint8_t> rebuiltDDOP;
+	std::size_t totalSize = 0;
+	for (std::size_t i = 0; i < view.size(); i++)
+	{
+		auto object = view.get_object_by_index(i);
+		auto materialized = object.materialize();
+		ASSERT_NE(nullptr, materialized);
+		EXPECT_EQ(object.get_object_id(), materialized->get_object_id());
+		EXPECT_EQ(object.get_binary_object_size(), materialized->get_binary_object_size());
+		materialized->append_binary_object(rebuiltDDOP);
+		totalSize += object.get_binary_object_size();
+	}
+	EXPECT_EQ(binaryDDOP.size(), totalSize);
+	EXPECT_EQ(binaryDDOP, rebuiltDDOP);
+
+	view.close();
+	EXPECT_EQ(0u, view.size());
+	EXPECT_FALSE(view.get_object_by_id(0).get_is_valid());
+}
+
+TEST(DDOP_VIEW_TESTS, VersionThreePool)
+{
+	std::vector<std::uint8_t> binaryDDOP = build_test_pool(3);
+	DeviceDescriptorObjectPoolView view(3);
+
+	ASSERT_TRUE(view.open(binaryDDOP));
+	EXPECT_EQ(5u, view.size());
+	EXPECT_TRUE(view.get_object_by_id(0).get_extended_structure_label().empty());
+	EXPECT_TRUE(view.get_object_by_id(1).get_designator() == "Sprayer");
+
+	// Reading a version 3 pool as version 4 misplaces everything after the device object
+	DeviceDescriptorObjectPoolView wrongVersionView;
+	EXPECT_FALSE(wrongVersionView.open(binaryDDOP));
+}
+
+TEST(DDOP_VIEW_TESTS, RejectMalformedPools)
+{
+	std::vector<std::uint8_t> binaryDDOP = build_test_pool(4);
+	DeviceDescriptorObjectPoolView view;
+
+	EXPECT_FALSE(view.open(nullptr, 0));
+	EXPECT_FALSE(view.open(std::vector<std::uint8_t>()));
+
+	// Truncate the last object
+	std::vector<std::uint8_t> truncatedDDOP(binaryDDOP.begin(), binaryDDOP.end() - 1);
+	EXPECT_FALSE(view.open(truncatedDDOP));
+	EXPECT_EQ(0u, view.size());
+
+	// Give the presentation object the same ID as the property object
+	std::vector<std::uint8_t> duplicateDDOP = binaryDDOP;
+	std::size_t presentationOffset = binaryDDOP.size() - 16;
+	ASSERT_EQ('D', duplicateDDOP[presentationOffset]);
+	ASSERT_EQ('V', duplicateDDOP[presentationOffset + 1]);
+	duplicateDDOP[presentationOffset + 3] = 3;
+	EXPECT_FALSE(view.open(duplicateDDOP));
+
+	// Corrupt the presentation object's namespace
+	std::vector<std::uint8_t> unknownDDOP = binaryDDOP;
+	unknownDDOP[presentationOffset + 2] = 'X';
+	EXPECT_FALSE(view.open(unknownDDOP));
+
+	// The view is usable again after a failed open
+	EXPECT_TRUE(view.open(binaryDDOP));
+	EXPECT_EQ(5u, view.size());
+}
@@ -18,16 +18,14 @@ TEST(HARDWARE_INTERFACE_TESTS, SendMessageToHardware)
 	CANHardwareInterface::assign_can_channel_frame_handler(0, sender);
 	CANHardwareInterface::start();
 
-	CANMessageFrame fakeFrame;
-	memset(&fakeFrame, 0, sizeof(CANMessageFrame));
+	CANMessageFrame fakeFrame = {};
 	fakeFrame.identifier = 0x613;
 	fakeFrame.isExtendedFrame = false;
 	fakeFrame.dataLength = 1;
 	fakeFrame.data[0] = 0x01;
 	fakeFrame.channel = 0;
 
-	CANMessageFrame receiveFrame;
-	memset(&receiveFrame, 0, sizeof(CANMessageFrame));
+	CANMessageFrame receiveFrame = {};
 	auto future = std::async(std::launch::async, [&] { receiver->read_frame(receiveFrame); });
 
 	isobus::send_can_message_frame_to_hardware(fakeFrame);
@@ -49,8 +47,7 @@ TEST(HARDWARE_INTERFACE_TESTS, ReceiveMessageFromHardware)
 	CANHardwareInterface::assign_can_channel_frame_handler(0, device);
 	CANHardwareInterface::start();
 
-	CANMessageFrame fakeFrame;
-	memset(&fakeFrame, 0, sizeof(CANMessageFrame));
+	CANMessageFrame fakeFrame = {};
 	fakeFrame.identifier = 0x613;
 	fakeFrame.isExtendedFrame = false;
 	fakeFrame.dataLength = 1;
@@ -85,17 +82,13 @@ TEST(HARDWARE_INTERFACE_TESTS, MessageFrameSentEventListener)
 	CANHardwareInterface::assign_can_channel_frame_handler(0, sender);
 	CANHardwareInterface::start();
 
-	CANMessageFrame fakeFrame;
-	memset(&fakeFrame, 0, sizeof(CANMessageFrame));
+	CANMessageFrame fakeFrame = {};
 	fakeFrame.identifier = 0x613;
 	fakeFrame.isExtendedFrame = false;
 	fakeFrame.dataLength = 1;
 	fakeFrame.data[0] = 0x01;
 	fakeFrame.channel = 0;
 
-	CANMessageFrame receiveFrame;
-	memset(&receiveFrame, 0, sizeof(CANMessageFrame));
-
 	int messageCount = 0;
 	std::function<void(const CANMessageFrame &)> sendCallback = [&messageCount](const CANMessageFrame &frame) {
 		messageCount += 1;
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include "isobus/utility/iop_file_interface.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+using namespace isobus;
+
+static std::string get_test_pool_path()
+{
+	std::string retVal = "../examples/virtual_terminal/version3_object_pool/VT3TestPool.iop";
+
+	if (IOPFileInterface::read_iop_file(retVal).empty())
+	{
+		// Try a different path to mitigate differences between how IDEs run the unit test
+		retVal = "examples/virtual_terminal/version3_object_pool/VT3TestPool.iop";
+	}
+	return retVal;
+}
+
+TEST(IOP_FILE_INTERFACE_TESTS, ReadAndMapFile)
+{
+	std::vector<std::uint8_t> testPool = IOPFileInterface::read_iop_file(get_test_pool_path());
+	ASSERT_FALSE(testPool.empty());
+
+	MappedIOPFile mappedPool = IOPFileInterface::map_iop_file(get_test_pool_path());
+	ASSERT_TRUE(mappedPool.get_is_valid());
+	ASSERT_EQ(testPool.size(), mappedPool.get_size());
+	EXPECT_TRUE(std::equal(testPool.begin(), testPool.end(), mappedPool.get_data()));
+
+	// Moving transfers the mapping
+	const std::uint8_t *mappedData = mappedPool.get_data();
+	MappedIOPFile movedPool(std::move(mappedPool));
+	EXPECT_FALSE(mappedPool.get_is_valid());
+	EXPECT_EQ(nullptr, mappedPool.get_data());
+	EXPECT_EQ(0u, mappedPool.get_size());
+	EXPECT_EQ(mappedData, movedPool.get_data());
+	EXPECT_EQ(testPool.size(), movedPool.get_size());
+
+	mappedPool = std::move(movedPool);
+	EXPECT_TRUE(mappedPool.get_is_valid());
+	EXPECT_FALSE(movedPool.get_is_valid());
+	EXPECT_EQ(mappedData, mappedPool.get_data());
+}
+
+TEST(IOP_FILE_INTERFACE_TESTS, MissingFile)
+{
+	EXPECT_TRUE(IOPFileInterface::read_iop_file("this_file_does_not_exist.iop").empty());
+
+	MappedIOPFile mappedPool = IOPFileInterface::map_iop_file("this_file_does_not_exist.iop");
+	EXPECT_FALSE(mappedPool.get_is_valid());
+	EXPECT_EQ(nullptr, mappedPool.get_data());
+	EXPECT_EQ(0u, mappedPool.get_size());
+
+	MappedIOPFile emptyMapping;
+	EXPECT_FALSE(emptyMapping.get_is_valid());
+}
+
+TEST(IOP_FILE_INTERFACE_TESTS, HashKnownValues)
+{
+	const std::uint8_t text[] = { 'a', 'b', 'c' };
+	std::vector<std::uint8_t> sequence(1000);
+
+	for (std::size_t i = 0; i < sequence.size(); i++)
+	{
+		sequence[i] = static_cast<std::uint8_t>(i);
+	}
+
+	// Reference values from the XXH64 reference implementation
+	EXPECT_EQ(0xEF46DB3751D8E999ULL, ObjectPoolHasher::hash(nullptr, 0));
+	EXPECT_EQ(0xD24EC4F1A98C6E5BULL, ObjectPoolHasher::hash(text, 1));
+	EXPECT_EQ(0x44BC2CF5AD770999ULL, ObjectPoolHasher::hash(text, 3));
+	EXPECT_EQ(0x6EF436B00EBA4078ULL, ObjectPoolHasher::hash(sequence.data(), sequence.size()));
+	EXPECT_EQ(0x4E0DA20A99A1E783ULL, ObjectPoolHasher::hash(sequence.data(), sequence.size(), 42));
+}
+
+TEST(IOP_FILE_INTERFACE_TESTS, StreamingHash)
+{
+	std::vector<std::uint8_t> testPool = IOPFileInterface::read_iop_file(get_test_pool_path());
+	ASSERT_FALSE(testPool.empty());
+
+	const std::uint64_t expectedHash = ObjectPoolHasher::hash(testPool.data(), testPool.size());
+
+	// Feeding the data in uneven pieces gives the same result as hashing it all at once
+	for (std::size_t pieceSize : { 1, 3, 31, 32, 33, 1785 })
+	{
+		ObjectPoolHasher hasher;
+		for (std::size_t offset = 0; offset < testPool.size(); offset += pieceSize)
+		{
+			hasher.update(&testPool[offset], std::min(pieceSize, testPool.size() - offset));
+		}
+		EXPECT_EQ(expectedHash, hasher.get_hash());
+	}
+
+	ObjectPoolHasher hasher;
+	hasher.update(testPool.data(), 10);
+	EXPECT_NE(expectedHash, hasher.get_hash());
+	hasher.reset();
+	hasher.update(testPool.data(), testPool.size());
+	EXPECT_EQ(expectedHash, hasher.get_hash());
+}
+
+static std::vector<std::uint8_t> chunkedTestPool;
+static bool read_test_pool_chunk(std::uint32_t, std::uint32_t bytesOffset, std::uint32_t numberOfBytesNeeded, std::uint8_t *chunkBuffer, void *)
+{
+	bool retVal = false;
+
+	if ((bytesOffset + numberOfBytesNeeded) <= chunkedTestPool.size())
+	{
+		memcpy(chunkBuffer, &chunkedTestPool[bytesOffset], numberOfBytesNeeded);
+		retVal = true;
+	}
+	return retVal;
+}
+
+TEST(IOP_FILE_INTERFACE_TESTS, VersionLabels)
+{
+	chunkedTestPool = IOPFileInterface::read_iop_file(get_test_pool_path());
+	ASSERT_FALSE(chunkedTestPool.empty());
+	MappedIOPFile mappedPool = IOPFileInterface::map_iop_file(get_test_pool_path());
+
+	std::string version = IOPFileInterface::hash_object_pool_to_version(chunkedTestPool);
+	ASSERT_EQ(7u, version.size());
+	for (char character : version)
+	{
+		EXPECT_TRUE(std::isdigit(character) || std::isupper(character));
+	}
+
+	// All the ways of providing a pool agree
+	EXPECT_EQ(version, IOPFileInterface::hash_object_pool_to_version(chunkedTestPool.data(), static_cast<std::uint32_t>(chunkedTestPool.size())));
+	EXPECT_EQ(version, IOPFileInterface::hash_object_pool_to_version(mappedPool));
+	EXPECT_EQ(version, IOPFileInterface::hash_object_pool_to_version(static_cast<std::uint32_t>(chunkedTestPool.size()), read_test_pool_chunk, nullptr));
+	EXPECT_EQ(version, IOPFileInterface::hash_to_version(ObjectPoolHasher::hash(chunkedTestPool.data(), chunkedTestPool.size())));
+
+	// A failing callback gives no version
+	EXPECT_EQ("", IOPFileInterface::hash_object_pool_to_version(static_cast<std::uint32_t>(chunkedTestPool.size() + 1), read_test_pool_chunk, nullptr));
+	EXPECT_EQ("", IOPFileInterface::hash_object_pool_to_version(static_cast<std::uint32_t>(chunkedTestPool.size()), nullptr, nullptr));
+
+	// Changing one byte changes the version
+	chunkedTestPool[chunkedTestPool.size() / 2] ^= 0x01;
+	EXPECT_NE(version, IOPFileInterface::hash_object_pool_to_version(chunkedTestPool));
+	chunkedTestPool.clear();
+}
+
+TEST(IOP_FILE_INTERFACE_TESTS, WriteFile)
+{
+	const std::vector<std::uint8_t> testData = { 0x01, 0x02, 0x03, 0xFF, 0x00, 0x0A };
+	const std::string filename = "iop_file_interface_write_test.iop";
+
+	EXPECT_FALSE(IOPFileInterface::write_iop_file(filename, nullptr, 5));
+	EXPECT_FALSE(IOPFileInterface::write_iop_file(filename, testData.data(), 0));
+
+	ASSERT_TRUE(IOPFileInterface::write_iop_file(filename, testData.data(), static_cast<std::uint32_t>(testData.size())));
+	EXPECT_EQ(testData, IOPFileInterface::read_iop_file(filename));
+
+	// Overwriting an existing file replaces it
+	ASSERT_TRUE(IOPFileInterface::write_iop_file(filename, testData.data(), 3));
+	EXPECT_EQ(std::vector<std::uint8_t>(testData.begin(), testData.begin() + 3), IOPFileInterface::read_iop_file(filename));
+
+	std::remove(filename.c_str());
+}
@@ -216,8 +216,7 @@ TEST(LANGUAGE_COMMAND_INTERFACE_TESTS, SettersAndTransmitting)
 
 	ASSERT_TRUE(testECU->get_address_valid());
 
-	CANMessageFrame testFrame;
-	memset(&testFrame, 0, sizeof(testFrame));
+	CANMessageFrame testFrame = {};
 	testFrame.isExtendedFrame = true;
 
 	// Get the virtual CAN plugin back to a known state
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include "isobus/isobus/can_latency_monitor.hpp"
+#include "isobus/isobus/can_network_manager.hpp"
+#include "isobus/utility/system_timing.hpp"
+
+using namespace isobus;
+
+#if !defined CAN_STACK_DISABLE_LATENCY_INSTRUMENTATION && !defined ARDUINO
+TEST(LATENCY_MONITOR_TESTS, Histogram)
+{
+	CANLatencyHistogram histogram;
+
+	EXPECT_EQ(0u, histogram.get_sample_count());
+	EXPECT_EQ(0u, histogram.get_percentile_us(50.0f));
+
+	for (std::uint32_t i = 1; i <= 1000; i++)
+	{
+		histogram.record(i);
+	}
+
+	EXPECT_EQ(1000u, histogram.get_sample_count());
+	EXPECT_EQ(1000u, histogram.get_maximum_us());
+	EXPECT_EQ(500u, histogram.get_mean_us());
+
+	// Percentiles are bucketed, so are only accurate to 12.5%
+	std::uint32_t median = histogram.get_percentile_us(50.0f);
+	EXPECT_GE(median, 500u);
+	EXPECT_LE(median, 563u);
+
+	std::uint32_t percentile99 = histogram.get_percentile_us(99.0f);
+	EXPECT_GE(percentile99, 990u);
+	EXPECT_LE(percentile99, 1000u);
+
+	EXPECT_EQ(1000u, histogram.get_percentile_us(100.0f));
+	EXPECT_EQ(1u, histogram.get_percentile_us(0.0f));
+
+	// Small values get their own buckets
+	histogram.reset();
+	EXPECT_EQ(0u, histogram.get_sample_count());
+	EXPECT_EQ(0u, histogram.get_maximum_us());
+	histogram.record(0);
+	histogram.record(3);
+	histogram.record(7);
+	EXPECT_EQ(3u, histogram.get_percentile_us(50.0f));
+	EXPECT_EQ(7u, histogram.get_percentile_us(100.0f));
+
+	// Huge values are clamped rather than lost
+	histogram.record(0xFFFFFFFFFFull);
+	EXPECT_EQ(0xFFFFFFFFu, histogram.get_maximum_us());
+	EXPECT_EQ(0xFFFFFFFFu, histogram.get_percentile_us(100.0f));
+}
+
+TEST(LATENCY_MONITOR_TESTS, InvalidArguments)
+{
+	CANLatencyMonitor::reset();
+
+	CANLatencyMonitor::record(CAN_PORT_MAXIMUM, CANLatencyMonitor::Stage::RxTotal, 100);
+	CANLatencyMonitor::record(0, CANLatencyMonitor::Stage::NumberOfStages, 100);
+
+	CANLatencyMonitor::Statistics statistics = CANLatencyMonitor::get_statistics(CAN_PORT_MAXIMUM, CANLatencyMonitor::Stage::RxTotal);
+	EXPECT_EQ(0u, statistics.sampleCount);
+	EXPECT_EQ(0u, CANLatencyMonitor::get_percentile_us(0, CANLatencyMonitor::Stage::NumberOfStages, 50.0f));
+
+	for (std::uint8_t i = 0; i < static_cast<std::uint8_t>(CANLatencyMonitor::Stage::NumberOfStages); i++)
+	{
+		EXPECT_EQ(0u, CANLatencyMonitor::get_statistics(0, static_cast<CANLatencyMonitor::Stage>(i)).sampleCount);
+	}
+}
+
+TEST(LATENCY_MONITOR_TESTS, ReceivePipeline)
+{
+	ManualClock clock(500);
+	SystemTiming::set_clock(&clock);
+	CANNetworkManager::CANNetwork.update();
+	CANLatencyMonitor::reset();
+
+	CANMessageFrame testFrame;
+	testFrame.channel = 0;
+	testFrame.isExtendedFrame = true;
+	testFrame.identifier = 0x18FEECF7;
+	testFrame.dataLength = 8;
+	testFrame.timestamp_us = 100;
+	testFrame.readTimestamp_us = 100;
+	testFrame.queueTimestamp_us = 200;
+
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+
+	CANLatencyMonitor::Statistics statistics = CANLatencyMonitor::get_statistics(0, CANLatencyMonitor::Stage::RxQueue);
+	EXPECT_EQ(1u, statistics.sampleCount);
+	EXPECT_EQ(300u, statistics.maximum_us);
+	EXPECT_EQ(300u, statistics.mean_us);
+
+	clock.advance_us(250);
+	CANNetworkManager::CANNetwork.update();
+
+	statistics = CANLatencyMonitor::get_statistics(0, CANLatencyMonitor::Stage::RxStackQueue);
+	EXPECT_EQ(1u, statistics.sampleCount);
+	EXPECT_EQ(250u, statistics.maximum_us);
+
+	statistics = CANLatencyMonitor::get_statistics(0, CANLatencyMonitor::Stage::RxCallbacks);
+	EXPECT_EQ(1u, statistics.sampleCount);
+	EXPECT_EQ(0u, statistics.maximum_us);
+
+	statistics = CANLatencyMonitor::get_statistics(0, CANLatencyMonitor::Stage::RxTotal);
+	EXPECT_EQ(1u, statistics.sampleCount);
+	EXPECT_EQ(650u, statistics.maximum_us);
+	EXPECT_EQ(650u, statistics.median_us);
+	EXPECT_EQ(650u, statistics.percentile99_us);
+
+	// Frames that did not come through a hardware interface are not measured
+	testFrame.queueTimestamp_us = 0;
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+	EXPECT_EQ(1u, CANLatencyMonitor::get_statistics(0, CANLatencyMonitor::Stage::RxTotal).sampleCount);
+
+	CANLatencyMonitor::reset();
+	EXPECT_EQ(0u, CANLatencyMonitor::get_statistics(0, CANLatencyMonitor::Stage::RxTotal).sampleCount);
+	SystemTiming::set_clock(nullptr);
+}
+#else
+TEST(LATENCY_MONITOR_TESTS, Disabled)
+{
+	EXPECT_FALSE(CANLatencyMonitor::get_is_enabled());
+	CANLatencyMonitor::record(0, CANLatencyMonitor::Stage::RxTotal, 100);
+	EXPECT_EQ(0u, CANLatencyMonitor::get_statistics(0, CANLatencyMonitor::Stage::RxTotal).sampleCount);
+}
+#endif
@@ -82,8 +82,7 @@ TEST(MAINTAIN_POWER_TESTS, MessageParsing)
 	interfaceUnderTest.initialize();
 	EXPECT_TRUE(interfaceUnderTest.get_initialized());
 
-	CANMessageFrame testFrame;
-	memset(&testFrame, 0, sizeof(testFrame));
+	CANMessageFrame testFrame = {};
 	testFrame.isExtendedFrame = true;
 
 	// Get the virtual CAN plugin back to a known state
@@ -276,8 +275,7 @@ TEST(MAINTAIN_POWER_TESTS, MessageEncoding)
 
 	ASSERT_TRUE(testECU->get_address_valid());
 
-	CANMessageFrame testFrame;
-	memset(&testFrame, 0, sizeof(testFrame));
+	CANMessageFrame testFrame = {};
 	testFrame.isExtendedFrame = true;
 
 	// Get the virtual CAN plugin back to a known state
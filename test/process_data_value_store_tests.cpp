@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+
+#include "isobus/isobus/isobus_process_data_value_store.hpp"
+
+#include <map>
+#include <thread>
+#include <vector>
+
+using namespace isobus;
+
+TEST(PROCESS_DATA_VALUE_STORE_TESTS, AddGetSet)
+{
+	ProcessDataValueStore store;
+	std::uint32_t value = 0;
+
+	EXPECT_EQ(0u, store.size());
+	EXPECT_FALSE(store.has_value(1, 2));
+	EXPECT_FALSE(store.get_value(1, 2, value));
+	EXPECT_FALSE(store.set_value(1, 2, 3));
+
+	EXPECT_TRUE(store.add_value(1, 2, 42));
+	EXPECT_FALSE(store.add_value(1, 2, 43));
+	EXPECT_TRUE(store.add_value(2, 1, 0, true));
+	EXPECT_EQ(2u, store.size());
+	EXPECT_TRUE(store.has_value(1, 2));
+	EXPECT_FALSE(store.has_value(1, 1));
+
+	EXPECT_TRUE(store.get_value(1, 2, value));
+	EXPECT_EQ(42u, value);
+	EXPECT_TRUE(store.set_value(1, 2, 1000));
+	EXPECT_TRUE(store.get_value(1, 2, value));
+	EXPECT_EQ(1000u, value);
+	EXPECT_TRUE(store.get_value(2, 1, value));
+	EXPECT_EQ(0u, value);
+}
+
+TEST(PROCESS_DATA_VALUE_STORE_TESTS, ChangedValues)
+{
+	ProcessDataValueStore store;
+	ProcessDataValueStore::ChangedValue changedValue = { 0, 0, 0, false };
+
+	// Nothing to take before any values are added
+	EXPECT_FALSE(store.take_changed_value(changedValue));
+
+	ASSERT_TRUE(store.add_value(1, 2, 5));
+	ASSERT_TRUE(store.add_value(3, 4, 0, true));
+
+	// Setting the same value is not a change
+	EXPECT_TRUE(store.set_value(1, 2, 5));
+	EXPECT_FALSE(store.take_changed_value(changedValue));
+
+	// Several changes are only reported once, with the latest value
+	EXPECT_TRUE(store.set_value(1, 2, 6));
+	EXPECT_TRUE(store.set_value(3, 4, 1));
+	EXPECT_TRUE(store.set_value(1, 2, 7));
+	ASSERT_TRUE(store.take_changed_value(changedValue));
+	EXPECT_EQ(1, changedValue.elementNumber);
+	EXPECT_EQ(2, changedValue.ddi);
+	EXPECT_EQ(7u, changedValue.value);
+	EXPECT_FALSE(changedValue.sendOnChange);
+	ASSERT_TRUE(store.take_changed_value(changedValue));
+	EXPECT_EQ(3, changedValue.elementNumber);
+	EXPECT_EQ(4, changedValue.ddi);
+	EXPECT_EQ(1u, changedValue.value);
+	EXPECT_TRUE(changedValue.sendOnChange);
+	EXPECT_FALSE(store.take_changed_value(changedValue));
+
+	// Once taken, a value is reported again the next time it changes
+	EXPECT_TRUE(store.set_value(1, 2, 8));
+	ASSERT_TRUE(store.take_changed_value(changedValue));
+	EXPECT_EQ(8u, changedValue.value);
+
+	// Adding values grows the queue without losing changes that weren't taken yet
+	EXPECT_TRUE(store.set_value(3, 4, 2));
+	for (std::uint16_t i = 0; i < 100; i++)
+	{
+		ASSERT_TRUE(store.add_value(10, i));
+	}
+	for (std::uint16_t i = 0; i < 100; i++)
+	{
+		EXPECT_TRUE(store.set_value(10, i, i + 1u));
+	}
+
+	ASSERT_TRUE(store.take_changed_value(changedValue));
+	EXPECT_EQ(4, changedValue.ddi);
+	EXPECT_EQ(2u, changedValue.value);
+
+	for (std::uint16_t i = 0; i < 100; i++)
+	{
+		ASSERT_TRUE(store.take_changed_value(changedValue));
+		EXPECT_EQ(10, changedValue.elementNumber);
+		EXPECT_EQ(i, changedValue.ddi);
+		EXPECT_EQ(i + 1u, changedValue.value);
+	}
+	EXPECT_FALSE(store.take_changed_value(changedValue));
+
+	// A store with a single value queues its changes too
+	ProcessDataValueStore singleValueStore;
+	ASSERT_TRUE(singleValueStore.add_value(5, 6));
+	EXPECT_FALSE(singleValueStore.take_changed_value(changedValue));
+	EXPECT_TRUE(singleValueStore.set_value(5, 6, 9));
+	ASSERT_TRUE(singleValueStore.take_changed_value(changedValue));
+	EXPECT_EQ(5, changedValue.elementNumber);
+	EXPECT_EQ(6, changedValue.ddi);
+	EXPECT_EQ(9u, changedValue.value);
+	EXPECT_FALSE(singleValueStore.take_changed_value(changedValue));
+}
+
+TEST(PROCESS_DATA_VALUE_STORE_TESTS, ValueChangedCallback)
+{
+	ProcessDataValueStore store;
+	ProcessDataValueStore::ChangedValue changedValue = { 0, 0, 0, false };
+	std::uint32_t numberOfCallbacks = 0;
+
+	store.set_value_changed_callback([](void *parentPointer) { (*static_cast<std::uint32_t *>(parentPointer))++; }, &numberOfCallbacks);
+
+	// A store with a single value still queues its changes
+	ASSERT_TRUE(store.add_value(1, 2));
+	EXPECT_TRUE(store.set_value(1, 2, 3));
+	EXPECT_EQ(1u, numberOfCallbacks);
+
+	// The callback is only called when the value is newly queued
+	EXPECT_TRUE(store.set_value(1, 2, 4));
+	EXPECT_TRUE(store.set_value(1, 2, 4));
+	EXPECT_EQ(1u, numberOfCallbacks);
+
+	ASSERT_TRUE(store.take_changed_value(changedValue));
+	EXPECT_EQ(4u, changedValue.value);
+	EXPECT_TRUE(store.set_value(1, 2, 5));
+	EXPECT_EQ(2u, numberOfCallbacks);
+
+	store.set_value_changed_callback(nullptr, nullptr);
+	ASSERT_TRUE(store.take_changed_value(changedValue));
+	EXPECT_TRUE(store.set_value(1, 2, 6));
+	EXPECT_EQ(2u, numberOfCallbacks);
+}
+
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+TEST(PROCESS_DATA_VALUE_STORE_TESTS, ConcurrentWriters)
+{
+	constexpr std::uint16_t NUMBER_OF_WRITERS = 4;
+	constexpr std::uint16_t VALUES_PER_WRITER = 64;
+	constexpr std::uint32_t NUMBER_OF_UPDATES = 2000;
+	ProcessDataValueStore store;
+	std::map<std::uint32_t, std::uint32_t> lastTakenValues;
+	std::atomic<bool> writersDone = { false };
+
+	for (std::uint16_t writer = 0; writer < NUMBER_OF_WRITERS; writer++)
+	{
+		for (std::uint16_t i = 0; i < VALUES_PER_WRITER; i++)
+		{
+			ASSERT_TRUE(store.add_value(writer, i));
+		}
+	}
+
+	auto take_values = [&store, &lastTakenValues]() {
+		ProcessDataValueStore::ChangedValue changedValue = { 0, 0, 0, false };
+		while (store.take_changed_value(changedValue))
+		{
+			lastTakenValues[(static_cast<std::uint32_t>(changedValue.elementNumber) << 16) | changedValue.ddi] = changedValue.value;
+		}
+	};
+
+	std::thread consumer([&writersDone, &take_values]() {
+		while (!writersDone)
+		{
+			take_values();
+		}
+	});
+
+	std::vector<std::thread> writers;
+	for (std::uint16_t writer = 0; writer < NUMBER_OF_WRITERS; writer++)
+	{
+		writers.emplace_back([&store, writer, VALUES_PER_WRITER, NUMBER_OF_UPDATES]() {
+			for (std::uint32_t update = 1; update <= NUMBER_OF_UPDATES; update++)
+			{
+				for (std::uint16_t i = 0; i < VALUES_PER_WRITER; i++)
+				{
+					store.set_value(writer, i, update);
+				}
+			}
+		});
+	}
+
+	for (auto &writer : writers)
+	{
+		writer.join();
+	}
+	writersDone = true;
+	consumer.join();
+	take_values();
+
+	// Every variable's final value must have been seen by the consumer
+	ASSERT_EQ(static_cast<std::size_t>(NUMBER_OF_WRITERS * VALUES_PER_WRITER), lastTakenValues.size());
+	for (const auto &takenValue : lastTakenValues)
+	{
+		std::uint32_t value = 0;
+		EXPECT_TRUE(store.get_value(static_cast<std::uint16_t>(takenValue.first >> 16), static_cast<std::uint16_t>(takenValue.first & 0xFFFF), value));
+		EXPECT_EQ(NUMBER_OF_UPDATES, value);
+		EXPECT_EQ(NUMBER_OF_UPDATES, takenValue.second);
+	}
+}
+
+TEST(PROCESS_DATA_VALUE_STORE_TESTS, TakeWhileSetting)
+{
+	constexpr std::uint32_t NUMBER_OF_UPDATES = 200000;
+	ProcessDataValueStore store;
+	std::atomic<bool> writerDone = { false };
+	std::uint32_t lastTakenValue = 0;
+
+	// A single variable, so that every set races with the consumer clearing its changed flag
+	ASSERT_TRUE(store.add_value(1, 2));
+
+	auto take_values = [&store, &lastTakenValue]() {
+		ProcessDataValueStore::ChangedValue changedValue = { 0, 0, 0, false };
+		while (store.take_changed_value(changedValue))
+		{
+			lastTakenValue = changedValue.value;
+		}
+	};
+
+	std::thread consumer([&writerDone, &take_values]() {
+		while (!writerDone)
+		{
+			take_values();
+		}
+	});
+
+	for (std::uint32_t update = 1; update <= NUMBER_OF_UPDATES; update++)
+	{
+		store.set_value(1, 2, update);
+	}
+	writerDone = true;
+	consumer.join();
+	take_values();
+
+	// The last change can't be lost, even if it was set while the consumer was taking the previous one
+	EXPECT_EQ(NUMBER_OF_UPDATES, lastTakenValue);
+}
+#endif
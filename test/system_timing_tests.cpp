@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include "isobus/utility/system_timing.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace isobus;
+
+TEST(SYSTEM_TIMING_TESTS, ManualClock)
+{
+	ManualClock clock(5000);
+	SystemTiming::set_clock(&clock);
+	EXPECT_EQ(&clock, SystemTiming::get_clock());
+
+	EXPECT_EQ(5000u, SystemTiming::get_timestamp_us());
+	EXPECT_EQ(5u, SystemTiming::get_timestamp_ms());
+
+	std::uint32_t startTime_ms = SystemTiming::get_timestamp_ms();
+	EXPECT_FALSE(SystemTiming::time_expired_ms(startTime_ms, 100));
+
+	clock.advance_ms(99);
+	EXPECT_FALSE(SystemTiming::time_expired_ms(startTime_ms, 100));
+	EXPECT_EQ(99u, SystemTiming::get_time_elapsed_ms(startTime_ms));
+
+	clock.advance_us(1000);
+	EXPECT_TRUE(SystemTiming::time_expired_ms(startTime_ms, 100));
+	EXPECT_TRUE(SystemTiming::time_expired_us(5000, 100000));
+
+	clock.set_time_us(1000000);
+	EXPECT_EQ(1000u, SystemTiming::get_timestamp_ms());
+
+	SystemTiming::set_clock(nullptr);
+	EXPECT_EQ(nullptr, SystemTiming::get_clock());
+}
+
+TEST(SYSTEM_TIMING_TESTS, ManualClockRollover)
+{
+	ManualClock clock(0xFFFFFFFFull * 1000);
+	SystemTiming::set_clock(&clock);
+
+	std::uint32_t startTime_ms = SystemTiming::get_timestamp_ms();
+	EXPECT_EQ(0xFFFFFFFFu, startTime_ms);
+
+	clock.advance_ms(10);
+	EXPECT_EQ(9u, SystemTiming::get_timestamp_ms());
+	EXPECT_EQ(10u, SystemTiming::get_time_elapsed_ms(startTime_ms));
+	EXPECT_TRUE(SystemTiming::time_expired_ms(startTime_ms, 10));
+
+	SystemTiming::set_clock(nullptr);
+}
+
+TEST(SYSTEM_TIMING_TESTS, Snapshot)
+{
+	ManualClock clock(1000);
+	SystemTiming::set_clock(&clock);
+
+	{
+		SystemTiming::Snapshot snapshot;
+		clock.advance_ms(50);
+		EXPECT_EQ(1000u, SystemTiming::get_timestamp_us());
+
+		{
+			// Nested snapshots keep the time of the outermost one
+			SystemTiming::Snapshot nestedSnapshot;
+			clock.advance_ms(50);
+			EXPECT_EQ(1000u, SystemTiming::get_timestamp_us());
+		}
+		EXPECT_EQ(1000u, SystemTiming::get_timestamp_us());
+
+		// Other threads are not affected by this thread's snapshot
+		std::uint64_t otherThreadTime_us = 0;
+		std::thread otherThread([&otherThreadTime_us]() { otherThreadTime_us = SystemTiming::get_timestamp_us(); });
+		otherThread.join();
+		EXPECT_EQ(101000u, otherThreadTime_us);
+	}
+	EXPECT_EQ(101000u, SystemTiming::get_timestamp_us());
+
+	SystemTiming::set_clock(nullptr);
+}
+
+TEST(SYSTEM_TIMING_TESTS, SteadyClock)
+{
+	std::uint32_t startTime_ms;
+
+	{
+		SystemTiming::Snapshot snapshot;
+		startTime_ms = SystemTiming::get_timestamp_ms();
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		EXPECT_EQ(startTime_ms, SystemTiming::get_timestamp_ms());
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	EXPECT_GE(SystemTiming::get_time_elapsed_ms(startTime_ms), 5u);
+}
@@ -3,9 +3,15 @@
 #include "isobus/hardware_integration/can_hardware_interface.hpp"
 #include "isobus/hardware_integration/virtual_can_plugin.hpp"
 #include "isobus/isobus/can_network_manager.hpp"
+#include "isobus/isobus/isobus_standard_data_description_indices.hpp"
 #include "isobus/isobus/isobus_task_controller_client.hpp"
+#include "isobus/isobus/isobus_task_controller_client_executor.hpp"
 #include "isobus/utility/system_timing.hpp"
 
+#include <map>
+#include <utility>
+#include <vector>
+
 using namespace isobus;
 
 class DerivedTestTCClient : public TaskControllerClient
@@ -1190,6 +1196,83 @@ TEST(TASK_CONTROLLER_CLIENT_TESTS, ClientSettings)
 	EXPECT_EQ(true, interfaceUnderTest.get_supports_tcgeo_with_position_based_control());
 }
 
+static std::shared_ptr<DeviceDescriptorObjectPool> build_label_test_ddop(const std::string &elementDesignator)
+{
+	auto retVal = std::make_shared<DeviceDescriptorObjectPool>();
+
+	EXPECT_TRUE(retVal->add_device("Label Test", "1.0.0", "123", "Manual1", { 0 }, std::vector<std::uint8_t>(), 0xA000820000000001));
+	EXPECT_TRUE(retVal->add_device_element(elementDesignator, 0, 0, task_controller_object::DeviceElementObject::Type::Device, 1));
+	EXPECT_TRUE(retVal->add_device_process_data("Actual Work State", static_cast<std::uint16_t>(DataDescriptionIndex::ActualWorkState), task_controller_object::Object::NULL_OBJECT_ID, static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::PropertiesBit::MemberOfDefaultSet), static_cast<std::uint8_t>(task_controller_object::DeviceProcessDataObject::AvailableTriggerMethods::OnChange), 2));
+	std::static_pointer_cast<task_controller_object::DeviceElementObject>(retVal->get_object_by_id(1))->add_reference_to_child_object(2);
+	return retVal;
+}
+
+static std::string generate_label_test_structure_label(const std::shared_ptr<DeviceDescriptorObjectPool> &ddop)
+{
+	DerivedTestTCClient interfaceUnderTest(nullptr, nullptr);
+
+	interfaceUnderTest.configure(ddop, 6, 64, 32, false, false, false, false, false);
+	interfaceUnderTest.set_automatic_ddop_labels(true);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::ProcessDDOP);
+	interfaceUnderTest.update();
+	EXPECT_EQ(TaskControllerClient::StateMachineState::RequestStructureLabel, interfaceUnderTest.test_wrapper_get_state());
+	return std::static_pointer_cast<task_controller_object::DeviceObject>(ddop->get_object_by_id(0))->get_structure_label();
+}
+
+TEST(TASK_CONTROLLER_CLIENT_TESTS, AutomaticDDOPLabels)
+{
+	DerivedTestTCClient interfaceUnderTest(nullptr, nullptr);
+	auto testDDOP = build_label_test_ddop("Sprayer");
+
+	EXPECT_FALSE(interfaceUnderTest.get_automatic_ddop_labels());
+	interfaceUnderTest.set_automatic_ddop_labels(true);
+	EXPECT_TRUE(interfaceUnderTest.get_automatic_ddop_labels());
+
+	interfaceUnderTest.configure(testDDOP, 6, 64, 32, false, false, false, false, false);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::ProcessDDOP);
+	interfaceUnderTest.update();
+	EXPECT_EQ(TaskControllerClient::StateMachineState::RequestStructureLabel, interfaceUnderTest.test_wrapper_get_state());
+
+	// The labels come from the language command and from the pool's contents
+	auto deviceObject = std::static_pointer_cast<task_controller_object::DeviceObject>(testDDOP->get_object_by_id(0));
+	std::string structureLabel = deviceObject->get_structure_label();
+	ASSERT_EQ(7u, structureLabel.size());
+	EXPECT_EQ(std::string::npos, structureLabel.find_first_not_of("0123456789ABCDEFGHJKMNPQRSTVWXYZ"));
+	EXPECT_EQ(interfaceUnderTest.languageCommandInterface.get_localization_raw_data(), deviceObject->get_localization_label());
+
+	// An identical pool gets the same label, and a changed one gets a new label
+	EXPECT_EQ(structureLabel, generate_label_test_structure_label(build_label_test_ddop("Sprayer")));
+	EXPECT_NE(structureLabel, generate_label_test_structure_label(build_label_test_ddop("Spreader")));
+
+	// Reuploading an unchanged pool keeps the active one
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+	EXPECT_TRUE(interfaceUnderTest.reupload_device_descriptor_object_pool(build_label_test_ddop("Sprayer")));
+	EXPECT_EQ(TaskControllerClient::StateMachineState::Connected, interfaceUnderTest.test_wrapper_get_state());
+
+	// Reuploading a changed pool replaces it
+	EXPECT_TRUE(interfaceUnderTest.reupload_device_descriptor_object_pool(build_label_test_ddop("Spreader")));
+	EXPECT_EQ(TaskControllerClient::StateMachineState::DeactivateObjectPool, interfaceUnderTest.test_wrapper_get_state());
+
+	// A language change between two reuploads of the same pool changes the localization label, so the pool is replaced
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+	EXPECT_TRUE(interfaceUnderTest.reupload_device_descriptor_object_pool(build_label_test_ddop("Spreader")));
+	EXPECT_EQ(TaskControllerClient::StateMachineState::Connected, interfaceUnderTest.test_wrapper_get_state());
+	interfaceUnderTest.languageCommandInterface.set_language_code("de");
+	auto germanDDOP = build_label_test_ddop("Spreader");
+	EXPECT_TRUE(interfaceUnderTest.reupload_device_descriptor_object_pool(germanDDOP));
+	EXPECT_EQ(TaskControllerClient::StateMachineState::DeactivateObjectPool, interfaceUnderTest.test_wrapper_get_state());
+	EXPECT_EQ('d', std::static_pointer_cast<task_controller_object::DeviceObject>(germanDDOP->get_object_by_id(0))->get_localization_label()[0]);
+
+	// Without automatic labels, the pool's own labels are used
+	auto manualDDOP = build_label_test_ddop("Sprayer");
+	interfaceUnderTest.set_automatic_ddop_labels(false);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Disconnected);
+	interfaceUnderTest.configure(manualDDOP, 6, 64, 32, false, false, false, false, false);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::ProcessDDOP);
+	interfaceUnderTest.update();
+	EXPECT_EQ("Manual1", std::static_pointer_cast<task_controller_object::DeviceObject>(manualDDOP->get_object_by_id(0))->get_structure_label());
+}
+
 TEST(TASK_CONTROLLER_CLIENT_TESTS, TimeoutTests)
 {
 	NAME clientNAME(0);
@@ -1756,3 +1839,657 @@ TEST(TASK_CONTROLLER_CLIENT_TESTS, CallbackTests)
 	ASSERT_TRUE(TestPartnerTC->destroy(3));
 	ASSERT_TRUE(internalECU->destroy(3));
 }
+
+/// @brief Connects a TC client's control functions to a virtual TC server, and cleans up afterwards so tests don't depend on each other
+class TaskControllerClientTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		take_control_functions_offline();
+		serverTC.open();
+
+		CANHardwareInterface::set_number_of_can_channels(1);
+		CANHardwareInterface::assign_can_channel_frame_handler(0, std::make_shared<VirtualCANPlugin>());
+		CANHardwareInterface::start();
+
+		NAME clientNAME(0);
+		clientNAME.set_industry_group(2);
+		clientNAME.set_ecu_instance(1);
+		clientNAME.set_function_code(static_cast<std::uint8_t>(NAME::Function::RateControl));
+		internalECU = InternalControlFunction::create(clientNAME, 0x86, 0);
+		const isobus::NAMEFilter filterTaskController(isobus::NAME::NAMEParameters::FunctionCode, static_cast<std::uint8_t>(isobus::NAME::Function::TaskController));
+		const isobus::NAMEFilter filterTaskControllerIdentity(isobus::NAME::NAMEParameters::IdentityNumber, 0x405);
+		const std::vector<isobus::NAMEFilter> tcNameFilters = { filterTaskController, filterTaskControllerIdentity };
+		TestPartnerTC = isobus::PartneredControlFunction::create(0, tcNameFilters);
+		blankDDOP = std::make_shared<DeviceDescriptorObjectPool>();
+
+		std::uint32_t waitingTimestamp_ms = SystemTiming::get_timestamp_ms();
+
+		while ((!internalECU->get_address_valid()) &&
+		       (!SystemTiming::time_expired_ms(waitingTimestamp_ms, 2000)))
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		}
+		ASSERT_TRUE(internalECU->get_address_valid());
+
+		// Force claim a partner
+		testFrame.dataLength = 8;
+		testFrame.channel = 0;
+		testFrame.isExtendedFrame = true;
+		testFrame.identifier = 0x18EEFFF7;
+		testFrame.data[0] = 0x05;
+		testFrame.data[1] = 0x04;
+		testFrame.data[2] = 0x00;
+		testFrame.data[3] = 0x13;
+		testFrame.data[4] = 0x00;
+		testFrame.data[5] = 0x82;
+		testFrame.data[6] = 0x00;
+		testFrame.data[7] = 0xA0;
+		CANNetworkManager::process_receive_can_message_frame(testFrame);
+	}
+
+	void TearDown() override
+	{
+		SystemTiming::set_clock(nullptr);
+		CANHardwareInterface::stop();
+		serverTC.close();
+
+		TestPartnerTC->destroy();
+		internalECU->destroy();
+		take_control_functions_offline();
+	}
+
+	/// @brief Makes the network manager forget every control function left over from earlier tests
+	/// @details Destroyed control functions stay on the bus as external ones with the same NAME,
+	/// which would keep this test's control functions from claiming the same addresses.
+	/// Requesting address claims, and not answering, takes them all offline.
+	void take_control_functions_offline()
+	{
+		ManualClock clock(1000000);
+		CANMessageFrame requestFrame;
+
+		SystemTiming::set_clock(&clock);
+		requestFrame.dataLength = 3;
+		requestFrame.channel = 0;
+		requestFrame.isExtendedFrame = true;
+		requestFrame.identifier = 0x18EAFFFE;
+		requestFrame.data[0] = 0x00;
+		requestFrame.data[1] = 0xEE;
+		requestFrame.data[2] = 0x00;
+		CANNetworkManager::process_receive_can_message_frame(requestFrame);
+		CANNetworkManager::CANNetwork.update();
+		clock.advance_ms(1000);
+		CANNetworkManager::CANNetwork.update();
+		SystemTiming::set_clock(nullptr);
+	}
+
+	/// @brief Waits for the client's start up messages and discards them, and anything else the server has received
+	void clear_sent_frames()
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		while (!serverTC.get_queue_empty())
+		{
+			serverTC.read_frame(testFrame);
+		}
+	}
+
+	VirtualCANPlugin serverTC;
+	std::shared_ptr<InternalControlFunction> internalECU;
+	std::shared_ptr<PartneredControlFunction> TestPartnerTC;
+	std::shared_ptr<DeviceDescriptorObjectPool> blankDDOP;
+	CANMessageFrame testFrame;
+};
+
+static std::map<std::uint16_t, std::uint32_t> scheduledValues;
+static std::map<std::uint16_t, std::uint32_t> scheduledValueRequestCounts;
+
+static constexpr std::uint32_t UNAVAILABLE_SCHEDULED_VALUE = 0xFFFFFFFF;
+
+static bool scheduled_value_request_callback(std::uint16_t,
+                                             std::uint16_t ddi,
+                                             std::uint32_t &value,
+                                             void *)
+{
+	value = scheduledValues[ddi];
+	scheduledValueRequestCounts[ddi]++;
+	return (UNAVAILABLE_SCHEDULED_VALUE != value);
+}
+
+TEST_F(TaskControllerClientTest, MeasurementScheduling)
+{
+	DerivedTestTCClient interfaceUnderTest(TestPartnerTC, internalECU);
+	interfaceUnderTest.initialize(false);
+	clear_sent_frames();
+	ASSERT_TRUE(TestPartnerTC->get_address_valid());
+
+	ManualClock clock(SystemTiming::get_timestamp_us());
+	SystemTiming::set_clock(&clock);
+
+	EXPECT_EQ(100u, interfaceUnderTest.get_threshold_check_interval());
+	interfaceUnderTest.set_threshold_check_interval(0);
+	EXPECT_EQ(0u, interfaceUnderTest.get_threshold_check_interval());
+
+	interfaceUnderTest.configure(blankDDOP, 1, 32, 32, true, false, true, false, true);
+	interfaceUnderTest.add_request_value_callback(scheduled_value_request_callback, nullptr);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+
+	// Status message
+	testFrame.identifier = 0x18CBFFF7;
+	testFrame.data[0] = 0xFE; // Status mux
+	testFrame.data[1] = 0xFF; // Element number, set to not available
+	testFrame.data[2] = 0xFF; // DDI (N/A)
+	testFrame.data[3] = 0xFF; // DDI (N/A)
+	testFrame.data[4] = 0x01; // Status (task active)
+	testFrame.data[5] = 0x00; // Command address
+	testFrame.data[6] = 0x00; // Command
+	testFrame.data[7] = 0xFF; // Reserved
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+
+	auto send_measurement_command = [this](std::uint8_t command, std::uint16_t ddi, std::uint32_t value) {
+		testFrame.identifier = 0x18CB86F7;
+		testFrame.data[0] = static_cast<std::uint8_t>(0x10 | command); // Element 1
+		testFrame.data[1] = 0x00;
+		testFrame.data[2] = static_cast<std::uint8_t>(ddi & 0xFF);
+		testFrame.data[3] = static_cast<std::uint8_t>(ddi >> 8);
+		testFrame.data[4] = static_cast<std::uint8_t>(value & 0xFF);
+		testFrame.data[5] = static_cast<std::uint8_t>((value >> 8) & 0xFF);
+		testFrame.data[6] = static_cast<std::uint8_t>((value >> 16) & 0xFF);
+		testFrame.data[7] = static_cast<std::uint8_t>((value >> 24) & 0xFF);
+		CANNetworkManager::process_receive_can_message_frame(testFrame);
+		CANNetworkManager::CANNetwork.update();
+	};
+
+	// Two time interval commands are only processed when each one is due
+	send_measurement_command(0x04, 1, 100);
+	send_measurement_command(0x04, 2, 250);
+	interfaceUnderTest.update();
+	EXPECT_EQ(0u, scheduledValueRequestCounts[1]);
+	EXPECT_EQ(0u, scheduledValueRequestCounts[2]);
+
+	clock.advance_ms(100);
+	interfaceUnderTest.update();
+	EXPECT_EQ(1u, scheduledValueRequestCounts[1]);
+	EXPECT_EQ(0u, scheduledValueRequestCounts[2]);
+
+	clock.advance_ms(100);
+	interfaceUnderTest.update();
+	interfaceUnderTest.update();
+	EXPECT_EQ(2u, scheduledValueRequestCounts[1]);
+	EXPECT_EQ(0u, scheduledValueRequestCounts[2]);
+
+	clock.advance_ms(50);
+	interfaceUnderTest.update();
+	EXPECT_EQ(2u, scheduledValueRequestCounts[1]);
+	EXPECT_EQ(1u, scheduledValueRequestCounts[2]);
+
+	clock.advance_ms(50);
+	interfaceUnderTest.update();
+	EXPECT_EQ(3u, scheduledValueRequestCounts[1]);
+	EXPECT_EQ(1u, scheduledValueRequestCounts[2]);
+
+	// Shortening an interval moves when the command is next due
+	send_measurement_command(0x04, 1, 20);
+	clock.advance_ms(20);
+	interfaceUnderTest.update();
+	EXPECT_EQ(4u, scheduledValueRequestCounts[1]);
+
+	// Clear the time interval commands so they don't get in the way
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Disconnected);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+	clock.advance_ms(1000);
+	interfaceUnderTest.update();
+	EXPECT_EQ(4u, scheduledValueRequestCounts[1]);
+	EXPECT_EQ(1u, scheduledValueRequestCounts[2]);
+
+	// Changing an interval back and forth still leaves the command scheduled once
+	send_measurement_command(0x04, 10, 100);
+	send_measurement_command(0x04, 10, 50);
+	send_measurement_command(0x04, 10, 100);
+	clock.advance_ms(100);
+	interfaceUnderTest.update();
+	interfaceUnderTest.update();
+	EXPECT_EQ(1u, scheduledValueRequestCounts[10]);
+
+	// A value that can't be read is retried a little later, instead of keeping the client due
+	scheduledValues[10] = UNAVAILABLE_SCHEDULED_VALUE;
+	clock.advance_ms(100);
+	interfaceUnderTest.update();
+	EXPECT_EQ(2u, scheduledValueRequestCounts[10]);
+	EXPECT_NE(0u, interfaceUnderTest.get_time_until_update_due_ms());
+	interfaceUnderTest.update();
+	EXPECT_EQ(2u, scheduledValueRequestCounts[10]);
+
+	scheduledValues[10] = 0;
+	clock.advance_ms(50);
+	interfaceUnderTest.update();
+	EXPECT_EQ(3u, scheduledValueRequestCounts[10]);
+
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Disconnected);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+
+	// A threshold is checked when it arrives, then only when a value is published
+	scheduledValues[3] = 10;
+	send_measurement_command(0x07, 3, 16);
+	interfaceUnderTest.update();
+	EXPECT_EQ(1u, scheduledValueRequestCounts[3]);
+
+	clock.advance_ms(500);
+	interfaceUnderTest.update();
+	EXPECT_EQ(1u, scheduledValueRequestCounts[3]);
+
+	scheduledValues[3] = 20;
+	interfaceUnderTest.on_value_published(1, 3);
+	interfaceUnderTest.on_value_published(1, 3);
+	interfaceUnderTest.on_value_published(1, 9); // No threshold was set for this one
+	interfaceUnderTest.update();
+	EXPECT_EQ(2u, scheduledValueRequestCounts[3]);
+	EXPECT_EQ(0u, scheduledValueRequestCounts[9]);
+
+	// With a check interval, thresholds are also polled
+	interfaceUnderTest.set_threshold_check_interval(100);
+	send_measurement_command(0x08, 4, 1);
+	interfaceUnderTest.update();
+	EXPECT_EQ(1u, scheduledValueRequestCounts[4]);
+
+	clock.advance_ms(50);
+	interfaceUnderTest.update();
+	EXPECT_EQ(1u, scheduledValueRequestCounts[4]);
+
+	clock.advance_ms(50);
+	interfaceUnderTest.update();
+	EXPECT_EQ(2u, scheduledValueRequestCounts[4]);
+	EXPECT_EQ(2u, scheduledValueRequestCounts[3]);
+
+	auto find_sent_value = [this](std::uint16_t ddi, std::uint32_t value) {
+		bool retVal = false;
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		while (!serverTC.get_queue_empty())
+		{
+			serverTC.read_frame(testFrame);
+
+			if ((0x13 == testFrame.data[0]) &&
+			    (ddi == (static_cast<std::uint16_t>(testFrame.data[2]) | (static_cast<std::uint16_t>(testFrame.data[3]) << 8))) &&
+			    (value == (static_cast<std::uint32_t>(testFrame.data[4]) | (static_cast<std::uint32_t>(testFrame.data[5]) << 8))))
+			{
+				retVal = true;
+			}
+		}
+		return retVal;
+	};
+
+	// Values in the value store are used instead of calling the request value callbacks
+	EXPECT_TRUE(interfaceUnderTest.processDataValues.add_value(1, 5, 7));
+	EXPECT_TRUE(interfaceUnderTest.processDataValues.add_value(1, 6, 0, true));
+	send_measurement_command(0x07, 5, 16);
+	interfaceUnderTest.update();
+	EXPECT_FALSE(find_sent_value(5, 7));
+
+	// Changing a stored value checks its thresholds without the application publishing it
+	EXPECT_TRUE(interfaceUnderTest.processDataValues.set_value(1, 5, 20));
+	interfaceUnderTest.update();
+	EXPECT_TRUE(find_sent_value(5, 20));
+
+	// Values added with send on change are sent whenever they change
+	EXPECT_TRUE(interfaceUnderTest.processDataValues.set_value(1, 6, 3));
+	interfaceUnderTest.update();
+	EXPECT_TRUE(find_sent_value(6, 3));
+	interfaceUnderTest.update();
+	EXPECT_FALSE(find_sent_value(6, 3));
+
+	// The TC can also request stored values
+	send_measurement_command(0x02, 6, 0);
+	interfaceUnderTest.update();
+	EXPECT_TRUE(find_sent_value(6, 3));
+	EXPECT_EQ(0u, scheduledValueRequestCounts[5]);
+	EXPECT_EQ(0u, scheduledValueRequestCounts[6]);
+
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Disconnected);
+	SystemTiming::set_clock(nullptr);
+}
+
+static std::uint32_t routedValueCommandCount = 0;
+static std::uint32_t routedValueRequestCount = 0;
+static std::uint32_t generalValueCommandCount = 0;
+static std::uint32_t generalValueRequestCount = 0;
+static std::uint16_t lastRoutedDDI = 0;
+
+static bool routed_value_command_callback(std::uint16_t, std::uint16_t ddi, std::uint32_t, void *)
+{
+	routedValueCommandCount++;
+	lastRoutedDDI = ddi;
+	return true;
+}
+
+static bool routed_value_request_callback(std::uint16_t, std::uint16_t ddi, std::uint32_t &value, void *)
+{
+	routedValueRequestCount++;
+	lastRoutedDDI = ddi;
+	value = 1;
+	return true;
+}
+
+static bool general_value_command_callback(std::uint16_t, std::uint16_t, std::uint32_t, void *)
+{
+	generalValueCommandCount++;
+	return true;
+}
+
+static bool general_value_request_callback(std::uint16_t, std::uint16_t, std::uint32_t &value, void *)
+{
+	generalValueRequestCount++;
+	value = 2;
+	return true;
+}
+
+TEST_F(TaskControllerClientTest, CallbackRouting)
+{
+	DerivedTestTCClient interfaceUnderTest(TestPartnerTC, internalECU);
+	interfaceUnderTest.initialize(false);
+	clear_sent_frames();
+	ASSERT_TRUE(TestPartnerTC->get_address_valid());
+
+	interfaceUnderTest.configure(blankDDOP, 1, 32, 32, true, false, true, false, true);
+	interfaceUnderTest.add_value_command_callback(general_value_command_callback, nullptr);
+	interfaceUnderTest.add_request_value_callback(general_value_request_callback, nullptr);
+	interfaceUnderTest.add_value_command_callback(1, static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState1_16), static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState17_32), routed_value_command_callback, nullptr);
+	interfaceUnderTest.add_request_value_callback(1, 0x0101, routed_value_request_callback, nullptr);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+
+	// Status message
+	testFrame.identifier = 0x18CBFFF7;
+	testFrame.data[0] = 0xFE; // Status mux
+	testFrame.data[1] = 0xFF; // Element number, set to not available
+	testFrame.data[2] = 0xFF; // DDI (N/A)
+	testFrame.data[3] = 0xFF; // DDI (N/A)
+	testFrame.data[4] = 0x01; // Status (task active)
+	testFrame.data[5] = 0x00; // Command address
+	testFrame.data[6] = 0x00; // Command
+	testFrame.data[7] = 0xFF; // Reserved
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+
+	auto send_process_data = [this, &interfaceUnderTest](std::uint8_t command, std::uint16_t element, std::uint16_t ddi) {
+		testFrame.identifier = 0x18CB86F7;
+		testFrame.data[0] = static_cast<std::uint8_t>(((element & 0x0F) << 4) | command);
+		testFrame.data[1] = static_cast<std::uint8_t>(element >> 4);
+		testFrame.data[2] = static_cast<std::uint8_t>(ddi & 0xFF);
+		testFrame.data[3] = static_cast<std::uint8_t>(ddi >> 8);
+		testFrame.data[4] = 0x01;
+		testFrame.data[5] = 0x00;
+		testFrame.data[6] = 0x00;
+		testFrame.data[7] = 0x00;
+		CANNetworkManager::process_receive_can_message_frame(testFrame);
+		CANNetworkManager::CANNetwork.update();
+		interfaceUnderTest.update();
+	};
+
+	// Section control set points go straight to their routed callback
+	send_process_data(0x03, 1, static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState1_16));
+	EXPECT_EQ(1u, routedValueCommandCount);
+	EXPECT_EQ(0u, generalValueCommandCount);
+	send_process_data(0x03, 1, static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState17_32));
+	EXPECT_EQ(2u, routedValueCommandCount);
+	EXPECT_EQ(static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState17_32), lastRoutedDDI);
+	EXPECT_EQ(0u, generalValueCommandCount);
+
+	// Other variables, or the same DDI on another element, use the general callbacks
+	send_process_data(0x03, 2, static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState1_16));
+	send_process_data(0x03, 1, static_cast<std::uint16_t>(DataDescriptionIndex::ActualCondensedWorkState1_16));
+	EXPECT_EQ(2u, routedValueCommandCount);
+	EXPECT_EQ(2u, generalValueCommandCount);
+
+	// Value requests are routed the same way
+	send_process_data(0x02, 1, 0x0101);
+	EXPECT_EQ(1u, routedValueRequestCount);
+	EXPECT_EQ(0x0101, lastRoutedDDI);
+	EXPECT_EQ(0u, generalValueRequestCount);
+	send_process_data(0x02, 1, 0x0102);
+	EXPECT_EQ(1u, routedValueRequestCount);
+	EXPECT_EQ(1u, generalValueRequestCount);
+
+	// Once removed, the general callbacks are used instead
+	interfaceUnderTest.remove_value_command_callback(1, static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState1_16), static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState17_32), routed_value_command_callback, nullptr);
+	interfaceUnderTest.remove_request_value_callback(1, 0x0101, routed_value_request_callback, nullptr);
+	send_process_data(0x03, 1, static_cast<std::uint16_t>(DataDescriptionIndex::SetpointCondensedWorkState1_16));
+	send_process_data(0x02, 1, 0x0101);
+	EXPECT_EQ(2u, routedValueCommandCount);
+	EXPECT_EQ(3u, generalValueCommandCount);
+	EXPECT_EQ(1u, routedValueRequestCount);
+	EXPECT_EQ(2u, generalValueRequestCount);
+
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Disconnected);
+}
+
+TEST_F(TaskControllerClientTest, OutboundValueBatching)
+{
+	DerivedTestTCClient interfaceUnderTest(TestPartnerTC, internalECU);
+	interfaceUnderTest.initialize(false);
+	clear_sent_frames();
+	ASSERT_TRUE(TestPartnerTC->get_address_valid());
+
+	const std::uint16_t sectionStateDDI = static_cast<std::uint16_t>(DataDescriptionIndex::ActualCondensedWorkState1_16);
+
+	EXPECT_EQ(32, interfaceUnderTest.get_process_data_frames_per_update());
+	interfaceUnderTest.set_process_data_frames_per_update(2);
+	EXPECT_EQ(2, interfaceUnderTest.get_process_data_frames_per_update());
+
+	interfaceUnderTest.configure(blankDDOP, 1, 32, 32, true, false, true, false, true);
+	interfaceUnderTest.processDataValues.add_value(1, 0x0101, 0, true);
+	interfaceUnderTest.processDataValues.add_value(1, 0x0102, 0, true);
+	interfaceUnderTest.processDataValues.add_value(1, sectionStateDDI, 0, true);
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+
+	// Status message
+	testFrame.identifier = 0x18CBFFF7;
+	testFrame.data[0] = 0xFE; // Status mux
+	testFrame.data[1] = 0xFF; // Element number, set to not available
+	testFrame.data[2] = 0xFF; // DDI (N/A)
+	testFrame.data[3] = 0xFF; // DDI (N/A)
+	testFrame.data[4] = 0x01; // Status (task active)
+	testFrame.data[5] = 0x00; // Command address
+	testFrame.data[6] = 0x00; // Command
+	testFrame.data[7] = 0xFF; // Reserved
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+
+	auto read_sent_values = [this]() {
+		std::vector<std::pair<std::uint16_t, std::uint32_t>> retVal;
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		while (!serverTC.get_queue_empty())
+		{
+			serverTC.read_frame(testFrame);
+
+			if (0x13 == testFrame.data[0])
+			{
+				retVal.emplace_back(static_cast<std::uint16_t>(testFrame.data[2]) | (static_cast<std::uint16_t>(testFrame.data[3]) << 8),
+				                    static_cast<std::uint32_t>(testFrame.data[4]) | (static_cast<std::uint32_t>(testFrame.data[5]) << 8));
+			}
+		}
+		return retVal;
+	};
+	read_sent_values();
+
+	interfaceUnderTest.processDataValues.set_value(1, 0x0101, 5);
+	interfaceUnderTest.processDataValues.set_value(1, 0x0102, 6);
+	interfaceUnderTest.processDataValues.set_value(1, sectionStateDDI, 7);
+
+	// The TC asks for a value that is also being sent because it changed
+	testFrame.identifier = 0x18CB86F7;
+	testFrame.data[0] = 0x12;
+	testFrame.data[1] = 0x00;
+	testFrame.data[2] = 0x01;
+	testFrame.data[3] = 0x01;
+	testFrame.data[4] = 0x00;
+	testFrame.data[5] = 0x00;
+	testFrame.data[6] = 0x00;
+	testFrame.data[7] = 0x00;
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+
+	// The section state goes first, and duplicates are only sent once
+	interfaceUnderTest.update();
+	auto sentValues = read_sent_values();
+	ASSERT_EQ(2u, sentValues.size());
+	EXPECT_EQ(sectionStateDDI, sentValues[0].first);
+	EXPECT_EQ(7u, sentValues[0].second);
+	EXPECT_EQ(0x0101, sentValues[1].first);
+	EXPECT_EQ(5u, sentValues[1].second);
+
+	// The rest is sent on the next update, with the latest value
+	interfaceUnderTest.processDataValues.set_value(1, 0x0102, 8);
+	interfaceUnderTest.update();
+	sentValues = read_sent_values();
+	ASSERT_EQ(1u, sentValues.size());
+	EXPECT_EQ(0x0102, sentValues[0].first);
+	EXPECT_EQ(8u, sentValues[0].second);
+
+	interfaceUnderTest.update();
+	EXPECT_TRUE(read_sent_values().empty());
+
+	interfaceUnderTest.test_wrapper_set_state(TaskControllerClient::StateMachineState::Disconnected);
+}
+
+TEST_F(TaskControllerClientTest, Executor)
+{
+	auto interfaceUnderTest = std::make_shared<DerivedTestTCClient>(TestPartnerTC, internalECU);
+	interfaceUnderTest->processDataValues.add_value(1, 12, 0, true);
+	interfaceUnderTest->initialize(false);
+	clear_sent_frames();
+	ASSERT_TRUE(TestPartnerTC->get_address_valid());
+
+	ManualClock clock(SystemTiming::get_timestamp_us());
+	SystemTiming::set_clock(&clock);
+
+	interfaceUnderTest->configure(blankDDOP, 1, 32, 32, true, false, true, false, true);
+	interfaceUnderTest->add_request_value_callback(scheduled_value_request_callback, nullptr);
+	interfaceUnderTest->test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+
+	// Status message
+	testFrame.identifier = 0x18CBFFF7;
+	testFrame.data[0] = 0xFE; // Status mux
+	testFrame.data[1] = 0xFF; // Element number, set to not available
+	testFrame.data[2] = 0xFF; // DDI (N/A)
+	testFrame.data[3] = 0xFF; // DDI (N/A)
+	testFrame.data[4] = 0x01; // Status (task active)
+	testFrame.data[5] = 0x00; // Command address
+	testFrame.data[6] = 0x00; // Command
+	testFrame.data[7] = 0xFF; // Reserved
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+
+	auto find_sent_value = [this](std::uint16_t ddi, std::uint32_t value) {
+		bool retVal = false;
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		while (!serverTC.get_queue_empty())
+		{
+			serverTC.read_frame(testFrame);
+
+			if ((0x13 == testFrame.data[0]) &&
+			    (ddi == (static_cast<std::uint16_t>(testFrame.data[2]) | (static_cast<std::uint16_t>(testFrame.data[3]) << 8))) &&
+			    (value == (static_cast<std::uint32_t>(testFrame.data[4]) | (static_cast<std::uint32_t>(testFrame.data[5]) << 8))))
+			{
+				retVal = true;
+			}
+		}
+		return retVal;
+	};
+
+	{
+		TaskControllerClientExecutor executor(0);
+		TaskControllerClientExecutor otherExecutor(0);
+		EXPECT_EQ(0u, executor.get_number_of_threads());
+
+		EXPECT_FALSE(executor.add_client(nullptr));
+		EXPECT_TRUE(executor.add_client(interfaceUnderTest));
+		EXPECT_FALSE(executor.add_client(interfaceUnderTest));
+		EXPECT_FALSE(otherExecutor.add_client(interfaceUnderTest));
+		EXPECT_EQ(1u, executor.get_number_of_clients());
+		EXPECT_EQ(0u, otherExecutor.get_number_of_clients());
+
+		// With nothing to do, the client only needs to watch for the server status message timing out
+		EXPECT_EQ(1000u, executor.update());
+		EXPECT_EQ(6000u, interfaceUnderTest->get_time_until_update_due_ms());
+
+		// Receiving a command wakes the client up, and the measurement decides when it's due next
+		testFrame.identifier = 0x18CB86F7;
+		testFrame.data[0] = 0x14; // Time interval measurement, element 1
+		testFrame.data[1] = 0x00;
+		testFrame.data[2] = 11;
+		testFrame.data[3] = 0x00;
+		testFrame.data[4] = 100;
+		testFrame.data[5] = 0x00;
+		testFrame.data[6] = 0x00;
+		testFrame.data[7] = 0x00;
+		CANNetworkManager::process_receive_can_message_frame(testFrame);
+		CANNetworkManager::CANNetwork.update();
+		EXPECT_EQ(100u, executor.update());
+		EXPECT_EQ(100u, interfaceUnderTest->get_time_until_update_due_ms());
+		EXPECT_EQ(0u, scheduledValueRequestCounts[11]);
+
+		// The client isn't updated before it's due
+		clock.advance_ms(40);
+		EXPECT_EQ(60u, executor.update());
+		EXPECT_EQ(0u, scheduledValueRequestCounts[11]);
+
+		clock.advance_ms(60);
+		EXPECT_EQ(100u, executor.update());
+		EXPECT_EQ(1u, scheduledValueRequestCounts[11]);
+
+		// Changing a stored value wakes the client up too
+		find_sent_value(12, 0);
+		EXPECT_TRUE(interfaceUnderTest->processDataValues.set_value(1, 12, 9));
+		EXPECT_EQ(100u, executor.update());
+		EXPECT_TRUE(find_sent_value(12, 9));
+
+		// So does a change of state
+		interfaceUnderTest->test_wrapper_set_state(TaskControllerClient::StateMachineState::Disconnected);
+		executor.update();
+		EXPECT_EQ(TaskControllerClient::StateMachineState::WaitForStartUpDelay, interfaceUnderTest->test_wrapper_get_state());
+		EXPECT_EQ(6000u, interfaceUnderTest->get_time_until_update_due_ms());
+
+		EXPECT_TRUE(executor.remove_client(interfaceUnderTest));
+		EXPECT_FALSE(executor.remove_client(interfaceUnderTest));
+		EXPECT_EQ(0u, executor.get_number_of_clients());
+		EXPECT_EQ(1000u, executor.update());
+
+		// A client can move to another executor once it has been removed
+		EXPECT_TRUE(otherExecutor.add_client(interfaceUnderTest));
+	}
+
+	// The executor's threads update the client without the application calling update
+	SystemTiming::set_clock(nullptr);
+	interfaceUnderTest->test_wrapper_set_state(TaskControllerClient::StateMachineState::Connected);
+	testFrame.identifier = 0x18CBFFF7;
+	testFrame.data[0] = 0xFE; // Status mux
+	testFrame.data[1] = 0xFF; // Element number, set to not available
+	testFrame.data[2] = 0xFF; // DDI (N/A)
+	testFrame.data[3] = 0xFF; // DDI (N/A)
+	testFrame.data[4] = 0x01; // Status (task active)
+	testFrame.data[5] = 0x00; // Command address
+	testFrame.data[6] = 0x00; // Command
+	testFrame.data[7] = 0xFF; // Reserved
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+	CANNetworkManager::CANNetwork.update();
+	{
+		TaskControllerClientExecutor executor(1);
+		EXPECT_EQ(1u, executor.get_number_of_threads());
+		EXPECT_TRUE(executor.add_client(interfaceUnderTest));
+
+		find_sent_value(12, 0);
+		EXPECT_TRUE(interfaceUnderTest->processDataValues.set_value(1, 12, 10));
+
+		bool valueSent = false;
+		std::uint32_t waitingTimestamp_ms = SystemTiming::get_timestamp_ms();
+		while ((!valueSent) && (!SystemTiming::time_expired_ms(waitingTimestamp_ms, 1000)))
+		{
+			valueSent = find_sent_value(12, 10);
+		}
+		EXPECT_TRUE(valueSent);
+	}
+
+	interfaceUnderTest->test_wrapper_set_state(TaskControllerClient::StateMachineState::Disconnected);
+}
@@ -6,6 +6,7 @@
 #include "isobus/isobus/can_general_parameter_group_numbers.hpp"
 #include "isobus/isobus/can_network_manager.hpp"
 #include "isobus/isobus/isobus_virtual_terminal_client.hpp"
+#include "isobus/isobus/isobus_virtual_terminal_object_pool_parser.hpp"
 #include "isobus/utility/system_timing.hpp"
 
 using namespace isobus;
@@ -56,6 +57,11 @@ public:
 		return VirtualTerminalClient::get_number_bytes_in_object(buffer);
 	}
 
+	bool test_wrapper_index_object_pool(const std::uint8_t *pool, std::uint32_t size, std::vector<std::uint32_t> &objectOffsets)
+	{
+		return VirtualTerminalClient::index_object_pool(pool, size, objectOffsets);
+	}
+
 	bool test_wrapper_resize_object(std::uint8_t *buffer, float scaleFactor, VirtualTerminalObjectType type)
 	{
 		return resize_object(buffer, scaleFactor, type);
@@ -72,6 +78,60 @@ public:
 		VirtualTerminalClient::set_state(value);
 	}
 
+	void test_wrapper_set_vt_geometry(std::uint16_t dataMaskPixels, std::uint8_t softKeyPixels)
+	{
+		xPixels = dataMaskPixels;
+		yPixels = dataMaskPixels;
+		softKeyXAxisPixels = softKeyPixels;
+		softKeyYAxisPixels = softKeyPixels;
+	}
+
+	const std::vector<std::uint8_t> &test_wrapper_get_scaled_object_pool(std::uint8_t poolIndex) const
+	{
+		return objectPools[poolIndex].scaledObjectPool;
+	}
+
+	const MappedIOPFile &test_wrapper_get_cached_scaled_object_pool(std::uint8_t poolIndex) const
+	{
+		return objectPools[poolIndex].cachedScaledObjectPool;
+	}
+
+	bool test_wrapper_get_scaled_object_pool_cache_path(std::uint8_t poolIndex, std::string &path)
+	{
+		std::vector<std::uint8_t> cacheKey;
+		return get_scaled_object_pool_cache_path(objectPools[poolIndex], path, cacheKey);
+	}
+
+	void test_wrapper_optimize_object_pools()
+	{
+		optimize_object_pools();
+	}
+
+	static bool test_wrapper_optimize_object_pool(const std::vector<std::uint8_t> &pool, bool runLengthEncode, bool reduceColourDepth, GraphicMode graphicMode, std::vector<std::uint8_t> &optimizedPool)
+	{
+		return VirtualTerminalClient::optimize_object_pool(pool.data(), static_cast<std::uint32_t>(pool.size()), runLengthEncode, reduceColourDepth, graphicMode, optimizedPool);
+	}
+
+	VirtualTerminalClient::StateMachineState test_wrapper_get_state() const
+	{
+		return state;
+	}
+
+	void test_wrapper_prepare_object_pool_delta()
+	{
+		prepare_object_pool_delta();
+	}
+
+	std::uint32_t test_wrapper_get_object_pool_upload_size(std::uint8_t poolIndex) const
+	{
+		return get_object_pool_upload_size(objectPools[poolIndex]);
+	}
+
+	std::string test_wrapper_get_object_pool_delta_index_path(const std::string &versionLabel) const
+	{
+		return get_object_pool_delta_index_path(versionLabel);
+	}
+
 	static std::vector<std::uint8_t> staticTestPool;
 
 	static bool testWrapperDataChunkCallback(std::uint32_t,
@@ -88,6 +148,37 @@ public:
 	{
 		VirtualTerminalClient::process_command_queue();
 	}
+
+	std::size_t test_wrapper_get_number_of_queued_commands() const
+	{
+		std::size_t retVal = 0;
+
+		for (const auto &priorityQueue : commandQueue)
+		{
+			retVal += priorityQueue.size();
+		}
+		return retVal;
+	}
+
+	bool test_wrapper_get_command_window_available(std::uint8_t functionCode) const
+	{
+		return get_command_window_available(functionCode);
+	}
+
+	void test_wrapper_on_command_sent(std::uint8_t functionCode)
+	{
+		on_command_sent(functionCode);
+	}
+
+	void test_wrapper_update_command_pacing()
+	{
+		update_command_pacing();
+	}
+
+	static bool test_wrapper_get_command_coalescing_key(const std::vector<std::uint8_t> &data, std::uint64_t &key)
+	{
+		return VirtualTerminalClient::get_command_coalescing_key(data.data(), static_cast<std::uint32_t>(data.size()), key);
+	}
 };
 
 std::vector<std::uint8_t> DerivedTestVTClient::staticTestPool;
@@ -346,6 +437,518 @@ TEST(VIRTUAL_TERMINAL_TESTS, FullPoolAutoscalingWithPointer)
 	ASSERT_TRUE(internalECU->destroy(3));
 }
 
+TEST(VIRTUAL_TERMINAL_TESTS, FullPoolAutoscalingWithMappedFile)
+{
+	NAME clientNAME(0);
+	clientNAME.set_arbitrary_address_capable(true);
+	clientNAME.set_industry_group(1);
+	clientNAME.set_device_class(0);
+	clientNAME.set_function_code(static_cast<std::uint8_t>(isobus::NAME::Function::OilSystemMonitor));
+	clientNAME.set_identity_number(1);
+	clientNAME.set_ecu_instance(1);
+	clientNAME.set_function_instance(0);
+	clientNAME.set_device_class_instance(0);
+	clientNAME.set_manufacturer_code(69);
+
+	auto internalECU = InternalControlFunction::create(clientNAME, 0x26, 0);
+
+	std::vector<isobus::NAMEFilter> vtNameFilters;
+	const isobus::NAMEFilter testFilter(isobus::NAME::NAMEParameters::FunctionCode, static_cast<std::uint8_t>(isobus::NAME::Function::VirtualTerminal));
+	vtNameFilters.push_back(testFilter);
+
+	auto vtPartner = PartneredControlFunction::create(0, vtNameFilters);
+
+	DerivedTestVTClient clientUnderTest(vtPartner, internalECU);
+
+	// Actual tests start here
+	MappedIOPFile testPool = isobus::IOPFileInterface::map_iop_file("../examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+
+	if (!testPool.get_is_valid())
+	{
+		// Try a different path to mitigate differences between how IDEs run the unit test
+		testPool = isobus::IOPFileInterface::map_iop_file("examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+	}
+
+	ASSERT_TRUE(testPool.get_is_valid());
+
+	// An invalid mapping is ignored
+	MappedIOPFile invalidPool;
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version3, &invalidPool);
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version3, &testPool);
+	clientUnderTest.set_object_pool_scaling(0, 240, 240);
+
+	// Check functionality of get_any_pool_needs_scaling
+	EXPECT_EQ(true, clientUnderTest.test_wrapper_get_any_pool_needs_scaling());
+
+	// Full scaling test using the example pool
+	EXPECT_EQ(true, clientUnderTest.test_wrapper_scale_object_pools());
+
+	//! @todo try to reduce the reference count, such that that we don't use a control function after it is destroyed
+	ASSERT_TRUE(vtPartner->destroy(3));
+	ASSERT_TRUE(internalECU->destroy(3));
+}
+
+TEST(VIRTUAL_TERMINAL_TESTS, ParallelAndInPlaceAutoscaling)
+{
+	NAME clientNAME(0);
+	auto internalECU = InternalControlFunction::create(clientNAME, 0x26, 0);
+
+	std::vector<isobus::NAMEFilter> vtNameFilters;
+	const isobus::NAMEFilter testFilter(isobus::NAME::NAMEParameters::FunctionCode, static_cast<std::uint8_t>(isobus::NAME::Function::VirtualTerminal));
+	vtNameFilters.push_back(testFilter);
+
+	auto vtPartner = PartneredControlFunction::create(0, vtNameFilters);
+
+	DerivedTestVTClient clientUnderTest(vtPartner, internalECU);
+	clientUnderTest.test_wrapper_set_vt_geometry(480, 80);
+	clientUnderTest.test_wrapper_set_supported_fonts(0xFF, 0xFF);
+
+	std::vector<std::uint8_t> testPool = isobus::IOPFileInterface::read_iop_file("../examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+
+	if (0 == testPool.size())
+	{
+		// Try a different path to mitigate differences between how IDEs run the unit test
+		testPool = isobus::IOPFileInterface::read_iop_file("examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+	}
+	ASSERT_NE(0, testPool.size());
+
+	// Scale a copy one object at a time to get the expected result
+	std::vector<std::uint8_t> expectedPool = testPool;
+	for (std::uint32_t offset = 0; offset < expectedPool.size();)
+	{
+		auto type = static_cast<VirtualTerminalObjectType>(expectedPool[offset + 2]);
+		if (clientUnderTest.test_wrapper_get_is_object_scalable(type))
+		{
+			EXPECT_TRUE(clientUnderTest.test_wrapper_resize_object(&expectedPool[offset], (VirtualTerminalObjectType::Key == type) ? (80.0f / 60.0f) : 2.0f, type));
+		}
+		offset += clientUnderTest.test_wrapper_get_number_bytes_in_object(&expectedPool[offset]);
+	}
+	EXPECT_NE(expectedPool, testPool);
+
+	// Copy, chunk callback and in-place scaling of several pools at once all give the same result
+	std::vector<std::uint8_t> mutablePool = testPool;
+	DerivedTestVTClient::staticTestPool = testPool;
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version3, testPool.data(), testPool.size());
+	clientUnderTest.register_object_pool_data_chunk_callback(1, VirtualTerminalClient::VTVersion::Version3, DerivedTestVTClient::staticTestPool.size(), DerivedTestVTClient::testWrapperDataChunkCallback);
+	clientUnderTest.set_mutable_object_pool(2, VirtualTerminalClient::VTVersion::Version3, mutablePool.data(), mutablePool.size());
+	clientUnderTest.set_object_pool(3, VirtualTerminalClient::VTVersion::Version3, testPool.data(), testPool.size());
+	for (std::uint8_t i = 0; i < 3; i++)
+	{
+		clientUnderTest.set_object_pool_scaling(i, 240, 60);
+	}
+
+	EXPECT_TRUE(clientUnderTest.test_wrapper_scale_object_pools());
+	EXPECT_EQ(expectedPool, clientUnderTest.test_wrapper_get_scaled_object_pool(0));
+	EXPECT_EQ(expectedPool, clientUnderTest.test_wrapper_get_scaled_object_pool(1));
+	EXPECT_TRUE(clientUnderTest.test_wrapper_get_scaled_object_pool(2).empty());
+	EXPECT_EQ(expectedPool, mutablePool);
+
+	// Pools without scaling configured are not copied
+	EXPECT_TRUE(clientUnderTest.test_wrapper_get_scaled_object_pool(3).empty());
+
+	// A pool scaled in place is not scaled again for the same VT
+	EXPECT_TRUE(clientUnderTest.test_wrapper_scale_object_pools());
+	EXPECT_EQ(expectedPool, mutablePool);
+	EXPECT_EQ(expectedPool, clientUnderTest.test_wrapper_get_scaled_object_pool(0));
+
+	// A truncated pool fails to scale rather than reading past its end
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version3, testPool.data(), testPool.size() - 1);
+	clientUnderTest.set_object_pool_scaling(0, 240, 60);
+	EXPECT_FALSE(clientUnderTest.test_wrapper_scale_object_pools());
+
+	// A pool that failed to scale in place isn't treated as already scaled the next time
+	std::vector<std::uint8_t> truncatedMutablePool = testPool;
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version3, testPool.data(), testPool.size());
+	clientUnderTest.set_mutable_object_pool(2, VirtualTerminalClient::VTVersion::Version3, truncatedMutablePool.data(), truncatedMutablePool.size() - 1);
+	clientUnderTest.set_object_pool_scaling(2, 240, 60);
+	EXPECT_FALSE(clientUnderTest.test_wrapper_scale_object_pools());
+	EXPECT_FALSE(clientUnderTest.test_wrapper_scale_object_pools());
+
+	// String objects cut off before their macro list are rejected before their length is read
+	std::vector<std::uint32_t> objectOffsets;
+	std::uint32_t outputStringOffset = 0;
+	EXPECT_TRUE(clientUnderTest.test_wrapper_index_object_pool(testPool.data(), static_cast<std::uint32_t>(testPool.size()), objectOffsets));
+	for (const auto &objectOffset : objectOffsets)
+	{
+		if ((VirtualTerminalObjectType::OutputString == static_cast<VirtualTerminalObjectType>(testPool[objectOffset + 2])) &&
+		    (0 != testPool[objectOffset + 14]))
+		{
+			outputStringOffset = objectOffset;
+			break;
+		}
+	}
+	ASSERT_NE(0u, outputStringOffset);
+	const std::uint32_t outputStringLength = clientUnderTest.test_wrapper_get_number_bytes_in_object(&testPool[outputStringOffset]);
+	EXPECT_TRUE(clientUnderTest.test_wrapper_index_object_pool(testPool.data(), outputStringOffset + outputStringLength, objectOffsets));
+	EXPECT_FALSE(clientUnderTest.test_wrapper_index_object_pool(testPool.data(), outputStringOffset + 10, objectOffsets));
+	EXPECT_FALSE(clientUnderTest.test_wrapper_index_object_pool(testPool.data(), outputStringOffset + clientUnderTest.test_wrapper_get_minimum_object_length(VirtualTerminalObjectType::OutputString), objectOffsets));
+
+	DerivedTestVTClient::staticTestPool.clear();
+	ASSERT_TRUE(vtPartner->destroy(3));
+	ASSERT_TRUE(internalECU->destroy(3));
+}
+
+TEST(VIRTUAL_TERMINAL_TESTS, ScaledObjectPoolCache)
+{
+	NAME clientNAME(0);
+	auto internalECU = InternalControlFunction::create(clientNAME, 0x26, 0);
+
+	std::vector<isobus::NAMEFilter> vtNameFilters;
+	const isobus::NAMEFilter testFilter(isobus::NAME::NAMEParameters::FunctionCode, static_cast<std::uint8_t>(isobus::NAME::Function::VirtualTerminal));
+	vtNameFilters.push_back(testFilter);
+
+	auto vtPartner = PartneredControlFunction::create(0, vtNameFilters);
+
+	DerivedTestVTClient clientUnderTest(vtPartner, internalECU);
+	clientUnderTest.test_wrapper_set_vt_geometry(480, 80);
+	clientUnderTest.test_wrapper_set_supported_fonts(0xFF, 0xFF);
+
+	std::vector<std::uint8_t> testPool = isobus::IOPFileInterface::read_iop_file("../examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+
+	if (0 == testPool.size())
+	{
+		// Try a different path to mitigate differences between how IDEs run the unit test
+		testPool = isobus::IOPFileInterface::read_iop_file("examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+	}
+	ASSERT_NE(0, testPool.size());
+
+	EXPECT_EQ("", clientUnderTest.get_scaled_object_pool_cache_directory());
+	clientUnderTest.set_scaled_object_pool_cache_directory(".");
+	EXPECT_EQ(".", clientUnderTest.get_scaled_object_pool_cache_directory());
+
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version3, testPool.data(), testPool.size());
+	clientUnderTest.set_object_pool_scaling(0, 240, 60);
+
+	std::string cachePath;
+	ASSERT_TRUE(clientUnderTest.test_wrapper_get_scaled_object_pool_cache_path(0, cachePath));
+	EXPECT_EQ(0, cachePath.find("./"));
+	std::remove(cachePath.c_str());
+
+	// The first scale is done normally and saved to the cache
+	EXPECT_TRUE(clientUnderTest.test_wrapper_scale_object_pools());
+	const std::vector<std::uint8_t> scaledPool = clientUnderTest.test_wrapper_get_scaled_object_pool(0);
+	ASSERT_EQ(testPool.size(), scaledPool.size());
+	EXPECT_FALSE(clientUnderTest.test_wrapper_get_cached_scaled_object_pool(0).get_is_valid());
+	const std::vector<std::uint8_t> cacheFile = isobus::IOPFileInterface::read_iop_file(cachePath);
+	ASSERT_GT(cacheFile.size(), scaledPool.size());
+	EXPECT_TRUE(std::equal(scaledPool.begin(), scaledPool.end(), cacheFile.begin()));
+
+	// The next scale for the same VT comes straight from the cache
+	EXPECT_TRUE(clientUnderTest.test_wrapper_scale_object_pools());
+	EXPECT_TRUE(clientUnderTest.test_wrapper_get_scaled_object_pool(0).empty());
+	const MappedIOPFile &cachedPool = clientUnderTest.test_wrapper_get_cached_scaled_object_pool(0);
+	ASSERT_TRUE(cachedPool.get_is_valid());
+	EXPECT_TRUE(std::equal(scaledPool.begin(), scaledPool.end(), cachedPool.get_data()));
+
+	// A file of the right size whose contents don't match its key is scaled again and replaced
+	std::vector<std::uint8_t> corruptedCacheFile = cacheFile;
+	corruptedCacheFile[scaledPool.size() / 2] ^= 0xFF;
+	ASSERT_TRUE(isobus::IOPFileInterface::write_iop_file(cachePath, corruptedCacheFile.data(), static_cast<std::uint32_t>(corruptedCacheFile.size())));
+	EXPECT_TRUE(clientUnderTest.test_wrapper_scale_object_pools());
+	EXPECT_FALSE(clientUnderTest.test_wrapper_get_cached_scaled_object_pool(0).get_is_valid());
+	EXPECT_EQ(scaledPool, clientUnderTest.test_wrapper_get_scaled_object_pool(0));
+	EXPECT_EQ(cacheFile, isobus::IOPFileInterface::read_iop_file(cachePath));
+
+	// So is a file holding a scaled pool of the right size but no key
+	ASSERT_TRUE(isobus::IOPFileInterface::write_iop_file(cachePath, scaledPool.data(), static_cast<std::uint32_t>(scaledPool.size())));
+	EXPECT_TRUE(clientUnderTest.test_wrapper_scale_object_pools());
+	EXPECT_FALSE(clientUnderTest.test_wrapper_get_cached_scaled_object_pool(0).get_is_valid());
+	EXPECT_EQ(cacheFile, isobus::IOPFileInterface::read_iop_file(cachePath));
+
+	// A VT with a different screen size gets a different cache entry
+	std::string otherCachePath;
+	clientUnderTest.test_wrapper_set_vt_geometry(200, 60);
+	ASSERT_TRUE(clientUnderTest.test_wrapper_get_scaled_object_pool_cache_path(0, otherCachePath));
+	EXPECT_NE(cachePath, otherCachePath);
+	std::remove(otherCachePath.c_str());
+	EXPECT_TRUE(clientUnderTest.test_wrapper_scale_object_pools());
+	EXPECT_FALSE(clientUnderTest.test_wrapper_get_cached_scaled_object_pool(0).get_is_valid());
+	EXPECT_NE(scaledPool, clientUnderTest.test_wrapper_get_scaled_object_pool(0));
+
+	clientUnderTest.set_scaled_object_pool_cache_directory("");
+	std::remove(cachePath.c_str());
+	std::remove(otherCachePath.c_str());
+	ASSERT_TRUE(vtPartner->destroy(3));
+	ASSERT_TRUE(internalECU->destroy(3));
+}
+
+static void append_picture_graphic(std::vector<std::uint8_t> &pool, std::uint16_t objectID, std::uint16_t width, std::uint16_t height, std::uint8_t format, std::uint8_t options, const std::vector<std::uint8_t> &rawData, std::uint8_t numberOfMacros)
+{
+	const std::uint32_t rawDataSize = static_cast<std::uint32_t>(rawData.size());
+	const std::uint8_t header[] = {
+		static_cast<std::uint8_t>(objectID & 0xFF),
+		static_cast<std::uint8_t>(objectID >> 8),
+		static_cast<std::uint8_t>(VirtualTerminalObjectType::PictureGraphic),
+		static_cast<std::uint8_t>(width & 0xFF),
+		static_cast<std::uint8_t>(width >> 8),
+		static_cast<std::uint8_t>(width & 0xFF),
+		static_cast<std::uint8_t>(width >> 8),
+		static_cast<std::uint8_t>(height & 0xFF),
+		static_cast<std::uint8_t>(height >> 8),
+		format,
+		options,
+		0, // Transparency colour
+		static_cast<std::uint8_t>(rawDataSize & 0xFF),
+		static_cast<std::uint8_t>((rawDataSize >> 8) & 0xFF),
+		static_cast<std::uint8_t>((rawDataSize >> 16) & 0xFF),
+		static_cast<std::uint8_t>((rawDataSize >> 24) & 0xFF),
+		numberOfMacros
+	};
+	pool.insert(pool.end(), header, header + sizeof(header));
+	pool.insert(pool.end(), rawData.begin(), rawData.end());
+
+	for (std::uint8_t i = 0; i < numberOfMacros; i++)
+	{
+		pool.push_back(0x01); // On show event
+		pool.push_back(i);
+	}
+}
+
+TEST(VIRTUAL_TERMINAL_TESTS, PictureOptimization)
+{
+	std::vector<std::uint8_t> testPool;
+	std::vector<std::uint8_t> optimizedPool;
+	std::vector<std::uint8_t> twoColourPicture;
+	std::vector<std::uint8_t> tenColourPicture;
+	const std::vector<std::uint8_t> encodedPicture = { 200, 4, 56, 7 };
+	const std::uint8_t fontAttributes[] = { 0xD8, 0x59, 0x17, 0x04, 0x02, 0x00, 0x00, 0x00 };
+
+	// 16x4 pixels of four black then four white, 10x2 pixels using colours 0 through 9, and a picture that is already encoded
+	for (std::uint32_t i = 0; i < 64; i++)
+	{
+		twoColourPicture.push_back(((i / 4) % 2) ? 1 : 0);
+	}
+	for (std::uint32_t i = 0; i < 20; i++)
+	{
+		tenColourPicture.push_back(static_cast<std::uint8_t>(i % 10));
+	}
+	append_picture_graphic(testPool, 100, 16, 4, 2, 0, twoColourPicture, 0);
+	append_picture_graphic(testPool, 101, 10, 2, 2, 0, tenColourPicture, 1);
+	append_picture_graphic(testPool, 102, 16, 16, 2, 0x04, encodedPicture, 0);
+	testPool.insert(testPool.end(), fontAttributes, fontAttributes + sizeof(fontAttributes));
+
+	// Nothing to do
+	ASSERT_TRUE(DerivedTestVTClient::test_wrapper_optimize_object_pool(testPool, false, false, VirtualTerminalClient::GraphicMode::TwoHundredFiftySixColour, optimizedPool));
+	EXPECT_EQ(testPool, optimizedPool);
+
+	// Run length encoding only shrinks the first picture
+	ASSERT_TRUE(DerivedTestVTClient::test_wrapper_optimize_object_pool(testPool, true, false, VirtualTerminalClient::GraphicMode::TwoHundredFiftySixColour, optimizedPool));
+	ASSERT_EQ(testPool.size() - 32, optimizedPool.size());
+	EXPECT_EQ(2, optimizedPool[9]);
+	EXPECT_EQ(0x04, optimizedPool[10]);
+	EXPECT_EQ(32, optimizedPool[12]);
+	EXPECT_EQ(4, optimizedPool[17]);
+	EXPECT_EQ(0, optimizedPool[18]);
+	EXPECT_EQ(4, optimizedPool[19]);
+	EXPECT_EQ(1, optimizedPool[20]);
+	EXPECT_TRUE(std::equal(testPool.begin() + 81, testPool.end(), optimizedPool.begin() + 49));
+
+	// Reducing colour depth packs the first picture as monochrome, then encodes it, and packs the second as 4 bit
+	ASSERT_TRUE(DerivedTestVTClient::test_wrapper_optimize_object_pool(testPool, true, true, VirtualTerminalClient::GraphicMode::TwoHundredFiftySixColour, optimizedPool));
+	EXPECT_EQ(0, optimizedPool[9]);
+	EXPECT_EQ(0x04, optimizedPool[10]);
+	EXPECT_EQ(2, optimizedPool[12]);
+	EXPECT_EQ(8, optimizedPool[17]);
+	EXPECT_EQ(0x0F, optimizedPool[18]);
+
+	const std::uint8_t *secondPicture = &optimizedPool[19];
+	const std::uint8_t expectedSecondPictureData[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0x01, 0x23, 0x45, 0x67, 0x89 };
+	EXPECT_EQ(101, secondPicture[0]);
+	EXPECT_EQ(1, secondPicture[9]);
+	EXPECT_EQ(0, secondPicture[10]);
+	EXPECT_EQ(10, secondPicture[12]);
+	EXPECT_TRUE(std::equal(expectedSecondPictureData, expectedSecondPictureData + sizeof(expectedSecondPictureData), &secondPicture[17]));
+	EXPECT_EQ(0x01, secondPicture[27]);
+	EXPECT_EQ(0x00, secondPicture[28]);
+	EXPECT_EQ(testPool.size() - 62 - 10, optimizedPool.size());
+
+	// The optimized pool is still a valid pool
+	VTObjectTable objects;
+	ASSERT_EQ(VTObjectPoolParser::Error::None, VTObjectPoolParser::parse(optimizedPool, objects).error);
+	auto picture = std::static_pointer_cast<PictureGraphic>(objects.get_object(100));
+	ASSERT_NE(nullptr, picture);
+	EXPECT_EQ(PictureGraphic::Format::Monochrome, picture->get_format());
+	EXPECT_TRUE(picture->get_option(PictureGraphic::Options::RunLengthEncoded));
+	EXPECT_EQ(16, picture->get_actual_width());
+
+	// A monochrome VT can't take 4 bit pictures, and a pool with a colour map is not colour reduced
+	ASSERT_TRUE(DerivedTestVTClient::test_wrapper_optimize_object_pool(testPool, false, true, VirtualTerminalClient::GraphicMode::Monochrome, optimizedPool));
+	EXPECT_EQ(testPool.size() - 56, optimizedPool.size());
+	EXPECT_EQ(2, optimizedPool[25 + 9]);
+
+	std::vector<std::uint8_t> colourMapPool = testPool;
+	const std::uint8_t colourMap[] = { 0x10, 0x00, 0x27, 0x02, 0x00, 0x00, 0x01, 0x00 };
+	colourMapPool.insert(colourMapPool.end(), colourMap, colourMap + sizeof(colourMap));
+	ASSERT_TRUE(DerivedTestVTClient::test_wrapper_optimize_object_pool(colourMapPool, false, true, VirtualTerminalClient::GraphicMode::TwoHundredFiftySixColour, optimizedPool));
+	EXPECT_EQ(colourMapPool, optimizedPool);
+
+	// Pools that can't be indexed are rejected
+	std::vector<std::uint8_t> truncatedPool(testPool.begin(), testPool.begin() + 40);
+	EXPECT_FALSE(DerivedTestVTClient::test_wrapper_optimize_object_pool(truncatedPool, true, true, VirtualTerminalClient::GraphicMode::TwoHundredFiftySixColour, optimizedPool));
+
+	// Optimization happens in the client before upload, and the savings are reported
+	NAME clientNAME(0);
+	auto internalECU = InternalControlFunction::create(clientNAME, 0x26, 0);
+
+	std::vector<isobus::NAMEFilter> vtNameFilters;
+	const isobus::NAMEFilter testFilter(isobus::NAME::NAMEParameters::FunctionCode, static_cast<std::uint8_t>(isobus::NAME::Function::VirtualTerminal));
+	vtNameFilters.push_back(testFilter);
+
+	auto vtPartner = PartneredControlFunction::create(0, vtNameFilters);
+
+	DerivedTestVTClient clientUnderTest(vtPartner, internalECU);
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version4, &testPool);
+	clientUnderTest.test_wrapper_optimize_object_pools();
+	EXPECT_EQ(0u, clientUnderTest.get_object_pool_bytes_saved(0));
+	EXPECT_TRUE(clientUnderTest.test_wrapper_get_scaled_object_pool(0).empty());
+
+	clientUnderTest.set_object_pool_picture_optimization(0, true, true);
+	clientUnderTest.test_wrapper_optimize_object_pools();
+	EXPECT_EQ(72u, clientUnderTest.get_object_pool_bytes_saved(0));
+	EXPECT_EQ(testPool.size() - 72, clientUnderTest.test_wrapper_get_scaled_object_pool(0).size());
+	EXPECT_EQ(0u, clientUnderTest.get_object_pool_bytes_saved(1));
+
+	// Turning optimization off uploads the pool as authored again
+	clientUnderTest.set_object_pool_picture_optimization(0, false, false);
+	clientUnderTest.test_wrapper_optimize_object_pools();
+	EXPECT_EQ(0u, clientUnderTest.get_object_pool_bytes_saved(0));
+	EXPECT_TRUE(clientUnderTest.test_wrapper_get_scaled_object_pool(0).empty());
+
+	// Scaled pools are optimized after scaling
+	std::vector<std::uint8_t> examplePool = isobus::IOPFileInterface::read_iop_file("../examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+
+	if (0 == examplePool.size())
+	{
+		// Try a different path to mitigate differences between how IDEs run the unit test
+		examplePool = isobus::IOPFileInterface::read_iop_file("examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+	}
+	ASSERT_NE(0, examplePool.size());
+
+	clientUnderTest.test_wrapper_set_vt_geometry(480, 80);
+	clientUnderTest.test_wrapper_set_supported_fonts(0xFF, 0xFF);
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version3, &examplePool);
+	clientUnderTest.set_object_pool_scaling(0, 240, 60);
+	clientUnderTest.set_object_pool_picture_optimization(0, true, false);
+	ASSERT_TRUE(clientUnderTest.test_wrapper_scale_object_pools());
+	clientUnderTest.test_wrapper_optimize_object_pools();
+	const std::vector<std::uint8_t> &optimizedExamplePool = clientUnderTest.test_wrapper_get_scaled_object_pool(0);
+	ASSERT_FALSE(optimizedExamplePool.empty());
+	EXPECT_EQ(examplePool.size() - clientUnderTest.get_object_pool_bytes_saved(0), optimizedExamplePool.size());
+	EXPECT_EQ(VTObjectPoolParser::Error::None, VTObjectPoolParser::parse(optimizedExamplePool, objects).error);
+	EXPECT_EQ(34u, objects.size());
+
+	ASSERT_TRUE(vtPartner->destroy(3));
+	ASSERT_TRUE(internalECU->destroy(3));
+}
+
+TEST(VIRTUAL_TERMINAL_TESTS, DeltaObjectPoolUpload)
+{
+	NAME clientNAME(0);
+	auto internalECU = InternalControlFunction::create(clientNAME, 0x26, 0);
+
+	std::vector<isobus::NAMEFilter> vtNameFilters;
+	const isobus::NAMEFilter testFilter(isobus::NAME::NAMEParameters::FunctionCode, static_cast<std::uint8_t>(isobus::NAME::Function::VirtualTerminal));
+	vtNameFilters.push_back(testFilter);
+
+	auto vtPartner = PartneredControlFunction::create(0, vtNameFilters);
+
+	DerivedTestVTClient clientUnderTest(vtPartner, internalECU);
+
+	std::vector<std::uint8_t> originalPool = isobus::IOPFileInterface::read_iop_file("../examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+
+	if (0 == originalPool.size())
+	{
+		// Try a different path to mitigate differences between how IDEs run the unit test
+		originalPool = isobus::IOPFileInterface::read_iop_file("examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+	}
+	ASSERT_NE(0, originalPool.size());
+
+	EXPECT_EQ("", clientUnderTest.get_object_pool_delta_upload_directory());
+	clientUnderTest.set_object_pool_delta_upload_directory(".");
+	EXPECT_EQ(".", clientUnderTest.get_object_pool_delta_upload_directory());
+
+	const std::string originalIndexPath = clientUnderTest.test_wrapper_get_object_pool_delta_index_path("v1     ");
+	const std::string updatedIndexPath = clientUnderTest.test_wrapper_get_object_pool_delta_index_path("v2     ");
+	std::remove(originalIndexPath.c_str());
+	std::remove(updatedIndexPath.c_str());
+	EXPECT_EQ(0, originalIndexPath.find("./"));
+	EXPECT_EQ(originalIndexPath.size() - 4, originalIndexPath.find(".idx"));
+
+	// The first upload sends the whole pool, and saves its index once stored
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version3, &originalPool, "v1");
+	clientUnderTest.test_wrapper_optimize_object_pools();
+	clientUnderTest.test_wrapper_prepare_object_pool_delta();
+	EXPECT_TRUE(clientUnderTest.test_wrapper_get_scaled_object_pool(0).empty());
+	EXPECT_EQ(originalPool.size(), clientUnderTest.test_wrapper_get_object_pool_upload_size(0));
+
+	auto receive_response = [&clientUnderTest](VirtualTerminalClient::StateMachineState waitingState, const std::uint8_t *data, std::uint32_t length) {
+		CANMessage testMessage(0);
+		testMessage.set_identifier(CANIdentifier(CANIdentifier::Type::Extended, static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU), CANIdentifier::PriorityDefault6, 0, 0));
+		testMessage.set_data(data, length);
+		clientUnderTest.test_wrapper_set_state(waitingState);
+		clientUnderTest.test_wrapper_process_rx_message(testMessage, &clientUnderTest);
+	};
+	const std::uint8_t storeVersionResponse[] = { 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF };
+	receive_response(VirtualTerminalClient::StateMachineState::WaitForStoreVersionResponse, storeVersionResponse, sizeof(storeVersionResponse));
+	EXPECT_EQ(VirtualTerminalClient::StateMachineState::Connected, clientUnderTest.test_wrapper_get_state());
+	EXPECT_EQ(34u * 10u, isobus::IOPFileInterface::read_iop_file(originalIndexPath).size());
+
+	// Change the working set's background colour, and add a font attributes object
+	std::vector<std::uint8_t> updatedPool = originalPool;
+	const std::uint32_t workingSetSize = clientUnderTest.test_wrapper_get_number_bytes_in_object(updatedPool.data());
+	const std::uint8_t fontAttributes[] = { 0x60, 0xEA, 0x17, 0x04, 0x02, 0x00, 0x00, 0x00 };
+	ASSERT_EQ(VirtualTerminalObjectType::WorkingSet, static_cast<VirtualTerminalObjectType>(updatedPool[2]));
+	updatedPool[3] ^= 0x01;
+	updatedPool.insert(updatedPool.end(), fontAttributes, fontAttributes + sizeof(fontAttributes));
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version3, &updatedPool, "v2");
+
+	// The VT has the old version, so it is kept and loaded rather than deleted
+	const std::uint8_t getVersionsResponse[] = { 0xE0, 2, 'o', 't', 'h', 'e', 'r', ' ', ' ', 'v', '1', ' ', ' ', ' ', ' ', ' ' };
+	receive_response(VirtualTerminalClient::StateMachineState::WaitForGetVersionsResponse, getVersionsResponse, sizeof(getVersionsResponse));
+	EXPECT_EQ(VirtualTerminalClient::StateMachineState::SendLoadVersion, clientUnderTest.test_wrapper_get_state());
+
+	const std::uint8_t loadVersionResponse[] = { 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF };
+	receive_response(VirtualTerminalClient::StateMachineState::WaitForLoadVersionResponse, loadVersionResponse, sizeof(loadVersionResponse));
+	EXPECT_EQ(VirtualTerminalClient::StateMachineState::UploadObjectPool, clientUnderTest.test_wrapper_get_state());
+
+	// Only the changed and added objects are uploaded
+	clientUnderTest.test_wrapper_optimize_object_pools();
+	clientUnderTest.test_wrapper_prepare_object_pool_delta();
+	std::vector<std::uint8_t> expectedDelta(updatedPool.begin(), updatedPool.begin() + workingSetSize);
+	expectedDelta.insert(expectedDelta.end(), fontAttributes, fontAttributes + sizeof(fontAttributes));
+	EXPECT_EQ(expectedDelta, clientUnderTest.test_wrapper_get_scaled_object_pool(0));
+	EXPECT_EQ(expectedDelta.size(), clientUnderTest.test_wrapper_get_object_pool_upload_size(0));
+
+	// Storing the new version replaces the old one's index
+	receive_response(VirtualTerminalClient::StateMachineState::WaitForStoreVersionResponse, storeVersionResponse, sizeof(storeVersionResponse));
+	EXPECT_TRUE(isobus::IOPFileInterface::read_iop_file(originalIndexPath).empty());
+	EXPECT_EQ(35u * 10u, isobus::IOPFileInterface::read_iop_file(updatedIndexPath).size());
+
+	// An unchanged pool has nothing to upload
+	const std::uint8_t getUpdatedVersionResponse[] = { 0xE0, 1, 'v', '2', ' ', ' ', ' ', ' ', ' ', 0xFF };
+	clientUnderTest.set_object_pool(0, VirtualTerminalClient::VTVersion::Version3, &updatedPool, "v3");
+	receive_response(VirtualTerminalClient::StateMachineState::WaitForGetVersionsResponse, getUpdatedVersionResponse, sizeof(getUpdatedVersionResponse));
+	EXPECT_EQ(VirtualTerminalClient::StateMachineState::SendLoadVersion, clientUnderTest.test_wrapper_get_state());
+	clientUnderTest.test_wrapper_optimize_object_pools();
+	clientUnderTest.test_wrapper_prepare_object_pool_delta();
+	EXPECT_TRUE(clientUnderTest.test_wrapper_get_scaled_object_pool(0).empty());
+	EXPECT_EQ(0u, clientUnderTest.test_wrapper_get_object_pool_upload_size(0));
+
+	// Without a saved index the pool is uploaded in full
+	std::remove(updatedIndexPath.c_str());
+	receive_response(VirtualTerminalClient::StateMachineState::WaitForGetVersionsResponse, getUpdatedVersionResponse, sizeof(getUpdatedVersionResponse));
+	EXPECT_EQ(VirtualTerminalClient::StateMachineState::UploadObjectPool, clientUnderTest.test_wrapper_get_state());
+	clientUnderTest.test_wrapper_optimize_object_pools();
+	clientUnderTest.test_wrapper_prepare_object_pool_delta();
+	EXPECT_EQ(updatedPool.size(), clientUnderTest.test_wrapper_get_object_pool_upload_size(0));
+
+	clientUnderTest.set_object_pool_delta_upload_directory("");
+	std::remove(originalIndexPath.c_str());
+	std::remove(updatedIndexPath.c_str());
+	ASSERT_TRUE(vtPartner->destroy(3));
+	ASSERT_TRUE(internalECU->destroy(3));
+}
+
 TEST(VIRTUAL_TERMINAL_TESTS, ObjectMetadataTests)
 {
 	NAME clientNAME(0);
@@ -1006,3 +1609,280 @@ TEST(VIRTUAL_TERMINAL_TESTS, MessageConstruction)
 	ASSERT_TRUE(vtPartner->destroy(3));
 	ASSERT_TRUE(internalECU->destroy(3));
 }
+
+TEST(VIRTUAL_TERMINAL_TESTS, CommandQueueCoalescing)
+{
+	std::uint64_t firstKey = 0;
+	std::uint64_t secondKey = 0;
+
+	// Same object and attribute, different values
+	EXPECT_TRUE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xAF, 0x01, 0x02, 0x05, 0x01, 0x00, 0x00, 0x00 }, firstKey));
+	EXPECT_TRUE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xAF, 0x01, 0x02, 0x05, 0x02, 0x00, 0x00, 0x00 }, secondKey));
+	EXPECT_EQ(firstKey, secondKey);
+
+	// Different attribute of the same object
+	EXPECT_TRUE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xAF, 0x01, 0x02, 0x06, 0x01, 0x00, 0x00, 0x00 }, secondKey));
+	EXPECT_NE(firstKey, secondKey);
+
+	// Different function on the same object
+	EXPECT_TRUE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xA8, 0x01, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x00 }, firstKey));
+	EXPECT_TRUE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xA7, 0x01, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF }, secondKey));
+	EXPECT_NE(firstKey, secondKey);
+
+	// Same child in different parents
+	EXPECT_TRUE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xB4, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 }, firstKey));
+	EXPECT_TRUE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xB4, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 }, secondKey));
+	EXPECT_NE(firstKey, secondKey);
+
+	// Relative moves, macros and drawing must all be sent
+	EXPECT_FALSE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xA5, 0x01, 0x00, 0x02, 0x00, 0x80, 0x80, 0xFF }, firstKey));
+	EXPECT_FALSE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xBE, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }, firstKey));
+	EXPECT_FALSE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xB8, 0x01, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00 }, firstKey));
+
+	// Every query gets its own response, so none can be dropped
+	EXPECT_FALSE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xB9, 0x01, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF }, firstKey));
+
+	// Truncated commands can't be keyed
+	EXPECT_FALSE(DerivedTestVTClient::test_wrapper_get_command_coalescing_key({ 0xA8, 0x01 }, firstKey));
+
+	VirtualCANPlugin serverVT;
+	serverVT.open();
+
+	CANHardwareInterface::set_number_of_can_channels(1);
+	CANHardwareInterface::assign_can_channel_frame_handler(0, std::make_shared<VirtualCANPlugin>());
+	CANHardwareInterface::start();
+
+	NAME clientNAME(0);
+	clientNAME.set_industry_group(4);
+	clientNAME.set_arbitrary_address_capable(true);
+	clientNAME.set_identity_number(976);
+	clientNAME.set_function_code(static_cast<std::uint8_t>(NAME::Function::ControlHead));
+	auto internalECU = InternalControlFunction::create(clientNAME, 0x37, 0);
+
+	CANMessageFrame testFrame;
+
+	std::uint32_t waitingTimestamp_ms = SystemTiming::get_timestamp_ms();
+
+	while ((!internalECU->get_address_valid()) &&
+	       (!SystemTiming::time_expired_ms(waitingTimestamp_ms, 2000)))
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}
+
+	ASSERT_TRUE(internalECU->get_address_valid());
+
+	std::vector<isobus::NAMEFilter> vtNameFilters;
+	const isobus::NAMEFilter testFilter(isobus::NAME::NAMEParameters::FunctionCode, static_cast<std::uint8_t>(isobus::NAME::Function::VirtualTerminal));
+	vtNameFilters.push_back(testFilter);
+
+	auto vtPartner = PartneredControlFunction::create(0, vtNameFilters);
+
+	// Force claim a partner
+	NAME serverNAME(0);
+	serverNAME.set_arbitrary_address_capable(true);
+	serverNAME.set_device_class(1);
+	serverNAME.set_function_code(29);
+	serverNAME.set_identity_number(646);
+	serverNAME.set_manufacturer_code(1407);
+	std::uint64_t serverFullNAME = serverNAME.get_full_name();
+
+	testFrame.dataLength = 8;
+	testFrame.channel = 0;
+	testFrame.isExtendedFrame = true;
+	testFrame.identifier = 0x18EEFF26;
+	for (std::uint8_t i = 0; i < 8; i++)
+	{
+		testFrame.data[i] = static_cast<std::uint8_t>((serverFullNAME >> (8 * i)) & 0xFF);
+	}
+	CANNetworkManager::process_receive_can_message_frame(testFrame);
+
+	DerivedTestVTClient interfaceUnderTest(vtPartner, internalECU);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+	while (!serverVT.get_queue_empty())
+	{
+		serverVT.read_frame(testFrame);
+	}
+	ASSERT_TRUE(vtPartner->get_address_valid());
+
+	// While not connected, a burst of updates collapses to the latest value of each object
+	for (std::uint32_t i = 0; i < 100; i++)
+	{
+		EXPECT_TRUE(interfaceUnderTest.send_change_numeric_value(1000, i));
+		EXPECT_TRUE(interfaceUnderTest.send_change_numeric_value(1001, 1000 + i));
+		EXPECT_TRUE(interfaceUnderTest.send_change_attribute(1000, 5, i));
+	}
+	EXPECT_TRUE(interfaceUnderTest.send_change_string_value(1002, "Long string that needs a transport protocol"));
+	EXPECT_TRUE(interfaceUnderTest.send_change_string_value(1002, "Hi"));
+	EXPECT_TRUE(interfaceUnderTest.send_execute_macro(7));
+	EXPECT_TRUE(interfaceUnderTest.send_execute_macro(7));
+	EXPECT_TRUE(interfaceUnderTest.send_change_active_mask(123, 456));
+	EXPECT_EQ(7u, interfaceUnderTest.test_wrapper_get_number_of_queued_commands());
+
+	// Commands are not queued at all when queueing is disabled
+	interfaceUnderTest.set_should_queue_commands(false);
+	EXPECT_FALSE(interfaceUnderTest.send_change_numeric_value(1003, 1));
+	EXPECT_EQ(7u, interfaceUnderTest.test_wrapper_get_number_of_queued_commands());
+	interfaceUnderTest.set_should_queue_commands(true);
+
+	interfaceUnderTest.test_wrapper_set_state(VirtualTerminalClient::StateMachineState::Connected);
+	interfaceUnderTest.test_wrapper_process_command_queue();
+	EXPECT_EQ(0u, interfaceUnderTest.test_wrapper_get_number_of_queued_commands());
+
+	// The mask change has a higher priority, so it jumps ahead of the value updates
+	serverVT.read_frame(testFrame);
+	EXPECT_EQ(0xAD, testFrame.data[0]);
+
+	serverVT.read_frame(testFrame);
+	EXPECT_EQ(0xA8, testFrame.data[0]);
+	EXPECT_EQ(1000, testFrame.data[1] | (testFrame.data[2] << 8));
+	EXPECT_EQ(99, testFrame.data[4]);
+
+	serverVT.read_frame(testFrame);
+	EXPECT_EQ(0xA8, testFrame.data[0]);
+	EXPECT_EQ(1001, testFrame.data[1] | (testFrame.data[2] << 8));
+	EXPECT_EQ(1099 & 0xFF, testFrame.data[4]);
+	EXPECT_EQ(1099 >> 8, testFrame.data[5]);
+
+	serverVT.read_frame(testFrame);
+	EXPECT_EQ(0xAF, testFrame.data[0]);
+	EXPECT_EQ(5, testFrame.data[3]);
+	EXPECT_EQ(99, testFrame.data[4]);
+
+	// The short string replaced the long one, so it fits in a single frame
+	serverVT.read_frame(testFrame);
+	EXPECT_EQ(0xB3, testFrame.data[0]);
+	EXPECT_EQ(2, testFrame.data[3]);
+	EXPECT_EQ('H', testFrame.data[5]);
+
+	// Both macro executions are sent
+	serverVT.read_frame(testFrame);
+	EXPECT_EQ(0xBE, testFrame.data[0]);
+	serverVT.read_frame(testFrame);
+	EXPECT_EQ(0xBE, testFrame.data[0]);
+	EXPECT_TRUE(serverVT.get_queue_empty());
+
+	// Queries are never coalesced, since each one is answered separately
+	interfaceUnderTest.test_wrapper_set_state(VirtualTerminalClient::StateMachineState::Disconnected);
+	EXPECT_TRUE(interfaceUnderTest.send_get_attribute_value(1000, 5));
+	EXPECT_TRUE(interfaceUnderTest.send_get_attribute_value(1000, 5));
+	EXPECT_EQ(2u, interfaceUnderTest.test_wrapper_get_number_of_queued_commands());
+
+	interfaceUnderTest.test_wrapper_set_state(VirtualTerminalClient::StateMachineState::Connected);
+	interfaceUnderTest.test_wrapper_process_command_queue();
+	EXPECT_EQ(0u, interfaceUnderTest.test_wrapper_get_number_of_queued_commands());
+	serverVT.read_frame(testFrame);
+	EXPECT_EQ(0xB9, testFrame.data[0]);
+	serverVT.read_frame(testFrame);
+	EXPECT_EQ(0xB9, testFrame.data[0]);
+	EXPECT_TRUE(serverVT.get_queue_empty());
+
+	serverVT.close();
+	CANHardwareInterface::stop();
+
+	ASSERT_TRUE(vtPartner->destroy(3));
+	ASSERT_TRUE(internalECU->destroy(3));
+}
+
+TEST(VIRTUAL_TERMINAL_TESTS, CommandPacing)
+{
+	ManualClock clock(1000000);
+	SystemTiming::set_clock(&clock);
+
+	NAME clientNAME(0);
+	auto internalECU = InternalControlFunction::create(clientNAME, 0x26, 0);
+
+	std::vector<isobus::NAMEFilter> vtNameFilters;
+	const isobus::NAMEFilter testFilter(isobus::NAME::NAMEParameters::FunctionCode, static_cast<std::uint8_t>(isobus::NAME::Function::VirtualTerminal));
+	vtNameFilters.push_back(testFilter);
+
+	auto vtPartner = PartneredControlFunction::create(0, vtNameFilters);
+
+	DerivedTestVTClient clientUnderTest(vtPartner, internalECU);
+
+	CANMessage testMessage(0);
+	testMessage.set_identifier(CANIdentifier(CANIdentifier::Type::Extended, static_cast<std::uint32_t>(CANLibParameterGroupNumber::VirtualTerminalToECU), CANIdentifier::PriorityDefault6, 0, 0));
+	std::uint8_t changeNumericValueResponse[] = { 0xA8, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00 };
+	testMessage.set_data(changeNumericValueResponse, 8);
+
+	VirtualTerminalClient::CommandStatistics statistics = clientUnderTest.get_command_statistics();
+	EXPECT_EQ(8, statistics.windowSize);
+	EXPECT_EQ(0, statistics.commandsInFlight);
+
+	// Fill the window
+	for (std::uint8_t i = 0; i < 8; i++)
+	{
+		EXPECT_TRUE(clientUnderTest.test_wrapper_get_command_window_available(0xA8));
+		clientUnderTest.test_wrapper_on_command_sent(0xA8);
+	}
+	EXPECT_FALSE(clientUnderTest.test_wrapper_get_command_window_available(0xA8));
+	EXPECT_TRUE(clientUnderTest.test_wrapper_get_command_window_available(0xC0)); // Not a command the VT responds to
+
+	clientUnderTest.set_should_pace_commands(false);
+	EXPECT_TRUE(clientUnderTest.test_wrapper_get_command_window_available(0xA8));
+	clientUnderTest.set_should_pace_commands(true);
+
+	// A full window of fast responses grows the window
+	clock.advance_us(2000);
+	for (std::uint8_t i = 0; i < 8; i++)
+	{
+		clientUnderTest.test_wrapper_process_rx_message(testMessage, &clientUnderTest);
+	}
+	statistics = clientUnderTest.get_command_statistics();
+	EXPECT_EQ(8u, statistics.commandsSent);
+	EXPECT_EQ(8u, statistics.responsesReceived);
+	EXPECT_EQ(0, statistics.commandsInFlight);
+	EXPECT_EQ(9, statistics.windowSize);
+	EXPECT_EQ(2000u, statistics.minimumRoundTripTime_us);
+	EXPECT_EQ(2000u, statistics.maximumRoundTripTime_us);
+	EXPECT_EQ(2000u, statistics.smoothedRoundTripTime_us);
+
+	// Responses for other commands don't match anything in flight
+	std::uint8_t changeBackgroundColourResponse[] = { 0xA7, 0x01, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0xFF };
+	testMessage.set_data(changeBackgroundColourResponse, 8);
+	clientUnderTest.test_wrapper_process_rx_message(testMessage, &clientUnderTest);
+	EXPECT_EQ(8u, clientUnderTest.get_command_statistics().responsesReceived);
+	testMessage.set_data(changeNumericValueResponse, 8);
+
+	// Slow responses halve the window, but only once per round trip
+	for (std::uint8_t i = 0; i < 9; i++)
+	{
+		clientUnderTest.test_wrapper_on_command_sent(0xA8);
+	}
+	clock.advance_us(100000);
+	clientUnderTest.test_wrapper_process_rx_message(testMessage, &clientUnderTest);
+	clientUnderTest.test_wrapper_process_rx_message(testMessage, &clientUnderTest);
+	statistics = clientUnderTest.get_command_statistics();
+	EXPECT_EQ(4, statistics.windowSize);
+	EXPECT_EQ(7, statistics.commandsInFlight);
+	EXPECT_EQ(100000u, statistics.maximumRoundTripTime_us);
+	EXPECT_EQ(24968u, statistics.smoothedRoundTripTime_us);
+
+	// Commands the VT never responds to time out and shrink the window again
+	clock.advance_ms(1500);
+	clientUnderTest.test_wrapper_update_command_pacing();
+	statistics = clientUnderTest.get_command_statistics();
+	EXPECT_EQ(0, statistics.commandsInFlight);
+	EXPECT_EQ(7u, statistics.responseTimeouts);
+	EXPECT_EQ(2, statistics.windowSize);
+	EXPECT_EQ(6u, statistics.responsesPerSecond); // 10 responses in 1.602 seconds
+
+	// Disconnecting drops the commands in flight but keeps the counters until a new connection starts
+	clientUnderTest.test_wrapper_on_command_sent(0xA8);
+	clientUnderTest.test_wrapper_set_state(VirtualTerminalClient::StateMachineState::Disconnected);
+	statistics = clientUnderTest.get_command_statistics();
+	EXPECT_EQ(0, statistics.commandsInFlight);
+	EXPECT_EQ(8, statistics.windowSize);
+	EXPECT_EQ(18u, statistics.commandsSent);
+
+	clientUnderTest.test_wrapper_set_state(VirtualTerminalClient::StateMachineState::WaitForPartnerVTStatusMessage);
+	statistics = clientUnderTest.get_command_statistics();
+	EXPECT_EQ(0u, statistics.commandsSent);
+	EXPECT_EQ(0u, statistics.responsesReceived);
+	EXPECT_EQ(0u, statistics.smoothedRoundTripTime_us);
+
+	SystemTiming::set_clock(nullptr);
+	ASSERT_TRUE(vtPartner->destroy(3));
+	ASSERT_TRUE(internalECU->destroy(3));
+}
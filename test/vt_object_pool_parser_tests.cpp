@@ -0,0 +1,188 @@
+//================================================================================================
+/// @file vt_object_pool_parser_tests.cpp
+///
+/// @brief Unit tests for building VT objects from a binary object pool
+/// @author agent
+///
+/// @copyright 2026 agent
+//================================================================================================
+#include <gtest/gtest.h>
+
+#include "isobus/isobus/isobus_virtual_terminal_object_pool_parser.hpp"
+#include "isobus/utility/iop_file_interface.hpp"
+
+using namespace isobus;
+
+static std::vector<std::uint8_t> read_example_pool(const std::string &relativePath)
+{
+	std::vector<std::uint8_t> retVal = IOPFileInterface::read_iop_file("../" + relativePath);
+
+	if (retVal.empty())
+	{
+		// Try a different path to mitigate differences between how IDEs run the unit test
+		retVal = IOPFileInterface::read_iop_file(relativePath);
+	}
+	return retVal;
+}
+
+static std::vector<std::uint8_t> build_test_pool()
+{
+	return {
+		// Working Set 0, active mask 1000, one child and one language
+		0x00, 0x00, 0x00, 0x01, 0x01, 0xE8, 0x03, 0x01, 0x00, 0x01, 0xF8, 0x2A, 0x05, 0x00, 0x06, 0x00, 'e', 'n',
+		// Data Mask 1000, no soft key mask, one child and one macro
+		0xE8, 0x03, 0x01, 0x02, 0xFF, 0xFF, 0x01, 0x01, 0xF8, 0x2A, 0x0A, 0x00, 0x14, 0x00, 0x00, 0x05,
+		// Output String 11000, 100x20, font 23000, value "Hello"
+		0xF8, 0x2A, 0x0B, 0x64, 0x00, 0x14, 0x00, 0x03, 0xD8, 0x59, 0x00, 0xFF, 0xFF, 0x00, 0x05, 0x00, 'H', 'e', 'l', 'l', 'o', 0x00,
+		// Font Attributes 23000
+		0xD8, 0x59, 0x17, 0x04, 0x02, 0x00, 0x00, 0x00,
+		// Graphics Context 5000, which has no object class
+		0x88, 0x13, 0x24, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00
+	};
+}
+
+TEST(VT_OBJECT_POOL_PARSER_TESTS, ParseObjects)
+{
+	std::vector<std::uint8_t> testPool = build_test_pool();
+	VTObjectTable objects;
+
+	VTObjectPoolParser::Result result = VTObjectPoolParser::parse(testPool, objects);
+	ASSERT_EQ(VTObjectPoolParser::Error::None, result.error);
+	EXPECT_EQ(NULL_OBJECT_ID, result.objectID);
+	EXPECT_EQ(4u, result.numberOfObjects);
+	EXPECT_EQ(1u, result.numberOfSkippedObjects);
+	ASSERT_EQ(4u, objects.size());
+	EXPECT_EQ(0u, objects.count(5000));
+
+	auto workingSet = std::static_pointer_cast<WorkingSet>(objects.get_object(0));
+	ASSERT_NE(nullptr, workingSet);
+	EXPECT_EQ(VirtualTerminalObjectType::WorkingSet, workingSet->get_object_type());
+	EXPECT_EQ(1, workingSet->get_background_color());
+	EXPECT_TRUE(workingSet->get_selectable());
+	EXPECT_EQ(1000, workingSet->get_active_mask());
+	ASSERT_EQ(1, workingSet->get_number_children());
+	EXPECT_EQ(11000, workingSet->get_child_id(0));
+	EXPECT_EQ(5, workingSet->get_child_x(0));
+	EXPECT_EQ(6, workingSet->get_child_y(0));
+
+	auto dataMask = std::static_pointer_cast<DataMask>(objects.get_object(1000));
+	ASSERT_NE(nullptr, dataMask);
+	EXPECT_EQ(VirtualTerminalObjectType::DataMask, dataMask->get_object_type());
+	EXPECT_EQ(2, dataMask->get_background_color());
+	EXPECT_EQ(NULL_OBJECT_ID, dataMask->get_soft_key_mask());
+	ASSERT_EQ(1, dataMask->get_number_children());
+	EXPECT_EQ(10, dataMask->get_child_x(0));
+	EXPECT_EQ(20, dataMask->get_child_y(0));
+
+	auto outputString = std::static_pointer_cast<OutputString>(objects.get_object(11000));
+	ASSERT_NE(nullptr, outputString);
+	EXPECT_EQ(VirtualTerminalObjectType::OutputString, outputString->get_object_type());
+	EXPECT_EQ(100, outputString->get_width());
+	EXPECT_EQ(20, outputString->get_height());
+	EXPECT_EQ(3, outputString->get_background_color());
+	EXPECT_EQ(23000, outputString->get_font_attributes());
+	EXPECT_EQ(NULL_OBJECT_ID, outputString->get_variable_reference());
+	EXPECT_EQ("Hello", outputString->get_value());
+
+	auto font = std::static_pointer_cast<FontAttributes>(objects.get_object(23000));
+	ASSERT_NE(nullptr, font);
+	EXPECT_EQ(4, font->get_colour());
+	EXPECT_EQ(FontAttributes::FontSize::Size8x12, font->get_size());
+
+	// Parsing again replaces what was in the table
+	result = VTObjectPoolParser::parse(testPool.data(), static_cast<std::uint32_t>(testPool.size()), objects);
+	EXPECT_EQ(VTObjectPoolParser::Error::None, result.error);
+	EXPECT_EQ(4u, objects.size());
+
+	// An empty pool is valid, if not very useful
+	result = VTObjectPoolParser::parse(nullptr, 0, objects);
+	EXPECT_EQ(VTObjectPoolParser::Error::None, result.error);
+	EXPECT_TRUE(objects.empty());
+}
+
+TEST(VT_OBJECT_POOL_PARSER_TESTS, RejectMalformedPools)
+{
+	VTObjectTable objects;
+	std::vector<std::uint8_t> testPool = build_test_pool();
+
+	// Cut the output string's value short
+	std::vector<std::uint8_t> truncatedPool(testPool.begin(), testPool.begin() + 50);
+	VTObjectPoolParser::Result result = VTObjectPoolParser::parse(truncatedPool, objects);
+	EXPECT_EQ(VTObjectPoolParser::Error::TruncatedObject, result.error);
+	EXPECT_EQ(11000, result.objectID);
+	EXPECT_EQ(34u, result.offset);
+	EXPECT_TRUE(objects.empty());
+
+	truncatedPool.resize(19);
+	EXPECT_EQ(VTObjectPoolParser::Error::TruncatedObject, VTObjectPoolParser::parse(truncatedPool, objects).error);
+
+	// Give the font attributes the same ID as the data mask
+	std::vector<std::uint8_t> duplicatePool = testPool;
+	duplicatePool[56] = 0xE8;
+	duplicatePool[57] = 0x03;
+	result = VTObjectPoolParser::parse(duplicatePool, objects);
+	EXPECT_EQ(VTObjectPoolParser::Error::DuplicateObjectID, result.error);
+	EXPECT_EQ(1000, result.objectID);
+	EXPECT_EQ(56u, result.offset);
+	EXPECT_TRUE(objects.empty());
+
+	// Point the output string at a font that doesn't exist
+	std::vector<std::uint8_t> missingReferencePool = testPool;
+	missingReferencePool[42] = 0xD9;
+	result = VTObjectPoolParser::parse(missingReferencePool, objects);
+	EXPECT_EQ(VTObjectPoolParser::Error::MissingObjectReference, result.error);
+	EXPECT_EQ(11000, result.objectID);
+	EXPECT_TRUE(objects.empty());
+
+	// A font attributes object can't be a child of a working set
+	std::vector<std::uint8_t> invalidChildPool = testPool;
+	invalidChildPool[10] = 0xD8;
+	invalidChildPool[11] = 0x59;
+	result = VTObjectPoolParser::parse(invalidChildPool, objects);
+	EXPECT_EQ(VTObjectPoolParser::Error::InvalidObject, result.error);
+	EXPECT_EQ(0, result.objectID);
+	EXPECT_EQ(0u, result.offset);
+	EXPECT_TRUE(objects.empty());
+
+	// Manufacturer defined objects have no known length
+	std::vector<std::uint8_t> unknownTypePool = testPool;
+	unknownTypePool[58] = 240;
+	result = VTObjectPoolParser::parse(unknownTypePool, objects);
+	EXPECT_EQ(VTObjectPoolParser::Error::UnsupportedObjectType, result.error);
+	EXPECT_EQ(23000, result.objectID);
+	EXPECT_TRUE(objects.empty());
+}
+
+TEST(VT_OBJECT_POOL_PARSER_TESTS, ParseExamplePools)
+{
+	std::vector<std::uint8_t> testPool = read_example_pool("examples/virtual_terminal/version3_object_pool/VT3TestPool.iop");
+	ASSERT_FALSE(testPool.empty());
+
+	VTObjectTable objects;
+	VTObjectPoolParser::Result result = VTObjectPoolParser::parse(testPool, objects);
+	EXPECT_EQ(VTObjectPoolParser::Error::None, result.error);
+	EXPECT_EQ(34u, result.numberOfObjects);
+	EXPECT_EQ(0u, result.numberOfSkippedObjects);
+	EXPECT_EQ(34u, objects.size());
+
+	std::uint32_t numberOfPictures = 0;
+	for (const auto &object : objects)
+	{
+		if (VirtualTerminalObjectType::PictureGraphic == object.second->get_object_type())
+		{
+			auto picture = std::static_pointer_cast<PictureGraphic>(object.second);
+			EXPECT_EQ(picture->get_number_of_bytes_in_raw_data(), picture->get_raw_data().size());
+			EXPECT_NE(0, picture->get_actual_width());
+			numberOfPictures++;
+		}
+	}
+	EXPECT_EQ(4u, numberOfPictures);
+
+	// This pool has auxiliary function objects, which are stepped over
+	testPool = read_example_pool("examples/virtual_terminal/aux_functions/aux_functions_pooldata.iop");
+	ASSERT_FALSE(testPool.empty());
+	result = VTObjectPoolParser::parse(testPool, objects);
+	EXPECT_EQ(VTObjectPoolParser::Error::None, result.error);
+	EXPECT_EQ(5u, result.numberOfObjects);
+	EXPECT_EQ(3u, result.numberOfSkippedObjects);
+}
@@ -38,7 +38,7 @@ static void run_baseline_tests(VTObject *objectUnderTest)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, WorkingSetTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	VTColourTable colourTable;
 	auto ws = std::make_shared<WorkingSet>();
 
@@ -78,20 +78,20 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, WorkingSetTests)
 	// Test the validity checker
 	EXPECT_FALSE(ws->get_is_valid(objects));
 	ws->set_id(10);
-	objects[ws->get_id()] = ws;
+	objects.insert(ws);
 	EXPECT_TRUE(ws->get_is_valid(objects));
 
 	// Add a valid object, a container
 	auto container = std::make_shared<Container>();
 	container->set_id(20);
-	objects[container->get_id()] = container;
+	objects.insert(container);
 	ws->add_child(container->get_id(), 0, 0);
 	EXPECT_TRUE(ws->get_is_valid(objects));
 
 	// Add an invalid object, a Key
 	auto key = std::make_shared<Key>();
 	key->set_id(30);
-	objects[key->get_id()] = key;
+	objects.insert(key);
 	ws->add_child(key->get_id(), 0, 0);
 	EXPECT_FALSE(ws->get_is_valid(objects));
 
@@ -128,7 +128,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, WorkingSetTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, DataMaskTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	DataMask mask;
 
 	run_baseline_tests(&mask);
@@ -151,25 +151,25 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, DataMaskTests)
 	// We'll make a new shared pointer to an data mask
 	auto dataMask2 = std::make_shared<DataMask>();
 	dataMask2->set_id(1); // Arbitrary ID
-	objects[dataMask2->get_id()] = dataMask2;
+	objects.insert(dataMask2);
 
 	// Let's add a soft key mask to the alarm mask
 	auto softKeyMask = std::make_shared<SoftKeyMask>();
 	softKeyMask->set_id(100);
 	dataMask2->add_child(softKeyMask->get_id(), 0, 0);
-	objects[softKeyMask->get_id()] = softKeyMask;
+	objects.insert(softKeyMask);
 
 	// now let's make a different soft key mask that we'll use to replace the old one
 	auto softKeyMask2 = std::make_shared<SoftKeyMask>();
 	softKeyMask2->set_id(200);
-	objects[softKeyMask2->get_id()] = softKeyMask2;
+	objects.insert(softKeyMask2);
 
 	EXPECT_TRUE(dataMask2->get_is_valid(objects));
 
 	// Add an invalid object, another data mask
 	auto dataMask3 = std::make_shared<DataMask>();
 	dataMask3->set_id(2); // Arbitrary ID
-	objects[dataMask3->get_id()] = dataMask3;
+	objects.insert(dataMask3);
 	dataMask2->add_child(dataMask3->get_id(), 0, 0);
 	EXPECT_FALSE(dataMask2->get_is_valid(objects));
 
@@ -205,7 +205,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, DataMaskTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ContainerTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	Container container;
 
 	run_baseline_tests(&container);
@@ -249,14 +249,14 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ContainerTests)
 	// Add a valid child object, a Button
 	auto button = std::make_shared<Button>();
 	button->set_id(200);
-	objects[button->get_id()] = button;
+	objects.insert(button);
 	container.add_child(button->get_id(), 0, 0);
 	EXPECT_TRUE(container.get_is_valid(objects));
 
 	// Add an invalid object, a data mask
 	auto dataMask = std::make_shared<DataMask>();
 	dataMask->set_id(300);
-	objects[dataMask->get_id()] = dataMask;
+	objects.insert(dataMask);
 	container.add_child(dataMask->get_id(), 0, 0);
 	EXPECT_FALSE(container.get_is_valid(objects));
 
@@ -276,7 +276,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ContainerTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, AlarmMaskTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	AlarmMask alarmMask;
 
 	run_baseline_tests(&alarmMask);
@@ -288,18 +288,18 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, AlarmMaskTests)
 	// We'll make a new shared pointer to an alarm mask
 	auto alarmMask2 = std::make_shared<AlarmMask>();
 	alarmMask2->set_id(1); // Arbitrary ID
-	objects[alarmMask2->get_id()] = alarmMask2;
+	objects.insert(alarmMask2);
 
 	// Let's add a soft key mask to the alarm mask
 	auto softKeyMask = std::make_shared<SoftKeyMask>();
 	softKeyMask->set_id(100);
 	alarmMask2->add_child(softKeyMask->get_id(), 0, 0);
-	objects[softKeyMask->get_id()] = softKeyMask;
+	objects.insert(softKeyMask);
 
 	// now let's make a different soft key mask that we'll use to replace the old one
 	auto softKeyMask2 = std::make_shared<SoftKeyMask>();
 	softKeyMask2->set_id(200);
-	objects[softKeyMask2->get_id()] = softKeyMask2;
+	objects.insert(softKeyMask2);
 
 	VTObject::AttributeError error = VTObject::AttributeError::AnyOtherError;
 	EXPECT_TRUE(alarmMask2->set_attribute(static_cast<std::uint8_t>(AlarmMask::AttributeName::SoftKeyMask), 200, objects, error));
@@ -335,7 +335,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, AlarmMaskTests)
 	// Add an invalid object, another Alarm Mask
 	auto alarmMask3 = std::make_shared<AlarmMask>();
 	alarmMask3->set_id(2); // Arbitrary ID
-	objects[alarmMask3->get_id()] = alarmMask3;
+	objects.insert(alarmMask3);
 	alarmMask2->add_child(alarmMask3->get_id(), 0, 0);
 	EXPECT_FALSE(alarmMask2->get_is_valid(objects));
 
@@ -369,7 +369,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, AlarmMaskTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, SoftKeyMaskTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto softKeyMask = std::make_shared<SoftKeyMask>();
 
 	run_baseline_tests(softKeyMask.get());
@@ -391,14 +391,14 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, SoftKeyMaskTests)
 	EXPECT_NE(0, static_cast<std::uint8_t>(error));
 
 	softKeyMask->set_id(100);
-	objects[softKeyMask->get_id()] = softKeyMask;
+	objects.insert(softKeyMask);
 
 	EXPECT_TRUE(softKeyMask->get_is_valid(objects));
 
 	// Add an invalid object, a container
 	auto container = std::make_shared<Container>();
 	container->set_id(200);
-	objects[container->get_id()] = container;
+	objects.insert(container);
 	softKeyMask->add_child(container->get_id(), 0, 0);
 	EXPECT_FALSE(softKeyMask->get_is_valid(objects));
 	softKeyMask->remove_child(200, 0, 0);
@@ -406,7 +406,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, SoftKeyMaskTests)
 	// Add a valid object, a Key
 	auto key = std::make_shared<Key>();
 	key->set_id(300);
-	objects[key->get_id()] = key;
+	objects.insert(key);
 	softKeyMask->add_child(key->get_id(), 0, 0);
 	EXPECT_TRUE(softKeyMask->get_is_valid(objects));
 
@@ -420,7 +420,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, SoftKeyMaskTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, SoftKeyTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto softKey = std::make_shared<Key>();
 
 	run_baseline_tests(softKey.get());
@@ -449,19 +449,19 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, SoftKeyTests)
 	EXPECT_NE(0, static_cast<std::uint8_t>(error));
 
 	softKey->set_id(100);
-	objects[softKey->get_id()] = softKey;
+	objects.insert(softKey);
 
 	// Add a valid child, a picture graphic
 	auto pictureGraphic = std::make_shared<PictureGraphic>();
 	pictureGraphic->set_id(200);
-	objects[pictureGraphic->get_id()] = pictureGraphic;
+	objects.insert(pictureGraphic);
 	softKey->add_child(pictureGraphic->get_id(), 0, 0);
 	EXPECT_TRUE(softKey->get_is_valid(objects));
 
 	// Add an invalid object, a data mask
 	auto dataMask = std::make_shared<DataMask>();
 	dataMask->set_id(300);
-	objects[dataMask->get_id()] = dataMask;
+	objects.insert(dataMask);
 	softKey->add_child(dataMask->get_id(), 0, 0);
 	EXPECT_FALSE(softKey->get_is_valid(objects));
 
@@ -478,7 +478,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, SoftKeyTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ButtonTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto button = std::make_shared<Button>();
 
 	run_baseline_tests(button.get());
@@ -525,19 +525,19 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ButtonTests)
 	EXPECT_FALSE(button->get_option(Button::Options::NoBorder));
 
 	button->set_id(100);
-	objects[button->get_id()] = button;
+	objects.insert(button);
 
 	// Add a valid child, a picture graphic
 	auto pictureGraphic = std::make_shared<PictureGraphic>();
 	pictureGraphic->set_id(200);
-	objects[pictureGraphic->get_id()] = pictureGraphic;
+	objects.insert(pictureGraphic);
 	button->add_child(pictureGraphic->get_id(), 0, 0);
 	EXPECT_TRUE(button->get_is_valid(objects));
 
 	// Add an invalid object, a data mask
 	auto dataMask = std::make_shared<DataMask>();
 	dataMask->set_id(300);
-	objects[dataMask->get_id()] = dataMask;
+	objects.insert(dataMask);
 	button->add_child(dataMask->get_id(), 0, 0);
 	EXPECT_FALSE(button->get_is_valid(objects));
 
@@ -566,7 +566,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ButtonTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, KeyGroupTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto keyGroup = std::make_shared<KeyGroup>();
 	auto testName = std::make_shared<OutputString>();
 
@@ -574,11 +574,11 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, KeyGroupTests)
 	EXPECT_EQ(keyGroup->get_object_type(), VirtualTerminalObjectType::KeyGroup);
 
 	keyGroup->set_id(100);
-	objects[keyGroup->get_id()] = keyGroup;
+	objects.insert(keyGroup);
 	EXPECT_EQ(100, keyGroup->get_id());
 
 	testName->set_id(200);
-	objects[testName->get_id()] = testName;
+	objects.insert(testName);
 	keyGroup->set_name_object_id(200);
 
 	keyGroup->set_key_group_icon(500);
@@ -598,7 +598,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, KeyGroupTests)
 	// Add a key
 	auto key = std::make_shared<Key>();
 	key->set_id(300);
-	objects[key->get_id()] = key;
+	objects.insert(key);
 	keyGroup->add_child(key->get_id(), 0, 0);
 
 	// It should still be valid
@@ -607,7 +607,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, KeyGroupTests)
 	// Add an object pointer that isn't a key
 	auto objectPointer = std::make_shared<ObjectPointer>();
 	objectPointer->set_id(400);
-	objects[objectPointer->get_id()] = objectPointer;
+	objects.insert(objectPointer);
 	objectPointer->add_child(key->get_id(), 0, 0);
 	keyGroup->add_child(objectPointer->get_id(), 0, 0);
 
@@ -617,7 +617,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, KeyGroupTests)
 	// Change the object pointer to some random thing
 	auto container = std::make_shared<Container>();
 	container->set_id(500);
-	objects[container->get_id()] = container;
+	objects.insert(container);
 	objectPointer->remove_child(key->get_id(), 0, 0);
 	objectPointer->set_value(container->get_id());
 
@@ -632,7 +632,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, KeyGroupTests)
 	// Make an output string we can use to test the name of the key group
 	auto outputString = std::make_shared<OutputString>();
 	outputString->set_id(600);
-	objects[outputString->get_id()] = outputString;
+	objects.insert(outputString);
 	keyGroup->add_child(outputString->get_id(), 0, 0);
 
 	// Now let's change the name of the key group
@@ -660,7 +660,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, KeyGroupTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputBooleanTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto inputBoolean = std::make_shared<InputBoolean>();
 
 	run_baseline_tests(inputBoolean.get());
@@ -696,7 +696,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputBooleanTests)
 	// First, let's make a font attributes object
 	auto fontAttribute = std::make_shared<FontAttributes>();
 	fontAttribute->set_id(1); // Arbitrary
-	objects[fontAttribute->get_id()] = fontAttribute;
+	objects.insert(fontAttribute);
 
 	// Add it
 	inputBoolean->set_foreground_colour_object_id(fontAttribute->get_id());
@@ -705,7 +705,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputBooleanTests)
 	// Now lets replace it with a different font attributes object using set_attribute
 	auto fontAttribute2 = std::make_shared<FontAttributes>();
 	fontAttribute2->set_id(2); // Arbitrary
-	objects[fontAttribute2->get_id()] = fontAttribute2;
+	objects.insert(fontAttribute2);
 
 	EXPECT_TRUE(inputBoolean->set_attribute(static_cast<std::uint8_t>(InputBoolean::AttributeName::ForegroundColour), fontAttribute2->get_id(), objects, error));
 	EXPECT_EQ(inputBoolean->get_foreground_colour_object_id(), fontAttribute2->get_id()); // Now the 2nd font attribute should be used for the foreground colour
@@ -718,12 +718,12 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputBooleanTests)
 	EXPECT_TRUE(inputBoolean->set_attribute(static_cast<std::uint8_t>(InputBoolean::AttributeName::VariableReference), 0xFFFF, objects, error));
 
 	inputBoolean->set_id(100);
-	objects[inputBoolean->get_id()] = inputBoolean;
+	objects.insert(inputBoolean);
 
 	// Add a variable reference
 	auto numberVariable = std::make_shared<NumberVariable>();
 	numberVariable->set_id(200);
-	objects[numberVariable->get_id()] = numberVariable;
+	objects.insert(numberVariable);
 	inputBoolean->set_variable_reference(numberVariable->get_id());
 	EXPECT_EQ(inputBoolean->get_variable_reference(), 200);
 	EXPECT_TRUE(inputBoolean->get_is_valid(objects));
@@ -731,7 +731,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputBooleanTests)
 	// Add an invalid variable reference, a container
 	auto container = std::make_shared<Container>();
 	container->set_id(300);
-	objects[container->get_id()] = container;
+	objects.insert(container);
 	inputBoolean->set_variable_reference(container->get_id());
 	EXPECT_EQ(300, inputBoolean->get_variable_reference());
 	EXPECT_FALSE(inputBoolean->get_is_valid(objects));
@@ -761,7 +761,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputBooleanTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputStringTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto inputString = std::make_shared<InputString>();
 
 	run_baseline_tests(inputString.get());
@@ -811,12 +811,12 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputStringTests)
 	// Test input string font attribute
 	auto fontAttribute = std::make_shared<FontAttributes>();
 	fontAttribute->set_id(1); // Arbitrary
-	objects[fontAttribute->get_id()] = fontAttribute;
+	objects.insert(fontAttribute);
 
 	// Test input string input attributes
 	auto inputAttribute = std::make_shared<InputAttributes>();
 	inputAttribute->set_id(5); // Arbitrary
-	objects[inputAttribute->get_id()] = inputAttribute;
+	objects.insert(inputAttribute);
 
 	// Add it
 	inputString->set_font_attributes(fontAttribute->get_id());
@@ -825,7 +825,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputStringTests)
 	// Now lets replace it with a different font attributes object using set_attribute
 	auto fontAttribute2 = std::make_shared<FontAttributes>();
 	fontAttribute2->set_id(2); // Arbitrary
-	objects[fontAttribute2->get_id()] = fontAttribute2;
+	objects.insert(fontAttribute2);
 
 	EXPECT_TRUE(inputString->set_attribute(static_cast<std::uint8_t>(InputString::AttributeName::FontAttributes), fontAttribute2->get_id(), objects, error));
 	EXPECT_TRUE(inputString->set_attribute(static_cast<std::uint8_t>(InputString::AttributeName::InputAttributes), inputAttribute->get_id(), objects, error));
@@ -843,13 +843,13 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputStringTests)
 	EXPECT_TRUE(inputString->get_option(InputString::Options::Transparent));
 
 	inputString->set_id(100);
-	objects[inputString->get_id()] = inputString;
+	objects.insert(inputString);
 	EXPECT_TRUE(inputString->get_is_valid(objects));
 
 	// Add an invalid object, a picture graphic
 	auto pictureGraphic = std::make_shared<PictureGraphic>();
 	pictureGraphic->set_id(200);
-	objects[pictureGraphic->get_id()] = pictureGraphic;
+	objects.insert(pictureGraphic);
 	inputString->add_child(pictureGraphic->get_id(), 0, 0);
 	EXPECT_FALSE(inputString->get_is_valid(objects));
 
@@ -887,7 +887,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputStringTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputNumberTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto inputNumber = std::make_shared<InputNumber>();
 
 	run_baseline_tests(inputNumber.get());
@@ -985,7 +985,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputNumberTests)
 	// Test input number font attribute
 	auto fontAttribute = std::make_shared<FontAttributes>();
 	fontAttribute->set_id(1); // Arbitrary
-	objects[fontAttribute->get_id()] = fontAttribute;
+	objects.insert(fontAttribute);
 
 	// Add it
 	inputNumber->set_font_attributes(fontAttribute->get_id());
@@ -994,18 +994,18 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputNumberTests)
 	// Now lets replace it with a different font attributes object using set_attribute
 	auto fontAttribute2 = std::make_shared<FontAttributes>();
 	fontAttribute2->set_id(2); // Arbitrary
-	objects[fontAttribute2->get_id()] = fontAttribute2;
+	objects.insert(fontAttribute2);
 	EXPECT_TRUE(inputNumber->set_attribute(static_cast<std::uint8_t>(InputNumber::AttributeName::FontAttributes), fontAttribute2->get_id(), objects, error));
 
 	inputNumber->set_id(100);
-	objects[inputNumber->get_id()] = inputNumber;
+	objects.insert(inputNumber);
 
 	EXPECT_TRUE(inputNumber->get_is_valid(objects));
 
 	// Add an invalid object, a FillAttributes object
 	auto fillAttributes = std::make_shared<FillAttributes>();
 	fillAttributes->set_id(200);
-	objects[fillAttributes->get_id()] = fillAttributes;
+	objects.insert(fillAttributes);
 	inputNumber->add_child(fillAttributes->get_id(), 0, 0);
 	EXPECT_FALSE(inputNumber->get_is_valid(objects));
 
@@ -1061,7 +1061,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputNumberTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputListTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto inputList = std::make_shared<InputList>();
 
 	run_baseline_tests(inputList.get());
@@ -1114,12 +1114,12 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputListTests)
 	EXPECT_EQ(inputList->get_variable_reference(), 386);
 
 	inputList->set_id(100);
-	objects[inputList->get_id()] = inputList;
+	objects.insert(inputList);
 
 	// Add a valid child object, an output string
 	auto outputString = std::make_shared<OutputString>();
 	outputString->set_id(200);
-	objects[outputString->get_id()] = outputString;
+	objects.insert(outputString);
 	inputList->add_child(outputString->get_id(), 0, 0);
 	EXPECT_TRUE(inputList->get_is_valid(objects));
 
@@ -1132,7 +1132,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputListTests)
 	// Add an invalid object, a Soft Key Mask
 	auto softKeyMask = std::make_shared<SoftKeyMask>();
 	softKeyMask->set_id(300);
-	objects[softKeyMask->get_id()] = softKeyMask;
+	objects.insert(softKeyMask);
 	inputList->add_child(softKeyMask->get_id(), 0, 0);
 	EXPECT_FALSE(inputList->get_is_valid(objects));
 
@@ -1158,7 +1158,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputListTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputStringTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto outputString = std::make_shared<OutputString>();
 
 	run_baseline_tests(outputString.get());
@@ -1205,7 +1205,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputStringTests)
 	// Test output string font attribute
 	auto fontAttribute = std::make_shared<FontAttributes>();
 	fontAttribute->set_id(1); // Arbitrary
-	objects[fontAttribute->get_id()] = fontAttribute;
+	objects.insert(fontAttribute);
 
 	// Add it
 	outputString->set_font_attributes(fontAttribute->get_id());
@@ -1214,7 +1214,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputStringTests)
 	// Now lets replace it with a different font attributes object using set_attribute
 	auto fontAttribute2 = std::make_shared<FontAttributes>();
 	fontAttribute2->set_id(2); // Arbitrary
-	objects[fontAttribute2->get_id()] = fontAttribute2;
+	objects.insert(fontAttribute2);
 	EXPECT_TRUE(outputString->set_attribute(static_cast<std::uint8_t>(OutputString::AttributeName::FontAttributes), fontAttribute2->get_id(), objects, error));
 
 	// Test output string justification attribute
@@ -1226,14 +1226,14 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputStringTests)
 	EXPECT_EQ(outputString->get_vertical_justification(), OutputString::VerticalJustification::PositionTop);
 
 	outputString->set_id(100);
-	objects[outputString->get_id()] = outputString;
+	objects.insert(outputString);
 
 	EXPECT_EQ(outputString->get_is_valid(objects), true);
 
 	// Add an invalid child, an Input String
 	auto inputString = std::make_shared<InputString>();
 	inputString->set_id(200);
-	objects[inputString->get_id()] = inputString;
+	objects.insert(inputString);
 	outputString->set_font_attributes(inputString->get_id());
 	EXPECT_FALSE(outputString->get_is_valid(objects));
 
@@ -1265,7 +1265,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputStringTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputNumberTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto outputNumber = std::make_shared<OutputNumber>();
 
 	run_baseline_tests(outputNumber.get());
@@ -1317,7 +1317,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputNumberTests)
 	// Test output number font attribute
 	auto fontAttribute = std::make_shared<FontAttributes>();
 	fontAttribute->set_id(1); // Arbitrary
-	objects[fontAttribute->get_id()] = fontAttribute;
+	objects.insert(fontAttribute);
 
 	// Add it
 	outputNumber->set_font_attributes(fontAttribute->get_id());
@@ -1326,7 +1326,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputNumberTests)
 	// Now lets replace it with a different font attributes object using set_attribute
 	auto fontAttribute2 = std::make_shared<FontAttributes>();
 	fontAttribute2->set_id(2); // Arbitrary
-	objects[fontAttribute2->get_id()] = fontAttribute2;
+	objects.insert(fontAttribute2);
 	EXPECT_TRUE(outputNumber->set_attribute(static_cast<std::uint8_t>(OutputNumber::AttributeName::FontAttributes), fontAttribute2->get_id(), objects, error));
 
 	// Test output number justification attribute
@@ -1355,14 +1355,14 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputNumberTests)
 	EXPECT_EQ(outputNumber->get_value(), 6);
 
 	outputNumber->set_id(100);
-	objects[outputNumber->get_id()] = outputNumber;
+	objects.insert(outputNumber);
 
 	EXPECT_TRUE(outputNumber->get_is_valid(objects));
 
 	// Add an invalid child, an Input Attributes
 	auto inputAttributes = std::make_shared<InputAttributes>();
 	inputAttributes->set_id(200);
-	objects[inputAttributes->get_id()] = inputAttributes;
+	objects.insert(inputAttributes);
 	outputNumber->set_font_attributes(inputAttributes->get_id());
 	EXPECT_FALSE(outputNumber->get_is_valid(objects));
 
@@ -1403,7 +1403,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputNumberTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputListTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto outputList = std::make_shared<OutputList>();
 
 	run_baseline_tests(outputList.get());
@@ -1452,21 +1452,21 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputListTests)
 
 	// Test validity with some real objects
 	outputList->set_id(100);
-	objects[outputList->get_id()] = outputList;
+	objects.insert(outputList);
 
 	// Create 4 output strings
 	auto outputString1 = std::make_shared<OutputString>();
 	outputString1->set_id(1);
-	objects[outputString1->get_id()] = outputString1;
+	objects.insert(outputString1);
 	auto outputString2 = std::make_shared<OutputString>();
 	outputString2->set_id(2);
-	objects[outputString2->get_id()] = outputString2;
+	objects.insert(outputString2);
 	auto outputString3 = std::make_shared<OutputString>();
 	outputString3->set_id(3);
-	objects[outputString3->get_id()] = outputString3;
+	objects.insert(outputString3);
 	auto outputString4 = std::make_shared<OutputString>();
 	outputString4->set_id(4);
-	objects[outputString4->get_id()] = outputString4;
+	objects.insert(outputString4);
 
 	// Add the valid children and test validity
 	outputList->add_child(outputString1->get_id(), 0, 0);
@@ -1482,7 +1482,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputListTests)
 	// Add an invalid obejct, a Data Mask object
 	auto dataMask = std::make_shared<DataMask>();
 	dataMask->set_id(200);
-	objects[dataMask->get_id()] = dataMask;
+	objects.insert(dataMask);
 	outputList->add_child(dataMask->get_id(), 0, 0);
 	EXPECT_FALSE(outputList->get_is_valid(objects));
 
@@ -1516,7 +1516,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputListTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputLineTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto outputLine = std::make_shared<OutputLine>();
 
 	run_baseline_tests(outputLine.get());
@@ -1547,7 +1547,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputLineTests)
 	// Test output line line attribute
 	auto lineAttribute = std::make_shared<LineAttributes>();
 	lineAttribute->set_id(1); // Arbitrary
-	objects[lineAttribute->get_id()] = lineAttribute;
+	objects.insert(lineAttribute);
 
 	// Add it
 	outputLine->set_line_attributes(lineAttribute->get_id());
@@ -1555,7 +1555,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputLineTests)
 	// Now lets replace it with a different line attributes object using set_attribute
 	auto lineAttribute2 = std::make_shared<LineAttributes>();
 	lineAttribute2->set_id(2); // Arbitrary
-	objects[lineAttribute2->get_id()] = lineAttribute2;
+	objects.insert(lineAttribute2);
 	EXPECT_TRUE(outputLine->set_attribute(static_cast<std::uint8_t>(OutputLine::AttributeName::LineAttributes), lineAttribute2->get_id(), objects, error));
 
 	EXPECT_EQ(outputLine->get_line_attributes(), lineAttribute2->get_id()); // Now the 2nd line attribute should be used for the line attributes
@@ -1564,14 +1564,14 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputLineTests)
 	EXPECT_EQ(OutputLine::LineDirection::BottomLeftToTopRight, outputLine->get_line_direction());
 
 	outputLine->set_id(100);
-	objects[outputLine->get_id()] = outputLine;
+	objects.insert(outputLine);
 
 	EXPECT_TRUE(outputLine->get_is_valid(objects));
 
 	// Add an invalid line attributes object, an Input Attributes object
 	auto inputAttributes = std::make_shared<InputAttributes>();
 	inputAttributes->set_id(200);
-	objects[inputAttributes->get_id()] = inputAttributes;
+	objects.insert(inputAttributes);
 	outputLine->set_line_attributes(inputAttributes->get_id());
 	EXPECT_FALSE(outputLine->get_is_valid(objects));
 
@@ -1597,7 +1597,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputLineTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputRectangleTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto outputRectangle = std::make_shared<OutputRectangle>();
 
 	run_baseline_tests(outputRectangle.get());
@@ -1624,7 +1624,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputRectangleTests)
 	// Test output rectangle line attribute
 	auto lineAttribute = std::make_shared<LineAttributes>();
 	lineAttribute->set_id(1); // Arbitrary
-	objects[lineAttribute->get_id()] = lineAttribute;
+	objects.insert(lineAttribute);
 
 	// Add it
 	outputRectangle->set_line_attributes(lineAttribute->get_id());
@@ -1633,7 +1633,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputRectangleTests)
 	// Now lets replace it with a different line attributes object using set_attribute
 	auto lineAttribute2 = std::make_shared<LineAttributes>();
 	lineAttribute2->set_id(2); // Arbitrary
-	objects[lineAttribute2->get_id()] = lineAttribute2;
+	objects.insert(lineAttribute2);
 	EXPECT_TRUE(outputRectangle->set_attribute(static_cast<std::uint8_t>(OutputRectangle::AttributeName::LineAttributes), lineAttribute2->get_id(), objects, error));
 	EXPECT_EQ(outputRectangle->get_line_attributes(), lineAttribute2->get_id()); // Now the 2nd line attribute should be used for the line attributes
 
@@ -1649,7 +1649,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputRectangleTests)
 	EXPECT_EQ(16, outputRectangle->get_child_y(0));
 
 	outputRectangle->set_id(100);
-	objects[outputRectangle->get_id()] = outputRectangle;
+	objects.insert(outputRectangle);
 
 	outputRectangle->remove_child(1, 15, 16);
 	outputRectangle->remove_child(2, 20, 50);
@@ -1658,7 +1658,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputRectangleTests)
 	// Add an invalid object, a Data Mask
 	auto dataMask = std::make_shared<DataMask>();
 	dataMask->set_id(200);
-	objects[dataMask->get_id()] = dataMask;
+	objects.insert(dataMask);
 	outputRectangle->set_line_attributes(dataMask->get_id());
 	EXPECT_FALSE(outputRectangle->get_is_valid(objects));
 
@@ -1694,7 +1694,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputRectangleTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputEllipseTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto outputEllipse = std::make_shared<OutputEllipse>();
 
 	run_baseline_tests(outputEllipse.get());
@@ -1736,7 +1736,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputEllipseTests)
 	// Test output ellipse line attribute
 	auto lineAttribute = std::make_shared<LineAttributes>();
 	lineAttribute->set_id(1); // Arbitrary
-	objects[lineAttribute->get_id()] = lineAttribute;
+	objects.insert(lineAttribute);
 
 	// Add it
 	outputEllipse->set_line_attributes(lineAttribute->get_id());
@@ -1744,14 +1744,14 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputEllipseTests)
 	// Now lets replace it with a different line attributes object using set_attribute
 	auto lineAttribute2 = std::make_shared<LineAttributes>();
 	lineAttribute2->set_id(2); // Arbitrary
-	objects[lineAttribute2->get_id()] = lineAttribute2;
+	objects.insert(lineAttribute2);
 	EXPECT_TRUE(outputEllipse->set_attribute(static_cast<std::uint8_t>(OutputEllipse::AttributeName::LineAttributes), lineAttribute2->get_id(), objects, error));
 	EXPECT_EQ(outputEllipse->get_line_attributes(), lineAttribute2->get_id()); // Now the 2nd line attribute should be used for the line attributes
 
 	// Test output ellipse fill attribute
 	auto fillAttribute = std::make_shared<FillAttributes>();
 	fillAttribute->set_id(3); // Arbitrary
-	objects[fillAttribute->get_id()] = fillAttribute;
+	objects.insert(fillAttribute);
 
 	// Add it
 	outputEllipse->set_fill_attributes(fillAttribute->get_id());
@@ -1759,19 +1759,19 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputEllipseTests)
 	// Now lets replace it with a different fill attributes object using set_attribute
 	auto fillAttribute2 = std::make_shared<FillAttributes>();
 	fillAttribute2->set_id(4); // Arbitrary
-	objects[fillAttribute2->get_id()] = fillAttribute2;
+	objects.insert(fillAttribute2);
 	EXPECT_TRUE(outputEllipse->set_attribute(static_cast<std::uint8_t>(OutputEllipse::AttributeName::FillAttributes), fillAttribute2->get_id(), objects, error));
 	EXPECT_EQ(outputEllipse->get_fill_attributes(), fillAttribute2->get_id()); // Now the 2nd fill attribute should be used for the line attributes
 
 	outputEllipse->set_id(100);
-	objects[outputEllipse->get_id()] = outputEllipse;
+	objects.insert(outputEllipse);
 
 	EXPECT_TRUE(outputEllipse->get_is_valid(objects));
 
 	// Add an invalid object, an alarm mask
 	auto alarmMask = std::make_shared<AlarmMask>();
 	alarmMask->set_id(200);
-	objects[alarmMask->get_id()] = alarmMask;
+	objects.insert(alarmMask);
 	outputEllipse->set_fill_attributes(alarmMask->get_id());
 	EXPECT_FALSE(outputEllipse->get_is_valid(objects));
 
@@ -1806,7 +1806,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputEllipseTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputPolygonTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto outputPolygon = std::make_shared<OutputPolygon>();
 
 	run_baseline_tests(outputPolygon.get());
@@ -1833,7 +1833,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputPolygonTests)
 	// Test output polygon line attribute
 	auto lineAttribute = std::make_shared<LineAttributes>();
 	lineAttribute->set_id(1); // Arbitrary
-	objects[lineAttribute->get_id()] = lineAttribute;
+	objects.insert(lineAttribute);
 
 	// Add it
 	outputPolygon->set_line_attributes(lineAttribute->get_id());
@@ -1841,14 +1841,14 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputPolygonTests)
 	// Now lets replace it with a different line attributes object using set_attribute
 	auto lineAttribute2 = std::make_shared<LineAttributes>();
 	lineAttribute2->set_id(2); // Arbitrary
-	objects[lineAttribute2->get_id()] = lineAttribute2;
+	objects.insert(lineAttribute2);
 	EXPECT_TRUE(outputPolygon->set_attribute(static_cast<std::uint8_t>(OutputPolygon::AttributeName::LineAttributes), lineAttribute2->get_id(), objects, error));
 	EXPECT_EQ(outputPolygon->get_line_attributes(), lineAttribute2->get_id()); // Now the 2nd line attribute should be used for the line attributes
 
 	// Test output polygon fill attribute
 	auto fillAttribute = std::make_shared<FillAttributes>();
 	fillAttribute->set_id(3); // Arbitrary
-	objects[fillAttribute->get_id()] = fillAttribute;
+	objects.insert(fillAttribute);
 
 	// Add it
 	outputPolygon->set_fill_attributes(fillAttribute->get_id());
@@ -1856,19 +1856,19 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputPolygonTests)
 	// Now lets replace it with a different fill attributes object using set_attribute
 	auto fillAttribute2 = std::make_shared<FillAttributes>();
 	fillAttribute2->set_id(4); // Arbitrary
-	objects[fillAttribute2->get_id()] = fillAttribute2;
+	objects.insert(fillAttribute2);
 	EXPECT_TRUE(outputPolygon->set_attribute(static_cast<std::uint8_t>(OutputPolygon::AttributeName::FillAttributes), fillAttribute2->get_id(), objects, error));
 	EXPECT_EQ(outputPolygon->get_fill_attributes(), fillAttribute2->get_id()); // Now the 2nd fill attribute should be used for the line attributes
 
 	outputPolygon->set_id(100);
-	objects[outputPolygon->get_id()] = outputPolygon;
+	objects.insert(outputPolygon);
 
 	EXPECT_TRUE(outputPolygon->get_is_valid(objects));
 
 	// Add an invalid object, an alarm mask
 	auto alarmMask = std::make_shared<AlarmMask>();
 	alarmMask->set_id(200);
-	objects[alarmMask->get_id()] = alarmMask;
+	objects.insert(alarmMask);
 	outputPolygon->set_fill_attributes(alarmMask->get_id());
 	EXPECT_FALSE(outputPolygon->get_is_valid(objects));
 
@@ -1918,7 +1918,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputPolygonTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputMeterTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto outputMeter = std::make_shared<OutputMeter>();
 
 	run_baseline_tests(outputMeter.get());
@@ -1985,14 +1985,14 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputMeterTests)
 	EXPECT_TRUE(outputMeter->get_option(OutputMeter::Options::DeflectionDirection));
 
 	outputMeter->set_id(100);
-	objects[outputMeter->get_id()] = outputMeter;
+	objects.insert(outputMeter);
 
 	EXPECT_TRUE(outputMeter->get_is_valid(objects));
 
 	// Add an invalid object, a container
 	auto container = std::make_shared<Container>();
 	container->set_id(200);
-	objects[container->get_id()] = container;
+	objects.insert(container);
 	outputMeter->add_child(container->get_id(), 0, 0);
 	EXPECT_FALSE(outputMeter->get_is_valid(objects));
 
@@ -2039,7 +2039,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputMeterTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputLinearBarGraphTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	OutputLinearBarGraph outputLinearBarGraph;
 
 	run_baseline_tests(&outputLinearBarGraph);
@@ -2133,7 +2133,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputLinearBarGraphTests)
 	// Create and add a number variable so that the test for setting the variable reference passes
 	auto numberVariable = std::make_shared<NumberVariable>();
 	numberVariable->set_id(100);
-	objects[numberVariable->get_id()] = numberVariable;
+	objects.insert(numberVariable);
 
 	EXPECT_TRUE(outputLinearBarGraph.set_attribute(static_cast<std::uint8_t>(OutputLinearBarGraph::AttributeName::VariableReference), 100, objects, error));
 	EXPECT_TRUE(outputLinearBarGraph.get_attribute(static_cast<std::uint8_t>(OutputLinearBarGraph::AttributeName::VariableReference), testValue));
@@ -2151,7 +2151,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputLinearBarGraphTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputArchedBarGraphTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	OutputArchedBarGraph outputArchedBarGraph;
 
 	run_baseline_tests(&outputArchedBarGraph);
@@ -2273,7 +2273,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, OutputArchedBarGraphTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, PictureGraphicTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	PictureGraphic pictureGraphic;
 
 	run_baseline_tests(&pictureGraphic);
@@ -2365,7 +2365,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, PictureGraphicTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, NumberVariableTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	NumberVariable numberVariable;
 
 	run_baseline_tests(&numberVariable);
@@ -2400,7 +2400,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, NumberVariableTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, StringVariableTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	StringVariable stringVariable;
 
 	run_baseline_tests(&stringVariable);
@@ -2426,7 +2426,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, StringVariableTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, FontAttributesTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	FontAttributes fontAttributes;
 
 	run_baseline_tests(&fontAttributes);
@@ -2543,7 +2543,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, FontAttributesTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, LineAttributesTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	LineAttributes lineAttributes;
 
 	run_baseline_tests(&lineAttributes);
@@ -2590,12 +2590,12 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, LineAttributesTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, FillAttributesTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	FillAttributes fillAttributes;
 	auto fillPattern = std::make_shared<PictureGraphic>();
 
 	fillPattern->set_id(3);
-	objects[fillPattern->get_id()] = fillPattern;
+	objects.insert(fillPattern);
 
 	run_baseline_tests(&fillAttributes);
 	EXPECT_EQ(fillAttributes.get_object_type(), VirtualTerminalObjectType::FillAttributes);
@@ -2638,7 +2638,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, FillAttributesTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputAttributesTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	InputAttributes inputAttributes;
 
 	run_baseline_tests(&inputAttributes);
@@ -2676,7 +2676,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, InputAttributesTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ExtendedInputAttributesTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	ExtendedInputAttributes extendedInputAttributes;
 
 	run_baseline_tests(&extendedInputAttributes);
@@ -2708,7 +2708,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ExtendedInputAttributesTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, MacroTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	Macro macro;
 
 	run_baseline_tests(&macro);
@@ -2749,7 +2749,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, MacroTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ColourMapTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	ColourMap colourMap;
 
 	run_baseline_tests(&colourMap);
@@ -2785,7 +2785,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ColourMapTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, WindowMaskTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto windowMask = std::make_shared<WindowMask>();
 
 	run_baseline_tests(windowMask.get());
@@ -2832,12 +2832,12 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, WindowMaskTests)
 	EXPECT_FALSE(windowMask->get_is_valid(objects));
 
 	windowMask->set_id(50);
-	objects[windowMask->get_id()] = windowMask;
+	objects.insert(windowMask);
 
 	// Add a valid title object
 	auto title = std::make_shared<OutputString>();
 	title->set_id(100);
-	objects[title->get_id()] = title;
+	objects.insert(title);
 	windowMask->set_title_object_id(100);
 
 	// Should still be invalid because we have no name
@@ -2846,7 +2846,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, WindowMaskTests)
 	// Add a name
 	auto name = std::make_shared<OutputString>();
 	name->set_id(101);
-	objects[name->get_id()] = name;
+	objects.insert(name);
 	EXPECT_TRUE(windowMask->set_attribute(static_cast<std::uint8_t>(WindowMask::AttributeName::Name), name->get_id(), objects, error));
 
 	// Should still be invalid because we have no icon
@@ -2855,7 +2855,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, WindowMaskTests)
 	// Add an icon
 	auto icon = std::make_shared<PictureGraphic>();
 	icon->set_id(102);
-	objects[icon->get_id()] = icon;
+	objects.insert(icon);
 	windowMask->set_icon_object_id(102);
 
 	// Because this is an input number window mask, it should still be invalid until we add an input number as a child
@@ -2864,7 +2864,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, WindowMaskTests)
 	// Add an input number
 	auto inputNumber = std::make_shared<InputNumber>();
 	inputNumber->set_id(103);
-	objects[inputNumber->get_id()] = inputNumber;
+	objects.insert(inputNumber);
 	windowMask->add_child(inputNumber->get_id(), 0, 0);
 
 	// Now it should be valid
@@ -2879,7 +2879,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, WindowMaskTests)
 	// Add a units object
 	auto units = std::make_shared<OutputString>();
 	units->set_id(104);
-	objects[units->get_id()] = units;
+	objects.insert(units);
 	windowMask->add_child(104, 0, 0);
 
 	// Now it should be valid again
@@ -2901,7 +2901,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, WindowMaskTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ExternalObjectPointerTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto externalObject = std::make_shared<ExternalObjectPointer>();
 
 	run_baseline_tests(externalObject.get());
@@ -2957,7 +2957,7 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ExternalObjectPointerTests)
 
 TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ObjectPointerTests)
 {
-	std::map<std::uint16_t, std::shared_ptr<VTObject>> objects;
+	VTObjectTable objects;
 	auto externalObject = std::make_shared<ObjectPointer>();
 
 	run_baseline_tests(externalObject.get());
@@ -2975,3 +2975,98 @@ TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ObjectPointerTests)
 	EXPECT_TRUE(externalObject->get_attribute(static_cast<std::uint8_t>(ObjectPointer::AttributeName::Type), testValue));
 	EXPECT_EQ(testValue, static_cast<std::uint8_t>(VirtualTerminalObjectType::ObjectPointer));
 }
+
+TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, ObjectTableTests)
+{
+	VTObjectTable objectPool;
+	EXPECT_TRUE(objectPool.empty());
+	EXPECT_EQ(nullptr, objectPool.get_object(100));
+	EXPECT_EQ(objectPool.end(), objectPool.find(100));
+
+	auto numberVariable = objectPool.create_object<NumberVariable>(100);
+	ASSERT_NE(nullptr, numberVariable);
+	EXPECT_EQ(100, numberVariable->get_id());
+	EXPECT_EQ(nullptr, objectPool.create_object<NumberVariable>(100)); // ID already in use
+	EXPECT_EQ(nullptr, objectPool.create_object<NumberVariable>(NULL_OBJECT_ID));
+
+	auto font = std::make_shared<FontAttributes>();
+	font->set_id(0);
+	EXPECT_TRUE(objectPool.insert(font));
+	EXPECT_FALSE(objectPool.insert(font));
+	EXPECT_FALSE(objectPool.insert(nullptr));
+
+	auto outputNumber = objectPool.create_object<OutputNumber>(65534);
+	ASSERT_NE(nullptr, outputNumber);
+	EXPECT_EQ(3u, objectPool.size());
+	EXPECT_EQ(1u, objectPool.count(0));
+	EXPECT_EQ(font, objectPool.get_object(0));
+	EXPECT_EQ(outputNumber, objectPool.find(65534)->second);
+	EXPECT_EQ(65534, objectPool.find(65534)->first);
+
+	// References are validated through the table
+	VTObject::AttributeError error;
+	EXPECT_TRUE(outputNumber->set_attribute(static_cast<std::uint8_t>(OutputNumber::AttributeName::VariableReference), 100, objectPool, error));
+	EXPECT_FALSE(outputNumber->set_attribute(static_cast<std::uint8_t>(OutputNumber::AttributeName::VariableReference), 0, objectPool, error));
+	outputNumber->set_font_attributes(0);
+	EXPECT_TRUE(outputNumber->get_is_valid(objectPool));
+
+	// Erasing keeps the remaining objects reachable
+	EXPECT_EQ(1u, objectPool.erase(100));
+	EXPECT_EQ(0u, objectPool.erase(100));
+	EXPECT_EQ(2u, objectPool.size());
+	EXPECT_EQ(nullptr, objectPool.get_object(100));
+	EXPECT_EQ(font, objectPool.get_object(0));
+	EXPECT_EQ(outputNumber, objectPool.get_object(65534));
+	EXPECT_FALSE(outputNumber->get_is_valid(objectPool));
+
+	// Objects outlive the table that created them
+	objectPool.clear();
+	EXPECT_TRUE(objectPool.empty());
+	EXPECT_EQ(nullptr, objectPool.get_object(0));
+	EXPECT_EQ(100, numberVariable->get_id());
+
+	std::map<std::uint16_t, std::shared_ptr<VTObject>> objectMap;
+	objectMap[5] = std::make_shared<Container>();
+	objectMap[5]->set_id(5);
+	objectMap[6] = std::make_shared<OutputRectangle>();
+	objectMap[6]->set_id(6);
+	objectMap[5]->add_child(6, 0, 0);
+	VTObjectTable mapTable(objectMap);
+	EXPECT_EQ(2u, mapTable.size());
+	EXPECT_TRUE(mapTable.get_object(5)->get_is_valid(mapTable));
+}
+
+TEST(VIRTUAL_TERMINAL_OBJECT_TESTS, LargeObjectTableValidation)
+{
+	VTObjectTable objectPool;
+	std::uint16_t nextID = 1;
+
+	auto font = objectPool.create_object<FontAttributes>(nextID++);
+	for (std::uint16_t i = 0; i < 1000; i++)
+	{
+		auto container = objectPool.create_object<Container>(nextID++);
+		for (std::uint8_t j = 0; j < 3; j++)
+		{
+			auto variable = objectPool.create_object<NumberVariable>(nextID++);
+			auto number = objectPool.create_object<OutputNumber>(nextID++);
+			number->set_variable_reference(variable->get_id());
+			number->set_font_attributes(font->get_id());
+			container->add_child(number->get_id(), 0, 0);
+			container->add_child(objectPool.create_object<OutputRectangle>(nextID++)->get_id(), 0, 0);
+		}
+	}
+	EXPECT_EQ(10001u, objectPool.size());
+
+	std::size_t numberValid = 0;
+	for (const auto &object : objectPool)
+	{
+		numberValid += object.second->get_is_valid(objectPool) ? 1 : 0;
+	}
+	EXPECT_EQ(objectPool.size(), numberValid);
+
+	// A container pointing at a variable is not valid
+	auto badContainer = objectPool.create_object<Container>(nextID++);
+	badContainer->add_child(3, 0, 0);
+	EXPECT_EQ(VirtualTerminalObjectType::NumberVariable, objectPool.get_object(3)->get_object_type());
+	EXPECT_FALSE(badContainer->get_is_valid(objectPool));
+}
@@ -10,12 +10,128 @@
 #ifndef IOP_FILE_INTERFACE_HPP
 #define IOP_FILE_INTERFACE_HPP
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
 
 namespace isobus
 {
+	//================================================================================================
+	/// @class ObjectPoolHasher
+	///
+	/// @brief A fast, incremental 64 bit hash for object pools and other large binary data
+	/// @details This is an implementation of the XXH64 algorithm. It consumes 32 bytes per round,
+	/// so hashing a pool of several megabytes takes on the order of a millisecond. Data can be fed
+	/// in pieces of any size and the result is the same as hashing it all at once, which allows
+	/// hashing pools that are never fully in memory.
+	//================================================================================================
+	class ObjectPoolHasher
+	{
+	public:
+		/// @brief Constructor for an ObjectPoolHasher
+		/// @param[in] seed A value to start the hash from. Different seeds give unrelated hashes for the same data.
+		explicit ObjectPoolHasher(std::uint64_t seed = 0);
+
+		/// @brief Discards all data that has been hashed so far
+		/// @param[in] seed A value to start the hash from
+		void reset(std::uint64_t seed = 0);
+
+		/// @brief Adds data to the hash
+		/// @param[in] data A pointer to the data to add
+		/// @param[in] length The number of bytes to add
+		void update(const std::uint8_t *data, std::size_t length);
+
+		/// @brief Returns the hash of all data added so far. More data can still be added afterwards.
+		/// @returns The 64 bit hash of the data
+		std::uint64_t get_hash() const;
+
+		/// @brief Hashes a block of data in one call
+		/// @param[in] data A pointer to the data to hash
+		/// @param[in] length The number of bytes to hash
+		/// @param[in] seed A value to start the hash from
+		/// @returns The 64 bit hash of the data
+		static std::uint64_t hash(const std::uint8_t *data, std::size_t length, std::uint64_t seed = 0);
+
+	private:
+		static constexpr std::size_t STRIPE_LENGTH = 32; ///< The number of bytes consumed by each round
+
+		/// @brief Consumes one 32 byte stripe of data
+		/// @param[in] stripe A pointer to 32 bytes of data
+		void process_stripe(const std::uint8_t *stripe);
+
+		std::array<std::uint64_t, 4> accumulators; ///< The four parallel lanes of the hash state
+		std::array<std::uint8_t, STRIPE_LENGTH> buffer; ///< Holds data that doesn't yet make up a full stripe
+		std::uint64_t totalLength = 0; ///< The number of bytes hashed so far
+		std::uint64_t seedValue = 0; ///< The seed the hash was started with
+		std::size_t bufferedLength = 0; ///< The number of bytes waiting in the buffer
+	};
+
+	//================================================================================================
+	/// @class MappedIOPFile
+	///
+	/// @brief A read-only view of an IOP file that is mapped into memory rather than copied
+	/// @details On platforms that support it the file is memory mapped, so the OS pages in the pool
+	/// as it is read and no heap memory is used for it. This makes loading large pools (such as ones
+	/// with many picture graphics) nearly instant. On other platforms the file is read into
+	/// RAM in one go instead.
+	///
+	/// The data can be passed straight to VirtualTerminalClient::set_object_pool, which will upload
+	/// the pool directly out of the mapping. The object must outlive the upload.
+	//================================================================================================
+	class MappedIOPFile
+	{
+	public:
+		/// @brief Constructs an empty, invalid mapping
+		MappedIOPFile() = default;
+
+		/// @brief Maps an IOP file into memory
+		/// @param[in] filename A string filepath for the IOP file to map
+		explicit MappedIOPFile(const std::string &filename);
+
+		/// @brief Unmaps the file
+		~MappedIOPFile();
+
+		/// @brief Move constructor, transfers the mapping to a new object
+		/// @param[in] other The mapping to move from, which will become invalid
+		MappedIOPFile(MappedIOPFile &&other) noexcept;
+
+		/// @brief Move assignment, transfers the mapping to this object
+		/// @param[in] other The mapping to move from, which will become invalid
+		/// @returns A reference to this object
+		MappedIOPFile &operator=(MappedIOPFile &&other) noexcept;
+
+		/// @brief Deleted copy constructor
+		MappedIOPFile(const MappedIOPFile &) = delete;
+
+		/// @brief Deleted assignment operator
+		/// @returns Nothing, this is deleted
+		MappedIOPFile &operator=(const MappedIOPFile &) = delete;
+
+		/// @brief Returns if the file was opened and contains data
+		/// @returns `true` if the file was mapped successfully, otherwise `false`
+		bool get_is_valid() const;
+
+		/// @brief Returns a pointer to the object pool data
+		/// @returns A pointer to the read-only object pool, or nullptr if the mapping is invalid
+		const std::uint8_t *get_data() const;
+
+		/// @brief Returns the size of the object pool
+		/// @returns The size of the object pool in bytes, or 0 if the mapping is invalid
+		std::uint32_t get_size() const;
+
+	private:
+		/// @brief Releases the mapping, if there is one
+		void close();
+
+		const std::uint8_t *mappedData = nullptr; ///< The start of the mapped file
+		std::size_t mappedSize = 0; ///< The size of the mapped file in bytes
+		std::vector<std::uint8_t> fallbackData; ///< Holds the file on platforms that can't memory map files
+		void *fileHandle = nullptr; ///< The OS file handle, used on Windows only
+		void *mappingHandle = nullptr; ///< The OS file mapping handle, used on Windows only
+	};
+
 	//================================================================================================
 	/// @class IOPFileInterface
 	///
@@ -27,16 +143,66 @@ namespace isobus
 	class IOPFileInterface
 	{
 	public:
+		/// @brief A callback used to read a pool in chunks, compatible with the stack's DataChunkCallback
+		using PoolDataChunkCallback = bool (*)(std::uint32_t callbackIndex,
+		                                       std::uint32_t bytesOffset,
+		                                       std::uint32_t numberOfBytesNeeded,
+		                                       std::uint8_t *chunkBuffer,
+		                                       void *parentPointer);
+
 		/// @brief Reads an IOP file given a file name/path
 		/// @param[in] filename A string filepath for the IOP file to read
 		/// @returns A vector with an object pool in it, or an empty vector if reading failed
 		static std::vector<std::uint8_t> read_iop_file(const std::string &filename);
 
+		/// @brief Writes an object pool to an IOP file
+		/// @details The data is written to a temporary file first which is then renamed, so
+		/// readers never see a partially written file. On POSIX systems the temporary file is
+		/// flushed to disk and then atomically replaces any existing file.
+		/// @param[in] filename A string filepath for the IOP file to write
+		/// @param[in] data A pointer to the object pool to write
+		/// @param[in] size The size of the object pool in bytes
+		/// @returns `true` if the whole file was written, otherwise `false`
+		static bool write_iop_file(const std::string &filename, const std::uint8_t *data, std::uint32_t size);
+
+		/// @brief Maps an IOP file into memory given a file name/path, without copying it
+		/// @param[in] filename A string filepath for the IOP file to map
+		/// @returns A mapping of the object pool, which is invalid if the file could not be opened
+		static MappedIOPFile map_iop_file(const std::string &filename);
+
 		/// @brief Reads an object pool and generates a string version by hashing it
-		/// @details Credit for the hash algorithm here goes to "see" on stack overflow.
 		/// @param[in] iopData The object pool to hash and generate a version for
-		/// @returns A 7 character string that is probably somewhat unique for this pool
-		static std::string hash_object_pool_to_version(std::vector<std::uint8_t> &iopData);
+		/// @returns A 7 character string that is probably unique for this pool
+		static std::string hash_object_pool_to_version(const std::vector<std::uint8_t> &iopData);
+
+		/// @brief Generates a string version for an object pool in memory by hashing it
+		/// @param[in] iopData A pointer to the object pool to hash
+		/// @param[in] size The size of the object pool in bytes
+		/// @returns A 7 character string that is probably unique for this pool
+		static std::string hash_object_pool_to_version(const std::uint8_t *iopData, std::uint32_t size);
+
+		/// @brief Generates a string version for a memory mapped object pool by hashing it
+		/// @param[in] iopData The mapped object pool to hash
+		/// @returns A 7 character string that is probably unique for this pool
+		static std::string hash_object_pool_to_version(const MappedIOPFile &iopData);
+
+		/// @brief Generates a string version for an object pool by reading it in chunks and hashing it
+		/// @details The callback is called with increasing offsets and chunks of at most 4096 bytes,
+		/// so the callback given to the VT client for uploading the pool can usually be reused.
+		/// @param[in] poolTotalSize The size of the object pool in bytes
+		/// @param[in] callback The callback used to read the object pool
+		/// @param[in] parentPointer A generic context variable passed to the callback
+		/// @returns A 7 character string that is probably unique for this pool, or an empty string if the callback failed
+		static std::string hash_object_pool_to_version(std::uint32_t poolTotalSize, PoolDataChunkCallback callback, void *parentPointer);
+
+		/// @brief Converts a 64 bit hash into a 7 character version string
+		/// @param[in] hash The hash to convert, usually from an ObjectPoolHasher
+		/// @returns A 7 character alphanumeric string
+		static std::string hash_to_version(std::uint64_t hash);
+
+	private:
+		static constexpr std::uint32_t HASH_CHUNK_SIZE = 4096; ///< The size of chunks requested when hashing a pool through a callback
+		static constexpr std::uint8_t VERSION_LABEL_LENGTH = 7; ///< The number of characters in a generated version label
 	};
 }
 
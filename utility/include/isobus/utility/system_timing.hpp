@@ -6,28 +6,140 @@
 ///
 /// @copyright 2022 Adrian Del Grosso
 //================================================================================================
+#ifndef SYSTEM_TIMING_HPP
+#define SYSTEM_TIMING_HPP
 
 #include <cstdint>
 
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+#include <atomic>
+#endif
+
 namespace isobus
 {
+	//================================================================================================
+	/// @class SystemClock
+	///
+	/// @brief A base class for a source of monotonic time that can be injected into SystemTiming
+	/// @details By default the stack reads `std::chrono::steady_clock`. You can derive from this
+	/// class and pass your clock to SystemTiming::set_clock to drive the stack from another time
+	/// base, such as the timestamps of a log file being replayed.
+	//================================================================================================
+	class SystemClock
+	{
+	public:
+		/// @brief The destructor for a SystemClock
+		virtual ~SystemClock() = default;
+
+		/// @brief Returns the current time of this clock
+		/// @returns A monotonic timestamp in microseconds
+		virtual std::uint64_t get_time_us() const = 0;
+	};
+
+	//================================================================================================
+	/// @class ManualClock
+	///
+	/// @brief A clock that only advances when told to, for simulation and deterministic testing
+	//================================================================================================
+	class ManualClock : public SystemClock
+	{
+	public:
+		/// @brief Constructor for a ManualClock
+		/// @param[in] initialTime_us The time the clock starts at in microseconds
+		explicit ManualClock(std::uint64_t initialTime_us = 0);
+
+		/// @brief Returns the current time of this clock
+		/// @returns The current simulated time in microseconds
+		std::uint64_t get_time_us() const override;
+
+		/// @brief Sets the current time of this clock
+		/// @note Setting a time earlier than the current time will confuse any pending timeouts
+		/// @param[in] time_us The new time in microseconds
+		void set_time_us(std::uint64_t time_us);
+
+		/// @brief Moves the clock forward
+		/// @param[in] delta_us The number of microseconds to advance the clock by
+		void advance_us(std::uint64_t delta_us);
+
+		/// @brief Moves the clock forward
+		/// @param[in] delta_ms The number of milliseconds to advance the clock by
+		void advance_ms(std::uint32_t delta_ms);
+
+	private:
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		std::atomic<std::uint64_t> currentTime_us; ///< The current simulated time in microseconds
+#else
+		std::uint64_t currentTime_us; ///< The current simulated time in microseconds
+#endif
+	};
+
 	class SystemTiming
 	{
 	public:
+		//================================================================================================
+		/// @class Snapshot
+		///
+		/// @brief Freezes the timestamps returned to the calling thread for the lifetime of the object
+		/// @details Create one of these at the start of an update cycle so that every timeout checked
+		/// during that cycle uses the same "now", and only one clock read is done per cycle.
+		/// Snapshots can be nested, in which case only the outermost one reads the clock.
+		//================================================================================================
+		class Snapshot
+		{
+		public:
+			/// @brief Reads the clock and freezes it for the calling thread
+			Snapshot();
+
+			/// @brief Releases the frozen time for the calling thread
+			~Snapshot();
+
+			/// @brief Deleted copy constructor
+			Snapshot(const Snapshot &) = delete;
+
+			/// @brief Deleted assignment operator
+			/// @returns Nothing, this is deleted
+			Snapshot &operator=(const Snapshot &) = delete;
+		};
+
 		static std::uint32_t get_timestamp_ms();
 		static std::uint64_t get_timestamp_us();
 
+		/// @brief Reads the clock, ignoring any Snapshot held by the calling thread.
+		/// Useful for measuring how long something takes inside an update cycle.
+		/// @returns The current time in microseconds
+		static std::uint64_t get_uncached_timestamp_us();
+
 		static std::uint32_t get_time_elapsed_ms(std::uint32_t timestamp_ms);
 		static std::uint64_t get_time_elapsed_us(std::uint64_t timestamp_us);
 
 		static bool time_expired_ms(std::uint32_t timestamp_ms, std::uint32_t timeout_ms);
 		static bool time_expired_us(std::uint64_t timestamp_us, std::uint64_t timeout_us);
 
+		/// @brief Replaces the source of time used by the whole stack
+		/// @note The clock must outlive its use by the stack. Set it before starting the stack,
+		/// since timestamps taken from the previous clock will not be comparable to the new one.
+		/// @param[in] clock The clock to use, or nullptr to go back to the steady system clock
+		static void set_clock(SystemClock *clock);
+
+		/// @brief Returns the clock that was set with set_clock
+		/// @returns The active clock, or nullptr if the steady system clock is in use
+		static SystemClock *get_clock();
+
 	private:
-		static std::uint32_t incrementing_difference(std::uint32_t currentValue, std::uint32_t previousValue);
+		static std::uint64_t read_clock_us();
 		static std::uint64_t incrementing_difference(std::uint64_t currentValue, std::uint64_t previousValue);
-		static std::uint64_t s_timestamp_ms;
 		static std::uint64_t s_timestamp_us;
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+		static std::atomic<SystemClock *> s_clock;
+		static thread_local std::uint64_t s_snapshot_us;
+		static thread_local std::uint32_t s_snapshotDepth;
+#else
+		static SystemClock *s_clock;
+		static std::uint64_t s_snapshot_us;
+		static std::uint32_t s_snapshotDepth;
+#endif
 	};
 
 } // namespace isobus
+
+#endif // SYSTEM_TIMING_HPP
@@ -8,50 +8,473 @@
 //================================================================================================
 #include "isobus/utility/iop_file_interface.hpp"
 
+#include <cstdio>
+#include <cstring>
 #include <fstream>
-#include <iomanip>
-#include <iterator>
-#include <sstream>
+#include <limits>
+#include <utility>
+
+#if defined(_WIN32) && !defined ARDUINO
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif (defined(__unix__) || defined(__APPLE__)) && !defined ARDUINO
+#define IOP_FILE_INTERFACE_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace isobus
 {
+	namespace
+	{
+		constexpr std::uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+		constexpr std::uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+		constexpr std::uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+		constexpr std::uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+		constexpr std::uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+		inline std::uint64_t rotate_left(std::uint64_t value, std::uint32_t bits)
+		{
+			return (value << bits) | (value >> (64 - bits));
+		}
+
+		// Assembled byte by byte so the result doesn't depend on platform endianness or alignment.
+		// Compilers turn this into a single load on little endian targets.
+		inline std::uint64_t read_64(const std::uint8_t *data)
+		{
+			return static_cast<std::uint64_t>(data[0]) |
+			  (static_cast<std::uint64_t>(data[1]) << 8) |
+			  (static_cast<std::uint64_t>(data[2]) << 16) |
+			  (static_cast<std::uint64_t>(data[3]) << 24) |
+			  (static_cast<std::uint64_t>(data[4]) << 32) |
+			  (static_cast<std::uint64_t>(data[5]) << 40) |
+			  (static_cast<std::uint64_t>(data[6]) << 48) |
+			  (static_cast<std::uint64_t>(data[7]) << 56);
+		}
+
+		inline std::uint32_t read_32(const std::uint8_t *data)
+		{
+			return static_cast<std::uint32_t>(data[0]) |
+			  (static_cast<std::uint32_t>(data[1]) << 8) |
+			  (static_cast<std::uint32_t>(data[2]) << 16) |
+			  (static_cast<std::uint32_t>(data[3]) << 24);
+		}
+
+		inline std::uint64_t hash_round(std::uint64_t accumulator, std::uint64_t input)
+		{
+			accumulator += input * PRIME64_2;
+			accumulator = rotate_left(accumulator, 31);
+			return accumulator * PRIME64_1;
+		}
+
+		inline std::uint64_t merge_round(std::uint64_t hash, std::uint64_t accumulator)
+		{
+			hash ^= hash_round(0, accumulator);
+			return (hash * PRIME64_1) + PRIME64_4;
+		}
+	} // namespace
+
+	ObjectPoolHasher::ObjectPoolHasher(std::uint64_t seed)
+	{
+		reset(seed);
+	}
+
+	void ObjectPoolHasher::reset(std::uint64_t seed)
+	{
+		seedValue = seed;
+		accumulators[0] = seed + PRIME64_1 + PRIME64_2;
+		accumulators[1] = seed + PRIME64_2;
+		accumulators[2] = seed;
+		accumulators[3] = seed - PRIME64_1;
+		totalLength = 0;
+		bufferedLength = 0;
+	}
+
+	void ObjectPoolHasher::update(const std::uint8_t *data, std::size_t length)
+	{
+		if ((nullptr != data) && (0 != length))
+		{
+			totalLength += length;
+
+			// Top up a partial stripe left over from the last call
+			if (0 != bufferedLength)
+			{
+				std::size_t bytesToCopy = ((STRIPE_LENGTH - bufferedLength) < length) ? (STRIPE_LENGTH - bufferedLength) : length;
+				memcpy(&buffer[bufferedLength], data, bytesToCopy);
+				bufferedLength += bytesToCopy;
+				data += bytesToCopy;
+				length -= bytesToCopy;
+
+				if (STRIPE_LENGTH == bufferedLength)
+				{
+					process_stripe(buffer.data());
+					bufferedLength = 0;
+				}
+			}
+
+			while (length >= STRIPE_LENGTH)
+			{
+				process_stripe(data);
+				data += STRIPE_LENGTH;
+				length -= STRIPE_LENGTH;
+			}
+
+			if (0 != length)
+			{
+				memcpy(buffer.data(), data, length);
+				bufferedLength = length;
+			}
+		}
+	}
+
+	std::uint64_t ObjectPoolHasher::get_hash() const
+	{
+		std::uint64_t retVal;
+
+		if (totalLength >= STRIPE_LENGTH)
+		{
+			retVal = rotate_left(accumulators[0], 1) + rotate_left(accumulators[1], 7) + rotate_left(accumulators[2], 12) + rotate_left(accumulators[3], 18);
+
+			for (const auto &accumulator : accumulators)
+			{
+				retVal = merge_round(retVal, accumulator);
+			}
+		}
+		else
+		{
+			retVal = seedValue + PRIME64_5;
+		}
+		retVal += totalLength;
+
+		// Mix in the bytes that didn't fill a whole stripe
+		std::size_t index = 0;
+		for (; (index + 8) <= bufferedLength; index += 8)
+		{
+			retVal ^= hash_round(0, read_64(&buffer[index]));
+			retVal = (rotate_left(retVal, 27) * PRIME64_1) + PRIME64_4;
+		}
+
+		if ((index + 4) <= bufferedLength)
+		{
+			retVal ^= static_cast<std::uint64_t>(read_32(&buffer[index])) * PRIME64_1;
+			retVal = (rotate_left(retVal, 23) * PRIME64_2) + PRIME64_3;
+			index += 4;
+		}
+
+		for (; index < bufferedLength; index++)
+		{
+			retVal ^= static_cast<std::uint64_t>(buffer[index]) * PRIME64_5;
+			retVal = rotate_left(retVal, 11) * PRIME64_1;
+		}
+
+		// Final avalanche so every input bit affects every output bit
+		retVal ^= retVal >> 33;
+		retVal *= PRIME64_2;
+		retVal ^= retVal >> 29;
+		retVal *= PRIME64_3;
+		retVal ^= retVal >> 32;
+		return retVal;
+	}
+
+	std::uint64_t ObjectPoolHasher::hash(const std::uint8_t *data, std::size_t length, std::uint64_t seed)
+	{
+		ObjectPoolHasher hasher(seed);
+		hasher.update(data, length);
+		return hasher.get_hash();
+	}
+
+	void ObjectPoolHasher::process_stripe(const std::uint8_t *stripe)
+	{
+		accumulators[0] = hash_round(accumulators[0], read_64(&stripe[0]));
+		accumulators[1] = hash_round(accumulators[1], read_64(&stripe[8]));
+		accumulators[2] = hash_round(accumulators[2], read_64(&stripe[16]));
+		accumulators[3] = hash_round(accumulators[3], read_64(&stripe[24]));
+	}
+
+	MappedIOPFile::MappedIOPFile(const std::string &filename)
+	{
+#if defined(_WIN32) && !defined ARDUINO
+		HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (INVALID_HANDLE_VALUE != file)
+		{
+			LARGE_INTEGER fileSize;
+
+			if ((0 != GetFileSizeEx(file, &fileSize)) &&
+			    (fileSize.QuadPart > 0) &&
+			    (static_cast<std::uint64_t>(fileSize.QuadPart) <= std::numeric_limits<std::uint32_t>::max()))
+			{
+				HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+				if (nullptr != mapping)
+				{
+					const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+					if (nullptr != view)
+					{
+						mappedData = static_cast<const std::uint8_t *>(view);
+						mappedSize = static_cast<std::size_t>(fileSize.QuadPart);
+						mappingHandle = mapping;
+						fileHandle = file;
+						return;
+					}
+					CloseHandle(mapping);
+				}
+			}
+			CloseHandle(file);
+		}
+#elif defined IOP_FILE_INTERFACE_USE_MMAP
+		int file = open(filename.c_str(), O_RDONLY);
+
+		if (file >= 0)
+		{
+			struct stat fileStatus;
+
+			if ((0 == fstat(file, &fileStatus)) &&
+			    (fileStatus.st_size > 0) &&
+			    (static_cast<std::uint64_t>(fileStatus.st_size) <= std::numeric_limits<std::uint32_t>::max()))
+			{
+				void *view = mmap(nullptr, static_cast<std::size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+				if (MAP_FAILED != view)
+				{
+					// Pools are uploaded front to back, so let the OS read ahead
+					madvise(view, static_cast<std::size_t>(fileStatus.st_size), MADV_SEQUENTIAL);
+					mappedData = static_cast<const std::uint8_t *>(view);
+					mappedSize = static_cast<std::size_t>(fileStatus.st_size);
+				}
+			}
+			// The mapping stays valid after the descriptor is closed
+			::close(file);
+		}
+#else
+		fallbackData = IOPFileInterface::read_iop_file(filename);
+
+		if ((!fallbackData.empty()) &&
+		    (fallbackData.size() <= std::numeric_limits<std::uint32_t>::max()))
+		{
+			mappedData = fallbackData.data();
+			mappedSize = fallbackData.size();
+		}
+#endif
+	}
+
+	MappedIOPFile::~MappedIOPFile()
+	{
+		close();
+	}
+
+	MappedIOPFile::MappedIOPFile(MappedIOPFile &&other) noexcept
+	{
+		*this = std::move(other);
+	}
+
+	MappedIOPFile &MappedIOPFile::operator=(MappedIOPFile &&other) noexcept
+	{
+		if (this != &other)
+		{
+			close();
+			fallbackData = std::move(other.fallbackData);
+			mappedData = other.mappedData;
+			mappedSize = other.mappedSize;
+			fileHandle = other.fileHandle;
+			mappingHandle = other.mappingHandle;
+			other.mappedData = nullptr;
+			other.mappedSize = 0;
+			other.fileHandle = nullptr;
+			other.mappingHandle = nullptr;
+		}
+		return *this;
+	}
+
+	bool MappedIOPFile::get_is_valid() const
+	{
+		return (nullptr != mappedData);
+	}
+
+	const std::uint8_t *MappedIOPFile::get_data() const
+	{
+		return mappedData;
+	}
+
+	std::uint32_t MappedIOPFile::get_size() const
+	{
+		return static_cast<std::uint32_t>(mappedSize);
+	}
+
+	void MappedIOPFile::close()
+	{
+		if (nullptr != mappedData)
+		{
+#if defined(_WIN32) && !defined ARDUINO
+			UnmapViewOfFile(mappedData);
+			CloseHandle(static_cast<HANDLE>(mappingHandle));
+			CloseHandle(static_cast<HANDLE>(fileHandle));
+#elif defined IOP_FILE_INTERFACE_USE_MMAP
+			munmap(const_cast<std::uint8_t *>(mappedData), mappedSize);
+#endif
+		}
+		fallbackData.clear();
+		mappedData = nullptr;
+		mappedSize = 0;
+		fileHandle = nullptr;
+		mappingHandle = nullptr;
+	}
+
 	std::vector<std::uint8_t> IOPFileInterface::read_iop_file(const std::string &filename)
 	{
 		std::vector<std::uint8_t> retVal;
-		std::streampos fileSize;
-
 		std::ifstream file(filename, std::ios::binary);
 
 		if (file.is_open())
 		{
-			// Ignore newlines
-			file.unsetf(std::ios::skipws);
-
 			file.seekg(0, std::ios::end);
-			fileSize = file.tellg();
+			std::streamoff fileSize = file.tellg();
 			file.seekg(0, std::ios::beg);
 
-			retVal.reserve(fileSize);
+			if (fileSize > 0)
+			{
+				// Read in the data in one block rather than a byte at a time
+				retVal.resize(static_cast<std::size_t>(fileSize));
+				file.read(reinterpret_cast<char *>(retVal.data()), fileSize);
+				retVal.resize(static_cast<std::size_t>(file.gcount()));
+			}
+		}
+		return retVal;
+	}
+
+	bool IOPFileInterface::write_iop_file(const std::string &filename, const std::uint8_t *data, std::uint32_t size)
+	{
+		bool retVal = false;
+
+		if ((nullptr != data) && (0 != size))
+		{
+			const std::string temporaryFilename = filename + ".tmp";
+#ifdef IOP_FILE_INTERFACE_USE_MMAP
+			int file = ::open(temporaryFilename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+			if (-1 != file)
+			{
+				std::uint32_t bytesWritten = 0;
+
+				while (bytesWritten < size)
+				{
+					ssize_t result = ::write(file, data + bytesWritten, size - bytesWritten);
+
+					if (result <= 0)
+					{
+						break;
+					}
+					bytesWritten += static_cast<std::uint32_t>(result);
+				}
+
+				// The data must be on disk before the rename, or a crash could leave an empty file under the final name
+				const bool written = ((bytesWritten == size) && (0 == ::fsync(file)));
+
+				if ((0 == ::close(file)) && written)
+				{
+					// Replaces any existing file atomically
+					retVal = (0 == std::rename(temporaryFilename.c_str(), filename.c_str()));
+				}
 
-			// Read in the data
-			retVal.insert(retVal.begin(), std::istream_iterator<std::uint8_t>(file), std::istream_iterator<std::uint8_t>());
+				if (!retVal)
+				{
+					std::remove(temporaryFilename.c_str());
+				}
+			}
+#else
+			std::ofstream file(temporaryFilename, std::ios::binary | std::ios::trunc);
+
+			if (file.is_open())
+			{
+				file.write(reinterpret_cast<const char *>(data), size);
+				file.close();
+
+				if (!file.fail())
+				{
+					// Renaming over an existing file isn't allowed on Windows
+					std::remove(filename.c_str());
+					retVal = (0 == std::rename(temporaryFilename.c_str(), filename.c_str()));
+				}
+
+				if (!retVal)
+				{
+					std::remove(temporaryFilename.c_str());
+				}
+			}
+#endif
 		}
 		return retVal;
 	}
 
-	std::string IOPFileInterface::hash_object_pool_to_version(std::vector<std::uint8_t> &iopData)
+	MappedIOPFile IOPFileInterface::map_iop_file(const std::string &filename)
 	{
-		std::size_t seed = iopData.size();
-		std::stringstream stream;
+		return MappedIOPFile(filename);
+	}
 
-		for (auto x : iopData)
+	std::string IOPFileInterface::hash_object_pool_to_version(const std::vector<std::uint8_t> &iopData)
+	{
+		return hash_to_version(ObjectPoolHasher::hash(iopData.data(), iopData.size()));
+	}
+
+	std::string IOPFileInterface::hash_object_pool_to_version(const std::uint8_t *iopData, std::uint32_t size)
+	{
+		return hash_to_version(ObjectPoolHasher::hash(iopData, (nullptr != iopData) ? size : 0));
+	}
+
+	std::string IOPFileInterface::hash_object_pool_to_version(const MappedIOPFile &iopData)
+	{
+		return hash_to_version(ObjectPoolHasher::hash(iopData.get_data(), iopData.get_size()));
+	}
+
+	std::string IOPFileInterface::hash_object_pool_to_version(std::uint32_t poolTotalSize, PoolDataChunkCallback callback, void *parentPointer)
+	{
+		std::string retVal;
+
+		if (nullptr != callback)
 		{
-			x = ((x >> 16) ^ x) * 0x45d9f3b;
-			x = ((x >> 16) ^ x) * 0x45d9f3b;
-			x = (x >> 16) ^ x;
-			seed ^= x + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+			ObjectPoolHasher hasher;
+			std::array<std::uint8_t, HASH_CHUNK_SIZE> chunk;
+			std::uint32_t bytesOffset = 0;
+			std::uint32_t callbackIndex = 0;
+			bool success = true;
+
+			while (success && (bytesOffset < poolTotalSize))
+			{
+				std::uint32_t chunkSize = ((poolTotalSize - bytesOffset) < HASH_CHUNK_SIZE) ? (poolTotalSize - bytesOffset) : HASH_CHUNK_SIZE;
+
+				success = callback(callbackIndex, bytesOffset, chunkSize, chunk.data(), parentPointer);
+				hasher.update(chunk.data(), chunkSize);
+				bytesOffset += chunkSize;
+				callbackIndex++;
+			}
+
+			if (success)
+			{
+				retVal = hash_to_version(hasher.get_hash());
+			}
 		}
-		stream << std::hex << seed;
-		return stream.str();
+		return retVal;
+	}
+
+	std::string IOPFileInterface::hash_to_version(std::uint64_t hash)
+	{
+		constexpr char CHARACTERS[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+		constexpr std::uint64_t NUMBER_OF_CHARACTERS = sizeof(CHARACTERS) - 1;
+		std::string retVal(VERSION_LABEL_LENGTH, '0');
+
+		for (auto &character : retVal)
+		{
+			character = CHARACTERS[hash % NUMBER_OF_CHARACTERS];
+			hash /= NUMBER_OF_CHARACTERS;
+		}
+		return retVal;
 	}
 }
@@ -14,17 +14,69 @@
 
 namespace isobus
 {
-	std::uint64_t SystemTiming::s_timestamp_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	ManualClock::ManualClock(std::uint64_t initialTime_us) :
+	  currentTime_us(initialTime_us)
+	{
+	}
+
+	std::uint64_t ManualClock::get_time_us() const
+	{
+		return currentTime_us;
+	}
+
+	void ManualClock::set_time_us(std::uint64_t time_us)
+	{
+		currentTime_us = time_us;
+	}
+
+	void ManualClock::advance_us(std::uint64_t delta_us)
+	{
+		currentTime_us += delta_us;
+	}
+
+	void ManualClock::advance_ms(std::uint32_t delta_ms)
+	{
+		currentTime_us += (static_cast<std::uint64_t>(delta_ms) * 1000);
+	}
+
 	std::uint64_t SystemTiming::s_timestamp_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#if !defined CAN_STACK_DISABLE_THREADS && !defined ARDUINO
+	std::atomic<SystemClock *> SystemTiming::s_clock = { nullptr };
+	thread_local std::uint64_t SystemTiming::s_snapshot_us = 0;
+	thread_local std::uint32_t SystemTiming::s_snapshotDepth = 0;
+#else
+	SystemClock *SystemTiming::s_clock = nullptr;
+	std::uint64_t SystemTiming::s_snapshot_us = 0;
+	std::uint32_t SystemTiming::s_snapshotDepth = 0;
+#endif
+
+	SystemTiming::Snapshot::Snapshot()
+	{
+		if (0 == s_snapshotDepth)
+		{
+			s_snapshot_us = read_clock_us();
+		}
+		s_snapshotDepth++;
+	}
+
+	SystemTiming::Snapshot::~Snapshot()
+	{
+		s_snapshotDepth--;
+	}
 
 	std::uint32_t SystemTiming::get_timestamp_ms()
 	{
-		return incrementing_difference(static_cast<std::uint32_t>(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()) & std::numeric_limits<std::uint32_t>::max()), static_cast<std::uint32_t>(s_timestamp_ms));
+		return static_cast<std::uint32_t>((get_timestamp_us() / 1000) & std::numeric_limits<std::uint32_t>::max());
 	}
 
 	std::uint64_t SystemTiming::get_timestamp_us()
 	{
-		return incrementing_difference(static_cast<std::uint64_t>(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()) & std::numeric_limits<std::uint64_t>::max()), s_timestamp_us);
+		return (0 != s_snapshotDepth) ? s_snapshot_us : read_clock_us();
+	}
+
+	std::uint64_t SystemTiming::get_uncached_timestamp_us()
+	{
+		return read_clock_us();
 	}
 
 	std::uint32_t SystemTiming::get_time_elapsed_ms(std::uint32_t timestamp_ms)
@@ -47,17 +99,28 @@ namespace isobus
 		return (get_time_elapsed_us(timestamp_us) >= timeout_us);
 	}
 
-	std::uint32_t SystemTiming::incrementing_difference(std::uint32_t currentValue, std::uint32_t previousValue)
+	void SystemTiming::set_clock(SystemClock *clock)
 	{
-		std::uint32_t retVal;
+		s_clock = clock;
+	}
 
-		if (currentValue >= previousValue)
+	SystemClock *SystemTiming::get_clock()
+	{
+		return s_clock;
+	}
+
+	std::uint64_t SystemTiming::read_clock_us()
+	{
+		const SystemClock *clock = s_clock;
+		std::uint64_t retVal;
+
+		if (nullptr != clock)
 		{
-			retVal = currentValue - previousValue;
+			retVal = clock->get_time_us();
 		}
 		else
 		{
-			retVal = (std::numeric_limits<std::uint32_t>::max() - previousValue) + currentValue + 1;
+			retVal = incrementing_difference(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()), s_timestamp_us);
 		}
 		return retVal;
 	}